@@ -135,6 +135,8 @@ arrayops::clamp(eT* mem, const uword n_elem, const eT min_val, const eT max_val,
   {
   arma_ignore(junk);
   
+  if(eop_simd::clamp(mem, mem, n_elem, min_val, max_val))  { return; }
+  
   for(uword i=0; i<n_elem; ++i)
     {
     eT& val = mem[i];
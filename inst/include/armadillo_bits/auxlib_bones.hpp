@@ -173,6 +173,12 @@ struct auxlib
   template<typename T>
   inline static bool eig_sym_dc(Col<T>& eigval, Mat< std::complex<T> >& eigvec, const Mat< std::complex<T> >& X);
   
+  template<typename eT>
+  inline static bool eig_sym_range(Col<eT>& eigval, Mat<eT>& eigvec, const Mat<eT>& X, const eig_range& range, const bool calc_vec);
+  
+  template<typename T>
+  inline static bool eig_sym_range(Col<T>& eigval, Mat< std::complex<T> >& eigvec, const Mat< std::complex<T> >& X, const eig_range& range, const bool calc_vec);
+  
   
   //
   // chol
@@ -189,6 +195,9 @@ struct auxlib
   template<typename eT>
   inline static bool chol_pivot(Mat<eT>& X, Mat<uword>& P, const uword layout);
   
+  template<typename eT>
+  inline static bool chol_update(Mat<eT>& X, const Mat<eT>& V, const bool downdate, const uword layout);
+  
   
   //
   // hessenberg decomposition
@@ -212,6 +221,21 @@ struct auxlib
   template<typename  T, typename T1>
   inline static bool qr_pivot(Mat< std::complex<T> >& Q, Mat< std::complex<T> >& R, Mat<uword>& P, const Base<std::complex<T>,T1>& X);
   
+  template<typename eT>
+  inline static void givens(typename get_pod_type<eT>::result& c, eT& s, eT& r, const eT a, const eT b);
+  
+  template<typename eT>
+  inline static void givens_apply(Mat<eT>& Q, Mat<eT>& R, const uword p, const uword q, const uword R_col_start, const typename get_pod_type<eT>::result c, const eT s);
+  
+  template<typename eT>
+  inline static void qr_insert_col(Mat<eT>& Q, Mat<eT>& R, const uword col, const Col<eT>& x, const bool econ);
+  
+  template<typename eT>
+  inline static void qr_delete_col(Mat<eT>& Q, Mat<eT>& R, const uword col, const bool econ);
+  
+  template<typename eT>
+  inline static void qr_insert_row(Mat<eT>& Q, Mat<eT>& R, const uword row, const Col<eT>& x, const bool econ);
+  
   
   //
   // svd
@@ -255,6 +279,12 @@ struct auxlib
   template<typename T>
   inline static bool svd_dc_econ(Mat< std::complex<T> >& U, Col<T>& S, Mat< std::complex<T> >& V, Mat< std::complex<T> >& A);
   
+  template<typename eT>
+  inline static bool svd_subset(Mat<eT>& U, Col<eT>& S, Mat<eT>& V, Mat<eT>& A, const svd_range& range, const bool calc_UV);
+  
+  template<typename T>
+  inline static bool svd_subset(Mat< std::complex<T> >& U, Col<T>& S, Mat< std::complex<T> >& V, Mat< std::complex<T> >& A, const svd_range& range, const bool calc_UV);
+  
   
   //
   // solve
@@ -304,6 +334,11 @@ struct auxlib
   
   //
   
+  template<typename T1>
+  inline static bool solve_square_mixed(Mat<typename T1::elem_type>& out, uword& out_n_iter, const Mat<typename T1::elem_type>& A, const Base<typename T1::elem_type,T1>& B_expr, const bool try_sympd);
+  
+  //
+  
   template<typename T1>
   inline static bool solve_rect_fast(Mat<typename T1::elem_type>& out, Mat<typename T1::elem_type>& A, const Base<typename T1::elem_type,T1>& B_expr);
   
@@ -2261,11 +2261,6 @@ auxlib::eig_sym(Col<eT>& eigval, Mat<eT>& A)
     
     if(A.is_empty())  { eigval.reset(); return true; }
     
-    if((arma_config::check_conform) && (auxlib::rudimentary_sym_check(A) == false))
-      {
-      arma_warn(1, "eig_sym(): given matrix is not symmetric");
-      }
-    
     if(arma_config::check_nonfinite && trimat_helper::has_nonfinite_triu(A))  { return false; }
     
     arma_conform_assert_blas_size(A);
@@ -2314,11 +2309,6 @@ auxlib::eig_sym(Col<T>& eigval, Mat< std::complex<T> >& A)
     
     if(A.is_empty())  { eigval.reset(); return true; }
     
-    if((arma_config::check_conform) && (auxlib::rudimentary_sym_check(A) == false))
-      {
-      arma_warn(1, "eig_sym(): given matrix is not hermitian");
-      }
-    
     if(arma_config::check_nonfinite && trimat_helper::has_nonfinite_triu(A))  { return false; }
     
     arma_conform_assert_blas_size(A);
@@ -2610,6 +2600,255 @@ auxlib::eig_sym_dc(Col<T>& eigval, Mat< std::complex<T> >& eigvec, const Mat< st
 
 
 
+//! subset of eigenvalues and optionally eigenvectors of a symmetric real matrix, selected by index or value range;
+//! the relatively robust representations algorithm is used, with a fallback to bisection and inverse iteration;
+//! only the selected eigenvectors are computed and back-transformed
+template<typename eT>
+inline
+bool
+auxlib::eig_sym_range(Col<eT>& eigval, Mat<eT>& eigvec, const Mat<eT>& X, const eig_range& range, const bool calc_vec)
+  {
+  arma_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    arma_conform_check( (X.is_square() == false), "eig_sym(): given matrix must be square sized" );
+    
+    const uword n = X.n_rows;
+    
+    if(range.type == eig_range::RANGE_INDEX)
+      {
+      arma_conform_check( ((range.first > range.last) || (uword(range.last) >= n)), "eig_sym(): index range is out of bounds" );
+      }
+    
+    if(range.type == eig_range::RANGE_VALUE)
+      {
+      arma_conform_check( (range.lo >= range.hi), "eig_sym(): lower bound of value range must be less than upper bound" );
+      }
+    
+    if(arma_config::check_nonfinite && trimat_helper::has_nonfinite_triu(X))  { return false; }
+    
+    if(n == 0)  { eigval.reset(); eigvec.reset(); return true; }
+    
+    Mat<eT> A(X);
+    
+    arma_conform_assert_blas_size(A);
+    
+    char jobz    = (calc_vec) ? 'V' : 'N';
+    char range_c = (range.type == eig_range::RANGE_INDEX) ? 'I' : ( (range.type == eig_range::RANGE_VALUE) ? 'V' : 'A' );
+    char uplo    = 'U';
+    
+    blas_int N      = blas_int(n);
+    eT       vl     = eT(range.lo);
+    eT       vu     = eT(range.hi);
+    blas_int il     = (range_c == 'I') ? blas_int(range.first + 1) : blas_int(1);
+    blas_int iu     = (range_c == 'I') ? blas_int(range.last  + 1) : N;
+    eT       abstol = eT(2) * std::numeric_limits<eT>::min();  // safe minimum, for the most accurate eigenvalues
+    blas_int m      = 0;
+    blas_int info   = 0;
+    
+    // the number of eigenvalues within a value range is not known in advance
+    const uword max_m = uword(iu - il + 1);
+    
+    Col<eT> w(n, arma_nozeros_indicator());
+    
+    Mat<eT> Z( (calc_vec ? n : uword(1)), (calc_vec ? max_m : uword(1)), arma_nozeros_indicator() );
+    
+    blas_int ldz = blas_int(Z.n_rows);
+    
+    podarray<blas_int> isuppz(2*max_m);
+    
+    blas_int  lwork_min = 26*N;
+    blas_int liwork_min = 10*N;
+    
+    eT        work_query[2] = {};
+    blas_int iwork_query[2] = {};
+    
+    blas_int  lwork_query = -1;
+    blas_int liwork_query = -1;
+    
+    arma_debug_print("lapack::syevr()");
+    lapack::syevr(&jobz, &range_c, &uplo, &N, A.memptr(), &N, &vl, &vu, &il, &iu, &abstol, &m, w.memptr(), Z.memptr(), &ldz, isuppz.memptr(), &work_query[0], &lwork_query, &iwork_query[0], &liwork_query, &info);
+    
+    if(info != 0)  { return false; }
+    
+    blas_int  lwork_final = (std::max)( lwork_min, static_cast<blas_int>(work_query[0]) );
+    blas_int liwork_final = (std::max)(liwork_min, iwork_query[0]);
+    
+    podarray<eT>        work( static_cast<uword>( lwork_final) );
+    podarray<blas_int> iwork( static_cast<uword>(liwork_final) );
+    
+    arma_debug_print("lapack::syevr()");
+    lapack::syevr(&jobz, &range_c, &uplo, &N, A.memptr(), &N, &vl, &vu, &il, &iu, &abstol, &m, w.memptr(), Z.memptr(), &ldz, isuppz.memptr(), work.memptr(), &lwork_final, iwork.memptr(), &liwork_final, &info);
+    
+    if(info > 0)
+      {
+      // internal error in the relatively robust representations algorithm
+      
+      A = X;
+      
+      podarray<blas_int> ifail(n);
+      
+      lwork_final = (std::max)(lwork_final, blas_int(8*N));
+      
+      work.set_min_size( static_cast<uword>(lwork_final) );
+     iwork.set_min_size(5*n);
+      
+      arma_debug_print("lapack::syevx()");
+      lapack::syevx(&jobz, &range_c, &uplo, &N, A.memptr(), &N, &vl, &vu, &il, &iu, &abstol, &m, w.memptr(), Z.memptr(), &ldz, work.memptr(), &lwork_final, iwork.memptr(), ifail.memptr(), &info);
+      }
+    
+    if(info != 0)  { return false; }
+    
+    eigval = w.head( uword(m) );
+    
+    if(calc_vec)
+      {
+      if(uword(m) == Z.n_cols)  { eigvec.steal_mem(Z); }  else  { eigvec = Z.head_cols( uword(m) ); }
+      }
+    
+    return true;
+    }
+  #else
+    {
+    arma_ignore(eigval);
+    arma_ignore(eigvec);
+    arma_ignore(X);
+    arma_ignore(range);
+    arma_ignore(calc_vec);
+    arma_stop_logic_error("eig_sym(): use of LAPACK must be enabled");
+    return false;
+    }
+  #endif
+  }
+
+
+
+//! subset of eigenvalues and optionally eigenvectors of a hermitian complex matrix, selected by index or value range
+template<typename T>
+inline
+bool
+auxlib::eig_sym_range(Col<T>& eigval, Mat< std::complex<T> >& eigvec, const Mat< std::complex<T> >& X, const eig_range& range, const bool calc_vec)
+  {
+  arma_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    typedef typename std::complex<T> eT;
+    
+    arma_conform_check( (X.is_square() == false), "eig_sym(): given matrix must be square sized" );
+    
+    const uword n = X.n_rows;
+    
+    if(range.type == eig_range::RANGE_INDEX)
+      {
+      arma_conform_check( ((range.first > range.last) || (uword(range.last) >= n)), "eig_sym(): index range is out of bounds" );
+      }
+    
+    if(range.type == eig_range::RANGE_VALUE)
+      {
+      arma_conform_check( (range.lo >= range.hi), "eig_sym(): lower bound of value range must be less than upper bound" );
+      }
+    
+    if(arma_config::check_nonfinite && trimat_helper::has_nonfinite_triu(X))  { return false; }
+    
+    if(n == 0)  { eigval.reset(); eigvec.reset(); return true; }
+    
+    Mat<eT> A(X);
+    
+    arma_conform_assert_blas_size(A);
+    
+    char jobz    = (calc_vec) ? 'V' : 'N';
+    char range_c = (range.type == eig_range::RANGE_INDEX) ? 'I' : ( (range.type == eig_range::RANGE_VALUE) ? 'V' : 'A' );
+    char uplo    = 'U';
+    
+    blas_int N      = blas_int(n);
+    T        vl     = T(range.lo);
+    T        vu     = T(range.hi);
+    blas_int il     = (range_c == 'I') ? blas_int(range.first + 1) : blas_int(1);
+    blas_int iu     = (range_c == 'I') ? blas_int(range.last  + 1) : N;
+    T        abstol = T(2) * std::numeric_limits<T>::min();
+    blas_int m      = 0;
+    blas_int info   = 0;
+    
+    const uword max_m = uword(iu - il + 1);
+    
+    Col<T> w(n, arma_nozeros_indicator());
+    
+    Mat<eT> Z( (calc_vec ? n : uword(1)), (calc_vec ? max_m : uword(1)), arma_nozeros_indicator() );
+    
+    blas_int ldz = blas_int(Z.n_rows);
+    
+    podarray<blas_int> isuppz(2*max_m);
+    
+    blas_int  lwork_min =  2*N;
+    blas_int lrwork_min = 24*N;
+    blas_int liwork_min = 10*N;
+    
+    eT        work_query[2] = {};
+    T        rwork_query[2] = {};
+    blas_int iwork_query[2] = {};
+    
+    blas_int  lwork_query = -1;
+    blas_int lrwork_query = -1;
+    blas_int liwork_query = -1;
+    
+    arma_debug_print("lapack::heevr()");
+    lapack::heevr(&jobz, &range_c, &uplo, &N, A.memptr(), &N, &vl, &vu, &il, &iu, &abstol, &m, w.memptr(), Z.memptr(), &ldz, isuppz.memptr(), &work_query[0], &lwork_query, &rwork_query[0], &lrwork_query, &iwork_query[0], &liwork_query, &info);
+    
+    if(info != 0)  { return false; }
+    
+    blas_int  lwork_final = (std::max)( lwork_min, static_cast<blas_int>( access::tmp_real(work_query[0]) ) );
+    blas_int lrwork_final = (std::max)(lrwork_min, static_cast<blas_int>( rwork_query[0] ) );
+    blas_int liwork_final = (std::max)(liwork_min, iwork_query[0]);
+    
+    podarray<eT>        work( static_cast<uword>( lwork_final) );
+    podarray< T>       rwork( static_cast<uword>(lrwork_final) );
+    podarray<blas_int> iwork( static_cast<uword>(liwork_final) );
+    
+    arma_debug_print("lapack::heevr()");
+    lapack::heevr(&jobz, &range_c, &uplo, &N, A.memptr(), &N, &vl, &vu, &il, &iu, &abstol, &m, w.memptr(), Z.memptr(), &ldz, isuppz.memptr(), work.memptr(), &lwork_final, rwork.memptr(), &lrwork_final, iwork.memptr(), &liwork_final, &info);
+    
+    if(info > 0)
+      {
+      // internal error in the relatively robust representations algorithm
+      
+      A = X;
+      
+      podarray<blas_int> ifail(n);
+      
+      // rwork and iwork are already larger than the 7*N and 5*N required by heevx()
+      
+      arma_debug_print("lapack::heevx()");
+      lapack::heevx(&jobz, &range_c, &uplo, &N, A.memptr(), &N, &vl, &vu, &il, &iu, &abstol, &m, w.memptr(), Z.memptr(), &ldz, work.memptr(), &lwork_final, rwork.memptr(), iwork.memptr(), ifail.memptr(), &info);
+      }
+    
+    if(info != 0)  { return false; }
+    
+    eigval = w.head( uword(m) );
+    
+    if(calc_vec)
+      {
+      if(uword(m) == Z.n_cols)  { eigvec.steal_mem(Z); }  else  { eigvec = Z.head_cols( uword(m) ); }
+      }
+    
+    return true;
+    }
+  #else
+    {
+    arma_ignore(eigval);
+    arma_ignore(eigvec);
+    arma_ignore(X);
+    arma_ignore(range);
+    arma_ignore(calc_vec);
+    arma_stop_logic_error("eig_sym(): use of LAPACK must be enabled");
+    return false;
+    }
+  #endif
+  }
+
+
+
 template<typename eT>
 inline
 bool
@@ -2781,6 +3020,91 @@ auxlib::chol_pivot(Mat<eT>& X, Mat<uword>& P, const uword layout)
 
 
 
+//! rank-k update (X'*X + V*V') or downdate (X'*X - V*V') of the Cholesky factor X, via a sweep of plane rotations for each column of V;
+//! downdates use hyperbolic rotations, and fail if the result is not positive definite, in which case X is unchanged
+template<typename eT>
+inline
+bool
+auxlib::chol_update(Mat<eT>& X, const Mat<eT>& V, const bool downdate, const uword layout)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  // the sweeps are done on the columns of the lower triangular factor L = R', as these are contiguous in memory
+  
+  Mat<eT> tmp;
+  
+  if(layout == 0)  { tmp = X.t(); }  else  { tmp = X; }
+  
+  Mat<eT>& L = tmp;
+  
+  const uword N = L.n_rows;
+  
+  podarray<eT> x(N);
+  
+  for(uword j=0; j < V.n_cols; ++j)
+    {
+    arrayops::copy(x.memptr(), V.colptr(j), N);
+    
+    for(uword k=0; k < N; ++k)
+      {
+      eT* L_colmem = L.colptr(k);
+      
+      const T  a     = access::tmp_real(L_colmem[k]);
+      const eT b     = x[k];
+      const T  abs_b = std::abs(b);
+      
+      if(downdate == false)
+        {
+        // unitary rotation of [L(:,k), x] that zeros x(k)
+        
+        const T  r = arma_hypot(a, abs_b);
+        const T  c = a / r;
+        const eT s = b / r;
+        
+        L_colmem[k] = eT(r);
+        
+        for(uword i=k+1; i < N; ++i)
+          {
+          const eT l_i = L_colmem[i];
+          
+          L_colmem[i] = c * l_i + access::alt_conj(s) * x[i];
+          x[i]        = c * x[i] - s * l_i;
+          }
+        }
+      else
+        {
+        // hyperbolic rotation of [L(:,k), x] that zeros x(k)
+        
+        const T r2 = (a - abs_b) * (a + abs_b);
+        
+        if( (r2 <= T(0)) || arma_isnan(r2) )  { return false; }
+        
+        const T  r = std::sqrt(r2);
+        const T  c = r / a;
+        const eT s = b / a;
+        
+        L_colmem[k] = eT(r);
+        
+        for(uword i=k+1; i < N; ++i)
+          {
+          const eT l_i = L_colmem[i];
+          
+          L_colmem[i] = (l_i  - access::alt_conj(s) * x[i]) / c;
+          x[i]        = (x[i] - s * l_i                   ) / c;
+          }
+        }
+      }
+    }
+  
+  if(layout == 0)  { X = L.t(); }  else  { X.steal_mem(L); }
+  
+  return true;
+  }
+
+
+
 //
 // hessenberg decomposition
 template<typename eT, typename T1>
@@ -3181,21 +3505,254 @@ auxlib::qr_pivot(Mat< std::complex<T> >& Q, Mat< std::complex<T> >& R, Mat<uword
       P.at(col) = jpvt[col] - 1;  // take into account that Fortran counts from 1
       }
     
-    arma_debug_print("lapack::ungqr()");
-    lapack::ungqr(&m, &m, &k, Q.memptr(), &m, tau.memptr(), work.memptr(), &lwork_final, &info);
+    arma_debug_print("lapack::ungqr()");
+    lapack::ungqr(&m, &m, &k, Q.memptr(), &m, tau.memptr(), work.memptr(), &lwork_final, &info);
+    
+    return (info == 0);
+    }
+  #else
+    {
+    arma_ignore(Q);
+    arma_ignore(R);
+    arma_ignore(P);
+    arma_ignore(X);
+    arma_stop_logic_error("qr(): use of LAPACK must be enabled");
+    return false;
+    }
+  #endif
+  }
+
+
+
+//! plane rotation G = [c s; -conj(s) c], with real c, such that G*[a; b] = [r; 0]
+template<typename eT>
+inline
+void
+auxlib::givens(typename get_pod_type<eT>::result& c, eT& s, eT& r, const eT a, const eT b)
+  {
+  typedef typename get_pod_type<eT>::result T;
+  
+  const T abs_a = std::abs(a);
+  const T abs_b = std::abs(b);
+  
+  if(abs_b == T(0))  { c = T(1); s = eT(0); r = a; return; }
+  
+  if(abs_a == T(0))  { c = T(0); s = access::alt_conj(b) / abs_b; r = eT(abs_b); return; }
+  
+  const T  nrm   = arma_hypot(abs_a, abs_b);
+  const eT alpha = a / abs_a;
+  
+  c = abs_a / nrm;
+  s = alpha * access::alt_conj(b) / nrm;
+  r = alpha * nrm;
+  }
+
+
+
+//! R = G*R on rows p and q of R, starting at column R_col_start, and Q = Q*G' on columns p and q of Q, so that Q*R is unchanged
+template<typename eT>
+inline
+void
+auxlib::givens_apply(Mat<eT>& Q, Mat<eT>& R, const uword p, const uword q, const uword R_col_start, const typename get_pod_type<eT>::result c, const eT s)
+  {
+  const eT s_conj = access::alt_conj(s);
+  
+  const uword R_n_cols = R.n_cols;
+  
+  for(uword col=R_col_start; col < R_n_cols; ++col)
+    {
+    eT& R_p = R.at(p,col);
+    eT& R_q = R.at(q,col);
+    
+    const eT x = R_p;
+    const eT y = R_q;
+    
+    R_p = c * x + s      * y;
+    R_q = c * y - s_conj * x;
+    }
+  
+  eT* Q_p = Q.colptr(p);
+  eT* Q_q = Q.colptr(q);
+  
+  const uword Q_n_rows = Q.n_rows;
+  
+  for(uword i=0; i < Q_n_rows; ++i)
+    {
+    const eT x = Q_p[i];
+    const eT y = Q_q[i];
+    
+    Q_p[i] = c * x + s_conj * y;
+    Q_q[i] = c * y - s      * x;
+    }
+  }
+
+
+
+//! Q*R = X  ->  Q*R = [X(:,0:col-1), x, X(:,col:end)];
+//! for the economical form, Q is extended by the normalised component of x orthogonal to the range of Q
+template<typename eT>
+inline
+void
+auxlib::qr_insert_col(Mat<eT>& Q, Mat<eT>& R, const uword col, const Col<eT>& x, const bool econ)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const uword m = Q.n_rows;
+  const uword k = Q.n_cols;
+  
+  Col<eT> w = Q.t() * x;
+  
+  if(econ && (k < m))
+    {
+    // classical Gram-Schmidt with one step of reorthogonalisation keeps Q orthonormal to working precision
+    
+    Col<eT> res = x - Q*w;
+    
+    const Col<eT> w2 = Q.t() * res;
+    
+    res -= Q*w2;
+    w   += w2;
+    
+    const T rho = norm(res, 2);
+    
+    // if x is in the range of Q, res is rounding noise and must not be added to Q
+    
+    const T rho_tol = T(m) * std::numeric_limits<T>::epsilon() * norm(x, 2);
+    
+    if(rho > rho_tol)
+      {
+      res /= rho;
+      
+      Q.insert_cols(k, res);
+      R.insert_rows(k, 1);
+      
+      w.resize(k+1);
+      
+      w[k] = eT(rho);
+      }
+    }
+  
+  R.insert_cols(col, w);
+  
+  // zero the new column below the diagonal, from the bottom up;
+  // each rotation of rows i-1 and i introduces a single nonzero at R(i,i), which is on the diagonal
+  
+  T  c;
+  eT s;
+  eT r;
+  
+  for(uword i = R.n_rows; i-- > (col+1); )
+    {
+    auxlib::givens(c, s, r, R.at(i-1,col), R.at(i,col));
+    
+    R.at(i-1,col) = r;
+    R.at(i,  col) = eT(0);
+    
+    auxlib::givens_apply(Q, R, i-1, i, col+1, c, s);
+    }
+  }
+
+
+
+//! Q*R = X  ->  Q*R = X with column col removed;
+//! for the economical form, the last column of Q and the last row of R are removed when they are no longer needed
+template<typename eT>
+inline
+void
+auxlib::qr_delete_col(Mat<eT>& Q, Mat<eT>& R, const uword col, const bool econ)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  R.shed_col(col);
+  
+  const uword k = R.n_rows;
+  const uword n = R.n_cols;
+  
+  // R is now upper Hessenberg from column col onwards
+  
+  const uword n_rot = (k > 0) ? (std::min)(n, k-1) : uword(0);
+  
+  T  c;
+  eT s;
+  eT r;
+  
+  for(uword i=col; i < n_rot; ++i)
+    {
+    auxlib::givens(c, s, r, R.at(i,i), R.at(i+1,i));
+    
+    R.at(i,  i) = r;
+    R.at(i+1,i) = eT(0);
+    
+    auxlib::givens_apply(Q, R, i, i+1, i+1, c, s);
+    }
+  
+  if(econ && (k > n))
+    {
+    Q.shed_col(k-1);
+    R.shed_row(k-1);
+    }
+  }
+
+
+
+//! Q*R = X  ->  Q*R = [X(0:row-1,:); x'; X(row:end,:)], with x' denoting the simple transpose of x;
+//! for the economical form, the last column of Q and the last row of R are removed when they are no longer needed
+template<typename eT>
+inline
+void
+auxlib::qr_insert_row(Mat<eT>& Q, Mat<eT>& R, const uword row, const Col<eT>& x, const bool econ)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const uword m = Q.n_rows;
+  const uword k = Q.n_cols;
+  
+  // [X(0:row-1,:); x'; X(row:end,:)] = P * [1 0; 0 Q] * [x'; R], with P moving the first row to position 'row'
+  
+  Mat<eT> Q_new(m+1, k+1, arma_zeros_indicator());
+  
+  Q_new.at(row,0) = eT(1);
+  
+  if((row > 0) && (k > 0))  { Q_new.submat(0,     1, row-1, k) = Q.rows(0,   row-1); }
+  if((row < m) && (k > 0))  { Q_new.submat(row+1, 1, m,     k) = Q.rows(row, m-1  ); }
+  
+  Q.steal_mem(Q_new);
+  
+  R.insert_rows(0, 1);
+  
+  R.row(0) = x.st();
+  
+  const uword n = R.n_cols;
+  
+  // R is now upper Hessenberg
+  
+  const uword n_rot = (std::min)(n, k);
+  
+  T  c;
+  eT s;
+  eT r;
+  
+  for(uword i=0; i < n_rot; ++i)
+    {
+    auxlib::givens(c, s, r, R.at(i,i), R.at(i+1,i));
+    
+    R.at(i,  i) = r;
+    R.at(i+1,i) = eT(0);
     
-    return (info == 0);
+    auxlib::givens_apply(Q, R, i, i+1, i+1, c, s);
     }
-  #else
+  
+  if(econ && (k+1 > n))
     {
-    arma_ignore(Q);
-    arma_ignore(R);
-    arma_ignore(P);
-    arma_ignore(X);
-    arma_stop_logic_error("qr(): use of LAPACK must be enabled");
-    return false;
+    Q.shed_col(k);
+    R.shed_row(k);
     }
-  #endif
   }
 
 
@@ -4186,6 +4743,223 @@ auxlib::svd_dc_econ(Mat< std::complex<T> >& U, Col<T>& S, Mat< std::complex<T> >
 
 
 
+//! subset of singular values and optionally singular vectors, selected by index or value range;
+//! for tall matrices LAPACK first reduces A to triangular form via QR decomposition,
+//! and only the selected singular vectors are computed
+template<typename eT>
+inline
+bool
+auxlib::svd_subset(Mat<eT>& U, Col<eT>& S, Mat<eT>& V, Mat<eT>& A, const svd_range& range, const bool calc_UV)
+  {
+  arma_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    const uword min_mn_u = (std::min)(A.n_rows, A.n_cols);
+    
+    if(range.type == svd_range::RANGE_INDEX)
+      {
+      arma_conform_check( ((range.first > range.last) || (uword(range.last) >= min_mn_u)), "svd(): index range is out of bounds" );
+      }
+    
+    if(range.type == svd_range::RANGE_VALUE)
+      {
+      arma_conform_check( ((range.lo < double(0)) || (range.lo >= range.hi)), "svd(): value range must satisfy 0 <= lo < hi" );
+      }
+    
+    if(min_mn_u == 0)
+      {
+      S.reset();
+      
+      if(calc_UV)  { U.set_size(A.n_rows, 0); V.set_size(A.n_cols, 0); }
+      
+      return true;
+      }
+    
+    if(arma_config::check_nonfinite && A.internal_has_nonfinite())  { return false; }
+    
+    arma_conform_assert_blas_size(A);
+    
+    char jobu    = (calc_UV) ? 'V' : 'N';
+    char jobvt   = (calc_UV) ? 'V' : 'N';
+    char range_c = (range.type == svd_range::RANGE_INDEX) ? 'I' : ( (range.type == svd_range::RANGE_VALUE) ? 'V' : 'A' );
+    
+    blas_int m      = blas_int(A.n_rows);
+    blas_int n      = blas_int(A.n_cols);
+    blas_int min_mn = (std::min)(m,n);
+    blas_int lda    = blas_int(A.n_rows);
+    eT       vl     = eT(range.lo);
+    eT       vu     = eT(range.hi);
+    blas_int il     = (range_c == 'I') ? blas_int(range.first + 1) : blas_int(1);
+    blas_int iu     = (range_c == 'I') ? blas_int(range.last  + 1) : min_mn;
+    blas_int ns     = 0;
+    blas_int info   = 0;
+    
+    // the number of singular values within a value range is not known in advance
+    const uword max_ns = uword(iu - il + 1);
+    
+    Col<eT> s( static_cast<uword>(min_mn), arma_nozeros_indicator() );
+    
+    Mat<eT> UU( (calc_UV ? A.n_rows : uword(1)), (calc_UV ? max_ns : uword(1)), arma_nozeros_indicator() );
+    Mat<eT> VT( (calc_UV ? max_ns : uword(1)), (calc_UV ? A.n_cols : uword(1)), arma_nozeros_indicator() );
+    
+    blas_int ldu  = blas_int(UU.n_rows);
+    blas_int ldvt = blas_int(VT.n_rows);
+    
+    podarray<blas_int> iwork( uword(12*min_mn) );
+    
+    eT       work_query[2] = {};
+    blas_int lwork_query   = -1;
+    
+    arma_debug_print("lapack::gesvdx()");
+    lapack::gesvdx<eT>(&jobu, &jobvt, &range_c, &m, &n, A.memptr(), &lda, &vl, &vu, &il, &iu, &ns, s.memptr(), UU.memptr(), &ldu, VT.memptr(), &ldvt, &work_query[0], &lwork_query, iwork.memptr(), &info);
+    
+    if(info != 0)  { return false; }
+    
+    blas_int lwork_final = (std::max)( blas_int(1), static_cast<blas_int>(work_query[0]) );
+    
+    podarray<eT> work( static_cast<uword>(lwork_final) );
+    
+    arma_debug_print("lapack::gesvdx()");
+    lapack::gesvdx<eT>(&jobu, &jobvt, &range_c, &m, &n, A.memptr(), &lda, &vl, &vu, &il, &iu, &ns, s.memptr(), UU.memptr(), &ldu, VT.memptr(), &ldvt, work.memptr(), &lwork_final, iwork.memptr(), &info);
+    
+    if(info != 0)  { return false; }
+    
+    S = s.head( uword(ns) );
+    
+    if(calc_UV)
+      {
+      if(uword(ns) == UU.n_cols)  { U.steal_mem(UU); }  else  { U = UU.head_cols( uword(ns) ); }
+      
+      V = VT.head_rows( uword(ns) ).t();
+      }
+    
+    return true;
+    }
+  #else
+    {
+    arma_ignore(U);
+    arma_ignore(S);
+    arma_ignore(V);
+    arma_ignore(A);
+    arma_ignore(range);
+    arma_ignore(calc_UV);
+    arma_stop_logic_error("svd(): use of LAPACK must be enabled");
+    return false;
+    }
+  #endif
+  }
+
+
+
+template<typename T>
+inline
+bool
+auxlib::svd_subset(Mat< std::complex<T> >& U, Col<T>& S, Mat< std::complex<T> >& V, Mat< std::complex<T> >& A, const svd_range& range, const bool calc_UV)
+  {
+  arma_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    typedef std::complex<T> eT;
+    
+    const uword min_mn_u = (std::min)(A.n_rows, A.n_cols);
+    
+    if(range.type == svd_range::RANGE_INDEX)
+      {
+      arma_conform_check( ((range.first > range.last) || (uword(range.last) >= min_mn_u)), "svd(): index range is out of bounds" );
+      }
+    
+    if(range.type == svd_range::RANGE_VALUE)
+      {
+      arma_conform_check( ((range.lo < double(0)) || (range.lo >= range.hi)), "svd(): value range must satisfy 0 <= lo < hi" );
+      }
+    
+    if(min_mn_u == 0)
+      {
+      S.reset();
+      
+      if(calc_UV)  { U.set_size(A.n_rows, 0); V.set_size(A.n_cols, 0); }
+      
+      return true;
+      }
+    
+    if(arma_config::check_nonfinite && A.internal_has_nonfinite())  { return false; }
+    
+    arma_conform_assert_blas_size(A);
+    
+    char jobu    = (calc_UV) ? 'V' : 'N';
+    char jobvt   = (calc_UV) ? 'V' : 'N';
+    char range_c = (range.type == svd_range::RANGE_INDEX) ? 'I' : ( (range.type == svd_range::RANGE_VALUE) ? 'V' : 'A' );
+    
+    blas_int m      = blas_int(A.n_rows);
+    blas_int n      = blas_int(A.n_cols);
+    blas_int min_mn = (std::min)(m,n);
+    blas_int lda    = blas_int(A.n_rows);
+    T        vl     = T(range.lo);
+    T        vu     = T(range.hi);
+    blas_int il     = (range_c == 'I') ? blas_int(range.first + 1) : blas_int(1);
+    blas_int iu     = (range_c == 'I') ? blas_int(range.last  + 1) : min_mn;
+    blas_int ns     = 0;
+    blas_int info   = 0;
+    
+    const uword max_ns = uword(iu - il + 1);
+    
+    Col<T> s( static_cast<uword>(min_mn), arma_nozeros_indicator() );
+    
+    Mat<eT> UU( (calc_UV ? A.n_rows : uword(1)), (calc_UV ? max_ns : uword(1)), arma_nozeros_indicator() );
+    Mat<eT> VT( (calc_UV ? max_ns : uword(1)), (calc_UV ? A.n_cols : uword(1)), arma_nozeros_indicator() );
+    
+    blas_int ldu  = blas_int(UU.n_rows);
+    blas_int ldvt = blas_int(VT.n_rows);
+    
+    podarray<T>        rwork( uword(min_mn * (2*min_mn + 15*min_mn)) );
+    podarray<blas_int> iwork( uword(12*min_mn) );
+    
+    eT       work_query[2] = {};
+    blas_int lwork_query   = -1;
+    
+    arma_debug_print("lapack::cx_gesvdx()");
+    lapack::cx_gesvdx<T>(&jobu, &jobvt, &range_c, &m, &n, A.memptr(), &lda, &vl, &vu, &il, &iu, &ns, s.memptr(), UU.memptr(), &ldu, VT.memptr(), &ldvt, &work_query[0], &lwork_query, rwork.memptr(), iwork.memptr(), &info);
+    
+    if(info != 0)  { return false; }
+    
+    blas_int lwork_final = (std::max)( blas_int(1), static_cast<blas_int>( access::tmp_real(work_query[0]) ) );
+    
+    podarray<eT> work( static_cast<uword>(lwork_final) );
+    
+    arma_debug_print("lapack::cx_gesvdx()");
+    lapack::cx_gesvdx<T>(&jobu, &jobvt, &range_c, &m, &n, A.memptr(), &lda, &vl, &vu, &il, &iu, &ns, s.memptr(), UU.memptr(), &ldu, VT.memptr(), &ldvt, work.memptr(), &lwork_final, rwork.memptr(), iwork.memptr(), &info);
+    
+    if(info != 0)  { return false; }
+    
+    S = s.head( uword(ns) );
+    
+    if(calc_UV)
+      {
+      if(uword(ns) == UU.n_cols)  { U.steal_mem(UU); }  else  { U = UU.head_cols( uword(ns) ); }
+      
+      V = VT.head_rows( uword(ns) ).t();
+      }
+    
+    return true;
+    }
+  #else
+    {
+    arma_ignore(U);
+    arma_ignore(S);
+    arma_ignore(V);
+    arma_ignore(A);
+    arma_ignore(range);
+    arma_ignore(calc_UV);
+    arma_stop_logic_error("svd(): use of LAPACK must be enabled");
+    return false;
+    }
+  #endif
+  }
+
+
+
 //! solve a system of linear equations via LU decomposition
 template<typename T1>
 inline
@@ -5148,6 +5922,184 @@ auxlib::solve_sympd_refine(Mat< std::complex<typename T1::pod_type> >& out, type
 
 
 
+//! solve a system of linear equations via LU or Cholesky decomposition in single precision,
+//! followed by iterative refinement of the solution in double precision (as done by LAPACK functions dsgesv and dsposv);
+//! returns false if the conversion to single precision overflows, if the decomposition fails, if the solution or the residual is not finite,
+//! or if the refinement does not converge, in which case the system should be solved in double precision;
+//! only used when ARMA_USE_MIXED_SOLVE is enabled, as it requires the single precision LAPACK functions
+template<typename T1>
+inline
+bool
+auxlib::solve_square_mixed(Mat<typename T1::elem_type>& out, uword& out_n_iter, const Mat<typename T1::elem_type>& A, const Base<typename T1::elem_type,T1>& B_expr, const bool try_sympd)
+  {
+  arma_debug_sigprint();
+  
+  out_n_iter = 0;
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    typedef typename T1::elem_type eT;
+    typedef typename T1::pod_type   T;
+    
+    typedef typename std::conditional< is_cx<eT>::yes, std::complex<float>, float >::type eT_f;
+    
+    const quasi_unwrap<T1> UB(B_expr.get_ref());
+    
+    Mat<eT> B_tmp;  if(UB.is_alias(out))  { B_tmp = UB.M; }
+    
+    const Mat<eT>& B = (UB.is_alias(out)) ? B_tmp : UB.M;
+    
+    arma_conform_check( (A.n_rows != B.n_rows), "solve(): number of rows in given matrices must be the same" );
+    
+    if(A.is_empty() || B.is_empty())  { out.zeros(A.n_cols, B.n_cols); return true; }
+    
+    arma_conform_assert_blas_size(A,B);
+    
+    Mat<eT_f> AF = conv_to< Mat<eT_f> >::from(A);
+    
+    if(AF.internal_has_nonfinite())  { return false; }
+    
+    char     uplo  = 'L';
+    char     trans = 'N';
+    blas_int n     = blas_int(A.n_rows);
+    blas_int lda   = blas_int(A.n_rows);
+    blas_int ldb   = blas_int(A.n_rows);
+    blas_int nrhs  = blas_int(B.n_cols);
+    blas_int info  = blas_int(0);
+    
+    podarray<blas_int> ipiv(A.n_rows + 2);  // +2 for paranoia
+    
+    bool use_chol = try_sympd;
+    
+    if(use_chol)
+      {
+      arma_debug_print("lapack::potrf()");
+      lapack::potrf<eT_f>(&uplo, &n, AF.memptr(), &lda, &info);
+      
+      if(info != 0)
+        {
+        arma_debug_print("auxlib::solve_square_mixed(): Cholesky decomposition failed; using LU decomposition");
+        
+        use_chol = false;
+        
+        AF = conv_to< Mat<eT_f> >::from(A);
+        }
+      }
+    
+    if(use_chol == false)
+      {
+      arma_debug_print("lapack::getrf()");
+      lapack::getrf<eT_f>(&n, &n, AF.memptr(), &lda, ipiv.memptr(), &info);
+      
+      if(info != 0)  { return false; }
+      }
+    
+    // solve in single precision for the columns of R_f, which are converted from the given matrix;
+    // the result is false if the given matrix has elements that cannot be represented in single precision,
+    // or if the solution overflows in single precision
+    
+    Mat<eT_f> R_f;
+    
+    auto solve_f = [&](const Mat<eT>& R) -> bool
+      {
+      R_f = conv_to< Mat<eT_f> >::from(R);
+      
+      if(R_f.internal_has_nonfinite())  { return false; }
+      
+      if(use_chol)
+        {
+        arma_debug_print("lapack::potrs()");
+        lapack::potrs<eT_f>(&uplo, &n, &nrhs, AF.memptr(), &lda, R_f.memptr(), &ldb, &info);
+        }
+      else
+        {
+        arma_debug_print("lapack::getrs()");
+        lapack::getrs<eT_f>(&trans, &n, &nrhs, AF.memptr(), &lda, ipiv.memptr(), R_f.memptr(), &ldb, &info);
+        }
+      
+      return (info == 0) && (R_f.internal_has_nonfinite() == false);
+      };
+    
+    if(solve_f(B) == false)  { return false; }
+    
+    out = conv_to< Mat<eT> >::from(R_f);
+    
+    // stopping criterion of dsgesv: for each column, norm(r,inf) <= norm(x,inf) * norm(A,inf) * eps * sqrt(n);
+    // the max number of iterations (30) is also taken from dsgesv
+    
+    const T tol = op_norm::mat_norm_inf(A) * std::numeric_limits<T>::epsilon() * std::sqrt(T(A.n_rows));
+    
+    const uword max_iter = 30;
+    
+    Mat<eT> R(B.n_rows, B.n_cols, arma_nozeros_indicator());
+    
+    for(uword iter=0; iter <= max_iter; ++iter)
+      {
+      // R = B - A*out
+      
+      R = B;
+      
+      gemm<false, false, true, true>::apply(R, A, out, eT(-1), eT(1));
+      
+      // out is finite, but the residual can overflow; this also ensures that the max values below are not affected by NaN
+      
+      if(R.internal_has_nonfinite())  { return false; }
+      
+      bool converged = true;
+      
+      for(uword col=0; col < B.n_cols; ++col)
+        {
+        const eT* R_colptr =   R.colptr(col);
+        const eT* X_colptr = out.colptr(col);
+        
+        T R_max = T(0);
+        T X_max = T(0);
+        
+        for(uword row=0; row < B.n_rows; ++row)
+          {
+          R_max = (std::max)(R_max, std::abs(R_colptr[row]));
+          X_max = (std::max)(X_max, std::abs(X_colptr[row]));
+          }
+        
+        if(R_max > X_max * tol)  { converged = false; break; }
+        }
+      
+      if(converged)
+        {
+        arma_debug_print("auxlib::solve_square_mixed(): refinement iterations: ", iter);
+        
+        out_n_iter = iter;
+        
+        return true;
+        }
+      
+      if(iter == max_iter)  { break; }
+      
+      if(solve_f(R) == false)  { return false; }
+      
+      out += conv_to< Mat<eT> >::from(R_f);
+      
+      if(out.internal_has_nonfinite())  { return false; }
+      }
+    
+    arma_debug_print("auxlib::solve_square_mixed(): refinement did not converge");
+    
+    return false;
+    }
+  #else
+    {
+    arma_ignore(out);
+    arma_ignore(A);
+    arma_ignore(B_expr);
+    arma_ignore(try_sympd);
+    arma_stop_logic_error("solve(): use of LAPACK must be enabled");
+    return false;
+    }
+  #endif
+  }
+
+
+
 //! solve a non-square full-rank system via QR or LQ decomposition
 template<typename T1>
 inline
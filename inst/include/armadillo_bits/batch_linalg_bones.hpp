@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 The RcppArmadillo Authors
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup batch_linalg
+//! @{
+
+
+//! linear algebra applied independently to each slice of a cube;
+//! slices are processed in parallel when OpenMP is enabled.
+//! slices of size up to small_n x small_n are handled by built-in kernels, avoiding the per-call overhead of LAPACK;
+//! for real matrices the Cholesky based kernels interleave block_size slices element by element,
+//! so that the innermost loops run across slices and are vectorised by the compiler
+struct batch_linalg
+  {
+  static constexpr uword small_n    = 16;
+  static constexpr uword block_size = 16;
+  
+  template<typename eT> inline static bool chol         (Cube<eT>& out, const Cube<eT>& X, const uword layout);
+  template<typename eT> inline static bool inv_sympd    (Cube<eT>& out, const Cube<eT>& X);
+  template<typename eT> inline static bool log_det_sympd(Col<typename get_pod_type<eT>::result>& out, const Cube<eT>& X);
+  
+  //! out_rcond receives the reciprocal condition number of each system, which is zero for exactly singular systems
+  template<typename eT> inline static bool solve  (Cube<eT>& out, Col<typename get_pod_type<eT>::result>& out_rcond, const Cube<eT>& A, const Cube<eT>& B);
+  template<typename eT> inline static bool det    (Col<eT>& out, const Cube<eT>& X);
+  template<typename eT> inline static bool log_det(Col<eT>& out_val, Col<typename get_pod_type<eT>::result>& out_sign, const Cube<eT>& X);
+  
+  template<typename eT> inline static void times(Cube<eT>& out, const Cube<eT>& A, const Cube<eT>& B);
+  
+  
+  //
+  // internal
+  
+  //! worker(start,end) is applied to contiguous ranges of the items [0,n_items), in parallel if worthwhile
+  template<typename eT, typename worker_type> inline static bool run(const uword n_items, const uword n_elem, const worker_type& worker);
+  
+  //! mode 0: Cholesky factor;  mode 1: inverse;  mode 2: log determinant
+  template<typename eT> inline static bool sympd_interleaved(Cube<eT>& out, Col<typename get_pod_type<eT>::result>& out_vals, const Cube<eT>& X, const uword layout, const uword mode, const typename arma_not_cx<eT>::result* junk = nullptr);
+  template<typename eT> inline static bool sympd_interleaved(Cube<eT>& out, Col<typename get_pod_type<eT>::result>& out_vals, const Cube<eT>& X, const uword layout, const uword mode, const typename arma_cx_only<eT>::result* junk = nullptr);
+  
+  template<typename eT> inline static bool sympd_lapack(Cube<eT>& out, Col<typename get_pod_type<eT>::result>& out_vals, const Cube<eT>& X, const uword layout, const uword mode);
+  
+  template<typename eT> inline static void gather  (eT* buf, const Cube<eT>& X, const uword slice_start, const bool trans);
+  template<typename eT> inline static void scatter (Cube<eT>& out, const eT* buf, const uword slice_start, const bool trans, const bool full);
+  
+  template<typename eT, const uword N> inline static bool chol_block (eT* buf, const uword n);
+  template<typename eT, const uword N> inline static void inv_block  (eT* out_buf, eT* buf, const uword n);
+  
+  template<typename eT, const uword N> inline static bool lu_small   (eT* A, uword* piv, const uword n);
+  template<typename eT, const uword N> inline static void lu_solve_small(const eT* LU, const uword* piv, eT* B, const uword n, const uword n_rhs);
+  template<typename eT, const uword N> inline static void lu_inv_small  (eT* out, const eT* LU, const uword* piv, const uword n);
+  
+  template<typename eT> inline static bool lu_small_dispatch(eT* A, uword* piv, const uword n);
+  
+  template<typename eT> inline static typename get_pod_type<eT>::result lu_rcond_small(const eT* LU, const uword* piv, const uword n, const typename get_pod_type<eT>::result norm_val);
+  };
+
+
+
+//! @}
@@ -0,0 +1,973 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 The RcppArmadillo Authors
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup batch_linalg
+//! @{
+
+
+
+template<typename eT>
+inline
+bool
+batch_linalg::chol(Cube<eT>& out, const Cube<eT>& X, const uword layout)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  out.set_size(X.n_rows, X.n_cols, X.n_slices);
+  
+  if(out.is_empty())  { return true; }
+  
+  Col<T> junk;
+  
+  return (X.n_rows <= batch_linalg::small_n) ? batch_linalg::sympd_interleaved(out, junk, X, layout, 0) : batch_linalg::sympd_lapack(out, junk, X, layout, 0);
+  }
+
+
+
+template<typename eT>
+inline
+bool
+batch_linalg::inv_sympd(Cube<eT>& out, const Cube<eT>& X)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  out.set_size(X.n_rows, X.n_cols, X.n_slices);
+  
+  if(out.is_empty())  { return true; }
+  
+  Col<T> junk;
+  
+  return (X.n_rows <= batch_linalg::small_n) ? batch_linalg::sympd_interleaved(out, junk, X, 0, 1) : batch_linalg::sympd_lapack(out, junk, X, 0, 1);
+  }
+
+
+
+template<typename eT>
+inline
+bool
+batch_linalg::log_det_sympd(Col<typename get_pod_type<eT>::result>& out, const Cube<eT>& X)
+  {
+  arma_debug_sigprint();
+  
+  out.zeros(X.n_slices);
+  
+  if(X.is_empty())  { return true; }
+  
+  Cube<eT> junk;
+  
+  return (X.n_rows <= batch_linalg::small_n) ? batch_linalg::sympd_interleaved(junk, out, X, 0, 2) : batch_linalg::sympd_lapack(junk, out, X, 0, 2);
+  }
+
+
+
+template<typename eT>
+inline
+bool
+batch_linalg::solve(Cube<eT>& out, Col<typename get_pod_type<eT>::result>& out_rcond, const Cube<eT>& A, const Cube<eT>& B)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const uword N        = A.n_rows;
+  const uword n_rhs    = B.n_cols;
+  const uword n_slices = ( (A.n_slices == 0) || (B.n_slices == 0) ) ? uword(0) : (std::max)(A.n_slices, B.n_slices);
+  
+  out.set_size(N, n_rhs, n_slices);
+  
+  out_rcond.zeros(n_slices);
+  
+  if( out.is_empty() || (N == 0) )  { out.zeros(); out_rcond.ones(); return true; }
+  
+  if(A.n_slices == 1)
+    {
+    // all systems share the same A;
+    // the slices of B are adjacent in memory, forming a single matrix with n_rhs*n_slices columns
+    
+    Mat<eT> AA(A.slice_memptr(0), N, N);
+    
+    const Mat<eT> BB(const_cast<eT*>(B.memptr()), N, n_rhs*n_slices, false, true);
+    
+    Mat<eT> XX(out.memptr(), N, n_rhs*n_slices, false, true);
+    
+    T rcond = T(0);
+    
+    if(auxlib::solve_square_rcond(XX, rcond, AA, BB))  { out_rcond.fill(rcond); }
+    
+    return true;
+    }
+  
+  T* rcond_mem = out_rcond.memptr();
+  
+  const auto worker = [&](const uword start, const uword end) -> bool
+    {
+    eT    LU [batch_linalg::small_n * batch_linalg::small_n];
+    uword piv[batch_linalg::small_n];
+    
+    for(uword s=start; s < end; ++s)
+      {
+      const eT* A_mem = A.slice_memptr(s);
+      const eT* B_mem = B.slice_memptr( (B.n_slices == 1) ? uword(0) : s );
+      
+      if(N <= batch_linalg::small_n)
+        {
+        T norm_val = T(0);
+        
+        for(uword c=0; c < N; ++c)
+          {
+          T acc = T(0);
+          
+          for(uword r=0; r < N; ++r)  { acc += std::abs(A_mem[r + c*N]); }
+          
+          norm_val = (std::max)(norm_val, acc);
+          }
+        
+        arrayops::copy(LU, A_mem, N*N);
+        
+        // an exactly singular system keeps an rcond of zero
+        
+        if(batch_linalg::lu_small_dispatch(LU, piv, N) == false)  { continue; }
+        
+        eT* X_mem = out.slice_memptr(s);
+        
+        arrayops::copy(X_mem, B_mem, N*n_rhs);
+        
+        switch(N)
+          {
+          case  1:  batch_linalg::lu_solve_small<eT,1>(LU, piv, X_mem, N, n_rhs);  break;
+          case  2:  batch_linalg::lu_solve_small<eT,2>(LU, piv, X_mem, N, n_rhs);  break;
+          case  3:  batch_linalg::lu_solve_small<eT,3>(LU, piv, X_mem, N, n_rhs);  break;
+          case  4:  batch_linalg::lu_solve_small<eT,4>(LU, piv, X_mem, N, n_rhs);  break;
+          default:  batch_linalg::lu_solve_small<eT,0>(LU, piv, X_mem, N, n_rhs);
+          }
+        
+        rcond_mem[s] = batch_linalg::lu_rcond_small(LU, piv, N, norm_val);
+        }
+      else
+        {
+        Mat<eT> AA(A_mem, N, N);
+        
+        const Mat<eT> BB(const_cast<eT*>(B_mem), N, n_rhs, false, true);
+        
+        Mat<eT> XX(out.slice_memptr(s), N, n_rhs, false, true);
+        
+        T rcond = T(0);
+        
+        if(auxlib::solve_square_rcond(XX, rcond, AA, BB))  { rcond_mem[s] = rcond; }
+        }
+      }
+    
+    return true;
+    };
+  
+  return batch_linalg::run<eT>(n_slices, A.n_elem, worker);
+  }
+
+
+
+template<typename eT>
+inline
+bool
+batch_linalg::det(Col<eT>& out, const Cube<eT>& X)
+  {
+  arma_debug_sigprint();
+  
+  const uword N = X.n_rows;
+  
+  out.ones(X.n_slices);
+  
+  if(X.is_empty())  { return true; }
+  
+  eT* out_mem = out.memptr();
+  
+  const auto worker = [&](const uword start, const uword end) -> bool
+    {
+    eT    LU [batch_linalg::small_n * batch_linalg::small_n];
+    uword piv[batch_linalg::small_n];
+    
+    for(uword s=start; s < end; ++s)
+      {
+      if(N <= batch_linalg::small_n)
+        {
+        arrayops::copy(LU, X.slice_memptr(s), N*N);
+        
+        // a singular matrix has a zero on the diagonal of U, and hence a zero determinant
+        batch_linalg::lu_small_dispatch(LU, piv, N);
+        
+        eT val = eT(1);
+        
+        for(uword i=0; i < N; ++i)
+          {
+          val *= LU[i + i*N];
+          
+          if(piv[i] != i)  { val = -val; }
+          }
+        
+        out_mem[s] = val;
+        }
+      else
+        {
+        Mat<eT> tmp(X.slice_memptr(s), N, N);
+        
+        if(auxlib::det(out_mem[s], tmp) == false)  { return false; }
+        }
+      }
+    
+    return true;
+    };
+  
+  return batch_linalg::run<eT>(X.n_slices, X.n_elem, worker);
+  }
+
+
+
+template<typename eT>
+inline
+bool
+batch_linalg::log_det(Col<eT>& out_val, Col<typename get_pod_type<eT>::result>& out_sign, const Cube<eT>& X)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const uword N = X.n_rows;
+  
+  out_val.zeros(X.n_slices);
+  out_sign.ones(X.n_slices);
+  
+  if(X.is_empty())  { return true; }
+  
+  eT* out_val_mem  = out_val.memptr();
+   T* out_sign_mem = out_sign.memptr();
+  
+  const auto worker = [&](const uword start, const uword end) -> bool
+    {
+    eT    LU [batch_linalg::small_n * batch_linalg::small_n];
+    uword piv[batch_linalg::small_n];
+    
+    for(uword s=start; s < end; ++s)
+      {
+      if(N <= batch_linalg::small_n)
+        {
+        arrayops::copy(LU, X.slice_memptr(s), N*N);
+        
+        batch_linalg::lu_small_dispatch(LU, piv, N);
+        
+        // same formulation as auxlib::log_det()
+        
+        eT val  = eT(0);
+        T  sign = T(1);
+        
+        for(uword i=0; i < N; ++i)
+          {
+          const eT x = LU[i + i*N];
+          
+          const bool x_neg = (is_cx<eT>::no) && (access::tmp_real(x) < T(0));
+          
+          if(x_neg)  { sign = -sign; }
+          
+          val += std::log( (x_neg) ? eT(x*T(-1)) : x );
+          
+          if(piv[i] != i)  { sign = -sign; }
+          }
+        
+        out_val_mem[s]  = val;
+        out_sign_mem[s] = sign;
+        }
+      else
+        {
+        Mat<eT> tmp(X.slice_memptr(s), N, N);
+        
+        if(auxlib::log_det(out_val_mem[s], out_sign_mem[s], tmp) == false)  { return false; }
+        }
+      }
+    
+    return true;
+    };
+  
+  return batch_linalg::run<eT>(X.n_slices, X.n_elem, worker);
+  }
+
+
+
+template<typename eT>
+inline
+void
+batch_linalg::times(Cube<eT>& out, const Cube<eT>& A, const Cube<eT>& B)
+  {
+  arma_debug_sigprint();
+  
+  const uword n_slices = ( (A.n_slices == 0) || (B.n_slices == 0) ) ? uword(0) : (std::max)(A.n_slices, B.n_slices);
+  
+  out.set_size(A.n_rows, B.n_cols, n_slices);
+  
+  if(out.is_empty())  { return; }
+  
+  if(A.n_cols == 0)  { out.zeros(); return; }
+  
+  if(A.n_slices == 1)
+    {
+    // the slices of B are adjacent in memory, forming a single matrix with B.n_cols*n_slices columns;
+    // one large multiplication is considerably more efficient than many small ones
+    
+    const Mat<eT> AA(const_cast<eT*>(A.memptr()), A.n_rows, A.n_cols,            false, true);
+    const Mat<eT> BB(const_cast<eT*>(B.memptr()), B.n_rows, B.n_cols*B.n_slices, false, true);
+    
+    Mat<eT> CC(out.memptr(), out.n_rows, out.n_cols*out.n_slices, false, true);
+    
+    glue_times::apply<eT,false,false,false>(CC, AA, BB, eT(0));
+    
+    return;
+    }
+  
+  const auto worker = [&](const uword start, const uword end) -> bool
+    {
+    for(uword s=start; s < end; ++s)
+      {
+      const eT* B_mem = B.slice_memptr( (B.n_slices == 1) ? uword(0) : s );
+      
+      const Mat<eT> AA(const_cast<eT*>(A.slice_memptr(s)), A.n_rows, A.n_cols, false, true);
+      const Mat<eT> BB(const_cast<eT*>(B_mem),              B.n_rows, B.n_cols, false, true);
+      
+      Mat<eT> CC(out.slice_memptr(s), out.n_rows, out.n_cols, false, true);
+      
+      glue_times::apply<eT,false,false,false>(CC, AA, BB, eT(0));
+      }
+    
+    return true;
+    };
+  
+  batch_linalg::run<eT>(n_slices, (out.n_elem * A.n_cols), worker);
+  }
+
+
+
+template<typename eT, typename worker_type>
+inline
+bool
+batch_linalg::run(const uword n_items, const uword n_elem, const worker_type& worker)
+  {
+  arma_debug_sigprint();
+  
+  if(n_items == 0)  { return true; }
+  
+  const bool use_mp = (arma_config::openmp) && (n_items >= 2) && (mp_thread_limit::in_parallel() == false) && mp_gate<eT>::eval(n_elem);
+  
+  if(use_mp)
+    {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      arma_debug_print("batch_linalg::run(): parallelised implementation");
+      
+      const uword n_threads = uword( (std::min)( mp_thread_limit::get(), int((std::min)(n_items, uword(INT_MAX))) ) );
+      
+      podarray<uword> status(n_threads);
+      
+      uword* status_mem = status.memptr();
+      
+      // each thread gets a contiguous range of items, so that workers can reuse their scratch memory
+      
+      #pragma omp parallel for schedule(static) num_threads(int(n_threads))
+      for(uword t=0; t < n_threads; ++t)
+        {
+        const uword start = (n_items *  t   ) / n_threads;
+        const uword end   = (n_items * (t+1)) / n_threads;
+        
+        status_mem[t] = worker(start, end) ? uword(1) : uword(0);
+        }
+      
+      for(uword t=0; t < n_threads; ++t)  { if(status_mem[t] == uword(0))  { return false; } }
+      
+      return true;
+      }
+    #endif
+    }
+  
+  return worker(uword(0), n_items);
+  }
+
+
+
+template<typename eT>
+inline
+bool
+batch_linalg::sympd_interleaved(Cube<eT>& out, Col<typename get_pod_type<eT>::result>& out_vals, const Cube<eT>& X, const uword layout, const uword mode, const typename arma_not_cx<eT>::result* junk)
+  {
+  arma_debug_sigprint();
+  arma_ignore(junk);
+  
+  const uword N  = X.n_rows;
+  const uword BS = batch_linalg::block_size;
+  
+  const uword n_blocks = (X.n_slices + BS - 1) / BS;
+  
+  // the kernels compute the upper triangular factor;
+  // the lower triangular factor is obtained by transposing the slices during gather and scatter
+  const bool trans = (mode == 0) && (layout == 1);
+  
+  eT* out_vals_mem = out_vals.memptr();
+  
+  const auto worker = [&](const uword block_start, const uword block_end) -> bool
+    {
+    podarray<eT> buf(N*N*BS);
+    podarray<eT> inv_buf( (mode == 1) ? N*N*BS : uword(0) );
+    
+    for(uword block=block_start; block < block_end; ++block)
+      {
+      const uword slice_start = block * BS;
+      
+      batch_linalg::gather(buf.memptr(), X, slice_start, trans);
+      
+      bool status = false;
+      
+      switch(N)
+        {
+        case  1:  status = batch_linalg::chol_block<eT,1>(buf.memptr(), N);  break;
+        case  2:  status = batch_linalg::chol_block<eT,2>(buf.memptr(), N);  break;
+        case  3:  status = batch_linalg::chol_block<eT,3>(buf.memptr(), N);  break;
+        case  4:  status = batch_linalg::chol_block<eT,4>(buf.memptr(), N);  break;
+        default:  status = batch_linalg::chol_block<eT,0>(buf.memptr(), N);
+        }
+      
+      if(status == false)  { return false; }
+      
+      if(mode == 0)
+        {
+        batch_linalg::scatter(out, buf.memptr(), slice_start, trans, false);
+        }
+      else
+      if(mode == 1)
+        {
+        switch(N)
+          {
+          case  1:  batch_linalg::inv_block<eT,1>(inv_buf.memptr(), buf.memptr(), N);  break;
+          case  2:  batch_linalg::inv_block<eT,2>(inv_buf.memptr(), buf.memptr(), N);  break;
+          case  3:  batch_linalg::inv_block<eT,3>(inv_buf.memptr(), buf.memptr(), N);  break;
+          case  4:  batch_linalg::inv_block<eT,4>(inv_buf.memptr(), buf.memptr(), N);  break;
+          default:  batch_linalg::inv_block<eT,0>(inv_buf.memptr(), buf.memptr(), N);
+          }
+        
+        batch_linalg::scatter(out, inv_buf.memptr(), slice_start, false, true);
+        }
+      else
+        {
+        const uword count = (std::min)(BS, X.n_slices - slice_start);
+        
+        for(uword b=0; b < count; ++b)
+          {
+          eT val = eT(0);
+          
+          for(uword j=0; j < N; ++j)  { val += std::log( buf[(j + j*N)*BS + b] ); }
+          
+          out_vals_mem[slice_start + b] = eT(2) * val;
+          }
+        }
+      }
+    
+    return true;
+    };
+  
+  return batch_linalg::run<eT>(n_blocks, X.n_elem, worker);
+  }
+
+
+
+template<typename eT>
+inline
+bool
+batch_linalg::sympd_interleaved(Cube<eT>& out, Col<typename get_pod_type<eT>::result>& out_vals, const Cube<eT>& X, const uword layout, const uword mode, const typename arma_cx_only<eT>::result* junk)
+  {
+  arma_debug_sigprint();
+  arma_ignore(junk);
+  
+  // the interleaved kernels are only implemented for real matrices
+  
+  return batch_linalg::sympd_lapack(out, out_vals, X, layout, mode);
+  }
+
+
+
+template<typename eT>
+inline
+bool
+batch_linalg::sympd_lapack(Cube<eT>& out, Col<typename get_pod_type<eT>::result>& out_vals, const Cube<eT>& X, const uword layout, const uword mode)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const uword N = X.n_rows;
+  
+  T* out_vals_mem = out_vals.memptr();
+  
+  const auto worker = [&](const uword start, const uword end) -> bool
+    {
+    for(uword s=start; s < end; ++s)
+      {
+      if(mode == 2)
+        {
+        Mat<eT> tmp(X.slice_memptr(s), N, N);
+        
+        if(auxlib::log_det_sympd(out_vals_mem[s], tmp) == false)  { return false; }
+        }
+      else
+        {
+        arrayops::copy(out.slice_memptr(s), X.slice_memptr(s), N*N);
+        
+        Mat<eT> tmp(out.slice_memptr(s), N, N, false, true);
+        
+        bool sympd_state_junk = false;
+        
+        const bool status = (mode == 0) ? auxlib::chol(tmp, layout) : auxlib::inv_sympd(tmp, sympd_state_junk);
+        
+        if(status == false)  { return false; }
+        }
+      }
+    
+    return true;
+    };
+  
+  return batch_linalg::run<eT>(X.n_slices, X.n_elem, worker);
+  }
+
+
+
+//! copy block_size slices, starting at slice_start, into buf;
+//! element (i,j) of slice slice_start+b is stored at buf[(i + j*n_rows)*block_size + b].
+//! slices beyond the end of the cube are padded with identity matrices
+template<typename eT>
+inline
+void
+batch_linalg::gather(eT* buf, const Cube<eT>& X, const uword slice_start, const bool trans)
+  {
+  arma_debug_sigprint();
+  
+  const uword N  = X.n_rows;
+  const uword BS = batch_linalg::block_size;
+  
+  const uword count = (std::min)(BS, X.n_slices - slice_start);
+  
+  for(uword b=0; b < count; ++b)
+    {
+    const eT* X_mem = X.slice_memptr(slice_start + b);
+    
+    for(uword j=0; j < N; ++j)
+    for(uword i=0; i < N; ++i)
+      {
+      buf[(i + j*N)*BS + b] = (trans) ? X_mem[j + i*N] : X_mem[i + j*N];
+      }
+    }
+  
+  for(uword b=count; b < BS; ++b)
+    {
+    for(uword i=0; i < N*N; ++i)  { buf[i*BS + b] = eT(0); }
+    for(uword i=0; i < N;   ++i)  { buf[(i + i*N)*BS + b] = eT(1); }
+    }
+  }
+
+
+
+//! inverse of gather();
+//! if full is false, only the upper triangle (lower triangle if trans is true) is used, with the remainder set to zero
+template<typename eT>
+inline
+void
+batch_linalg::scatter(Cube<eT>& out, const eT* buf, const uword slice_start, const bool trans, const bool full)
+  {
+  arma_debug_sigprint();
+  
+  const uword N  = out.n_rows;
+  const uword BS = batch_linalg::block_size;
+  
+  const uword count = (std::min)(BS, out.n_slices - slice_start);
+  
+  for(uword b=0; b < count; ++b)
+    {
+    eT* out_mem = out.slice_memptr(slice_start + b);
+    
+    for(uword j=0; j < N; ++j)
+    for(uword i=0; i < N; ++i)
+      {
+      const bool keep = (full) || ( (trans) ? (i >= j) : (i <= j) );
+      
+      out_mem[i + j*N] = (keep) ? buf[( (trans) ? (j + i*N) : (i + j*N) )*BS + b] : eT(0);
+      }
+    }
+  }
+
+
+
+//! upper triangular Cholesky factors of block_size interleaved matrices, using only their upper triangles;
+//! N is the matrix size if known at compile time, or zero otherwise
+template<typename eT, const uword N>
+inline
+bool
+batch_linalg::chol_block(eT* buf, const uword n)
+  {
+  const uword nn = (N > 0) ? N : n;
+  const uword BS = batch_linalg::block_size;
+  
+  // the updates are accumulated in local arrays, which are known not to alias buf;
+  // this allows the loops over b to be vectorised without run-time alias checks
+  
+  eT acc  [batch_linalg::block_size];
+  eT inv_d[batch_linalg::block_size];
+  
+  for(uword j=0; j < nn; ++j)
+    {
+    eT* R_jj = buf + (j + j*nn)*BS;
+    
+    for(uword b=0; b < BS; ++b)  { acc[b] = R_jj[b]; }
+    
+    for(uword k=0; k < j; ++k)
+      {
+      const eT* R_kj = buf + (k + j*nn)*BS;
+      
+      for(uword b=0; b < BS; ++b)  { acc[b] -= R_kj[b] * R_kj[b]; }
+      }
+    
+    bool status = true;
+    
+    for(uword b=0; b < BS; ++b)
+      {
+      // NaN also fails this test
+      if( (acc[b] > eT(0)) == false )  { status = false; }
+      }
+    
+    if(status == false)  { return false; }
+    
+    for(uword b=0; b < BS; ++b)
+      {
+      const eT d = std::sqrt(acc[b]);
+      
+      R_jj[b]  = d;
+      inv_d[b] = eT(1) / d;
+      }
+    
+    for(uword i=j+1; i < nn; ++i)
+      {
+      eT* R_ji = buf + (j + i*nn)*BS;
+      
+      for(uword b=0; b < BS; ++b)  { acc[b] = R_ji[b]; }
+      
+      for(uword k=0; k < j; ++k)
+        {
+        const eT* R_kj = buf + (k + j*nn)*BS;
+        const eT* R_ki = buf + (k + i*nn)*BS;
+        
+        for(uword b=0; b < BS; ++b)  { acc[b] -= R_kj[b] * R_ki[b]; }
+        }
+      
+      for(uword b=0; b < BS; ++b)  { R_ji[b] = acc[b] * inv_d[b]; }
+      }
+    }
+  
+  return true;
+  }
+
+
+
+//! inverses of block_size interleaved matrices from their upper triangular Cholesky factors;
+//! buf is overwritten with the inverses of the factors
+template<typename eT, const uword N>
+inline
+void
+batch_linalg::inv_block(eT* out_buf, eT* buf, const uword n)
+  {
+  const uword nn = (N > 0) ? N : n;
+  const uword BS = batch_linalg::block_size;
+  
+  eT acc  [batch_linalg::block_size];
+  eT inv_d[batch_linalg::block_size];
+  
+  // inv(R), one column at a time;
+  // element (i,j) of the inverse depends on earlier columns of the inverse and on elements (i:j-1,j) of R
+  
+  for(uword j=0; j < nn; ++j)
+    {
+    eT* R_jj = buf + (j + j*nn)*BS;
+    
+    for(uword b=0; b < BS; ++b)  { inv_d[b] = eT(1) / R_jj[b];  R_jj[b] = inv_d[b]; }
+    
+    for(uword i=0; i < j; ++i)
+      {
+      for(uword b=0; b < BS; ++b)  { acc[b] = eT(0); }
+      
+      for(uword k=i; k < j; ++k)
+        {
+        const eT* R_ik = buf + (i + k*nn)*BS;
+        const eT* R_kj = buf + (k + j*nn)*BS;
+        
+        for(uword b=0; b < BS; ++b)  { acc[b] += R_ik[b] * R_kj[b]; }
+        }
+      
+      eT* R_ij = buf + (i + j*nn)*BS;
+      
+      for(uword b=0; b < BS; ++b)  { R_ij[b] = -inv_d[b] * acc[b]; }
+      }
+    }
+  
+  // inv(A) = inv(R) * inv(R)'
+  
+  for(uword j=0; j < nn; ++j)
+  for(uword i=0; i <= j; ++i)
+    {
+    for(uword b=0; b < BS; ++b)  { acc[b] = eT(0); }
+    
+    for(uword k=j; k < nn; ++k)
+      {
+      const eT* R_ik = buf + (i + k*nn)*BS;
+      const eT* R_jk = buf + (j + k*nn)*BS;
+      
+      for(uword b=0; b < BS; ++b)  { acc[b] += R_ik[b] * R_jk[b]; }
+      }
+    
+    eT* out_ij = out_buf + (i + j*nn)*BS;
+    eT* out_ji = out_buf + (j + i*nn)*BS;
+    
+    for(uword b=0; b < BS; ++b)  { out_ij[b] = acc[b]; out_ji[b] = acc[b]; }
+    }
+  }
+
+
+
+//! LU decomposition with partial pivoting, in the same form as produced by getrf(), but with zero based pivot indices;
+//! returns false if the matrix is singular, in which case the decomposition is still completed
+template<typename eT, const uword N>
+inline
+bool
+batch_linalg::lu_small(eT* A, uword* piv, const uword n)
+  {
+  typedef typename get_pod_type<eT>::result T;
+  
+  const uword nn = (N > 0) ? N : n;
+  
+  bool status = true;
+  
+  for(uword k=0; k < nn; ++k)
+    {
+    // for complex matrices the pivot is chosen via |real|+|imag|, as done by getrf()
+    
+    uword p     = k;
+    T     p_val = std::abs(access::tmp_real(A[k + k*nn])) + std::abs(access::tmp_imag(A[k + k*nn]));
+    
+    for(uword i=k+1; i < nn; ++i)
+      {
+      const T val = std::abs(access::tmp_real(A[i + k*nn])) + std::abs(access::tmp_imag(A[i + k*nn]));
+      
+      if(val > p_val)  { p_val = val; p = i; }
+      }
+    
+    piv[k] = p;
+    
+    if(p != k)  { for(uword c=0; c < nn; ++c)  { std::swap(A[k + c*nn], A[p + c*nn]); } }
+    
+    if(p_val == T(0))  { status = false; continue; }
+    
+    const eT inv_pivot = eT(1) / A[k + k*nn];
+    
+    // the multipliers are also kept in a local array, so that the update below can be vectorised without alias checks;
+    // for compile-time sizes the update covers all rows (with zero multipliers for rows 0 to k), so that its trip count is constant
+    
+    eT L_k[ (N > 0) ? N : small_n ];
+    
+    const uword i_start = (N > 0) ? uword(0) : (k+1);
+    
+    for(uword i=i_start; i <= k; ++i)  { L_k[i] = eT(0); }
+    for(uword i=k+1;     i <  nn; ++i)  { L_k[i] = A[i + k*nn] * inv_pivot;  A[i + k*nn] = L_k[i]; }
+    
+    for(uword c=k+1; c < nn; ++c)
+      {
+      eT* A_c = &(A[c*nn]);
+      
+      const eT A_kc = A_c[k];
+      
+      for(uword i=i_start; i < nn; ++i)  { A_c[i] -= L_k[i] * A_kc; }
+      }
+    }
+  
+  return status;
+  }
+
+
+
+//! overwrite B with inv(A)*B, where A has been decomposed by lu_small()
+template<typename eT, const uword N>
+inline
+void
+batch_linalg::lu_solve_small(const eT* LU, const uword* piv, eT* B, const uword n, const uword n_rhs)
+  {
+  const uword nn = (N > 0) ? N : n;
+  
+  for(uword r=0; r < n_rhs; ++r)
+    {
+    eT* x = B + r*nn;
+    
+    for(uword k=0; k < nn; ++k)  { if(piv[k] != k)  { std::swap(x[k], x[piv[k]]); } }
+    
+    for(uword k=0; k < nn; ++k)
+      {
+      const eT x_k = x[k];
+      
+      for(uword i=k+1; i < nn; ++i)  { x[i] -= LU[i + k*nn] * x_k; }
+      }
+    
+    for(uword kk=nn; kk > 0; --kk)
+      {
+      const uword k = kk-1;
+      
+      x[k] /= LU[k + k*nn];
+      
+      const eT x_k = x[k];
+      
+      for(uword i=0; i < k; ++i)  { x[i] -= LU[i + k*nn] * x_k; }
+      }
+    }
+  }
+
+
+
+//! inverse of A, where A has been decomposed by lu_small();
+//! the rows of the intermediate result are stored contiguously, so that each update is applied to all columns at once
+template<typename eT, const uword N>
+inline
+void
+batch_linalg::lu_inv_small(eT* out, const eT* LU, const uword* piv, const uword n)
+  {
+  const uword nn = (N > 0) ? N : n;
+  
+  eT W[ (N > 0) ? (N*N) : (small_n*small_n) ];
+  eT inv_diag[ (N > 0) ? N : small_n ];
+  
+  for(uword i=0; i < nn*nn; ++i)  { W[i] = eT(0); }
+  for(uword i=0; i < nn;    ++i)  { W[i + i*nn] = eT(1); inv_diag[i] = eT(1) / LU[i + i*nn]; }
+  
+  // W(i,:) is stored in W[i*nn] to W[i*nn + nn-1]
+  
+  for(uword k=0; k < nn; ++k)
+    {
+    const uword p = piv[k];
+    
+    if(p != k)  { for(uword c=0; c < nn; ++c)  { std::swap(W[c + k*nn], W[c + p*nn]); } }
+    }
+  
+  // row k is copied to a separate array before it is used to update the other rows, so that the updates can be vectorised
+  
+  eT W_k[ (N > 0) ? N : small_n ];
+  
+  for(uword k=0; k < nn; ++k)
+    {
+    for(uword c=0; c < nn; ++c)  { W_k[c] = W[c + k*nn]; }
+    
+    for(uword i=k+1; i < nn; ++i)
+      {
+      const eT L_ik = LU[i + k*nn];
+      
+      eT* W_i = &(W[i*nn]);
+      
+      for(uword c=0; c < nn; ++c)  { W_i[c] -= L_ik * W_k[c]; }
+      }
+    }
+  
+  for(uword kk=nn; kk > 0; --kk)
+    {
+    const uword k = kk-1;
+    
+    const eT d = inv_diag[k];
+    
+    for(uword c=0; c < nn; ++c)  { W_k[c] = W[c + k*nn] * d;  W[c + k*nn] = W_k[c]; }
+    
+    for(uword i=0; i < k; ++i)
+      {
+      const eT U_ik = LU[i + k*nn];
+      
+      eT* W_i = &(W[i*nn]);
+      
+      for(uword c=0; c < nn; ++c)  { W_i[c] -= U_ik * W_k[c]; }
+      }
+    }
+  
+  for(uword c=0; c < nn; ++c)
+  for(uword r=0; r < nn; ++r)
+    {
+    out[r + c*nn] = W[c + r*nn];
+    }
+  }
+
+
+
+template<typename eT>
+inline
+bool
+batch_linalg::lu_small_dispatch(eT* A, uword* piv, const uword n)
+  {
+  switch(n)
+    {
+    case  1:  return batch_linalg::lu_small<eT,1>(A, piv, n);
+    case  2:  return batch_linalg::lu_small<eT,2>(A, piv, n);
+    case  3:  return batch_linalg::lu_small<eT,3>(A, piv, n);
+    case  4:  return batch_linalg::lu_small<eT,4>(A, piv, n);
+    default:  return batch_linalg::lu_small<eT,0>(A, piv, n);
+    }
+  }
+
+
+
+//! reciprocal condition number in the 1-norm of A, where A has been decomposed by lu_small() and norm_val is the 1-norm of A;
+//! for these small sizes the norm of inv(A) is computed exactly rather than estimated as done by gecon(),
+//! at a cost similar to that of the decomposition
+template<typename eT>
+inline
+typename get_pod_type<eT>::result
+batch_linalg::lu_rcond_small(const eT* LU, const uword* piv, const uword n, const typename get_pod_type<eT>::result norm_val)
+  {
+  typedef typename get_pod_type<eT>::result T;
+  
+  eT inv_A[batch_linalg::small_n * batch_linalg::small_n];
+  
+  switch(n)
+    {
+    case  1:  inv_A[0] = eT(1) / LU[0];                             break;
+    case  2:  batch_linalg::lu_inv_small<eT,2>(inv_A, LU, piv, n);  break;
+    case  3:  batch_linalg::lu_inv_small<eT,3>(inv_A, LU, piv, n);  break;
+    case  4:  batch_linalg::lu_inv_small<eT,4>(inv_A, LU, piv, n);  break;
+    default:  batch_linalg::lu_inv_small<eT,0>(inv_A, LU, piv, n);
+    }
+  
+  T inv_norm_val = T(0);
+  
+  for(uword c=0; c < n; ++c)
+    {
+    T acc = T(0);
+    
+    for(uword r=0; r < n; ++r)  { acc += std::abs(inv_A[r + c*n]); }
+    
+    inv_norm_val = (std::max)(inv_norm_val, acc);
+    }
+  
+  if( (norm_val == T(0)) || (inv_norm_val == T(0)) )  { return T(0); }
+  
+  return (T(1) / norm_val) / inv_norm_val;
+  }
+
+
+
+//! @}
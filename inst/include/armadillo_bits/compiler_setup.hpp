@@ -382,12 +382,31 @@
 #endif
 
 
+// explicit SIMD kernels require the target attribute and __builtin_cpu_supports() of gcc or clang;
+// they are not used on Windows, as gcc does not guarantee the stack alignment required by AVX
+#if defined(ARMA_USE_SIMD_DISPATCH)
+  #if !( (defined(__x86_64__) || defined(__amd64__)) && (defined(ARMA_REAL_GCC) || (defined(__clang__) && !defined(ARMA_DETECTED_FAKE_CLANG))) )
+    #undef ARMA_USE_SIMD_DISPATCH
+  #endif
+  
+  #if (defined(_WIN32) || defined(__CYGWIN__) || defined(__OPTIMIZE_SIZE__))
+    #undef ARMA_USE_SIMD_DISPATCH
+  #endif
+#endif
+
+
 #if (defined(__FAST_MATH__) || (defined(__FINITE_MATH_ONLY__) && (__FINITE_MATH_ONLY__ > 0)) || defined(_M_FP_FAST))
   #undef  ARMA_FAST_MATH
   #define ARMA_FAST_MATH
 #endif
 
 
+// the SIMD elementary functions rely on the exact rounding of each operation, which is not preserved in fast math mode
+#if defined(ARMA_USE_SIMD_MATH) && (!defined(ARMA_USE_SIMD_DISPATCH) || defined(ARMA_FAST_MATH))
+  #undef ARMA_USE_SIMD_MATH
+#endif
+
+
 #if defined(ARMA_FAST_MATH) && !defined(ARMA_DONT_PRINT_FAST_MATH_WARNING)
   #pragma message ("WARNING: compiler is in fast math mode; some functions may be unreliable.")
   #pragma message ("WARNING: to suppress this warning and related warnings,")
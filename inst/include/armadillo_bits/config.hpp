@@ -177,6 +177,31 @@
   //// Comment out the above line to disable optimised handling of pow()
 #endif
 
+#if !defined(ARMA_USE_SIMD_DISPATCH)
+// #define ARMA_USE_SIMD_DISPATCH
+//// Uncomment the above line to enable explicit SIMD kernels (SSE2, AVX2, AVX-512) for element-wise operations;
+//// the instruction set is selected at run time, based on the capabilities of the CPU.
+//// The kernels are only used on x86-64 systems with gcc or clang, and require the <immintrin.h> header.
+#endif
+
+#if !defined(ARMA_USE_SIMD_MATH)
+// #define ARMA_USE_SIMD_MATH
+//// Uncomment the above line to evaluate exp(), log(), pow(), sin(), cos(), tanh(), erf(), erfc() and related functions
+//// with SIMD kernels, instead of the functions from the standard library (libm).
+//// The SIMD kernels require ARMA_USE_SIMD_DISPATCH.
+//// The results can differ from those of glibc by up to 6 ULP for erfc(), and by up to 2 ULP for erf(), tanh() and log10();
+//// see eop_simd_meat.hpp for details on the accuracy.
+#endif
+
+#if !defined(ARMA_USE_MIXED_SOLVE)
+// #define ARMA_USE_MIXED_SOLVE
+//// Uncomment the above line to enable the mixed precision solver of solve() (option solve_opts::mixed_precision),
+//// which factorises in single precision and refines the solution in double precision.
+//// The solver uses the single precision LAPACK functions (eg. sgetrf, sgetrs, spotrf, spotrs),
+//// which are not provided by all LAPACK libraries (eg. the reference LAPACK subset bundled with R).
+//// If this is disabled, the option is ignored and the system is solved in double precision.
+#endif
+
 #if !defined(ARMA_CHECK_CONFORMANCE)
   #define ARMA_CHECK_CONFORMANCE
   //// Comment out the above line to disable conformance checks for bounds and size.
@@ -330,6 +355,14 @@
   #undef ARMA_OPTIMISE_POWEXPR
 #endif
 
+#if defined(ARMA_DONT_USE_SIMD_DISPATCH)
+  #undef ARMA_USE_SIMD_DISPATCH
+#endif
+
+#if defined(ARMA_DONT_USE_SIMD_MATH)
+  #undef ARMA_USE_SIMD_MATH
+#endif
+
 #if defined(ARMA_NO_DEBUG)
   #undef ARMA_DEBUG
   #undef ARMA_EXTRA_DEBUG
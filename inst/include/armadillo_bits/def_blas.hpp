@@ -61,6 +61,24 @@
   #define arma_cherk cherk
   #define arma_zherk zherk
   
+  #define arma_strsm strsm
+  #define arma_dtrsm dtrsm
+  #define arma_ctrsm ctrsm
+  #define arma_ztrsm ztrsm
+  
+  #define arma_strmm strmm
+  #define arma_dtrmm dtrmm
+  #define arma_ctrmm ctrmm
+  #define arma_ztrmm ztrmm
+  
+  #define arma_ssymm ssymm
+  #define arma_dsymm dsymm
+  #define arma_csymm csymm
+  #define arma_zsymm zsymm
+  
+  #define arma_chemm chemm
+  #define arma_zhemm zhemm
+  
 #else
   
   #define arma_sasum SASUM
@@ -88,6 +106,24 @@
   #define arma_cherk CHERK
   #define arma_zherk ZHERK
   
+  #define arma_strsm STRSM
+  #define arma_dtrsm DTRSM
+  #define arma_ctrsm CTRSM
+  #define arma_ztrsm ZTRSM
+  
+  #define arma_strmm STRMM
+  #define arma_dtrmm DTRMM
+  #define arma_ctrmm CTRMM
+  #define arma_ztrmm ZTRMM
+  
+  #define arma_ssymm SSYMM
+  #define arma_dsymm DSYMM
+  #define arma_csymm CSYMM
+  #define arma_zsymm ZSYMM
+  
+  #define arma_chemm CHEMM
+  #define arma_zhemm ZHEMM
+  
 #endif
 
 
@@ -124,6 +160,24 @@ extern "C"
   void arma_fortran(arma_cherk)(const char* uplo, const char* transA, const blas_int* n, const blas_int* k, const  float* alpha, const blas_cxf* A, const blas_int* ldA, const  float* beta, blas_cxf* C, const blas_int* ldC, blas_len uplo_len, blas_len transA_len) ARMA_NOEXCEPT;
   void arma_fortran(arma_zherk)(const char* uplo, const char* transA, const blas_int* n, const blas_int* k, const double* alpha, const blas_cxd* A, const blas_int* ldA, const double* beta, blas_cxd* C, const blas_int* ldC, blas_len uplo_len, blas_len transA_len) ARMA_NOEXCEPT;
   
+  void arma_fortran(arma_strsm)(const char* side, const char* uplo, const char* transA, const char* diag, const blas_int* m, const blas_int* n, const float*    alpha, const float*    A, const blas_int* ldA, float*    B, const blas_int* ldB, blas_len side_len, blas_len uplo_len, blas_len transA_len, blas_len diag_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_dtrsm)(const char* side, const char* uplo, const char* transA, const char* diag, const blas_int* m, const blas_int* n, const double*   alpha, const double*   A, const blas_int* ldA, double*   B, const blas_int* ldB, blas_len side_len, blas_len uplo_len, blas_len transA_len, blas_len diag_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_ctrsm)(const char* side, const char* uplo, const char* transA, const char* diag, const blas_int* m, const blas_int* n, const blas_cxf* alpha, const blas_cxf* A, const blas_int* ldA, blas_cxf* B, const blas_int* ldB, blas_len side_len, blas_len uplo_len, blas_len transA_len, blas_len diag_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_ztrsm)(const char* side, const char* uplo, const char* transA, const char* diag, const blas_int* m, const blas_int* n, const blas_cxd* alpha, const blas_cxd* A, const blas_int* ldA, blas_cxd* B, const blas_int* ldB, blas_len side_len, blas_len uplo_len, blas_len transA_len, blas_len diag_len) ARMA_NOEXCEPT;
+  
+  void arma_fortran(arma_strmm)(const char* side, const char* uplo, const char* transA, const char* diag, const blas_int* m, const blas_int* n, const float*    alpha, const float*    A, const blas_int* ldA, float*    B, const blas_int* ldB, blas_len side_len, blas_len uplo_len, blas_len transA_len, blas_len diag_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_dtrmm)(const char* side, const char* uplo, const char* transA, const char* diag, const blas_int* m, const blas_int* n, const double*   alpha, const double*   A, const blas_int* ldA, double*   B, const blas_int* ldB, blas_len side_len, blas_len uplo_len, blas_len transA_len, blas_len diag_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_ctrmm)(const char* side, const char* uplo, const char* transA, const char* diag, const blas_int* m, const blas_int* n, const blas_cxf* alpha, const blas_cxf* A, const blas_int* ldA, blas_cxf* B, const blas_int* ldB, blas_len side_len, blas_len uplo_len, blas_len transA_len, blas_len diag_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_ztrmm)(const char* side, const char* uplo, const char* transA, const char* diag, const blas_int* m, const blas_int* n, const blas_cxd* alpha, const blas_cxd* A, const blas_int* ldA, blas_cxd* B, const blas_int* ldB, blas_len side_len, blas_len uplo_len, blas_len transA_len, blas_len diag_len) ARMA_NOEXCEPT;
+  
+  void arma_fortran(arma_ssymm)(const char* side, const char* uplo, const blas_int* m, const blas_int* n, const float*    alpha, const float*    A, const blas_int* ldA, const float*    B, const blas_int* ldB, const float*    beta, float*    C, const blas_int* ldC, blas_len side_len, blas_len uplo_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_dsymm)(const char* side, const char* uplo, const blas_int* m, const blas_int* n, const double*   alpha, const double*   A, const blas_int* ldA, const double*   B, const blas_int* ldB, const double*   beta, double*   C, const blas_int* ldC, blas_len side_len, blas_len uplo_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_csymm)(const char* side, const char* uplo, const blas_int* m, const blas_int* n, const blas_cxf* alpha, const blas_cxf* A, const blas_int* ldA, const blas_cxf* B, const blas_int* ldB, const blas_cxf* beta, blas_cxf* C, const blas_int* ldC, blas_len side_len, blas_len uplo_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_zsymm)(const char* side, const char* uplo, const blas_int* m, const blas_int* n, const blas_cxd* alpha, const blas_cxd* A, const blas_int* ldA, const blas_cxd* B, const blas_int* ldB, const blas_cxd* beta, blas_cxd* C, const blas_int* ldC, blas_len side_len, blas_len uplo_len) ARMA_NOEXCEPT;
+  
+  void arma_fortran(arma_chemm)(const char* side, const char* uplo, const blas_int* m, const blas_int* n, const blas_cxf* alpha, const blas_cxf* A, const blas_int* ldA, const blas_cxf* B, const blas_int* ldB, const blas_cxf* beta, blas_cxf* C, const blas_int* ldC, blas_len side_len, blas_len uplo_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_zhemm)(const char* side, const char* uplo, const blas_int* m, const blas_int* n, const blas_cxd* alpha, const blas_cxd* A, const blas_int* ldA, const blas_cxd* B, const blas_int* ldB, const blas_cxd* beta, blas_cxd* C, const blas_int* ldC, blas_len side_len, blas_len uplo_len) ARMA_NOEXCEPT;
+  
 #else
   
   // prototypes without hidden arguments
@@ -153,6 +207,24 @@ extern "C"
   void arma_fortran(arma_cherk)(const char* uplo, const char* transA, const blas_int* n, const blas_int* k, const  float* alpha, const  blas_cxf* A, const blas_int* ldA, const  float* beta, blas_cxf* C, const blas_int* ldC) ARMA_NOEXCEPT;
   void arma_fortran(arma_zherk)(const char* uplo, const char* transA, const blas_int* n, const blas_int* k, const double* alpha, const  blas_cxd* A, const blas_int* ldA, const double* beta, blas_cxd* C, const blas_int* ldC) ARMA_NOEXCEPT;
   
+  void arma_fortran(arma_strsm)(const char* side, const char* uplo, const char* transA, const char* diag, const blas_int* m, const blas_int* n, const float*    alpha, const float*    A, const blas_int* ldA, float*    B, const blas_int* ldB) ARMA_NOEXCEPT;
+  void arma_fortran(arma_dtrsm)(const char* side, const char* uplo, const char* transA, const char* diag, const blas_int* m, const blas_int* n, const double*   alpha, const double*   A, const blas_int* ldA, double*   B, const blas_int* ldB) ARMA_NOEXCEPT;
+  void arma_fortran(arma_ctrsm)(const char* side, const char* uplo, const char* transA, const char* diag, const blas_int* m, const blas_int* n, const blas_cxf* alpha, const blas_cxf* A, const blas_int* ldA, blas_cxf* B, const blas_int* ldB) ARMA_NOEXCEPT;
+  void arma_fortran(arma_ztrsm)(const char* side, const char* uplo, const char* transA, const char* diag, const blas_int* m, const blas_int* n, const blas_cxd* alpha, const blas_cxd* A, const blas_int* ldA, blas_cxd* B, const blas_int* ldB) ARMA_NOEXCEPT;
+  
+  void arma_fortran(arma_strmm)(const char* side, const char* uplo, const char* transA, const char* diag, const blas_int* m, const blas_int* n, const float*    alpha, const float*    A, const blas_int* ldA, float*    B, const blas_int* ldB) ARMA_NOEXCEPT;
+  void arma_fortran(arma_dtrmm)(const char* side, const char* uplo, const char* transA, const char* diag, const blas_int* m, const blas_int* n, const double*   alpha, const double*   A, const blas_int* ldA, double*   B, const blas_int* ldB) ARMA_NOEXCEPT;
+  void arma_fortran(arma_ctrmm)(const char* side, const char* uplo, const char* transA, const char* diag, const blas_int* m, const blas_int* n, const blas_cxf* alpha, const blas_cxf* A, const blas_int* ldA, blas_cxf* B, const blas_int* ldB) ARMA_NOEXCEPT;
+  void arma_fortran(arma_ztrmm)(const char* side, const char* uplo, const char* transA, const char* diag, const blas_int* m, const blas_int* n, const blas_cxd* alpha, const blas_cxd* A, const blas_int* ldA, blas_cxd* B, const blas_int* ldB) ARMA_NOEXCEPT;
+  
+  void arma_fortran(arma_ssymm)(const char* side, const char* uplo, const blas_int* m, const blas_int* n, const float*    alpha, const float*    A, const blas_int* ldA, const float*    B, const blas_int* ldB, const float*    beta, float*    C, const blas_int* ldC) ARMA_NOEXCEPT;
+  void arma_fortran(arma_dsymm)(const char* side, const char* uplo, const blas_int* m, const blas_int* n, const double*   alpha, const double*   A, const blas_int* ldA, const double*   B, const blas_int* ldB, const double*   beta, double*   C, const blas_int* ldC) ARMA_NOEXCEPT;
+  void arma_fortran(arma_csymm)(const char* side, const char* uplo, const blas_int* m, const blas_int* n, const blas_cxf* alpha, const blas_cxf* A, const blas_int* ldA, const blas_cxf* B, const blas_int* ldB, const blas_cxf* beta, blas_cxf* C, const blas_int* ldC) ARMA_NOEXCEPT;
+  void arma_fortran(arma_zsymm)(const char* side, const char* uplo, const blas_int* m, const blas_int* n, const blas_cxd* alpha, const blas_cxd* A, const blas_int* ldA, const blas_cxd* B, const blas_int* ldB, const blas_cxd* beta, blas_cxd* C, const blas_int* ldC) ARMA_NOEXCEPT;
+  
+  void arma_fortran(arma_chemm)(const char* side, const char* uplo, const blas_int* m, const blas_int* n, const blas_cxf* alpha, const blas_cxf* A, const blas_int* ldA, const blas_cxf* B, const blas_int* ldB, const blas_cxf* beta, blas_cxf* C, const blas_int* ldC) ARMA_NOEXCEPT;
+  void arma_fortran(arma_zhemm)(const char* side, const char* uplo, const blas_int* m, const blas_int* n, const blas_cxd* alpha, const blas_cxd* A, const blas_int* ldA, const blas_cxd* B, const blas_int* ldB, const blas_cxd* beta, blas_cxd* C, const blas_int* ldC) ARMA_NOEXCEPT;
+  
 #endif
 }
 
@@ -37,6 +37,7 @@ extern "C"
   fftwf_plan fftwf_plan_dft_1d(int N, fftwf_complex* input, fftwf_complex* output, int fftw3_sign, unsigned int fftw3_flags);
   
   void      fftwf_execute(fftwf_plan plan);
+  void      fftwf_execute_dft(fftwf_plan plan, fftwf_complex* input, fftwf_complex* output);
   void fftwf_destroy_plan(fftwf_plan plan);
   
   void fftwf_cleanup();
@@ -47,6 +48,7 @@ extern "C"
   fftw_plan fftw_plan_dft_1d(int N, fftw_complex* input, fftw_complex* output, int fftw3_sign, unsigned int fftw3_flags);
   
   void      fftw_execute(fftw_plan plan);
+  void      fftw_execute_dft(fftw_plan plan, fftw_complex* input, fftw_complex* output);
   void fftw_destroy_plan(fftw_plan plan);
   
   void fftw_cleanup();
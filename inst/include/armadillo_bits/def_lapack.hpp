@@ -77,6 +77,18 @@
   #define arma_cheevd cheevd
   #define arma_zheevd zheevd
   
+  #define arma_ssyevr ssyevr
+  #define arma_dsyevr dsyevr
+  
+  #define arma_cheevr cheevr
+  #define arma_zheevr zheevr
+  
+  #define arma_ssyevx ssyevx
+  #define arma_dsyevx dsyevx
+  
+  #define arma_cheevx cheevx
+  #define arma_zheevx zheevx
+  
   #define arma_sggev  sggev
   #define arma_dggev  dggev
   
@@ -130,6 +142,11 @@
   #define arma_cgesdd cgesdd
   #define arma_zgesdd zgesdd
   
+  #define arma_sgesvdx sgesvdx
+  #define arma_dgesvdx dgesvdx
+  #define arma_cgesvdx cgesvdx
+  #define arma_zgesvdx zgesvdx
+  
   #define arma_sgesv  sgesv
   #define arma_dgesv  dgesv
   #define arma_cgesv  cgesv
@@ -342,6 +359,18 @@
   #define arma_cheevd CHEEVD
   #define arma_zheevd ZHEEVD
   
+  #define arma_ssyevr SSYEVR
+  #define arma_dsyevr DSYEVR
+  
+  #define arma_cheevr CHEEVR
+  #define arma_zheevr ZHEEVR
+  
+  #define arma_ssyevx SSYEVX
+  #define arma_dsyevx DSYEVX
+  
+  #define arma_cheevx CHEEVX
+  #define arma_zheevx ZHEEVX
+  
   #define arma_sggev  SGGEV
   #define arma_dggev  DGGEV
   
@@ -395,6 +424,11 @@
   #define arma_cgesdd CGESDD
   #define arma_zgesdd ZGESDD
   
+  #define arma_sgesvdx SGESVDX
+  #define arma_dgesvdx DGESVDX
+  #define arma_cgesvdx CGESVDX
+  #define arma_zgesvdx ZGESVDX
+  
   #define arma_sgesv  SGESV
   #define arma_dgesv  DGESV
   #define arma_cgesv  CGESV
@@ -643,6 +677,22 @@ extern "C"
   void arma_fortran(arma_cheevd)(const char* jobz, const char* uplo, const blas_int* n, blas_cxf* a, const blas_int* lda,  float* w, blas_cxf* work, const blas_int* lwork,  float* rwork, const blas_int* lrwork, blas_int* iwork, const blas_int* liwork, blas_int* info, blas_len jobz_len, blas_len uplo_len) ARMA_NOEXCEPT;
   void arma_fortran(arma_zheevd)(const char* jobz, const char* uplo, const blas_int* n, blas_cxd* a, const blas_int* lda, double* w, blas_cxd* work, const blas_int* lwork, double* rwork, const blas_int* lrwork, blas_int* iwork, const blas_int* liwork, blas_int* info, blas_len jobz_len, blas_len uplo_len) ARMA_NOEXCEPT;
   
+  // eigen decomposition of symmetric real matrices, subset of eigenvalues selected by index or value range (relatively robust representations)
+  void arma_fortran(arma_ssyevr)(const char* jobz, const char* range, const char* uplo, const blas_int* n,  float* a, const blas_int* lda, const  float* vl, const  float* vu, const blas_int* il, const blas_int* iu, const  float* abstol, blas_int* m,  float* w,  float* z, const blas_int* ldz, blas_int* isuppz,  float* work, const blas_int* lwork, blas_int* iwork, const blas_int* liwork, blas_int* info, blas_len jobz_len, blas_len range_len, blas_len uplo_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_dsyevr)(const char* jobz, const char* range, const char* uplo, const blas_int* n, double* a, const blas_int* lda, const double* vl, const double* vu, const blas_int* il, const blas_int* iu, const double* abstol, blas_int* m, double* w, double* z, const blas_int* ldz, blas_int* isuppz, double* work, const blas_int* lwork, blas_int* iwork, const blas_int* liwork, blas_int* info, blas_len jobz_len, blas_len range_len, blas_len uplo_len) ARMA_NOEXCEPT;
+  
+  // eigen decomposition of hermitian matrices (complex), subset of eigenvalues selected by index or value range (relatively robust representations)
+  void arma_fortran(arma_cheevr)(const char* jobz, const char* range, const char* uplo, const blas_int* n, blas_cxf* a, const blas_int* lda, const  float* vl, const  float* vu, const blas_int* il, const blas_int* iu, const  float* abstol, blas_int* m,  float* w, blas_cxf* z, const blas_int* ldz, blas_int* isuppz, blas_cxf* work, const blas_int* lwork,  float* rwork, const blas_int* lrwork, blas_int* iwork, const blas_int* liwork, blas_int* info, blas_len jobz_len, blas_len range_len, blas_len uplo_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_zheevr)(const char* jobz, const char* range, const char* uplo, const blas_int* n, blas_cxd* a, const blas_int* lda, const double* vl, const double* vu, const blas_int* il, const blas_int* iu, const double* abstol, blas_int* m, double* w, blas_cxd* z, const blas_int* ldz, blas_int* isuppz, blas_cxd* work, const blas_int* lwork, double* rwork, const blas_int* lrwork, blas_int* iwork, const blas_int* liwork, blas_int* info, blas_len jobz_len, blas_len range_len, blas_len uplo_len) ARMA_NOEXCEPT;
+  
+  // eigen decomposition of symmetric real matrices, subset of eigenvalues selected by index or value range (bisection and inverse iteration)
+  void arma_fortran(arma_ssyevx)(const char* jobz, const char* range, const char* uplo, const blas_int* n,  float* a, const blas_int* lda, const  float* vl, const  float* vu, const blas_int* il, const blas_int* iu, const  float* abstol, blas_int* m,  float* w,  float* z, const blas_int* ldz,  float* work, const blas_int* lwork, blas_int* iwork, blas_int* ifail, blas_int* info, blas_len jobz_len, blas_len range_len, blas_len uplo_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_dsyevx)(const char* jobz, const char* range, const char* uplo, const blas_int* n, double* a, const blas_int* lda, const double* vl, const double* vu, const blas_int* il, const blas_int* iu, const double* abstol, blas_int* m, double* w, double* z, const blas_int* ldz, double* work, const blas_int* lwork, blas_int* iwork, blas_int* ifail, blas_int* info, blas_len jobz_len, blas_len range_len, blas_len uplo_len) ARMA_NOEXCEPT;
+  
+  // eigen decomposition of hermitian matrices (complex), subset of eigenvalues selected by index or value range (bisection and inverse iteration)
+  void arma_fortran(arma_cheevx)(const char* jobz, const char* range, const char* uplo, const blas_int* n, blas_cxf* a, const blas_int* lda, const  float* vl, const  float* vu, const blas_int* il, const blas_int* iu, const  float* abstol, blas_int* m,  float* w, blas_cxf* z, const blas_int* ldz, blas_cxf* work, const blas_int* lwork,  float* rwork, blas_int* iwork, blas_int* ifail, blas_int* info, blas_len jobz_len, blas_len range_len, blas_len uplo_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_zheevx)(const char* jobz, const char* range, const char* uplo, const blas_int* n, blas_cxd* a, const blas_int* lda, const double* vl, const double* vu, const blas_int* il, const blas_int* iu, const double* abstol, blas_int* m, double* w, blas_cxd* z, const blas_int* ldz, blas_cxd* work, const blas_int* lwork, double* rwork, blas_int* iwork, blas_int* ifail, blas_int* info, blas_len jobz_len, blas_len range_len, blas_len uplo_len) ARMA_NOEXCEPT;
+  
   // eigen decomposition of general real matrix pair
   void arma_fortran(arma_sggev)(const char* jobvl, const char* jobvr, const blas_int* n,  float* a, const blas_int* lda,  float* b, const blas_int* ldb,  float* alphar,  float* alphai,  float* beta,  float* vl, const blas_int* ldvl,  float* vr, const blas_int* ldvr,  float* work, const blas_int* lwork, blas_int* info, blas_len jobvl_len, blas_len jobvr_len) ARMA_NOEXCEPT;
   void arma_fortran(arma_dggev)(const char* jobvl, const char* jobvr, const blas_int* n, double* a, const blas_int* lda, double* b, const blas_int* ldb, double* alphar, double* alphai, double* beta, double* vl, const blas_int* ldvl, double* vr, const blas_int* ldvr, double* work, const blas_int* lwork, blas_int* info, blas_len jobvl_len, blas_len jobvr_len) ARMA_NOEXCEPT;
@@ -713,6 +763,14 @@ extern "C"
   void arma_fortran(arma_cgesdd)(const char* jobz, const blas_int* m, const blas_int* n, blas_cxf* a, const blas_int* lda,  float* s, blas_cxf* u, const blas_int* ldu, blas_cxf* vt, const blas_int* ldvt, blas_cxf* work, const blas_int* lwork,  float* rwork, blas_int* iwork, blas_int* info, blas_len jobz_len) ARMA_NOEXCEPT;
   void arma_fortran(arma_zgesdd)(const char* jobz, const blas_int* m, const blas_int* n, blas_cxd* a, const blas_int* lda, double* s, blas_cxd* u, const blas_int* ldu, blas_cxd* vt, const blas_int* ldvt, blas_cxd* work, const blas_int* lwork, double* rwork, blas_int* iwork, blas_int* info, blas_len jobz_len) ARMA_NOEXCEPT;
   
+  // SVD (real matrices), subset of singular values selected by index or value range
+  void arma_fortran(arma_sgesvdx)(const char* jobu, const char* jobvt, const char* range, const blas_int* m, const blas_int* n,  float* a, const blas_int* lda, const  float* vl, const  float* vu, const blas_int* il, const blas_int* iu, blas_int* ns,  float* s,  float* u, const blas_int* ldu,  float* vt, const blas_int* ldvt,  float* work, const blas_int* lwork, blas_int* iwork, blas_int* info, blas_len jobu_len, blas_len jobvt_len, blas_len range_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_dgesvdx)(const char* jobu, const char* jobvt, const char* range, const blas_int* m, const blas_int* n, double* a, const blas_int* lda, const double* vl, const double* vu, const blas_int* il, const blas_int* iu, blas_int* ns, double* s, double* u, const blas_int* ldu, double* vt, const blas_int* ldvt, double* work, const blas_int* lwork, blas_int* iwork, blas_int* info, blas_len jobu_len, blas_len jobvt_len, blas_len range_len) ARMA_NOEXCEPT;
+  
+  // SVD (complex matrices), subset of singular values selected by index or value range
+  void arma_fortran(arma_cgesvdx)(const char* jobu, const char* jobvt, const char* range, const blas_int* m, const blas_int* n, blas_cxf* a, const blas_int* lda, const  float* vl, const  float* vu, const blas_int* il, const blas_int* iu, blas_int* ns,  float* s, blas_cxf* u, const blas_int* ldu, blas_cxf* vt, const blas_int* ldvt, blas_cxf* work, const blas_int* lwork,  float* rwork, blas_int* iwork, blas_int* info, blas_len jobu_len, blas_len jobvt_len, blas_len range_len) ARMA_NOEXCEPT;
+  void arma_fortran(arma_zgesvdx)(const char* jobu, const char* jobvt, const char* range, const blas_int* m, const blas_int* n, blas_cxd* a, const blas_int* lda, const double* vl, const double* vu, const blas_int* il, const blas_int* iu, blas_int* ns, double* s, blas_cxd* u, const blas_int* ldu, blas_cxd* vt, const blas_int* ldvt, blas_cxd* work, const blas_int* lwork, double* rwork, blas_int* iwork, blas_int* info, blas_len jobu_len, blas_len jobvt_len, blas_len range_len) ARMA_NOEXCEPT;
+  
   // solve system of linear equations (general square matrix)
   void arma_fortran(arma_sgesv)(const blas_int* n, const blas_int* nrhs,    float* a, const blas_int* lda, blas_int* ipiv,    float* b, const blas_int* ldb, blas_int* info) ARMA_NOEXCEPT;
   void arma_fortran(arma_dgesv)(const blas_int* n, const blas_int* nrhs,   double* a, const blas_int* lda, blas_int* ipiv,   double* b, const blas_int* ldb, blas_int* info) ARMA_NOEXCEPT;
@@ -1002,6 +1060,22 @@ extern "C"
   void arma_fortran(arma_cheevd)(const char* jobz, const char* uplo, const blas_int* n, blas_cxf* a, const blas_int* lda,  float* w, blas_cxf* work, const blas_int* lwork,  float* rwork, const blas_int* lrwork, blas_int* iwork, const blas_int* liwork, blas_int* info) ARMA_NOEXCEPT;
   void arma_fortran(arma_zheevd)(const char* jobz, const char* uplo, const blas_int* n, blas_cxd* a, const blas_int* lda, double* w, blas_cxd* work, const blas_int* lwork, double* rwork, const blas_int* lrwork, blas_int* iwork, const blas_int* liwork, blas_int* info) ARMA_NOEXCEPT;
   
+  // eigen decomposition of symmetric real matrices, subset of eigenvalues selected by index or value range (relatively robust representations)
+  void arma_fortran(arma_ssyevr)(const char* jobz, const char* range, const char* uplo, const blas_int* n,  float* a, const blas_int* lda, const  float* vl, const  float* vu, const blas_int* il, const blas_int* iu, const  float* abstol, blas_int* m,  float* w,  float* z, const blas_int* ldz, blas_int* isuppz,  float* work, const blas_int* lwork, blas_int* iwork, const blas_int* liwork, blas_int* info) ARMA_NOEXCEPT;
+  void arma_fortran(arma_dsyevr)(const char* jobz, const char* range, const char* uplo, const blas_int* n, double* a, const blas_int* lda, const double* vl, const double* vu, const blas_int* il, const blas_int* iu, const double* abstol, blas_int* m, double* w, double* z, const blas_int* ldz, blas_int* isuppz, double* work, const blas_int* lwork, blas_int* iwork, const blas_int* liwork, blas_int* info) ARMA_NOEXCEPT;
+  
+  // eigen decomposition of hermitian matrices (complex), subset of eigenvalues selected by index or value range (relatively robust representations)
+  void arma_fortran(arma_cheevr)(const char* jobz, const char* range, const char* uplo, const blas_int* n, blas_cxf* a, const blas_int* lda, const  float* vl, const  float* vu, const blas_int* il, const blas_int* iu, const  float* abstol, blas_int* m,  float* w, blas_cxf* z, const blas_int* ldz, blas_int* isuppz, blas_cxf* work, const blas_int* lwork,  float* rwork, const blas_int* lrwork, blas_int* iwork, const blas_int* liwork, blas_int* info) ARMA_NOEXCEPT;
+  void arma_fortran(arma_zheevr)(const char* jobz, const char* range, const char* uplo, const blas_int* n, blas_cxd* a, const blas_int* lda, const double* vl, const double* vu, const blas_int* il, const blas_int* iu, const double* abstol, blas_int* m, double* w, blas_cxd* z, const blas_int* ldz, blas_int* isuppz, blas_cxd* work, const blas_int* lwork, double* rwork, const blas_int* lrwork, blas_int* iwork, const blas_int* liwork, blas_int* info) ARMA_NOEXCEPT;
+  
+  // eigen decomposition of symmetric real matrices, subset of eigenvalues selected by index or value range (bisection and inverse iteration)
+  void arma_fortran(arma_ssyevx)(const char* jobz, const char* range, const char* uplo, const blas_int* n,  float* a, const blas_int* lda, const  float* vl, const  float* vu, const blas_int* il, const blas_int* iu, const  float* abstol, blas_int* m,  float* w,  float* z, const blas_int* ldz,  float* work, const blas_int* lwork, blas_int* iwork, blas_int* ifail, blas_int* info) ARMA_NOEXCEPT;
+  void arma_fortran(arma_dsyevx)(const char* jobz, const char* range, const char* uplo, const blas_int* n, double* a, const blas_int* lda, const double* vl, const double* vu, const blas_int* il, const blas_int* iu, const double* abstol, blas_int* m, double* w, double* z, const blas_int* ldz, double* work, const blas_int* lwork, blas_int* iwork, blas_int* ifail, blas_int* info) ARMA_NOEXCEPT;
+  
+  // eigen decomposition of hermitian matrices (complex), subset of eigenvalues selected by index or value range (bisection and inverse iteration)
+  void arma_fortran(arma_cheevx)(const char* jobz, const char* range, const char* uplo, const blas_int* n, blas_cxf* a, const blas_int* lda, const  float* vl, const  float* vu, const blas_int* il, const blas_int* iu, const  float* abstol, blas_int* m,  float* w, blas_cxf* z, const blas_int* ldz, blas_cxf* work, const blas_int* lwork,  float* rwork, blas_int* iwork, blas_int* ifail, blas_int* info) ARMA_NOEXCEPT;
+  void arma_fortran(arma_zheevx)(const char* jobz, const char* range, const char* uplo, const blas_int* n, blas_cxd* a, const blas_int* lda, const double* vl, const double* vu, const blas_int* il, const blas_int* iu, const double* abstol, blas_int* m, double* w, blas_cxd* z, const blas_int* ldz, blas_cxd* work, const blas_int* lwork, double* rwork, blas_int* iwork, blas_int* ifail, blas_int* info) ARMA_NOEXCEPT;
+  
   // eigen decomposition of general real matrix pair
   void arma_fortran(arma_sggev)(const char* jobvl, const char* jobvr, const blas_int* n,  float* a, const blas_int* lda,  float* b, const blas_int* ldb,  float* alphar,  float* alphai,  float* beta,  float* vl, const blas_int* ldvl,  float* vr, const blas_int* ldvr,  float* work, const blas_int* lwork, blas_int* info) ARMA_NOEXCEPT;
   void arma_fortran(arma_dggev)(const char* jobvl, const char* jobvr, const blas_int* n, double* a, const blas_int* lda, double* b, const blas_int* ldb, double* alphar, double* alphai, double* beta, double* vl, const blas_int* ldvl, double* vr, const blas_int* ldvr, double* work, const blas_int* lwork, blas_int* info) ARMA_NOEXCEPT;
@@ -1072,6 +1146,14 @@ extern "C"
   void arma_fortran(arma_cgesdd)(const char* jobz, const blas_int* m, const blas_int* n, blas_cxf* a, const blas_int* lda,  float* s, blas_cxf* u, const blas_int* ldu, blas_cxf* vt, const blas_int* ldvt, blas_cxf* work, const blas_int* lwork,  float* rwork, blas_int* iwork, blas_int* info) ARMA_NOEXCEPT;
   void arma_fortran(arma_zgesdd)(const char* jobz, const blas_int* m, const blas_int* n, blas_cxd* a, const blas_int* lda, double* s, blas_cxd* u, const blas_int* ldu, blas_cxd* vt, const blas_int* ldvt, blas_cxd* work, const blas_int* lwork, double* rwork, blas_int* iwork, blas_int* info) ARMA_NOEXCEPT;
   
+  // SVD (real matrices), subset of singular values selected by index or value range
+  void arma_fortran(arma_sgesvdx)(const char* jobu, const char* jobvt, const char* range, const blas_int* m, const blas_int* n,  float* a, const blas_int* lda, const  float* vl, const  float* vu, const blas_int* il, const blas_int* iu, blas_int* ns,  float* s,  float* u, const blas_int* ldu,  float* vt, const blas_int* ldvt,  float* work, const blas_int* lwork, blas_int* iwork, blas_int* info) ARMA_NOEXCEPT;
+  void arma_fortran(arma_dgesvdx)(const char* jobu, const char* jobvt, const char* range, const blas_int* m, const blas_int* n, double* a, const blas_int* lda, const double* vl, const double* vu, const blas_int* il, const blas_int* iu, blas_int* ns, double* s, double* u, const blas_int* ldu, double* vt, const blas_int* ldvt, double* work, const blas_int* lwork, blas_int* iwork, blas_int* info) ARMA_NOEXCEPT;
+  
+  // SVD (complex matrices), subset of singular values selected by index or value range
+  void arma_fortran(arma_cgesvdx)(const char* jobu, const char* jobvt, const char* range, const blas_int* m, const blas_int* n, blas_cxf* a, const blas_int* lda, const  float* vl, const  float* vu, const blas_int* il, const blas_int* iu, blas_int* ns,  float* s, blas_cxf* u, const blas_int* ldu, blas_cxf* vt, const blas_int* ldvt, blas_cxf* work, const blas_int* lwork,  float* rwork, blas_int* iwork, blas_int* info) ARMA_NOEXCEPT;
+  void arma_fortran(arma_zgesvdx)(const char* jobu, const char* jobvt, const char* range, const blas_int* m, const blas_int* n, blas_cxd* a, const blas_int* lda, const double* vl, const double* vu, const blas_int* il, const blas_int* iu, blas_int* ns, double* s, blas_cxd* u, const blas_int* ldu, blas_cxd* vt, const blas_int* ldvt, blas_cxd* work, const blas_int* lwork, double* rwork, blas_int* iwork, blas_int* info) ARMA_NOEXCEPT;
+  
   // solve system of linear equations (general square matrix)
   void arma_fortran(arma_sgesv)(const blas_int* n, const blas_int* nrhs,    float* a, const blas_int* lda, blas_int* ipiv,    float* b, const blas_int* ldb, blas_int* info) ARMA_NOEXCEPT;
   void arma_fortran(arma_dgesv)(const blas_int* n, const blas_int* nrhs,   double* a, const blas_int* lda, blas_int* ipiv,   double* b, const blas_int* ldb, blas_int* info) ARMA_NOEXCEPT;
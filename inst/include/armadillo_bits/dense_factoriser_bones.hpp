@@ -0,0 +1,173 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 The RcppArmadillo Authors
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup dense_factoriser
+//! @{
+
+
+
+//! holds a dense Cholesky, LU or QR factorisation, as produced by LAPACK
+template<typename eT>
+struct dense_factoriser_worker
+  {
+  typedef typename get_pod_type<eT>::result T;
+  
+  static constexpr uword kind_chol = 1;
+  static constexpr uword kind_lu   = 2;
+  static constexpr uword kind_qr   = 3;
+  
+  uword              kind      = 0;
+  bool               qr_trans  = false;  // QR: the factorisation is of A' rather than A; used for wide matrices
+  Mat<eT>            F;                  // Cholesky: lower triangular L, with A = L*L'; LU: L and U as packed by getrf(); QR: upper triangular R
+  Mat<eT>            Q;                  // QR: orthonormal columns, with A = Q*R (or A' = Q*R)
+  Mat<eT>            A_chol;             // Cholesky: copy of A, kept current by update_chol() so that rcond() uses the exact norm of A
+  podarray<blas_int> ipiv;               // LU: row interchanges
+  eT                 Q_det     = eT(1);  // QR: determinant of Q, for square matrices
+  T                  rcond_val = T(0);
+  
+  inline bool factorise_chol(const Mat<eT>& A);
+  inline bool factorise_lu  (const Mat<eT>& A);
+  inline bool factorise_qr  (const Mat<eT>& A);
+  
+  inline bool update_chol(const Mat<eT>& V, const bool downdate);
+  inline bool update_qr  (const uword op, const uword index, const Mat<eT>& x);
+  
+  inline bool solve(Mat<eT>& X, const Mat<eT>& B, const bool trans);
+  
+  inline bool log_det(eT& out_val, T& out_sign) const;
+  
+  inline bool inv(Mat<eT>& out);
+  };
+
+
+
+//! common part of chol_factoriser, lu_factoriser and qr_factoriser;
+//! the factors are computed once by factorise(), and then reused by all other member functions
+class dense_factoriser
+  {
+  protected:
+  
+  const char* class_name;
+  
+  void_ptr worker_ptr          = nullptr;
+  uword    elem_type_indicator = 0;
+  uword    n_rows              = 0;
+  uword    n_cols              = 0;
+  double   rcond_value         = double(0);
+  bool     allow_ugly          = false;
+  
+  template<typename worker_type> inline void delete_worker();
+  
+  inline void cleanup();
+  
+  template<typename eT> inline dense_factoriser_worker<eT>* get_worker(const char* func_name) const;
+  
+  template<typename T1> inline bool factorise_helper(const Base<typename T1::elem_type,T1>& A_expr, const solve_opts::opts& settings, const uword kind);
+  
+  template<typename eT> inline bool update_finish(const dense_factoriser_worker<eT>& worker, const bool status, const char* func_name);
+  
+  inline ~dense_factoriser();
+  inline  dense_factoriser(const char* in_class_name);
+  
+  
+  public:
+  
+  inline void reset();
+  
+  inline double rcond() const;
+  
+  //! X = A \ B;  for QR factorisations of non-square matrices, the least-squares or minimum-norm solution
+  template<typename T1> inline bool solve(Mat<typename T1::elem_type>& X, const Base<typename T1::elem_type,T1>& B_expr, const typename arma_blas_real_or_cx_only<typename T1::elem_type>::result* junk = nullptr);
+  
+  //! X = A' \ B
+  template<typename T1> inline bool solve_trans(Mat<typename T1::elem_type>& X, const Base<typename T1::elem_type,T1>& B_expr, const typename arma_blas_real_or_cx_only<typename T1::elem_type>::result* junk = nullptr);
+  
+  template<typename eT> inline bool log_det(eT& out_val, typename get_pod_type<eT>::result& out_sign, const typename arma_blas_real_or_cx_only<eT>::result* junk = nullptr) const;
+  
+  //! inverse of A;  for QR factorisations of non-square matrices, the pseudo-inverse
+  template<typename eT> inline bool inv(Mat<eT>& out, const typename arma_blas_real_or_cx_only<eT>::result* junk = nullptr) const;
+  
+  inline      dense_factoriser(const dense_factoriser&) = delete;
+  inline void operator=       (const dense_factoriser&) = delete;
+  
+  
+  private:
+  
+  template<typename T1> inline bool solve_helper(Mat<typename T1::elem_type>& X, const Base<typename T1::elem_type,T1>& B_expr, const bool trans, const char* func_name);
+  };
+
+
+
+//! Cholesky factorisation of a symmetric/hermitian positive definite matrix
+class chol_factoriser : public dense_factoriser
+  {
+  public:
+  
+  inline chol_factoriser();
+  
+  template<typename T1> inline bool factorise(const Base<typename T1::elem_type,T1>& A_expr, const solve_opts::opts& settings = solve_opts::none, const typename arma_blas_real_or_cx_only<typename T1::elem_type>::result* junk = nullptr);
+  
+  //! update the factorisation to that of A + V*V' (method "+") or A - V*V' (method "-"), without refactorising
+  template<typename T1> inline bool update(const Base<typename T1::elem_type,T1>& V_expr, const char* method = "+", const typename arma_blas_real_or_cx_only<typename T1::elem_type>::result* junk = nullptr);
+  };
+
+
+
+//! LU factorisation with partial pivoting of a square matrix;
+//! matrices that appear to be symmetric/hermitian positive definite (or are declared as such via solve_opts::likely_sympd)
+//! are first tried with the Cholesky factorisation
+class lu_factoriser : public dense_factoriser
+  {
+  public:
+  
+  inline lu_factoriser();
+  
+  template<typename T1> inline bool factorise(const Base<typename T1::elem_type,T1>& A_expr, const solve_opts::opts& settings = solve_opts::none, const typename arma_blas_real_or_cx_only<typename T1::elem_type>::result* junk = nullptr);
+  };
+
+
+
+//! QR factorisation of a full rank matrix of any size;
+//! for wide matrices the factorisation of the transpose is held
+class qr_factoriser : public dense_factoriser
+  {
+  public:
+  
+  inline qr_factoriser();
+  
+  template<typename T1> inline bool factorise(const Base<typename T1::elem_type,T1>& A_expr, const solve_opts::opts& settings = solve_opts::none, const typename arma_blas_real_or_cx_only<typename T1::elem_type>::result* junk = nullptr);
+  
+  //! update the factorisation to that of A with column x inserted before column col, without refactorising;
+  //! if A is square, the now wide A is refactorised via its transpose, in O(n^3) operations
+  template<typename T1> inline bool insert_col(const uword col, const Base<typename T1::elem_type,T1>& x_expr, const typename arma_blas_real_or_cx_only<typename T1::elem_type>::result* junk = nullptr);
+  
+  //! update the factorisation to that of A with row x inserted before row 'row', without refactorising
+  template<typename T1> inline bool insert_row(const uword row, const Base<typename T1::elem_type,T1>& x_expr, const typename arma_blas_real_or_cx_only<typename T1::elem_type>::result* junk = nullptr);
+  
+  //! update the factorisation to that of A with column col removed, without refactorising;
+  //! if A is wide, the result is refactorised, in O(n^3) operations
+  inline bool delete_col(const uword col);
+  
+  
+  private:
+  
+  template<typename eT> inline bool update_helper(const uword op, const uword index, const Mat<eT>& x, const char* func_name);
+  };
+
+
+
+//! @}
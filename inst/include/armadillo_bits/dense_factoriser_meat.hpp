@@ -0,0 +1,1208 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 The RcppArmadillo Authors
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup dense_factoriser
+//! @{
+
+
+
+template<typename eT>
+inline
+bool
+dense_factoriser_worker<eT>::factorise_chol(const Mat<eT>& A)
+  {
+  arma_debug_sigprint();
+  
+  kind      = 0;
+  rcond_val = T(0);
+  
+  F      = A;
+  A_chol = A;
+  
+  if(F.is_empty())  { kind = kind_chol; return true; }
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    arma_conform_assert_blas_size(F);
+    
+    char     uplo     = 'L';
+    blas_int n        = blas_int(F.n_rows);
+    blas_int info     = 0;
+    T        norm_val = auxlib::norm1_sym(A);
+    
+    // NOTE: for complex matrices, zpotrf() assumes the matrix is hermitian (not simply symmetric)
+    
+    arma_debug_print("lapack::potrf()");
+    lapack::potrf(&uplo, &n, F.memptr(), &n, &info);
+    
+    if(info != 0)  { F.reset(); A_chol.reset(); return false; }
+    
+    // the strictly upper triangular part is not referenced by LAPACK; it is cleared so that F holds exactly L
+    
+    const uword N = F.n_rows;
+    
+    for(uword col=1; col < N; ++col)  { arrayops::fill_zeros(F.colptr(col), col); }
+    
+    kind      = kind_chol;
+    rcond_val = auxlib::lu_rcond_sympd<T>(F, norm_val);
+    
+    return true;
+    }
+  #else
+    {
+    arma_stop_logic_error("chol_factoriser::factorise(): use of LAPACK must be enabled");
+    return false;
+    }
+  #endif
+  }
+
+
+
+template<typename eT>
+inline
+bool
+dense_factoriser_worker<eT>::factorise_lu(const Mat<eT>& A)
+  {
+  arma_debug_sigprint();
+  
+  kind      = 0;
+  rcond_val = T(0);
+  
+  F = A;
+  
+  ipiv.set_size(F.n_rows);
+  
+  if(F.is_empty())  { kind = kind_lu; return true; }
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    arma_conform_assert_blas_size(F);
+    
+    blas_int n        = blas_int(F.n_rows);
+    blas_int info     = 0;
+    T        norm_val = auxlib::norm1_gen(A);
+    
+    arma_debug_print("lapack::getrf()");
+    lapack::getrf(&n, &n, F.memptr(), &n, ipiv.memptr(), &info);
+    
+    if(info != 0)  { F.reset(); ipiv.reset(); return false; }
+    
+    kind      = kind_lu;
+    rcond_val = auxlib::lu_rcond<T>(F, norm_val);
+    
+    return true;
+    }
+  #else
+    {
+    arma_stop_logic_error("lu_factoriser::factorise(): use of LAPACK must be enabled");
+    return false;
+    }
+  #endif
+  }
+
+
+
+template<typename eT>
+inline
+bool
+dense_factoriser_worker<eT>::factorise_qr(const Mat<eT>& A)
+  {
+  arma_debug_sigprint();
+  
+  kind      = 0;
+  rcond_val = T(0);
+  Q_det     = eT(1);
+  qr_trans  = (A.n_rows < A.n_cols);
+  
+  if(qr_trans)  { Q = A.t(); }  else  { Q = A; }
+  
+  const uword Q_n_cols = Q.n_cols;
+  
+  if(Q_n_cols == 0)  { F.reset(); kind = kind_qr; return true; }
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    arma_conform_assert_blas_size(Q);
+    
+    const uword Q_n_rows = Q.n_rows;
+    
+    blas_int m         = static_cast<blas_int>(Q_n_rows);
+    blas_int n         = static_cast<blas_int>(Q_n_cols);
+    blas_int k         = n;
+    blas_int lwork_min = (std::max)(blas_int(1), m);
+    blas_int info      = 0;
+    
+    podarray<eT> tau( static_cast<uword>(k) );
+    
+    eT        work_query[2] = {};
+    blas_int lwork_query    = -1;
+    
+    arma_debug_print("lapack::geqrf()");
+    lapack::geqrf(&m, &n, Q.memptr(), &m, tau.memptr(), &work_query[0], &lwork_query, &info);
+    
+    if(info != 0)  { Q.reset(); return false; }
+    
+    blas_int lwork_proposed = static_cast<blas_int>( access::tmp_real(work_query[0]) );
+    blas_int lwork_final    = (std::max)(lwork_proposed, lwork_min);
+    
+    podarray<eT> work( static_cast<uword>(lwork_final) );
+    
+    arma_debug_print("lapack::geqrf()");
+    lapack::geqrf(&m, &n, Q.memptr(), &m, tau.memptr(), work.memptr(), &lwork_final, &info);
+    
+    if(info != 0)  { Q.reset(); return false; }
+    
+    // Q = H_1 * H_2 * ... * H_k, with H_i = I - tau_i * v_i * v_i';
+    // det(H_i) = 1 - tau_i * (v_i' * v_i), where v_i has an implicit unit leading element
+    
+    if(Q_n_rows == Q_n_cols)
+      {
+      for(uword i=0; i < Q_n_cols; ++i)
+        {
+        const eT* colmem = Q.colptr(i);
+        
+        T vv = T(1);
+        
+        for(uword r=i+1; r < Q_n_rows; ++r)  { const T tmp = std::abs(colmem[r]); vv += tmp*tmp; }
+        
+        Q_det *= ( eT(1) - tau[i] * vv );
+        }
+      }
+    
+    F.zeros(Q_n_cols, Q_n_cols);
+    
+    for(uword col=0; col < Q_n_cols; ++col)
+      {
+      for(uword row=0; row <= col; ++row)
+        {
+        F.at(row,col) = Q.at(row,col);
+        }
+      }
+    
+    if( (is_float<eT>::value) || (is_double<eT>::value) )
+      {
+      arma_debug_print("lapack::orgqr()");
+      lapack::orgqr(&m, &n, &k, Q.memptr(), &m, tau.memptr(), work.memptr(), &lwork_final, &info);
+      }
+    else
+    if( (is_cx_float<eT>::value) || (is_cx_double<eT>::value) )
+      {
+      arma_debug_print("lapack::ungqr()");
+      lapack::ungqr(&m, &n, &k, Q.memptr(), &m, tau.memptr(), work.memptr(), &lwork_final, &info);
+      }
+    
+    if(info != 0)  { Q.reset(); F.reset(); return false; }
+    
+    kind      = kind_qr;
+    rcond_val = auxlib::rcond_trimat(F, uword(0));
+    
+    return true;
+    }
+  #else
+    {
+    arma_stop_logic_error("qr_factoriser::factorise(): use of LAPACK must be enabled");
+    return false;
+    }
+  #endif
+  }
+
+
+
+template<typename eT>
+inline
+bool
+dense_factoriser_worker<eT>::update_chol(const Mat<eT>& V, const bool downdate)
+  {
+  arma_debug_sigprint();
+  
+  if(kind != kind_chol)  { return false; }
+  
+  if(auxlib::chol_update(F, V, downdate, uword(1)) == false)  { return false; }
+  
+  // updating the copy of A costs the same O(n^2) per column of V as updating L
+  
+  if(downdate)  { A_chol -= V * V.t(); }  else  { A_chol += V * V.t(); }
+  
+  const T norm_val = (F.n_elem > 0) ? auxlib::norm1_sym(A_chol) : T(0);
+  
+  rcond_val = (F.n_elem > 0) ? auxlib::lu_rcond_sympd<T>(F, norm_val) : T(0);
+  
+  return true;
+  }
+
+
+
+//! op: 1 = insert column of A, 2 = delete column of A, 3 = insert row of A
+template<typename eT>
+inline
+bool
+dense_factoriser_worker<eT>::update_qr(const uword op, const uword index, const Mat<eT>& x)
+  {
+  arma_debug_sigprint();
+  
+  if(kind != kind_qr)  { return false; }
+  
+  // the factorised matrix M is either A or A' (for wide A), and is never wide;
+  // a row x' of A is the column conj(x) of A', and vice versa
+  
+  const bool M_insert_col = ((op == 1) && (qr_trans == false)) || ((op == 3) && (qr_trans == true));
+  const bool M_insert_row = ((op == 3) && (qr_trans == false)) || ((op == 1) && (qr_trans == true));
+  const bool M_delete_col = ((op == 2) && (qr_trans == false));
+  
+  Col<eT> x_M(x.memptr(), x.n_elem);
+  
+  if(qr_trans)  { x_M = conj(x_M); }
+  
+  const bool has_room = (Q.n_rows > Q.n_cols);
+  
+  if( (M_insert_col && has_room) || M_insert_row || M_delete_col )
+    {
+    if(M_insert_col)  { auxlib::qr_insert_col(Q, F, index, x_M, true); }
+    if(M_insert_row)  { auxlib::qr_insert_row(Q, F, index, x_M, true); }
+    if(M_delete_col)  { auxlib::qr_delete_col(Q, F, index,      true); }
+    
+    // a column that lies in the range of Q does not extend Q, leaving R non-square and the updated matrix rank deficient
+    
+    if(F.is_square() == false)  { kind = 0; rcond_val = T(0); return false; }
+    
+    if(Q.is_square())  { Q_det = det(Q); }
+    
+    rcond_val = (F.n_elem > 0) ? auxlib::rcond_trimat(F, uword(0)) : T(0);
+    
+    return true;
+    }
+  
+  // deleting a row of M, or inserting a column into a square M, changes which of A and A' is factorised;
+  // M is reconstructed and factorised from scratch;
+  // for the insertion this cannot be avoided, as the new factor R of A' satisfies R'*R = A*A' = Q*F*F'*Q',
+  // so obtaining it from Q and F takes O(n^3) operations in any case
+  
+  Mat<eT> M = Q*F;
+  
+  if(M_insert_col)  { M.insert_cols(index, x_M); }  else  { M.shed_row(index); }
+  
+  if(qr_trans)  { return (*this).factorise_qr(M.t()); }
+  
+  return (*this).factorise_qr(M);
+  }
+
+
+
+template<typename eT>
+inline
+bool
+dense_factoriser_worker<eT>::solve(Mat<eT>& X, const Mat<eT>& B, const bool trans)
+  {
+  arma_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    arma_conform_assert_blas_size(F, B);
+    
+    blas_int n    = blas_int(F.n_rows);
+    blas_int nrhs = blas_int(B.n_cols);
+    blas_int info = 0;
+    
+    if(kind == kind_chol)
+      {
+      // A is symmetric/hermitian, so A' \ B = A \ B
+      
+      X = B;
+      
+      char uplo = 'L';
+      
+      arma_debug_print("lapack::potrs()");
+      lapack::potrs(&uplo, &n, &nrhs, F.memptr(), &n, X.memptr(), &n, &info);
+      
+      return (info == 0);
+      }
+    
+    if(kind == kind_lu)
+      {
+      X = B;
+      
+      char trans_c = (trans) ? 'C' : 'N';
+      
+      arma_debug_print("lapack::getrs()");
+      lapack::getrs(&trans_c, &n, &nrhs, F.memptr(), &n, ipiv.memptr(), X.memptr(), &n, &info);
+      
+      return (info == 0);
+      }
+    
+    if(kind == kind_qr)
+      {
+      // tall A = Q*R:  A \ B = inv(R) * Q' * B (least squares);  A' \ B = Q * inv(R') * B (minimum norm);
+      // for wide A the factorisation is of A', so the two cases are swapped
+      
+      char uplo = 'U';
+      char diag = 'N';
+      
+      if(trans == qr_trans)
+        {
+        char trans_c = 'N';
+        
+        X = Q.t() * B;
+        
+        arma_debug_print("lapack::trtrs()");
+        lapack::trtrs(&uplo, &trans_c, &diag, &n, &nrhs, F.memptr(), &n, X.memptr(), &n, &info);
+        
+        return (info == 0);
+        }
+      else
+        {
+        char trans_c = 'C';
+        
+        Mat<eT> tmp(B);
+        
+        arma_debug_print("lapack::trtrs()");
+        lapack::trtrs(&uplo, &trans_c, &diag, &n, &nrhs, F.memptr(), &n, tmp.memptr(), &n, &info);
+        
+        if(info != 0)  { return false; }
+        
+        X = Q * tmp;
+        
+        return true;
+        }
+      }
+    
+    return false;
+    }
+  #else
+    {
+    arma_ignore(X);
+    arma_ignore(B);
+    arma_ignore(trans);
+    return false;
+    }
+  #endif
+  }
+
+
+
+template<typename eT>
+inline
+bool
+dense_factoriser_worker<eT>::log_det(eT& out_val, T& out_sign) const
+  {
+  arma_debug_sigprint();
+  
+  const uword N = F.n_rows;
+  
+  if(kind == kind_chol)
+    {
+    T val = T(0);
+    
+    for(uword i=0; i < N; ++i)  { val += std::log( access::tmp_real(F.at(i,i)) ); }
+    
+    out_val  = eT(T(2) * val);
+    out_sign = T(1);
+    
+    return true;
+    }
+  
+  if( (kind == kind_qr) && (Q.n_rows != Q.n_cols) )  { return false; }
+  
+  if( (kind == kind_lu) || (kind == kind_qr) )
+    {
+    // for complex matrices, the phase is carried by the imaginary part of out_val
+    
+    sword sign = +1;
+    eT    val  = eT(0);
+    
+    for(uword i=0; i < N; ++i)
+      {
+      const eT x = F.at(i,i);
+      
+      sign *= (is_cx<eT>::no) ? ( (access::tmp_real(x) < T(0)) ? -1 : +1 ) : +1;
+      val  += (is_cx<eT>::no) ? std::log( (access::tmp_real(x) < T(0)) ? x*T(-1) : x ) : std::log(x);
+      }
+    
+    if(kind == kind_lu)
+      {
+      for(uword i=0; i < N; ++i)
+        {
+        if( blas_int(i) != (ipiv.mem[i] - 1) )  { sign *= -1; }  // NOTE: adjustment of -1 is required as Fortran counts from 1
+        }
+      }
+    else
+      {
+      sign *= (is_cx<eT>::no) ? ( (access::tmp_real(Q_det) < T(0)) ? -1 : +1 ) : +1;
+      val  += (is_cx<eT>::no) ? eT(0) : std::log(Q_det);
+      }
+    
+    out_val  = val;
+    out_sign = T(sign);
+    
+    return true;
+    }
+  
+  return false;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+dense_factoriser_worker<eT>::inv(Mat<eT>& out)
+  {
+  arma_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    if(kind == kind_qr)
+      {
+      const uword A_n_rows = (qr_trans) ? Q.n_cols : Q.n_rows;
+      
+      const Mat<eT> I(A_n_rows, A_n_rows, fill::eye);
+      
+      return (*this).solve(out, I, false);
+      }
+    
+    out = F;
+    
+    if(out.is_empty())  { return true; }
+    
+    arma_conform_assert_blas_size(out);
+    
+    blas_int n    = blas_int(out.n_rows);
+    blas_int info = 0;
+    
+    if(kind == kind_chol)
+      {
+      char uplo = 'L';
+      
+      arma_debug_print("lapack::potri()");
+      lapack::potri(&uplo, &n, out.memptr(), &n, &info);
+      
+      if(info != 0)  { return false; }
+      
+      out = symmatl(out);
+      
+      return true;
+      }
+    
+    if(kind == kind_lu)
+      {
+      blas_int lwork = (std::max)(blas_int(podarray_prealloc_n_elem::val), n);
+      
+      if(n > blas_int(podarray_prealloc_n_elem::val))
+        {
+        eT        work_query[2] = {};
+        blas_int lwork_query    = -1;
+        
+        arma_debug_print("lapack::getri()");
+        lapack::getri(&n, out.memptr(), &n, ipiv.memptr(), &work_query[0], &lwork_query, &info);
+        
+        if(info != 0)  { return false; }
+        
+        blas_int lwork_proposed = static_cast<blas_int>( access::tmp_real(work_query[0]) );
+        
+        lwork = (std::max)(lwork_proposed, lwork);
+        }
+      
+      podarray<eT> work( static_cast<uword>(lwork) );
+      
+      arma_debug_print("lapack::getri()");
+      lapack::getri(&n, out.memptr(), &n, ipiv.memptr(), work.memptr(), &lwork, &info);
+      
+      return (info == 0);
+      }
+    
+    return false;
+    }
+  #else
+    {
+    arma_ignore(out);
+    return false;
+    }
+  #endif
+  }
+
+
+
+// 
+
+
+
+inline
+dense_factoriser::dense_factoriser(const char* in_class_name)
+  : class_name(in_class_name)
+  {
+  arma_debug_sigprint_this(this);
+  }
+
+
+
+inline
+dense_factoriser::~dense_factoriser()
+  {
+  arma_debug_sigprint_this(this);
+  
+  cleanup();
+  }
+
+
+
+template<typename worker_type>
+inline
+void
+dense_factoriser::delete_worker()
+  {
+  arma_debug_sigprint();
+  
+  if(worker_ptr != nullptr)
+    {
+    worker_type* ptr = reinterpret_cast<worker_type*>(worker_ptr);
+    
+    delete ptr;
+    
+    worker_ptr = nullptr;
+    }
+  }
+
+
+
+inline
+void
+dense_factoriser::cleanup()
+  {
+  arma_debug_sigprint();
+  
+       if(elem_type_indicator == 1)  { delete_worker< dense_factoriser_worker<    float> >(); }
+  else if(elem_type_indicator == 2)  { delete_worker< dense_factoriser_worker<   double> >(); }
+  else if(elem_type_indicator == 3)  { delete_worker< dense_factoriser_worker< cx_float> >(); }
+  else if(elem_type_indicator == 4)  { delete_worker< dense_factoriser_worker<cx_double> >(); }
+  
+  worker_ptr          = nullptr;
+  elem_type_indicator = 0;
+  n_rows              = 0;
+  n_cols              = 0;
+  rcond_value         = double(0);
+  allow_ugly          = false;
+  }
+
+
+
+inline
+void
+dense_factoriser::reset()
+  {
+  arma_debug_sigprint();
+  
+  cleanup();
+  }
+
+
+
+//! reciprocal condition number estimate from the last factorisation;
+//! for QR factorisations this is the estimate for the triangular factor R
+inline
+double
+dense_factoriser::rcond() const
+  {
+  arma_debug_sigprint();
+  
+  return rcond_value;
+  }
+
+
+
+template<typename eT>
+inline
+dense_factoriser_worker<eT>*
+dense_factoriser::get_worker(const char* func_name) const
+  {
+  arma_debug_sigprint();
+  
+  if(worker_ptr == nullptr)
+    {
+    arma_warn(2, class_name, "::", func_name, "(): no factorisation available");
+    return nullptr;
+    }
+  
+  bool type_mismatch = false;
+  
+       if(    (is_float<eT>::value) && (elem_type_indicator != 1) )  { type_mismatch = true; }
+  else if(   (is_double<eT>::value) && (elem_type_indicator != 2) )  { type_mismatch = true; }
+  else if( (is_cx_float<eT>::value) && (elem_type_indicator != 3) )  { type_mismatch = true; }
+  else if((is_cx_double<eT>::value) && (elem_type_indicator != 4) )  { type_mismatch = true; }
+  
+  if(type_mismatch)
+    {
+    arma_warn(1, class_name, "::", func_name, "(): matrix type mismatch");
+    return nullptr;
+    }
+  
+  return reinterpret_cast< dense_factoriser_worker<eT>* >(worker_ptr);
+  }
+
+
+
+template<typename T1>
+inline
+bool
+dense_factoriser::factorise_helper(const Base<typename T1::elem_type,T1>& A_expr, const solve_opts::opts& settings, const uword kind)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type            eT;
+  typedef typename get_pod_type<eT>::result  T;
+  
+  typedef dense_factoriser_worker<eT> worker_type;
+  
+  cleanup();
+  
+  uword local_elem_type_indicator = 0;
+  
+       if(    is_float<eT>::value)  { local_elem_type_indicator = 1; }
+  else if(   is_double<eT>::value)  { local_elem_type_indicator = 2; }
+  else if( is_cx_float<eT>::value)  { local_elem_type_indicator = 3; }
+  else if(is_cx_double<eT>::value)  { local_elem_type_indicator = 4; }
+  
+  const uword flags = settings.flags;
+  
+  const bool allow_ugly_flag = bool(flags & solve_opts::flag_allow_ugly  );
+  const bool no_sympd        = bool(flags & solve_opts::flag_no_sympd    );
+  const bool likely_sympd    = bool(flags & solve_opts::flag_likely_sympd);
+  
+  arma_conform_check( (no_sympd && likely_sympd), class_name, "::factorise(): options 'no_sympd' and 'likely_sympd' are mutually exclusive" );
+  
+  const quasi_unwrap<T1> U(A_expr.get_ref());
+  const Mat<eT>& A     = U.M;
+  
+  if( (kind != worker_type::kind_qr) && (A.is_square() == false) )
+    {
+    arma_warn(1, class_name, "::factorise(): given matrix must be square sized");
+    return false;
+    }
+  
+  if(arma_config::check_nonfinite && A.internal_has_nonfinite())
+    {
+    arma_warn(3, class_name, "::factorise(): detected non-finite elements");
+    return false;
+    }
+  
+  worker_type* local_worker_ptr = new(std::nothrow) worker_type;
+  
+  if(local_worker_ptr == nullptr)
+    {
+    arma_warn(3, class_name, "::factorise(): could not construct worker object");
+    return false;
+    }
+  
+  worker_ptr          = local_worker_ptr;
+  elem_type_indicator = local_elem_type_indicator;
+  
+  worker_type& local_worker_ref = (*local_worker_ptr);
+  
+  bool status = false;
+  
+  if(kind == worker_type::kind_chol)
+    {
+    status = local_worker_ref.factorise_chol(A);
+    }
+  else
+  if(kind == worker_type::kind_lu)
+    {
+    const bool try_chol = (no_sympd == false) && (likely_sympd || (arma_config::optimise_sym && sym_helper::guess_sympd(A, uword(16))));
+    
+    if(try_chol)
+      {
+      arma_debug_print(class_name, "::factorise(): attempting Cholesky factorisation");
+      
+      status = local_worker_ref.factorise_chol(A);
+      
+      if(status == false)  { arma_debug_print(class_name, "::factorise(): Cholesky factorisation failed; falling back to LU"); }
+      }
+    
+    if(status == false)  { status = local_worker_ref.factorise_lu(A); }
+    
+    // the copy of A is needed only by chol_factoriser::update()
+    
+    local_worker_ref.A_chol.reset();
+    }
+  else
+  if(kind == worker_type::kind_qr)
+    {
+    status = local_worker_ref.factorise_qr(A);
+    }
+  
+  const T local_rcond_value = local_worker_ref.rcond_val;
+  
+  const bool is_ugly = (A.is_empty() == false) && ( arma_isnan(local_rcond_value) || ((allow_ugly_flag == false) && (local_rcond_value < std::numeric_limits<T>::epsilon())) );
+  
+  if( (status == false) || is_ugly )
+    {
+    arma_warn(3, class_name, "::factorise(): factorisation failed; rcond: ", local_rcond_value);
+    cleanup();
+    rcond_value = double(local_rcond_value);
+    return false;
+    }
+  
+  n_rows      = A.n_rows;
+  n_cols      = A.n_cols;
+  rcond_value = double(local_rcond_value);
+  allow_ugly  = allow_ugly_flag;
+  
+  return true;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+dense_factoriser::update_finish(const dense_factoriser_worker<eT>& worker, const bool status, const char* func_name)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  if(status == false)
+    {
+    if(worker.kind == 0)
+      {
+      arma_warn(3, class_name, "::", func_name, "(): update failed");
+      cleanup();
+      return false;
+      }
+    
+    arma_warn(3, class_name, "::", func_name, "(): update failed; factorisation is unchanged");
+    return false;
+    }
+  
+  const bool qr_trans = (worker.kind == dense_factoriser_worker<eT>::kind_qr) && worker.qr_trans;
+  const bool qr_kind  = (worker.kind == dense_factoriser_worker<eT>::kind_qr);
+  
+  const uword local_n_rows = (qr_kind) ? ((qr_trans) ? worker.Q.n_cols : worker.Q.n_rows) : worker.F.n_rows;
+  const uword local_n_cols = (qr_kind) ? ((qr_trans) ? worker.Q.n_rows : worker.Q.n_cols) : worker.F.n_cols;
+  
+  const T local_rcond_value = worker.rcond_val;
+  
+  const bool is_empty = (local_n_rows == 0) || (local_n_cols == 0);
+  
+  const bool is_ugly = (is_empty == false) && ( arma_isnan(local_rcond_value) || ((allow_ugly == false) && (local_rcond_value < std::numeric_limits<T>::epsilon())) );
+  
+  if(is_ugly)
+    {
+    arma_warn(3, class_name, "::", func_name, "(): updated matrix is singular");
+    cleanup();
+    rcond_value = double(local_rcond_value);
+    return false;
+    }
+  
+  n_rows      = local_n_rows;
+  n_cols      = local_n_cols;
+  rcond_value = double(local_rcond_value);
+  
+  return true;
+  }
+
+
+
+template<typename T1>
+inline
+bool
+dense_factoriser::solve_helper(Mat<typename T1::elem_type>& X, const Base<typename T1::elem_type,T1>& B_expr, const bool trans, const char* func_name)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  dense_factoriser_worker<eT>* local_worker_ptr = (*this).template get_worker<eT>(func_name);
+  
+  if(local_worker_ptr == nullptr)  { X.soft_reset(); return false; }
+  
+  const quasi_unwrap<T1> U(B_expr.get_ref());
+  const Mat<eT>& B     = U.M;
+  
+  const uword B_n_rows_req = (trans) ? n_cols : n_rows;
+  const uword X_n_rows     = (trans) ? n_rows : n_cols;
+  
+  if(B.n_rows != B_n_rows_req)
+    {
+    arma_warn(1, class_name, "::", func_name, "(): matrix size mismatch");
+    X.soft_reset();
+    return false;
+    }
+  
+  if(B.is_empty() || (n_rows == 0) || (n_cols == 0))  { X.zeros(X_n_rows, B.n_cols); return true; }
+  
+  const bool is_alias = U.is_alias(X);
+  
+  Mat<eT>  tmp;
+  Mat<eT>& out = is_alias ? tmp : X;
+  
+  const bool status = local_worker_ptr->solve(out, B, trans);
+  
+  if(is_alias)  { X.steal_mem(tmp); }
+  
+  if(status == false)
+    {
+    arma_warn(3, class_name, "::", func_name, "(): solution not found");
+    X.soft_reset();
+    return false;
+    }
+  
+  return true;
+  }
+
+
+
+template<typename T1>
+inline
+bool
+dense_factoriser::solve
+  (
+         Mat<typename T1::elem_type>&    X,
+  const Base<typename T1::elem_type,T1>& B_expr,
+  const typename arma_blas_real_or_cx_only<typename T1::elem_type>::result* junk
+  )
+  {
+  arma_debug_sigprint();
+  arma_ignore(junk);
+  
+  return (*this).solve_helper(X, B_expr, false, "solve");
+  }
+
+
+
+template<typename T1>
+inline
+bool
+dense_factoriser::solve_trans
+  (
+         Mat<typename T1::elem_type>&    X,
+  const Base<typename T1::elem_type,T1>& B_expr,
+  const typename arma_blas_real_or_cx_only<typename T1::elem_type>::result* junk
+  )
+  {
+  arma_debug_sigprint();
+  arma_ignore(junk);
+  
+  return (*this).solve_helper(X, B_expr, true, "solve_trans");
+  }
+
+
+
+//! log determinant of the factorised matrix, obtained from the diagonal of the triangular factors
+template<typename eT>
+inline
+bool
+dense_factoriser::log_det
+  (
+  eT&                                  out_val,
+  typename get_pod_type<eT>::result&   out_sign,
+  const typename arma_blas_real_or_cx_only<eT>::result* junk
+  ) const
+  {
+  arma_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const dense_factoriser_worker<eT>* local_worker_ptr = (*this).template get_worker<eT>("log_det");
+  
+  if(local_worker_ptr == nullptr)  { return false; }
+  
+  if(n_rows != n_cols)
+    {
+    arma_warn(1, class_name, "::log_det(): factorised matrix must be square sized");
+    return false;
+    }
+  
+  if(n_rows == 0)  { out_val = eT(0); out_sign = T(1); return true; }
+  
+  const bool status = local_worker_ptr->log_det(out_val, out_sign);
+  
+  if(status == false)
+    {
+    arma_warn(3, class_name, "::log_det(): determinant not available");
+    return false;
+    }
+  
+  return true;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+dense_factoriser::inv
+  (
+  Mat<eT>& out,
+  const typename arma_blas_real_or_cx_only<eT>::result* junk
+  ) const
+  {
+  arma_debug_sigprint();
+  arma_ignore(junk);
+  
+  dense_factoriser_worker<eT>* local_worker_ptr = (*this).template get_worker<eT>("inv");
+  
+  if(local_worker_ptr == nullptr)  { out.soft_reset(); return false; }
+  
+  if( (n_rows == 0) || (n_cols == 0) )  { out.zeros(n_cols, n_rows); return true; }
+  
+  const bool status = local_worker_ptr->inv(out);
+  
+  if(status == false)
+    {
+    arma_warn(3, class_name, "::inv(): inverse not found");
+    out.soft_reset();
+    return false;
+    }
+  
+  return true;
+  }
+
+
+
+// 
+
+
+
+inline
+chol_factoriser::chol_factoriser()
+  : dense_factoriser("chol_factoriser")
+  {
+  arma_debug_sigprint_this(this);
+  }
+
+
+
+template<typename T1>
+inline
+bool
+chol_factoriser::factorise
+  (
+  const Base<typename T1::elem_type,T1>& A_expr,
+  const solve_opts::opts&                settings,
+  const typename arma_blas_real_or_cx_only<typename T1::elem_type>::result* junk
+  )
+  {
+  arma_debug_sigprint();
+  arma_ignore(junk);
+  
+  return (*this).factorise_helper(A_expr, settings, dense_factoriser_worker<typename T1::elem_type>::kind_chol);
+  }
+
+
+
+template<typename T1>
+inline
+bool
+chol_factoriser::update
+  (
+  const Base<typename T1::elem_type,T1>& V_expr,
+  const char*                            method,
+  const typename arma_blas_real_or_cx_only<typename T1::elem_type>::result* junk
+  )
+  {
+  arma_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename T1::elem_type eT;
+  
+  const char sig = (method != nullptr) ? method[0] : char(0);
+  
+  arma_conform_check( ((sig != '+') && (sig != '-')), "chol_factoriser::update(): argument 'method' must be \"+\" or \"-\"" );
+  
+  dense_factoriser_worker<eT>* local_worker_ptr = (*this).template get_worker<eT>("update");
+  
+  if(local_worker_ptr == nullptr)  { return false; }
+  
+  const quasi_unwrap<T1> U(V_expr.get_ref());
+  const Mat<eT>& V     = U.M;
+  
+  if(V.n_rows != n_rows)
+    {
+    arma_warn(1, "chol_factoriser::update(): matrix size mismatch");
+    return false;
+    }
+  
+  if(V.internal_has_nonfinite())
+    {
+    arma_warn(3, "chol_factoriser::update(): detected non-finite elements");
+    return false;
+    }
+  
+  const bool status = local_worker_ptr->update_chol(V, (sig == '-'));
+  
+  return (*this).update_finish(*local_worker_ptr, status, "update");
+  }
+
+
+
+inline
+lu_factoriser::lu_factoriser()
+  : dense_factoriser("lu_factoriser")
+  {
+  arma_debug_sigprint_this(this);
+  }
+
+
+
+template<typename T1>
+inline
+bool
+lu_factoriser::factorise
+  (
+  const Base<typename T1::elem_type,T1>& A_expr,
+  const solve_opts::opts&                settings,
+  const typename arma_blas_real_or_cx_only<typename T1::elem_type>::result* junk
+  )
+  {
+  arma_debug_sigprint();
+  arma_ignore(junk);
+  
+  return (*this).factorise_helper(A_expr, settings, dense_factoriser_worker<typename T1::elem_type>::kind_lu);
+  }
+
+
+
+inline
+qr_factoriser::qr_factoriser()
+  : dense_factoriser("qr_factoriser")
+  {
+  arma_debug_sigprint_this(this);
+  }
+
+
+
+template<typename T1>
+inline
+bool
+qr_factoriser::factorise
+  (
+  const Base<typename T1::elem_type,T1>& A_expr,
+  const solve_opts::opts&                settings,
+  const typename arma_blas_real_or_cx_only<typename T1::elem_type>::result* junk
+  )
+  {
+  arma_debug_sigprint();
+  arma_ignore(junk);
+  
+  return (*this).factorise_helper(A_expr, settings, dense_factoriser_worker<typename T1::elem_type>::kind_qr);
+  }
+
+
+
+template<typename eT>
+inline
+bool
+qr_factoriser::update_helper(const uword op, const uword index, const Mat<eT>& x, const char* func_name)
+  {
+  arma_debug_sigprint();
+  
+  dense_factoriser_worker<eT>* local_worker_ptr = (*this).template get_worker<eT>(func_name);
+  
+  if(local_worker_ptr == nullptr)  { return false; }
+  
+  const uword index_max = (op == 1) ? n_cols : ( (op == 2) ? (n_cols-1) : n_rows );
+  
+  if( ((op == 2) && (n_cols == 0)) || (index > index_max) )
+    {
+    arma_warn(1, "qr_factoriser::", func_name, "(): index out of bounds");
+    return false;
+    }
+  
+  const uword x_n_elem_req = (op == 1) ? n_rows : ( (op == 2) ? uword(0) : n_cols );
+  
+  if(x.n_elem != x_n_elem_req)
+    {
+    arma_warn(1, "qr_factoriser::", func_name, "(): vector size mismatch");
+    return false;
+    }
+  
+  if(x.internal_has_nonfinite())
+    {
+    arma_warn(3, "qr_factoriser::", func_name, "(): detected non-finite elements");
+    return false;
+    }
+  
+  const bool status = local_worker_ptr->update_qr(op, index, x);
+  
+  return (*this).update_finish(*local_worker_ptr, status, func_name);
+  }
+
+
+
+template<typename T1>
+inline
+bool
+qr_factoriser::insert_col
+  (
+  const uword                            col,
+  const Base<typename T1::elem_type,T1>& x_expr,
+  const typename arma_blas_real_or_cx_only<typename T1::elem_type>::result* junk
+  )
+  {
+  arma_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename T1::elem_type eT;
+  
+  const quasi_unwrap<T1> U(x_expr.get_ref());
+  
+  return (*this).template update_helper<eT>(uword(1), col, U.M, "insert_col");
+  }
+
+
+
+template<typename T1>
+inline
+bool
+qr_factoriser::insert_row
+  (
+  const uword                            row,
+  const Base<typename T1::elem_type,T1>& x_expr,
+  const typename arma_blas_real_or_cx_only<typename T1::elem_type>::result* junk
+  )
+  {
+  arma_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename T1::elem_type eT;
+  
+  const quasi_unwrap<T1> U(x_expr.get_ref());
+  
+  return (*this).template update_helper<eT>(uword(3), row, U.M, "insert_row");
+  }
+
+
+
+inline
+bool
+qr_factoriser::delete_col(const uword col)
+  {
+  arma_debug_sigprint();
+  
+       if(elem_type_indicator == 1)  { return (*this).template update_helper<    float>(uword(2), col, Mat<    float>(), "delete_col"); }
+  else if(elem_type_indicator == 2)  { return (*this).template update_helper<   double>(uword(2), col, Mat<   double>(), "delete_col"); }
+  else if(elem_type_indicator == 3)  { return (*this).template update_helper< cx_float>(uword(2), col, Mat< cx_float>(), "delete_col"); }
+  else if(elem_type_indicator == 4)  { return (*this).template update_helper<cx_double>(uword(2), col, Mat<cx_double>(), "delete_col"); }
+  
+  arma_warn(2, "qr_factoriser::delete_col(): no factorisation available");
+  
+  return false;
+  }
+
+
+
+//! @}
@@ -278,15 +278,19 @@ eglue_core<eglue_type>::apply(outT& out, const eGlue<T1, T2, eglue_type>& x)
     
     if(use_mp && mp_gate<eT, (Proxy<T1>::use_mp && Proxy<T2>::use_mp)>::eval(n_elem))
       {
-      typename Proxy<T1>::ea_type P1 = x.P1.get_ea();
-      typename Proxy<T2>::ea_type P2 = x.P2.get_ea();
-      
-           if(is_same_type<eglue_type, eglue_plus >::yes) { arma_applier_1_mp(=, +); }
-      else if(is_same_type<eglue_type, eglue_minus>::yes) { arma_applier_1_mp(=, -); }
-      else if(is_same_type<eglue_type, eglue_div  >::yes) { arma_applier_1_mp(=, /); }
-      else if(is_same_type<eglue_type, eglue_schur>::yes) { arma_applier_1_mp(=, *); }
+      if(eop_simd::apply_mp<eop_simd::mode_equ>(out_mem, x, n_elem) == false)
+        {
+        typename Proxy<T1>::ea_type P1 = x.P1.get_ea();
+        typename Proxy<T2>::ea_type P2 = x.P2.get_ea();
+        
+             if(is_same_type<eglue_type, eglue_plus >::yes) { arma_applier_1_mp(=, +); }
+        else if(is_same_type<eglue_type, eglue_minus>::yes) { arma_applier_1_mp(=, -); }
+        else if(is_same_type<eglue_type, eglue_div  >::yes) { arma_applier_1_mp(=, /); }
+        else if(is_same_type<eglue_type, eglue_schur>::yes) { arma_applier_1_mp(=, *); }
+        }
       }
     else
+    if(eop_simd::apply<eop_simd::mode_equ>(out_mem, x, n_elem) == false)
       {
       if(memory::is_aligned(out_mem))
         {
@@ -378,15 +382,19 @@ eglue_core<eglue_type>::apply_inplace_plus(Mat<typename T1::elem_type>& out, con
     
     if(use_mp && mp_gate<eT, (Proxy<T1>::use_mp && Proxy<T2>::use_mp)>::eval(n_elem))
       {
-      typename Proxy<T1>::ea_type P1 = x.P1.get_ea();
-      typename Proxy<T2>::ea_type P2 = x.P2.get_ea();
-      
-           if(is_same_type<eglue_type, eglue_plus >::yes) { arma_applier_1_mp(+=, +); }
-      else if(is_same_type<eglue_type, eglue_minus>::yes) { arma_applier_1_mp(+=, -); }
-      else if(is_same_type<eglue_type, eglue_div  >::yes) { arma_applier_1_mp(+=, /); }
-      else if(is_same_type<eglue_type, eglue_schur>::yes) { arma_applier_1_mp(+=, *); }
+      if(eop_simd::apply_mp<eop_simd::mode_plus>(out_mem, x, n_elem) == false)
+        {
+        typename Proxy<T1>::ea_type P1 = x.P1.get_ea();
+        typename Proxy<T2>::ea_type P2 = x.P2.get_ea();
+        
+             if(is_same_type<eglue_type, eglue_plus >::yes) { arma_applier_1_mp(+=, +); }
+        else if(is_same_type<eglue_type, eglue_minus>::yes) { arma_applier_1_mp(+=, -); }
+        else if(is_same_type<eglue_type, eglue_div  >::yes) { arma_applier_1_mp(+=, /); }
+        else if(is_same_type<eglue_type, eglue_schur>::yes) { arma_applier_1_mp(+=, *); }
+        }
       }
     else
+    if(eop_simd::apply<eop_simd::mode_plus>(out_mem, x, n_elem) == false)
       {
       if(memory::is_aligned(out_mem))
         {
@@ -475,15 +483,19 @@ eglue_core<eglue_type>::apply_inplace_minus(Mat<typename T1::elem_type>& out, co
     
     if(use_mp && mp_gate<eT, (Proxy<T1>::use_mp && Proxy<T2>::use_mp)>::eval(n_elem))
       {
-      typename Proxy<T1>::ea_type P1 = x.P1.get_ea();
-      typename Proxy<T2>::ea_type P2 = x.P2.get_ea();
-      
-           if(is_same_type<eglue_type, eglue_plus >::yes) { arma_applier_1_mp(-=, +); }
-      else if(is_same_type<eglue_type, eglue_minus>::yes) { arma_applier_1_mp(-=, -); }
-      else if(is_same_type<eglue_type, eglue_div  >::yes) { arma_applier_1_mp(-=, /); }
-      else if(is_same_type<eglue_type, eglue_schur>::yes) { arma_applier_1_mp(-=, *); }
+      if(eop_simd::apply_mp<eop_simd::mode_minus>(out_mem, x, n_elem) == false)
+        {
+        typename Proxy<T1>::ea_type P1 = x.P1.get_ea();
+        typename Proxy<T2>::ea_type P2 = x.P2.get_ea();
+        
+             if(is_same_type<eglue_type, eglue_plus >::yes) { arma_applier_1_mp(-=, +); }
+        else if(is_same_type<eglue_type, eglue_minus>::yes) { arma_applier_1_mp(-=, -); }
+        else if(is_same_type<eglue_type, eglue_div  >::yes) { arma_applier_1_mp(-=, /); }
+        else if(is_same_type<eglue_type, eglue_schur>::yes) { arma_applier_1_mp(-=, *); }
+        }
       }
     else
+    if(eop_simd::apply<eop_simd::mode_minus>(out_mem, x, n_elem) == false)
       {
       if(memory::is_aligned(out_mem))
         {
@@ -572,15 +584,19 @@ eglue_core<eglue_type>::apply_inplace_schur(Mat<typename T1::elem_type>& out, co
     
     if(use_mp && mp_gate<eT, (Proxy<T1>::use_mp && Proxy<T2>::use_mp)>::eval(n_elem))
       {
-      typename Proxy<T1>::ea_type P1 = x.P1.get_ea();
-      typename Proxy<T2>::ea_type P2 = x.P2.get_ea();
-      
-           if(is_same_type<eglue_type, eglue_plus >::yes) { arma_applier_1_mp(*=, +); }
-      else if(is_same_type<eglue_type, eglue_minus>::yes) { arma_applier_1_mp(*=, -); }
-      else if(is_same_type<eglue_type, eglue_div  >::yes) { arma_applier_1_mp(*=, /); }
-      else if(is_same_type<eglue_type, eglue_schur>::yes) { arma_applier_1_mp(*=, *); }
+      if(eop_simd::apply_mp<eop_simd::mode_schur>(out_mem, x, n_elem) == false)
+        {
+        typename Proxy<T1>::ea_type P1 = x.P1.get_ea();
+        typename Proxy<T2>::ea_type P2 = x.P2.get_ea();
+        
+             if(is_same_type<eglue_type, eglue_plus >::yes) { arma_applier_1_mp(*=, +); }
+        else if(is_same_type<eglue_type, eglue_minus>::yes) { arma_applier_1_mp(*=, -); }
+        else if(is_same_type<eglue_type, eglue_div  >::yes) { arma_applier_1_mp(*=, /); }
+        else if(is_same_type<eglue_type, eglue_schur>::yes) { arma_applier_1_mp(*=, *); }
+        }
       }
     else
+    if(eop_simd::apply<eop_simd::mode_schur>(out_mem, x, n_elem) == false)
       {
       if(memory::is_aligned(out_mem))
         {
@@ -669,15 +685,19 @@ eglue_core<eglue_type>::apply_inplace_div(Mat<typename T1::elem_type>& out, cons
     
     if(use_mp && mp_gate<eT, (Proxy<T1>::use_mp && Proxy<T2>::use_mp)>::eval(n_elem))
       {
-      typename Proxy<T1>::ea_type P1 = x.P1.get_ea();
-      typename Proxy<T2>::ea_type P2 = x.P2.get_ea();
-      
-           if(is_same_type<eglue_type, eglue_plus >::yes) { arma_applier_1_mp(/=, +); }
-      else if(is_same_type<eglue_type, eglue_minus>::yes) { arma_applier_1_mp(/=, -); }
-      else if(is_same_type<eglue_type, eglue_div  >::yes) { arma_applier_1_mp(/=, /); }
-      else if(is_same_type<eglue_type, eglue_schur>::yes) { arma_applier_1_mp(/=, *); }
+      if(eop_simd::apply_mp<eop_simd::mode_div>(out_mem, x, n_elem) == false)
+        {
+        typename Proxy<T1>::ea_type P1 = x.P1.get_ea();
+        typename Proxy<T2>::ea_type P2 = x.P2.get_ea();
+        
+             if(is_same_type<eglue_type, eglue_plus >::yes) { arma_applier_1_mp(/=, +); }
+        else if(is_same_type<eglue_type, eglue_minus>::yes) { arma_applier_1_mp(/=, -); }
+        else if(is_same_type<eglue_type, eglue_div  >::yes) { arma_applier_1_mp(/=, /); }
+        else if(is_same_type<eglue_type, eglue_schur>::yes) { arma_applier_1_mp(/=, *); }
+        }
       }
     else
+    if(eop_simd::apply<eop_simd::mode_div>(out_mem, x, n_elem) == false)
       {
       if(memory::is_aligned(out_mem))
         {
@@ -770,15 +790,19 @@ eglue_core<eglue_type>::apply(Cube<typename T1::elem_type>& out, const eGlueCube
     
     if(use_mp && mp_gate<eT, (ProxyCube<T1>::use_mp && ProxyCube<T2>::use_mp)>::eval(n_elem))
       {
-      typename ProxyCube<T1>::ea_type P1 = x.P1.get_ea();
-      typename ProxyCube<T2>::ea_type P2 = x.P2.get_ea();
-      
-           if(is_same_type<eglue_type, eglue_plus >::yes) { arma_applier_1_mp(=, +); }
-      else if(is_same_type<eglue_type, eglue_minus>::yes) { arma_applier_1_mp(=, -); }
-      else if(is_same_type<eglue_type, eglue_div  >::yes) { arma_applier_1_mp(=, /); }
-      else if(is_same_type<eglue_type, eglue_schur>::yes) { arma_applier_1_mp(=, *); }
+      if(eop_simd::apply_mp<eop_simd::mode_equ>(out_mem, x, n_elem) == false)
+        {
+        typename ProxyCube<T1>::ea_type P1 = x.P1.get_ea();
+        typename ProxyCube<T2>::ea_type P2 = x.P2.get_ea();
+        
+             if(is_same_type<eglue_type, eglue_plus >::yes) { arma_applier_1_mp(=, +); }
+        else if(is_same_type<eglue_type, eglue_minus>::yes) { arma_applier_1_mp(=, -); }
+        else if(is_same_type<eglue_type, eglue_div  >::yes) { arma_applier_1_mp(=, /); }
+        else if(is_same_type<eglue_type, eglue_schur>::yes) { arma_applier_1_mp(=, *); }
+        }
       }
     else
+    if(eop_simd::apply<eop_simd::mode_equ>(out_mem, x, n_elem) == false)
       {
       if(memory::is_aligned(out_mem))
         {
@@ -872,15 +896,19 @@ eglue_core<eglue_type>::apply_inplace_plus(Cube<typename T1::elem_type>& out, co
     
     if(use_mp && mp_gate<eT, (ProxyCube<T1>::use_mp && ProxyCube<T2>::use_mp)>::eval(n_elem))
       {
-      typename ProxyCube<T1>::ea_type P1 = x.P1.get_ea();
-      typename ProxyCube<T2>::ea_type P2 = x.P2.get_ea();
-      
-           if(is_same_type<eglue_type, eglue_plus >::yes) { arma_applier_1_mp(+=, +); }
-      else if(is_same_type<eglue_type, eglue_minus>::yes) { arma_applier_1_mp(+=, -); }
-      else if(is_same_type<eglue_type, eglue_div  >::yes) { arma_applier_1_mp(+=, /); }
-      else if(is_same_type<eglue_type, eglue_schur>::yes) { arma_applier_1_mp(+=, *); }
+      if(eop_simd::apply_mp<eop_simd::mode_plus>(out_mem, x, n_elem) == false)
+        {
+        typename ProxyCube<T1>::ea_type P1 = x.P1.get_ea();
+        typename ProxyCube<T2>::ea_type P2 = x.P2.get_ea();
+        
+             if(is_same_type<eglue_type, eglue_plus >::yes) { arma_applier_1_mp(+=, +); }
+        else if(is_same_type<eglue_type, eglue_minus>::yes) { arma_applier_1_mp(+=, -); }
+        else if(is_same_type<eglue_type, eglue_div  >::yes) { arma_applier_1_mp(+=, /); }
+        else if(is_same_type<eglue_type, eglue_schur>::yes) { arma_applier_1_mp(+=, *); }
+        }
       }
     else
+    if(eop_simd::apply<eop_simd::mode_plus>(out_mem, x, n_elem) == false)
       {
       if(memory::is_aligned(out_mem))
         {
@@ -970,15 +998,19 @@ eglue_core<eglue_type>::apply_inplace_minus(Cube<typename T1::elem_type>& out, c
     
     if(use_mp && mp_gate<eT, (ProxyCube<T1>::use_mp && ProxyCube<T2>::use_mp)>::eval(n_elem))
       {
-      typename ProxyCube<T1>::ea_type P1 = x.P1.get_ea();
-      typename ProxyCube<T2>::ea_type P2 = x.P2.get_ea();
-      
-           if(is_same_type<eglue_type, eglue_plus >::yes) { arma_applier_1_mp(-=, +); }
-      else if(is_same_type<eglue_type, eglue_minus>::yes) { arma_applier_1_mp(-=, -); }
-      else if(is_same_type<eglue_type, eglue_div  >::yes) { arma_applier_1_mp(-=, /); }
-      else if(is_same_type<eglue_type, eglue_schur>::yes) { arma_applier_1_mp(-=, *); }
+      if(eop_simd::apply_mp<eop_simd::mode_minus>(out_mem, x, n_elem) == false)
+        {
+        typename ProxyCube<T1>::ea_type P1 = x.P1.get_ea();
+        typename ProxyCube<T2>::ea_type P2 = x.P2.get_ea();
+        
+             if(is_same_type<eglue_type, eglue_plus >::yes) { arma_applier_1_mp(-=, +); }
+        else if(is_same_type<eglue_type, eglue_minus>::yes) { arma_applier_1_mp(-=, -); }
+        else if(is_same_type<eglue_type, eglue_div  >::yes) { arma_applier_1_mp(-=, /); }
+        else if(is_same_type<eglue_type, eglue_schur>::yes) { arma_applier_1_mp(-=, *); }
+        }
       }
     else
+    if(eop_simd::apply<eop_simd::mode_minus>(out_mem, x, n_elem) == false)
       {
       if(memory::is_aligned(out_mem))
         {
@@ -1068,15 +1100,19 @@ eglue_core<eglue_type>::apply_inplace_schur(Cube<typename T1::elem_type>& out, c
     
     if(use_mp && mp_gate<eT, (ProxyCube<T1>::use_mp && ProxyCube<T2>::use_mp)>::eval(n_elem))
       {
-      typename ProxyCube<T1>::ea_type P1 = x.P1.get_ea();
-      typename ProxyCube<T2>::ea_type P2 = x.P2.get_ea();
-      
-           if(is_same_type<eglue_type, eglue_plus >::yes) { arma_applier_1_mp(*=, +); }
-      else if(is_same_type<eglue_type, eglue_minus>::yes) { arma_applier_1_mp(*=, -); }
-      else if(is_same_type<eglue_type, eglue_div  >::yes) { arma_applier_1_mp(*=, /); }
-      else if(is_same_type<eglue_type, eglue_schur>::yes) { arma_applier_1_mp(*=, *); }
+      if(eop_simd::apply_mp<eop_simd::mode_schur>(out_mem, x, n_elem) == false)
+        {
+        typename ProxyCube<T1>::ea_type P1 = x.P1.get_ea();
+        typename ProxyCube<T2>::ea_type P2 = x.P2.get_ea();
+        
+             if(is_same_type<eglue_type, eglue_plus >::yes) { arma_applier_1_mp(*=, +); }
+        else if(is_same_type<eglue_type, eglue_minus>::yes) { arma_applier_1_mp(*=, -); }
+        else if(is_same_type<eglue_type, eglue_div  >::yes) { arma_applier_1_mp(*=, /); }
+        else if(is_same_type<eglue_type, eglue_schur>::yes) { arma_applier_1_mp(*=, *); }
+        }
       }
     else
+    if(eop_simd::apply<eop_simd::mode_schur>(out_mem, x, n_elem) == false)
       {
       if(memory::is_aligned(out_mem))
         {
@@ -1166,15 +1202,19 @@ eglue_core<eglue_type>::apply_inplace_div(Cube<typename T1::elem_type>& out, con
     
     if(use_mp && mp_gate<eT, (ProxyCube<T1>::use_mp && ProxyCube<T2>::use_mp)>::eval(n_elem))
       {
-      typename ProxyCube<T1>::ea_type P1 = x.P1.get_ea();
-      typename ProxyCube<T2>::ea_type P2 = x.P2.get_ea();
-      
-           if(is_same_type<eglue_type, eglue_plus >::yes) { arma_applier_1_mp(/=, +); }
-      else if(is_same_type<eglue_type, eglue_minus>::yes) { arma_applier_1_mp(/=, -); }
-      else if(is_same_type<eglue_type, eglue_div  >::yes) { arma_applier_1_mp(/=, /); }
-      else if(is_same_type<eglue_type, eglue_schur>::yes) { arma_applier_1_mp(/=, *); }
+      if(eop_simd::apply_mp<eop_simd::mode_div>(out_mem, x, n_elem) == false)
+        {
+        typename ProxyCube<T1>::ea_type P1 = x.P1.get_ea();
+        typename ProxyCube<T2>::ea_type P2 = x.P2.get_ea();
+        
+             if(is_same_type<eglue_type, eglue_plus >::yes) { arma_applier_1_mp(/=, +); }
+        else if(is_same_type<eglue_type, eglue_minus>::yes) { arma_applier_1_mp(/=, -); }
+        else if(is_same_type<eglue_type, eglue_div  >::yes) { arma_applier_1_mp(/=, /); }
+        else if(is_same_type<eglue_type, eglue_schur>::yes) { arma_applier_1_mp(/=, *); }
+        }
       }
     else
+    if(eop_simd::apply<eop_simd::mode_div>(out_mem, x, n_elem) == false)
       {
       if(memory::is_aligned(out_mem))
         {
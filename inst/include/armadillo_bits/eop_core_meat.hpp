@@ -263,11 +263,15 @@ eop_core<eop_type>::apply(outT& out, const eOp<T1, eop_type>& x)
     
     if(use_mp && mp_gate<eT>::eval(n_elem))
       {
-      typename Proxy<T1>::ea_type P = x.P.get_ea();
-      
-      arma_applier_1_mp(=);
+      if(eop_simd::apply_mp<eop_simd::mode_equ>(out_mem, x, n_elem) == false)
+        {
+        typename Proxy<T1>::ea_type P = x.P.get_ea();
+        
+        arma_applier_1_mp(=);
+        }
       }
     else
+    if(eop_simd::apply<eop_simd::mode_equ>(out_mem, x, n_elem) == false)
       {
       if(memory::is_aligned(out_mem))
         {
@@ -340,11 +344,15 @@ eop_core<eop_type>::apply_inplace_plus(Mat<typename T1::elem_type>& out, const e
     
     if(use_mp && mp_gate<eT>::eval(n_elem))
       {
-      typename Proxy<T1>::ea_type P = x.P.get_ea();
-      
-      arma_applier_1_mp(+=);
+      if(eop_simd::apply_mp<eop_simd::mode_plus>(out_mem, x, n_elem) == false)
+        {
+        typename Proxy<T1>::ea_type P = x.P.get_ea();
+        
+        arma_applier_1_mp(+=);
+        }
       }
     else
+    if(eop_simd::apply<eop_simd::mode_plus>(out_mem, x, n_elem) == false)
       {
       if(memory::is_aligned(out_mem))
         {
@@ -414,11 +422,15 @@ eop_core<eop_type>::apply_inplace_minus(Mat<typename T1::elem_type>& out, const
     
     if(use_mp && mp_gate<eT>::eval(n_elem))
       {
-      typename Proxy<T1>::ea_type P = x.P.get_ea();
-      
-      arma_applier_1_mp(-=);
+      if(eop_simd::apply_mp<eop_simd::mode_minus>(out_mem, x, n_elem) == false)
+        {
+        typename Proxy<T1>::ea_type P = x.P.get_ea();
+        
+        arma_applier_1_mp(-=);
+        }
       }
     else
+    if(eop_simd::apply<eop_simd::mode_minus>(out_mem, x, n_elem) == false)
       {
       if(memory::is_aligned(out_mem))
         {
@@ -488,11 +500,15 @@ eop_core<eop_type>::apply_inplace_schur(Mat<typename T1::elem_type>& out, const
     
     if(use_mp && mp_gate<eT>::eval(n_elem))
       {
-      typename Proxy<T1>::ea_type P = x.P.get_ea();
-      
-      arma_applier_1_mp(*=);
+      if(eop_simd::apply_mp<eop_simd::mode_schur>(out_mem, x, n_elem) == false)
+        {
+        typename Proxy<T1>::ea_type P = x.P.get_ea();
+        
+        arma_applier_1_mp(*=);
+        }
       }
     else
+    if(eop_simd::apply<eop_simd::mode_schur>(out_mem, x, n_elem) == false)
       {
       if(memory::is_aligned(out_mem))
         {
@@ -562,11 +578,15 @@ eop_core<eop_type>::apply_inplace_div(Mat<typename T1::elem_type>& out, const eO
     
     if(use_mp && mp_gate<eT>::eval(n_elem))
       {
-      typename Proxy<T1>::ea_type P = x.P.get_ea();
-      
-      arma_applier_1_mp(/=);
+      if(eop_simd::apply_mp<eop_simd::mode_div>(out_mem, x, n_elem) == false)
+        {
+        typename Proxy<T1>::ea_type P = x.P.get_ea();
+        
+        arma_applier_1_mp(/=);
+        }
       }
     else
+    if(eop_simd::apply<eop_simd::mode_div>(out_mem, x, n_elem) == false)
       {
       if(memory::is_aligned(out_mem))
         {
@@ -639,11 +659,15 @@ eop_core<eop_type>::apply(Cube<typename T1::elem_type>& out, const eOpCube<T1, e
     
     if(use_mp && mp_gate<eT>::eval(n_elem))
       {
-      typename ProxyCube<T1>::ea_type P = x.P.get_ea();
-      
-      arma_applier_1_mp(=);
+      if(eop_simd::apply_mp<eop_simd::mode_equ>(out_mem, x, n_elem) == false)
+        {
+        typename ProxyCube<T1>::ea_type P = x.P.get_ea();
+        
+        arma_applier_1_mp(=);
+        }
       }
     else
+    if(eop_simd::apply<eop_simd::mode_equ>(out_mem, x, n_elem) == false)
       {
       if(memory::is_aligned(out_mem))
         {
@@ -718,11 +742,15 @@ eop_core<eop_type>::apply_inplace_plus(Cube<typename T1::elem_type>& out, const
     
     if(use_mp && mp_gate<eT>::eval(n_elem))
       {
-      typename ProxyCube<T1>::ea_type P = x.P.get_ea();
-      
-      arma_applier_1_mp(+=);
+      if(eop_simd::apply_mp<eop_simd::mode_plus>(out_mem, x, n_elem) == false)
+        {
+        typename ProxyCube<T1>::ea_type P = x.P.get_ea();
+        
+        arma_applier_1_mp(+=);
+        }
       }
     else
+    if(eop_simd::apply<eop_simd::mode_plus>(out_mem, x, n_elem) == false)
       {
       if(memory::is_aligned(out_mem))
         {
@@ -793,11 +821,15 @@ eop_core<eop_type>::apply_inplace_minus(Cube<typename T1::elem_type>& out, const
       
     if(use_mp && mp_gate<eT>::eval(n_elem))
       {
-      typename ProxyCube<T1>::ea_type P = x.P.get_ea();
-      
-      arma_applier_1_mp(-=);
+      if(eop_simd::apply_mp<eop_simd::mode_minus>(out_mem, x, n_elem) == false)
+        {
+        typename ProxyCube<T1>::ea_type P = x.P.get_ea();
+        
+        arma_applier_1_mp(-=);
+        }
       }
     else
+    if(eop_simd::apply<eop_simd::mode_minus>(out_mem, x, n_elem) == false)
       {
       if(memory::is_aligned(out_mem))
         {
@@ -868,11 +900,15 @@ eop_core<eop_type>::apply_inplace_schur(Cube<typename T1::elem_type>& out, const
     
     if(use_mp && mp_gate<eT>::eval(n_elem))
       {
-      typename ProxyCube<T1>::ea_type P = x.P.get_ea();
-      
-      arma_applier_1_mp(*=);
+      if(eop_simd::apply_mp<eop_simd::mode_schur>(out_mem, x, n_elem) == false)
+        {
+        typename ProxyCube<T1>::ea_type P = x.P.get_ea();
+        
+        arma_applier_1_mp(*=);
+        }
       }
     else
+    if(eop_simd::apply<eop_simd::mode_schur>(out_mem, x, n_elem) == false)
       {
       if(memory::is_aligned(out_mem))
         {
@@ -943,11 +979,15 @@ eop_core<eop_type>::apply_inplace_div(Cube<typename T1::elem_type>& out, const e
     
     if(use_mp && mp_gate<eT>::eval(n_elem))
       {
-      typename ProxyCube<T1>::ea_type P = x.P.get_ea();
-      
-      arma_applier_1_mp(/=);
+      if(eop_simd::apply_mp<eop_simd::mode_div>(out_mem, x, n_elem) == false)
+        {
+        typename ProxyCube<T1>::ea_type P = x.P.get_ea();
+        
+        arma_applier_1_mp(/=);
+        }
       }
     else
+    if(eop_simd::apply<eop_simd::mode_div>(out_mem, x, n_elem) == false)
       {
       if(memory::is_aligned(out_mem))
         {
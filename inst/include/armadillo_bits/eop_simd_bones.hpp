@@ -0,0 +1,177 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 The RcppArmadillo Authors
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup eop_simd
+//! @{
+
+
+
+template<typename eT>
+struct eop_simd_elem
+  {
+  static constexpr bool value = (is_same_type<eT,double>::yes || is_same_type<eT,float>::yes);
+  };
+
+
+
+//! elementary functions which have a SIMD implementation;
+//! these are only used when ARMA_USE_SIMD_MATH is enabled, otherwise the functions from the standard library are used
+template<typename op_type>
+struct eop_simd_math_op
+  {
+  static constexpr bool value = false;
+  };
+
+#if defined(ARMA_USE_SIMD_MATH)
+  template<> struct eop_simd_math_op<eop_exp  > { static constexpr bool value = true; };
+  template<> struct eop_simd_math_op<eop_exp2 > { static constexpr bool value = true; };
+  template<> struct eop_simd_math_op<eop_log  > { static constexpr bool value = true; };
+  template<> struct eop_simd_math_op<eop_log2 > { static constexpr bool value = true; };
+  template<> struct eop_simd_math_op<eop_log10> { static constexpr bool value = true; };
+  template<> struct eop_simd_math_op<eop_log1p> { static constexpr bool value = true; };
+  template<> struct eop_simd_math_op<eop_pow  > { static constexpr bool value = true; };
+  template<> struct eop_simd_math_op<eop_sin  > { static constexpr bool value = true; };
+  template<> struct eop_simd_math_op<eop_cos  > { static constexpr bool value = true; };
+  template<> struct eop_simd_math_op<eop_tanh > { static constexpr bool value = true; };
+  template<> struct eop_simd_math_op<eop_erf  > { static constexpr bool value = true; };
+  template<> struct eop_simd_math_op<eop_erfc > { static constexpr bool value = true; };
+#endif
+
+
+
+//! element-wise operations which have a SIMD implementation
+template<typename op_type>
+struct eop_simd_op
+  {
+  static constexpr bool value = eop_simd_math_op<op_type>::value;
+  };
+
+template<> struct eop_simd_op<eop_neg              > { static constexpr bool value = true; };
+template<> struct eop_simd_op<eop_scalar_plus      > { static constexpr bool value = true; };
+template<> struct eop_simd_op<eop_scalar_minus_pre > { static constexpr bool value = true; };
+template<> struct eop_simd_op<eop_scalar_minus_post> { static constexpr bool value = true; };
+template<> struct eop_simd_op<eop_scalar_times     > { static constexpr bool value = true; };
+template<> struct eop_simd_op<eop_scalar_div_pre   > { static constexpr bool value = true; };
+template<> struct eop_simd_op<eop_scalar_div_post  > { static constexpr bool value = true; };
+template<> struct eop_simd_op<eop_square           > { static constexpr bool value = true; };
+template<> struct eop_simd_op<eop_sqrt             > { static constexpr bool value = true; };
+template<> struct eop_simd_op<eop_abs              > { static constexpr bool value = true; };
+
+template<> struct eop_simd_op<eglue_plus           > { static constexpr bool value = true; };
+template<> struct eop_simd_op<eglue_minus          > { static constexpr bool value = true; };
+template<> struct eop_simd_op<eglue_schur          > { static constexpr bool value = true; };
+template<> struct eop_simd_op<eglue_div            > { static constexpr bool value = true; };
+
+
+
+//! leaf of an expression: an object whose elements are stored contiguously in memory
+template<typename T1, const bool is_cube = is_arma_cube_type<T1>::value>
+struct eop_simd_leaf
+  {
+  static constexpr bool value = is_same_type< typename Proxy<T1>::ea_type, const typename T1::elem_type* >::yes;
+  };
+
+template<typename T1>
+struct eop_simd_leaf<T1, true>
+  {
+  static constexpr bool value = is_same_type< typename ProxyCube<T1>::ea_type, const typename T1::elem_type* >::yes;
+  };
+
+
+
+//! expressions which can be evaluated by the SIMD kernels:
+//! trees of eOp and eGlue nodes with supported operations, where all leaves are stored contiguously in memory
+template<typename T1>
+struct eop_simd_expr
+  {
+  static constexpr bool value = eop_simd_elem<typename T1::elem_type>::value && eop_simd_leaf<T1>::value;
+  };
+
+template<typename T1, typename eop_type>
+struct eop_simd_expr< eOp<T1, eop_type> >
+  {
+  static constexpr bool value = eop_simd_op<eop_type>::value && eop_simd_expr<T1>::value;
+  };
+
+template<typename T1, typename T2, typename eglue_type>
+struct eop_simd_expr< eGlue<T1, T2, eglue_type> >
+  {
+  static constexpr bool value = eop_simd_op<eglue_type>::value && eop_simd_expr<T1>::value && eop_simd_expr<T2>::value;
+  };
+
+template<typename T1, typename eop_type>
+struct eop_simd_expr< eOpCube<T1, eop_type> >
+  {
+  static constexpr bool value = eop_simd_op<eop_type>::value && eop_simd_expr<T1>::value;
+  };
+
+template<typename T1, typename T2, typename eglue_type>
+struct eop_simd_expr< eGlueCube<T1, T2, eglue_type> >
+  {
+  static constexpr bool value = eop_simd_op<eglue_type>::value && eop_simd_expr<T1>::value && eop_simd_expr<T2>::value;
+  };
+
+
+
+//! explicit SIMD kernels for element-wise expressions, with the instruction set (SSE2, AVX2 or AVX-512) selected at run time;
+//! this provides full-width vector code even when the compiler is restricted to SSE2 (eg. default x86-64 flags).
+//! the kernels are only available when ARMA_USE_SIMD_DISPATCH is enabled;
+//! otherwise apply() and clamp() return false and the caller uses its generic loops
+struct eop_simd
+  {
+  static constexpr uword level_none   = 0;
+  static constexpr uword level_sse2   = 1;
+  static constexpr uword level_avx2   = 2;
+  static constexpr uword level_avx512 = 3;
+  
+  //! how the result is stored: out = x, out += x, out -= x, out %= x, out /= x
+  static constexpr uword mode_equ   = 0;
+  static constexpr uword mode_plus  = 1;
+  static constexpr uword mode_minus = 2;
+  static constexpr uword mode_schur = 3;
+  static constexpr uword mode_div   = 4;
+  
+  //! below this number of elements the generic loops are used, as they avoid the overhead of dispatch
+  static constexpr uword min_n_elem = 16;
+  
+  inline static uword get_level();
+  inline static uword detect_level();
+  
+  template<const uword mode, typename expr_type> inline static typename enable_if2< (eop_simd_expr<expr_type>::value == true ), bool >::result apply(typename expr_type::elem_type* out_mem, const expr_type& x, const uword n_elem);
+  template<const uword mode, typename expr_type> inline static typename enable_if2< (eop_simd_expr<expr_type>::value == false), bool >::result apply(typename expr_type::elem_type* out_mem, const expr_type& x, const uword n_elem);
+  
+  //! as per apply(), with the elements divided into contiguous chunks which are processed by OpenMP threads;
+  //! used instead of the OpenMP loops in eop_core and eglue_core, so that each thread uses the SIMD kernels
+  template<const uword mode, typename expr_type> inline static typename enable_if2< (eop_simd_expr<expr_type>::value == true ), bool >::result apply_mp(typename expr_type::elem_type* out_mem, const expr_type& x, const uword n_elem);
+  template<const uword mode, typename expr_type> inline static typename enable_if2< (eop_simd_expr<expr_type>::value == false), bool >::result apply_mp(typename expr_type::elem_type* out_mem, const expr_type& x, const uword n_elem);
+  
+  //! number of chunks for n_threads OpenMP threads, such that each chunk has at least min_n_elem elements (if n_elem >= min_n_elem)
+  inline static uword mp_n_chunks(const uword n_elem, const int n_threads);
+  
+  template<typename eT> inline static typename enable_if2< (eop_simd_elem<eT>::value == true ), bool >::result clamp(eT* out_mem, const eT* X_mem, const uword n_elem, const eT min_val, const eT max_val);
+  template<typename eT> inline static typename enable_if2< (eop_simd_elem<eT>::value == false), bool >::result clamp(eT* out_mem, const eT* X_mem, const uword n_elem, const eT min_val, const eT max_val);
+  
+  //! out = op(X), for a single element-wise operation (eg. eop_exp) applied to an array; out_mem may be equal to X_mem
+  template<typename eop_type, typename eT> inline static bool can_process(const uword n_elem);
+  
+  template<typename eop_type, typename eT> inline static typename enable_if2< (eop_simd_elem<eT>::value && eop_simd_op<eop_type>::value) == true,  bool >::result process(eT* out_mem, const eT* X_mem, const uword n_elem, const eT k = eT(0));
+  template<typename eop_type, typename eT> inline static typename enable_if2< (eop_simd_elem<eT>::value && eop_simd_op<eop_type>::value) == false, bool >::result process(eT* out_mem, const eT* X_mem, const uword n_elem, const eT k = eT(0));
+  };
+
+
+
+//! @}
@@ -0,0 +1,1321 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 The RcppArmadillo Authors
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup eop_simd
+//! @{
+
+
+
+#if defined(ARMA_USE_SIMD_DISPATCH)
+
+#undef arma_simd_sse2_inline
+#undef arma_simd_avx2_inline
+#undef arma_simd_avx512_inline
+
+#undef arma_simd_sse2_fn
+#undef arma_simd_avx2_fn
+#undef arma_simd_avx512_fn
+
+#undef arma_simd_engine
+#undef arma_simd_math
+
+// SSE2 is part of the x86-64 baseline, so it does not require a target attribute
+
+#define arma_simd_sse2_inline    __attribute__((__always_inline__)) inline
+#define arma_simd_avx2_inline    __attribute__((__target__("avx2"),    __always_inline__)) inline
+#define arma_simd_avx512_inline  __attribute__((__target__("avx512f"), __always_inline__)) inline
+
+#define arma_simd_sse2_fn        inline
+#define arma_simd_avx2_fn        __attribute__((__target__("avx2")))    inline
+#define arma_simd_avx512_fn      __attribute__((__target__("avx512f"))) inline
+
+
+
+// 
+// vector registers and operations for each instruction set;
+// max(a,b) and min(a,b) are defined as (a > b) ? a : b and (a < b) ? a : b, which matches the behaviour of the hardware instructions for NaN;
+// the result of mul() is passed through an empty asm statement, which prevents the compiler from contracting a product and a subsequent sum
+// into a fused multiply-add instruction within the kernels, so that the kernels give the same results for all instruction sets;
+// the generic loops are not protected in this way, so when the compiler is allowed to contract them (eg. gcc with -march=native or -mfma,
+// where -ffp-contract=fast is the default) the results of the kernels and the generic loops can differ in the last bit
+
+
+template<typename eT> struct eop_simd_sse2_vec   {};
+template<typename eT> struct eop_simd_avx2_vec   {};
+template<typename eT> struct eop_simd_avx512_vec {};
+
+
+template<>
+struct eop_simd_sse2_vec<double>
+  {
+  typedef __m128d vT;
+  
+  static constexpr uword width = 2;
+  
+  arma_simd_sse2_inline static vT   load (const double* mem)        { return _mm_loadu_pd(mem);                   }
+  arma_simd_sse2_inline static void store(double* mem, const vT a)  { _mm_storeu_pd(mem, a);                      }
+  arma_simd_sse2_inline static vT   set1 (const double val)         { return _mm_set1_pd(val);                    }
+  arma_simd_sse2_inline static vT   add  (const vT a, const vT b)   { return _mm_add_pd(a, b);                    }
+  arma_simd_sse2_inline static vT   sub  (const vT a, const vT b)   { return _mm_sub_pd(a, b);                    }
+  arma_simd_sse2_inline static vT   div  (const vT a, const vT b)   { return _mm_div_pd(a, b);                    }
+  arma_simd_sse2_inline static vT   max  (const vT a, const vT b)   { return _mm_max_pd(a, b);                    }
+  arma_simd_sse2_inline static vT   min  (const vT a, const vT b)   { return _mm_min_pd(a, b);                    }
+  arma_simd_sse2_inline static vT   sqrt (const vT a)               { return _mm_sqrt_pd(a);                      }
+  arma_simd_sse2_inline static vT   abs  (const vT a)               { return _mm_andnot_pd(_mm_set1_pd(-0.0), a); }
+  arma_simd_sse2_inline static vT   neg  (const vT a)               { return _mm_xor_pd   (_mm_set1_pd(-0.0), a); }
+  
+  arma_simd_sse2_inline static vT mul(const vT a, const vT b)
+    {
+    vT c = _mm_mul_pd(a, b);
+    
+    __asm__("" : "+x"(c));
+    
+    return c;
+    }
+  
+  typedef __m128d mT;
+  
+  arma_simd_sse2_inline static vT   bits    (const long long val)           { return _mm_castsi128_pd(_mm_set1_epi64x(val));                                       }
+  arma_simd_sse2_inline static vT   add_bits(const vT a, const long long val) { return _mm_castsi128_pd(_mm_add_epi64(_mm_castpd_si128(a), _mm_set1_epi64x(val))); }
+  arma_simd_sse2_inline static vT   bit_and (const vT a, const vT b)        { return _mm_and_pd(a, b);                                                              }
+  arma_simd_sse2_inline static vT   bit_or  (const vT a, const vT b)        { return _mm_or_pd (a, b);                                                              }
+  arma_simd_sse2_inline static mT   lt      (const vT a, const vT b)        { return _mm_cmplt_pd (a, b);                                                           }
+  arma_simd_sse2_inline static mT   eq      (const vT a, const vT b)        { return _mm_cmpeq_pd (a, b);                                                           }
+  arma_simd_sse2_inline static mT   not_lt  (const vT a, const vT b)        { return _mm_cmpnlt_pd(a, b);                                                           }
+  arma_simd_sse2_inline static mT   not_le  (const vT a, const vT b)        { return _mm_cmpnle_pd(a, b);                                                           }
+  arma_simd_sse2_inline static mT   mask_or (const mT a, const mT b)        { return _mm_or_pd(a, b);                                                               }
+  arma_simd_sse2_inline static int  mask_bits(const mT m)                   { return _mm_movemask_pd(m);                                                            }
+  arma_simd_sse2_inline static vT   select  (const mT m, const vT a, const vT b) { return _mm_or_pd(_mm_and_pd(m, a), _mm_andnot_pd(m, b));                          }
+  
+  template<int n> arma_simd_sse2_inline static vT shl(const vT a) { return _mm_castsi128_pd(_mm_slli_epi64(_mm_castpd_si128(a), n)); }
+  template<int n> arma_simd_sse2_inline static vT shr(const vT a) { return _mm_castsi128_pd(_mm_srli_epi64(_mm_castpd_si128(a), n)); }
+  };
+
+
+template<>
+struct eop_simd_sse2_vec<float>
+  {
+  typedef __m128 vT;
+  
+  static constexpr uword width = 4;
+  
+  arma_simd_sse2_inline static vT   load (const float* mem)         { return _mm_loadu_ps(mem);                    }
+  arma_simd_sse2_inline static void store(float* mem, const vT a)   { _mm_storeu_ps(mem, a);                       }
+  arma_simd_sse2_inline static vT   set1 (const float val)          { return _mm_set1_ps(val);                     }
+  arma_simd_sse2_inline static vT   add  (const vT a, const vT b)   { return _mm_add_ps(a, b);                     }
+  arma_simd_sse2_inline static vT   sub  (const vT a, const vT b)   { return _mm_sub_ps(a, b);                     }
+  arma_simd_sse2_inline static vT   div  (const vT a, const vT b)   { return _mm_div_ps(a, b);                     }
+  arma_simd_sse2_inline static vT   max  (const vT a, const vT b)   { return _mm_max_ps(a, b);                     }
+  arma_simd_sse2_inline static vT   min  (const vT a, const vT b)   { return _mm_min_ps(a, b);                     }
+  arma_simd_sse2_inline static vT   sqrt (const vT a)               { return _mm_sqrt_ps(a);                       }
+  arma_simd_sse2_inline static vT   abs  (const vT a)               { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+  arma_simd_sse2_inline static vT   neg  (const vT a)               { return _mm_xor_ps   (_mm_set1_ps(-0.0f), a); }
+  
+  arma_simd_sse2_inline static vT mul(const vT a, const vT b)
+    {
+    vT c = _mm_mul_ps(a, b);
+    
+    __asm__("" : "+x"(c));
+    
+    return c;
+    }
+  
+  typedef eop_simd_sse2_vec<double> dvec;
+  
+  arma_simd_sse2_inline static dvec::vT lo_to_double(const vT a)                         { return _mm_cvtps_pd(a);                                     }
+  arma_simd_sse2_inline static dvec::vT hi_to_double(const vT a)                         { return _mm_cvtps_pd(_mm_movehl_ps(a, a));                   }
+  arma_simd_sse2_inline static vT       from_double (const dvec::vT lo, const dvec::vT hi) { return _mm_movelh_ps(_mm_cvtpd_ps(lo), _mm_cvtpd_ps(hi)); }
+  };
+
+
+template<>
+struct eop_simd_avx2_vec<double>
+  {
+  typedef __m256d vT;
+  
+  static constexpr uword width = 4;
+  
+  arma_simd_avx2_inline static vT   load (const double* mem)        { return _mm256_loadu_pd(mem);                      }
+  arma_simd_avx2_inline static void store(double* mem, const vT a)  { _mm256_storeu_pd(mem, a);                         }
+  arma_simd_avx2_inline static vT   set1 (const double val)         { return _mm256_set1_pd(val);                       }
+  arma_simd_avx2_inline static vT   add  (const vT a, const vT b)   { return _mm256_add_pd(a, b);                       }
+  arma_simd_avx2_inline static vT   sub  (const vT a, const vT b)   { return _mm256_sub_pd(a, b);                       }
+  arma_simd_avx2_inline static vT   div  (const vT a, const vT b)   { return _mm256_div_pd(a, b);                       }
+  arma_simd_avx2_inline static vT   max  (const vT a, const vT b)   { return _mm256_max_pd(a, b);                       }
+  arma_simd_avx2_inline static vT   min  (const vT a, const vT b)   { return _mm256_min_pd(a, b);                       }
+  arma_simd_avx2_inline static vT   sqrt (const vT a)               { return _mm256_sqrt_pd(a);                         }
+  arma_simd_avx2_inline static vT   abs  (const vT a)               { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a); }
+  arma_simd_avx2_inline static vT   neg  (const vT a)               { return _mm256_xor_pd   (_mm256_set1_pd(-0.0), a); }
+  
+  arma_simd_avx2_inline static vT mul(const vT a, const vT b)
+    {
+    vT c = _mm256_mul_pd(a, b);
+    
+    __asm__("" : "+x"(c));
+    
+    return c;
+    }
+  
+  typedef __m256d mT;
+  
+  arma_simd_avx2_inline static vT   bits    (const long long val)           { return _mm256_castsi256_pd(_mm256_set1_epi64x(val));                                             }
+  arma_simd_avx2_inline static vT   add_bits(const vT a, const long long val) { return _mm256_castsi256_pd(_mm256_add_epi64(_mm256_castpd_si256(a), _mm256_set1_epi64x(val))); }
+  arma_simd_avx2_inline static vT   bit_and (const vT a, const vT b)        { return _mm256_and_pd(a, b);                                                                      }
+  arma_simd_avx2_inline static vT   bit_or  (const vT a, const vT b)        { return _mm256_or_pd (a, b);                                                                      }
+  arma_simd_avx2_inline static mT   lt      (const vT a, const vT b)        { return _mm256_cmp_pd(a, b, _CMP_LT_OQ );                                                         }
+  arma_simd_avx2_inline static mT   eq      (const vT a, const vT b)        { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ );                                                         }
+  arma_simd_avx2_inline static mT   not_lt  (const vT a, const vT b)        { return _mm256_cmp_pd(a, b, _CMP_NLT_UQ);                                                         }
+  arma_simd_avx2_inline static mT   not_le  (const vT a, const vT b)        { return _mm256_cmp_pd(a, b, _CMP_NLE_UQ);                                                         }
+  arma_simd_avx2_inline static mT   mask_or (const mT a, const mT b)        { return _mm256_or_pd(a, b);                                                                       }
+  arma_simd_avx2_inline static int  mask_bits(const mT m)                   { return _mm256_movemask_pd(m);                                                                    }
+  arma_simd_avx2_inline static vT   select  (const mT m, const vT a, const vT b) { return _mm256_blendv_pd(b, a, m);                                                          }
+  
+  template<int n> arma_simd_avx2_inline static vT shl(const vT a) { return _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_castpd_si256(a), n)); }
+  template<int n> arma_simd_avx2_inline static vT shr(const vT a) { return _mm256_castsi256_pd(_mm256_srli_epi64(_mm256_castpd_si256(a), n)); }
+  };
+
+
+template<>
+struct eop_simd_avx2_vec<float>
+  {
+  typedef __m256 vT;
+  
+  static constexpr uword width = 8;
+  
+  arma_simd_avx2_inline static vT   load (const float* mem)         { return _mm256_loadu_ps(mem);                       }
+  arma_simd_avx2_inline static void store(float* mem, const vT a)   { _mm256_storeu_ps(mem, a);                          }
+  arma_simd_avx2_inline static vT   set1 (const float val)          { return _mm256_set1_ps(val);                        }
+  arma_simd_avx2_inline static vT   add  (const vT a, const vT b)   { return _mm256_add_ps(a, b);                        }
+  arma_simd_avx2_inline static vT   sub  (const vT a, const vT b)   { return _mm256_sub_ps(a, b);                        }
+  arma_simd_avx2_inline static vT   div  (const vT a, const vT b)   { return _mm256_div_ps(a, b);                        }
+  arma_simd_avx2_inline static vT   max  (const vT a, const vT b)   { return _mm256_max_ps(a, b);                        }
+  arma_simd_avx2_inline static vT   min  (const vT a, const vT b)   { return _mm256_min_ps(a, b);                        }
+  arma_simd_avx2_inline static vT   sqrt (const vT a)               { return _mm256_sqrt_ps(a);                          }
+  arma_simd_avx2_inline static vT   abs  (const vT a)               { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+  arma_simd_avx2_inline static vT   neg  (const vT a)               { return _mm256_xor_ps   (_mm256_set1_ps(-0.0f), a); }
+  
+  arma_simd_avx2_inline static vT mul(const vT a, const vT b)
+    {
+    vT c = _mm256_mul_ps(a, b);
+    
+    __asm__("" : "+x"(c));
+    
+    return c;
+    }
+  
+  typedef eop_simd_avx2_vec<double> dvec;
+  
+  arma_simd_avx2_inline static dvec::vT lo_to_double(const vT a) { return _mm256_cvtps_pd(_mm256_castps256_ps128(a));   }
+  arma_simd_avx2_inline static dvec::vT hi_to_double(const vT a) { return _mm256_cvtps_pd(_mm256_extractf128_ps(a, 1)); }
+  
+  arma_simd_avx2_inline static vT from_double(const dvec::vT lo, const dvec::vT hi)
+    {
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(lo)), _mm256_cvtpd_ps(hi), 1);
+    }
+  };
+
+
+// bitwise operations on 512 bit floating point vectors require AVX-512DQ, so integer operations are used instead;
+// the masked forms of max(), min() and sqrt() avoid spurious warnings from gcc about uninitialised variables within the intrinsics
+
+template<>
+struct eop_simd_avx512_vec<double>
+  {
+  typedef __m512d vT;
+  
+  static constexpr uword width = 8;
+  
+  arma_simd_avx512_inline static vT   load (const double* mem)        { return _mm512_loadu_pd(mem);                      }
+  arma_simd_avx512_inline static void store(double* mem, const vT a)  { _mm512_storeu_pd(mem, a);                         }
+  arma_simd_avx512_inline static vT   set1 (const double val)         { return _mm512_set1_pd(val);                       }
+  arma_simd_avx512_inline static vT   add  (const vT a, const vT b)   { return _mm512_add_pd(a, b);                       }
+  arma_simd_avx512_inline static vT   sub  (const vT a, const vT b)   { return _mm512_sub_pd(a, b);                       }
+  arma_simd_avx512_inline static vT   div  (const vT a, const vT b)   { return _mm512_div_pd(a, b);                       }
+  arma_simd_avx512_inline static vT   max  (const vT a, const vT b)   { return _mm512_maskz_max_pd(__mmask8(0xFF), a, b); }
+  arma_simd_avx512_inline static vT   min  (const vT a, const vT b)   { return _mm512_maskz_min_pd(__mmask8(0xFF), a, b); }
+  arma_simd_avx512_inline static vT   sqrt (const vT a)               { return _mm512_maskz_sqrt_pd(__mmask8(0xFF), a);   }
+  arma_simd_avx512_inline static vT   abs  (const vT a)               { return _mm512_abs_pd(a);                          }
+  
+  arma_simd_avx512_inline static vT mul(const vT a, const vT b)
+    {
+    vT c = _mm512_mul_pd(a, b);
+    
+    __asm__("" : "+v"(c));
+    
+    return c;
+    }
+  
+  arma_simd_avx512_inline static vT neg(const vT a)
+    {
+    const __m512i sign_mask = _mm512_castpd_si512(_mm512_set1_pd(-0.0));
+    
+    return _mm512_castsi512_pd(_mm512_xor_si512(sign_mask, _mm512_castpd_si512(a)));
+    }
+  
+  typedef __mmask8 mT;
+  
+  arma_simd_avx512_inline static vT   bits    (const long long val)           { return _mm512_castsi512_pd(_mm512_set1_epi64(val));                                                                    }
+  arma_simd_avx512_inline static vT   add_bits(const vT a, const long long val) { return _mm512_castsi512_pd(_mm512_add_epi64(_mm512_castpd_si512(a), _mm512_set1_epi64(val)));                          }
+  arma_simd_avx512_inline static vT   bit_and (const vT a, const vT b)        { return _mm512_castsi512_pd(_mm512_and_si512(_mm512_castpd_si512(a), _mm512_castpd_si512(b)));                          }
+  arma_simd_avx512_inline static vT   bit_or  (const vT a, const vT b)        { return _mm512_castsi512_pd(_mm512_or_si512 (_mm512_castpd_si512(a), _mm512_castpd_si512(b)));                          }
+  arma_simd_avx512_inline static mT   lt      (const vT a, const vT b)        { return _mm512_cmp_pd_mask(a, b, _CMP_LT_OQ );                                                                          }
+  arma_simd_avx512_inline static mT   eq      (const vT a, const vT b)        { return _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ );                                                                          }
+  arma_simd_avx512_inline static mT   not_lt  (const vT a, const vT b)        { return _mm512_cmp_pd_mask(a, b, _CMP_NLT_UQ);                                                                          }
+  arma_simd_avx512_inline static mT   not_le  (const vT a, const vT b)        { return _mm512_cmp_pd_mask(a, b, _CMP_NLE_UQ);                                                                          }
+  arma_simd_avx512_inline static mT   mask_or (const mT a, const mT b)        { return mT(a | b);                                                                                                      }
+  arma_simd_avx512_inline static int  mask_bits(const mT m)                   { return int(m);                                                                                                         }
+  arma_simd_avx512_inline static vT   select  (const mT m, const vT a, const vT b) { return _mm512_mask_blend_pd(m, b, a);                                                                            }
+  
+  template<int n> arma_simd_avx512_inline static vT shl(const vT a) { return _mm512_castsi512_pd(_mm512_maskz_slli_epi64(__mmask8(0xFF), _mm512_castpd_si512(a), n)); }
+  template<int n> arma_simd_avx512_inline static vT shr(const vT a) { return _mm512_castsi512_pd(_mm512_maskz_srli_epi64(__mmask8(0xFF), _mm512_castpd_si512(a), n)); }
+  };
+
+
+template<>
+struct eop_simd_avx512_vec<float>
+  {
+  typedef __m512 vT;
+  
+  static constexpr uword width = 16;
+  
+  arma_simd_avx512_inline static vT   load (const float* mem)         { return _mm512_loadu_ps(mem);                         }
+  arma_simd_avx512_inline static void store(float* mem, const vT a)   { _mm512_storeu_ps(mem, a);                            }
+  arma_simd_avx512_inline static vT   set1 (const float val)          { return _mm512_set1_ps(val);                          }
+  arma_simd_avx512_inline static vT   add  (const vT a, const vT b)   { return _mm512_add_ps(a, b);                          }
+  arma_simd_avx512_inline static vT   sub  (const vT a, const vT b)   { return _mm512_sub_ps(a, b);                          }
+  arma_simd_avx512_inline static vT   div  (const vT a, const vT b)   { return _mm512_div_ps(a, b);                          }
+  arma_simd_avx512_inline static vT   max  (const vT a, const vT b)   { return _mm512_maskz_max_ps(__mmask16(0xFFFF), a, b); }
+  arma_simd_avx512_inline static vT   min  (const vT a, const vT b)   { return _mm512_maskz_min_ps(__mmask16(0xFFFF), a, b); }
+  arma_simd_avx512_inline static vT   sqrt (const vT a)               { return _mm512_maskz_sqrt_ps(__mmask16(0xFFFF), a);   }
+  arma_simd_avx512_inline static vT   abs  (const vT a)               { return _mm512_abs_ps(a);                             }
+  
+  arma_simd_avx512_inline static vT mul(const vT a, const vT b)
+    {
+    vT c = _mm512_mul_ps(a, b);
+    
+    __asm__("" : "+v"(c));
+    
+    return c;
+    }
+  
+  arma_simd_avx512_inline static vT neg(const vT a)
+    {
+    const __m512i sign_mask = _mm512_castps_si512(_mm512_set1_ps(-0.0f));
+    
+    return _mm512_castsi512_ps(_mm512_xor_si512(sign_mask, _mm512_castps_si512(a)));
+    }
+  
+  typedef eop_simd_avx512_vec<double> dvec;
+  
+  arma_simd_avx512_inline static dvec::vT lo_to_double(const vT a)
+    {
+    const __m256d lo = _mm512_maskz_extractf64x4_pd(__mmask8(0xFF), _mm512_castps_pd(a), 0);
+    
+    return _mm512_maskz_cvtps_pd(__mmask8(0xFF), _mm256_castpd_ps(lo));
+    }
+  
+  arma_simd_avx512_inline static dvec::vT hi_to_double(const vT a)
+    {
+    const __m256d hi = _mm512_maskz_extractf64x4_pd(__mmask8(0xFF), _mm512_castps_pd(a), 1);
+    
+    return _mm512_maskz_cvtps_pd(__mmask8(0xFF), _mm256_castpd_ps(hi));
+    }
+  
+  arma_simd_avx512_inline static vT from_double(const dvec::vT lo, const dvec::vT hi)
+    {
+    const __m256d lo_f = _mm256_castps_pd(_mm512_maskz_cvtpd_ps(__mmask8(0xFF), lo));
+    const __m256d hi_f = _mm256_castps_pd(_mm512_maskz_cvtpd_ps(__mmask8(0xFF), hi));
+    
+    const __m512d out = _mm512_maskz_insertf64x4(__mmask8(0xFF), _mm512_maskz_insertf64x4(__mmask8(0xFF), _mm512_setzero_pd(), lo_f, 0), hi_f, 1);
+    
+    return _mm512_castpd_ps(out);
+    }
+  };
+
+
+
+// 
+// the kernels are identical for each instruction set, apart from the vector type and the target attribute;
+// as a function can only be inlined into a function compiled for the same (or larger) instruction set,
+// every function of a kernel must carry the target attribute, and the kernels are hence generated by the macro below.
+// 
+// eval() evaluates W consecutive elements of an expression, starting at element i;
+// the leaves of the expression are proxies which provide direct access to memory via get_ea();
+// the trailing elements (less than W) are obtained by evaluating the last W elements of the expression,
+// so that all elements are computed by the same vector code; as the operations are element-wise,
+// the lanes which overlap already processed elements are discarded (this requires n_elem >= W, which is ensured by min_n_elem).
+// process() applies a single element-wise operation to an array
+
+
+#define arma_simd_engine(isa) \
+  \
+  template<typename eT, typename proxy_type> \
+  arma_simd_##isa##_inline static typename eop_simd_##isa##_vec<eT>::vT \
+  eval(const proxy_type& P, const uword i) \
+    { \
+    return eop_simd_##isa##_vec<eT>::load( &(P.get_ea()[i]) ); \
+    } \
+  \
+  template<typename eT, typename T1, typename eop_type> \
+  arma_simd_##isa##_inline static typename eop_simd_##isa##_vec<eT>::vT \
+  eval(const eOp<T1, eop_type>& x, const uword i) \
+    { \
+    return eval_eop<eT, eop_type>( eval<eT>(x.P, i), x.aux ); \
+    } \
+  \
+  template<typename eT, typename T1, typename eop_type> \
+  arma_simd_##isa##_inline static typename eop_simd_##isa##_vec<eT>::vT \
+  eval(const eOpCube<T1, eop_type>& x, const uword i) \
+    { \
+    return eval_eop<eT, eop_type>( eval<eT>(x.P, i), x.aux ); \
+    } \
+  \
+  template<typename eT, typename T1, typename T2, typename eglue_type> \
+  arma_simd_##isa##_inline static typename eop_simd_##isa##_vec<eT>::vT \
+  eval(const eGlue<T1, T2, eglue_type>& x, const uword i) \
+    { \
+    return eval_eglue<eT, eglue_type>( eval<eT>(x.P1, i), eval<eT>(x.P2, i) ); \
+    } \
+  \
+  template<typename eT, typename T1, typename T2, typename eglue_type> \
+  arma_simd_##isa##_inline static typename eop_simd_##isa##_vec<eT>::vT \
+  eval(const eGlueCube<T1, T2, eglue_type>& x, const uword i) \
+    { \
+    return eval_eglue<eT, eglue_type>( eval<eT>(x.P1, i), eval<eT>(x.P2, i) ); \
+    } \
+  \
+  template<typename eT, typename T1, typename eop_type> \
+  arma_simd_##isa##_inline static typename eop_simd_##isa##_vec<eT>::vT \
+  eval(const Proxy< eOp<T1, eop_type> >& P, const uword i) { return eval<eT>(P.Q, i); } \
+  \
+  template<typename eT, typename T1, typename eop_type> \
+  arma_simd_##isa##_inline static typename eop_simd_##isa##_vec<eT>::vT \
+  eval(const ProxyCube< eOpCube<T1, eop_type> >& P, const uword i) { return eval<eT>(P.Q, i); } \
+  \
+  template<typename eT, typename T1, typename T2, typename eglue_type> \
+  arma_simd_##isa##_inline static typename eop_simd_##isa##_vec<eT>::vT \
+  eval(const Proxy< eGlue<T1, T2, eglue_type> >& P, const uword i) { return eval<eT>(P.Q, i); } \
+  \
+  template<typename eT, typename T1, typename T2, typename eglue_type> \
+  arma_simd_##isa##_inline static typename eop_simd_##isa##_vec<eT>::vT \
+  eval(const ProxyCube< eGlueCube<T1, T2, eglue_type> >& P, const uword i) { return eval<eT>(P.Q, i); } \
+  \
+  template<typename eT, typename eop_type> \
+  arma_simd_##isa##_inline static typename eop_simd_##isa##_vec<eT>::vT \
+  eval_eop(const typename eop_simd_##isa##_vec<eT>::vT a, const eT k) \
+    { \
+    typedef eop_simd_##isa##_vec<eT> V; \
+    \
+         if(is_same_type<eop_type, eop_scalar_plus      >::yes)  { return V::add(a, V::set1(k)); } \
+    else if(is_same_type<eop_type, eop_scalar_minus_pre >::yes)  { return V::sub(V::set1(k), a); } \
+    else if(is_same_type<eop_type, eop_scalar_minus_post>::yes)  { return V::sub(a, V::set1(k)); } \
+    else if(is_same_type<eop_type, eop_scalar_times     >::yes)  { return V::mul(a, V::set1(k)); } \
+    else if(is_same_type<eop_type, eop_scalar_div_pre   >::yes)  { return V::div(V::set1(k), a); } \
+    else if(is_same_type<eop_type, eop_scalar_div_post  >::yes)  { return V::div(a, V::set1(k)); } \
+    else if(is_same_type<eop_type, eop_square           >::yes)  { return V::mul(a, a);          } \
+    else if(is_same_type<eop_type, eop_neg              >::yes)  { return V::neg(a);             } \
+    else if(is_same_type<eop_type, eop_sqrt             >::yes)  { return V::sqrt(a);            } \
+    else if(is_same_type<eop_type, eop_abs              >::yes)  { return V::abs(a);             } \
+    else if(eop_simd_math_op<eop_type>::value               )  { return math<eop_type>(a, k);  } \
+    \
+    return a; \
+    } \
+  \
+  template<typename eT, typename eglue_type> \
+  arma_simd_##isa##_inline static typename eop_simd_##isa##_vec<eT>::vT \
+  eval_eglue(const typename eop_simd_##isa##_vec<eT>::vT a, const typename eop_simd_##isa##_vec<eT>::vT b) \
+    { \
+    typedef eop_simd_##isa##_vec<eT> V; \
+    \
+         if(is_same_type<eglue_type, eglue_plus >::yes)  { return V::add(a, b); } \
+    else if(is_same_type<eglue_type, eglue_minus>::yes)  { return V::sub(a, b); } \
+    else if(is_same_type<eglue_type, eglue_schur>::yes)  { return V::mul(a, b); } \
+    else if(is_same_type<eglue_type, eglue_div  >::yes)  { return V::div(a, b); } \
+    \
+    return a; \
+    } \
+  \
+  template<const uword mode, typename eT> \
+  arma_simd_##isa##_inline static void \
+  store(eT* out_mem, const typename eop_simd_##isa##_vec<eT>::vT val) \
+    { \
+    typedef eop_simd_##isa##_vec<eT> V; \
+    \
+         if(mode == eop_simd::mode_equ  )  { V::store(out_mem,                      val ); } \
+    else if(mode == eop_simd::mode_plus )  { V::store(out_mem, V::add(V::load(out_mem), val)); } \
+    else if(mode == eop_simd::mode_minus)  { V::store(out_mem, V::sub(V::load(out_mem), val)); } \
+    else if(mode == eop_simd::mode_schur)  { V::store(out_mem, V::mul(V::load(out_mem), val)); } \
+    else if(mode == eop_simd::mode_div  )  { V::store(out_mem, V::div(V::load(out_mem), val)); } \
+    } \
+  \
+  template<const uword mode, typename eT> \
+  arma_simd_##isa##_inline static void \
+  store_tail(eT* out_mem, const typename eop_simd_##isa##_vec<eT>::vT val, const uword n_main, const uword n_elem) \
+    { \
+    constexpr uword W = eop_simd_##isa##_vec<eT>::width; \
+    \
+    eT tmp[W]; \
+    \
+    eop_simd_##isa##_vec<eT>::store(tmp, val); \
+    \
+    const eT* tmp_mem = &(tmp[W - (n_elem - n_main)]); \
+    \
+    for(uword i=n_main; i < n_elem; ++i) \
+      { \
+      const eT tmp_val = (*tmp_mem);  ++tmp_mem; \
+      \
+           if(mode == eop_simd::mode_equ  )  { out_mem[i]  = tmp_val; } \
+      else if(mode == eop_simd::mode_plus )  { out_mem[i] += tmp_val; } \
+      else if(mode == eop_simd::mode_minus)  { out_mem[i] -= tmp_val; } \
+      else if(mode == eop_simd::mode_schur)  { out_mem[i] *= tmp_val; } \
+      else if(mode == eop_simd::mode_div  )  { out_mem[i] /= tmp_val; } \
+      } \
+    } \
+  \
+  template<const uword mode, typename expr_type> \
+  arma_simd_##isa##_fn static void \
+  apply(typename expr_type::elem_type* out_mem, const expr_type& x, const uword i_start, const uword i_end) \
+    { \
+    typedef typename expr_type::elem_type eT; \
+    \
+    constexpr uword W = eop_simd_##isa##_vec<eT>::width; \
+    \
+    const uword n_main = i_end - ((i_end - i_start) % W); \
+    \
+    for(uword i=i_start; i < n_main; i += W) \
+      { \
+      store<mode, eT>( &(out_mem[i]), eval<eT>(x, i) ); \
+      } \
+    \
+    if(n_main < i_end)  { store_tail<mode, eT>(out_mem, eval<eT>(x, i_end - W), n_main, i_end); } \
+    } \
+  \
+  template<typename eop_type, typename eT> \
+  arma_simd_##isa##_fn static void \
+  process(eT* out_mem, const eT* X_mem, const uword n_elem, const eT k) \
+    { \
+    typedef eop_simd_##isa##_vec<eT> V; \
+    \
+    constexpr uword W = V::width; \
+    \
+    const uword n_main = n_elem - (n_elem % W); \
+    \
+    for(uword i=0; i < n_main; i += W) \
+      { \
+      V::store( &(out_mem[i]), eval_eop<eT, eop_type>( V::load( &(X_mem[i]) ), k ) ); \
+      } \
+    \
+    if(n_main < n_elem)  { store_tail<eop_simd::mode_equ, eT>(out_mem, eval_eop<eT, eop_type>( V::load( &(X_mem[n_elem - W]) ), k ), n_main, n_elem); } \
+    } \
+  \
+  template<typename eT> \
+  arma_simd_##isa##_fn static void \
+  clamp(eT* out_mem, const eT* X_mem, const uword n_elem, const eT min_val, const eT max_val) \
+    { \
+    typedef eop_simd_##isa##_vec<eT> V; \
+    \
+    constexpr uword W = V::width; \
+    \
+    const uword n_main = n_elem - (n_elem % W); \
+    \
+    const typename V::vT min_vec = V::set1(min_val); \
+    const typename V::vT max_vec = V::set1(max_val); \
+    \
+    for(uword i=0; i < n_main; i += W) \
+      { \
+      V::store( &(out_mem[i]), V::min(max_vec, V::max(min_vec, V::load( &(X_mem[i]) ))) ); \
+      } \
+    \
+    for(uword i=n_main; i < n_elem; ++i) \
+      { \
+      const eT val = X_mem[i]; \
+      \
+      out_mem[i] = (val < min_val) ? min_val : ((val > max_val) ? max_val : val); \
+      } \
+    }
+
+
+
+// 
+// elementary functions for vectors of doubles; the functions for vectors of floats convert to doubles and back.
+// the functions are evaluated over the range of arguments for which the result is a normal (non-subnormal) number,
+// with the argument reduced to a small interval and the function approximated there by polynomials;
+// lanes outside this range (eg. overflow, underflow, zero, infinity or NaN arguments) are marked as special,
+// and are recomputed by the scalar code of the operation (ie. by the standard library), so that special cases are handled identically.
+// 
+// intermediate results which need more than double precision (eg. the logarithm used by pow()) are held as the unevaluated sum of two doubles,
+// using the exact addition and multiplication algorithms of Knuth and Dekker; these rely on the absence of fused multiply-add contraction.
+// round_int() rounds to the nearest integer via addition and subtraction of 1.5*2^52, which leaves the integer in the low bits of the sum.
+// 
+// exp(), exp2():         reduction to exp(r) with |r| <= ln(2)/2 as in fdlibm (Sun Microsystems), with a degree 5 polynomial in r^2
+// log(), log2(), log10(): x = 2^e * m, with sqrt(1/2) <= m < sqrt(2), and log(m) = 2*atanh(s) = 2s + 2s^3/3 + 2s^5 * R(s^2), where s = (m-1)/(m+1)
+// log1p():               log() of 1+x, corrected by the rounding error of 1+x
+// pow():                 exp(y*log(x)), with log(x) and the product held in double-double form
+// sin(), cos():          reduction modulo pi/2 (3 part Cody-Waite), followed by the fdlibm kernels
+// tanh():                odd polynomial for |x| < 0.55, otherwise 1 - 2/(exp(2|x|)+1)
+// erf(), erfc():         odd polynomial for small |x|, otherwise exp(-x^2) * Q(t) / (|x|+4), with t = (|x|-4)/(|x|+4)
+// 
+// the polynomials (apart from those taken from fdlibm) are Chebyshev approximations computed with 60 digit arithmetic.
+// the maximum errors measured against 113 bit (quad precision) references, in units in the last place (ULP) of double precision:
+// exp: 0.86, exp2: 0.87, log: 0.50, log2: 0.50, log10: 0.50, log1p: 0.66, pow: 0.87, sin: 0.76, cos: 0.76, tanh: 1.4, erf: 1.6, erfc: 5.0;
+// for float, the results are correctly rounded apart from rare double rounding (max error 0.501 ULP of single precision).
+
+
+#define arma_simd_math(isa) \
+  \
+  typedef eop_simd_##isa##_vec<double> dvec; \
+  typedef dvec::vT dvT; \
+  typedef dvec::mT dmT; \
+  \
+  arma_simd_##isa##_inline static dvT \
+  horner(const dvT x, const double* coeffs, const uword N) \
+    { \
+    dvT out = dvec::set1(coeffs[0]); \
+    \
+    for(uword i=1; i < N; ++i)  { out = dvec::add( dvec::mul(out, x), dvec::set1(coeffs[i]) ); } \
+    \
+    return out; \
+    } \
+  \
+  arma_simd_##isa##_inline static void \
+  two_sum(dvT& s, dvT& e, const dvT a, const dvT b) \
+    { \
+    s = dvec::add(a, b); \
+    \
+    const dvT bb = dvec::sub(s, a); \
+    \
+    e = dvec::add( dvec::sub(a, dvec::sub(s, bb)), dvec::sub(b, bb) ); \
+    } \
+  \
+  arma_simd_##isa##_inline static void \
+  fast_two_sum(dvT& s, dvT& e, const dvT a, const dvT b) \
+    { \
+    s = dvec::add(a, b); \
+    e = dvec::sub(b, dvec::sub(s, a)); \
+    } \
+  \
+  arma_simd_##isa##_inline static void \
+  two_prod(dvT& p, dvT& e, const dvT a, const dvT b) \
+    { \
+    const dvT split = dvec::set1(134217729.0); \
+    \
+    const dvT a_t  = dvec::mul(a, split); \
+    const dvT a_hi = dvec::sub(a_t, dvec::sub(a_t, a)); \
+    const dvT a_lo = dvec::sub(a, a_hi); \
+    \
+    const dvT b_t  = dvec::mul(b, split); \
+    const dvT b_hi = dvec::sub(b_t, dvec::sub(b_t, b)); \
+    const dvT b_lo = dvec::sub(b, b_hi); \
+    \
+    p = dvec::mul(a, b); \
+    e = dvec::add( dvec::add( dvec::add( dvec::sub(dvec::mul(a_hi, b_hi), p), dvec::mul(a_hi, b_lo) ), dvec::mul(a_lo, b_hi) ), dvec::mul(a_lo, b_lo) ); \
+    } \
+  \
+  arma_simd_##isa##_inline static dvT \
+  round_int(dvT& n, const dvT x) \
+    { \
+    const dvT magic = dvec::set1(6755399441055744.0); \
+    \
+    const dvT t = dvec::add(x, magic); \
+    \
+    n = dvec::sub(t, magic); \
+    \
+    return t; \
+    } \
+  \
+  arma_simd_##isa##_inline static dvT \
+  pow2_int(const dvT t) \
+    { \
+    return dvec::shl<52>( dvec::add_bits(t, 1023) ); \
+    } \
+  \
+  arma_simd_##isa##_inline static dvT \
+  exp_reduced(const dvT hi, const dvT lo) \
+    { \
+    const double P[] = { 4.13813679705723846039e-08, -1.65339022054652515390e-06, 6.61375632143793436117e-05, -2.77777777770155933842e-03, 1.66666666666666019037e-01 }; \
+    \
+    const dvT r = dvec::sub(hi, lo); \
+    const dvT z = dvec::mul(r, r); \
+    const dvT c = dvec::sub(r, dvec::mul(z, horner(z, P, 5))); \
+    \
+    const dvT tmp = dvec::div( dvec::mul(r, c), dvec::sub(dvec::set1(2.0), c) ); \
+    \
+    return dvec::sub( dvec::set1(1.0), dvec::sub( dvec::sub(lo, tmp), hi ) ); \
+    } \
+  \
+  arma_simd_##isa##_fn static dvT \
+  exp_dd(const dvT x_hi, const dvT x_lo) \
+    { \
+    dvT n; \
+    \
+    const dvT t = round_int(n, dvec::mul(x_hi, dvec::set1(1.44269504088896338700e+00))); \
+    \
+    const dvT hi = dvec::sub(x_hi, dvec::mul(n, dvec::set1(6.93147180369123816490e-01))); \
+    const dvT lo = dvec::sub(dvec::mul(n, dvec::set1(1.90821492927058770002e-10)), x_lo); \
+    \
+    return dvec::mul( exp_reduced(hi, lo), pow2_int(t) ); \
+    } \
+  \
+  arma_simd_##isa##_fn static void \
+  log_dd(dvT& out_hi, dvT& out_lo, const dvT x) \
+    { \
+    const double R[] = { 0.05861589311938259, 0.05853118169745603, 0.06667402346923655, 0.07692297481259215, 0.09090909167696401, 0.11111111110827943, 0.14285714285714682, 0.2 }; \
+    \
+    dvT m = dvec::bit_or( dvec::bit_and(x, dvec::bits(0x000FFFFFFFFFFFFFLL)), dvec::bits(0x3FF0000000000000LL) ); \
+    dvT e = dvec::sub( dvec::bit_or( dvec::shr<52>(x), dvec::bits(0x4330000000000000LL) ), dvec::set1(4503599627371519.0) ); \
+    \
+    const dmT big = dvec::lt(dvec::set1(1.41421356237309504880), m); \
+    \
+    m = dvec::select(big, dvec::mul(m, dvec::set1(0.5)), m               ); \
+    e = dvec::select(big, dvec::add(e, dvec::set1(1.0)), e               ); \
+    \
+    const dvT f = dvec::sub(m, dvec::set1(1.0)); \
+    \
+    const dvT u    = dvec::add(dvec::set1(2.0), f); \
+    const dvT u_lo = dvec::sub(f, dvec::sub(u, dvec::set1(2.0))); \
+    \
+    const dvT s = dvec::div(f, u); \
+    \
+    dvT p, p_lo; \
+    \
+    two_prod(p, p_lo, s, u); \
+    \
+    const dvT s_lo = dvec::div( dvec::sub( dvec::sub(dvec::sub(f, p), p_lo), dvec::mul(s, u_lo) ), u ); \
+    \
+    dvT z, z_lo; \
+    \
+    two_prod(z, z_lo, s, s); \
+    \
+    dvT c, c_lo; \
+    \
+    two_prod(c, c_lo, s, z); \
+    \
+    c_lo = dvec::add( c_lo, dvec::add( dvec::mul(s, z_lo), dvec::mul(dvec::mul(dvec::set1(3.0), z), s_lo) ) ); \
+    \
+    dvT t, t_lo; \
+    \
+    two_prod(t, t_lo, c, dvec::set1(0.6666666666666666)); \
+    \
+    t_lo = dvec::add( t_lo, dvec::add( dvec::mul(c, dvec::set1(3.700743415417188e-17)), dvec::mul(c_lo, dvec::set1(0.6666666666666666)) ) ); \
+    \
+    const dvT T = dvec::mul( dvec::mul(dvec::add(c, c), z), horner(z, R, 8) ); \
+    \
+    dvT h, h_lo; \
+    \
+    two_sum(h, h_lo, dvec::mul(e, dvec::set1(6.93147180369123816490e-01)), dvec::add(s, s)); \
+    \
+    dvT g, g_lo; \
+    \
+    two_sum(g, g_lo, h, t); \
+    \
+    const dvT lo = dvec::add( dvec::add(h_lo, g_lo), dvec::add( dvec::add( dvec::mul(e, dvec::set1(1.90821492927058770002e-10)), dvec::add(s_lo, s_lo) ), dvec::add(t_lo, T) ) ); \
+    \
+    fast_two_sum(out_hi, out_lo, g, lo); \
+    } \
+  \
+  arma_simd_##isa##_inline static dvT \
+  mul_dd(const dvT x_hi, const dvT x_lo, const double c_hi, const double c_lo) \
+    { \
+    dvT p, p_lo; \
+    \
+    two_prod(p, p_lo, x_hi, dvec::set1(c_hi)); \
+    \
+    return dvec::add( p, dvec::add( p_lo, dvec::add( dvec::mul(x_hi, dvec::set1(c_lo)), dvec::mul(x_lo, dvec::set1(c_hi)) ) ) ); \
+    } \
+  \
+  arma_simd_##isa##_inline static dmT \
+  log_special(const dvT x) \
+    { \
+    return dvec::mask_or( dvec::not_le(dvec::set1(2.2250738585072014e-308), x), dvec::not_lt(x, dvec::set1(Datum<double>::inf)) ); \
+    } \
+  \
+  arma_simd_##isa##_fn static dvT \
+  math_exp(dmT& special, const dvT x) \
+    { \
+    special = dvec::not_lt(dvec::abs(x), dvec::set1(708.0)); \
+    \
+    return exp_dd(x, dvec::set1(0.0)); \
+    } \
+  \
+  arma_simd_##isa##_fn static dvT \
+  math_exp2(dmT& special, const dvT x) \
+    { \
+    special = dvec::not_lt(dvec::abs(x), dvec::set1(1020.0)); \
+    \
+    dvT n; \
+    \
+    const dvT t = round_int(n, x); \
+    const dvT r = dvec::sub(x, n); \
+    \
+    dvT hi, lo; \
+    \
+    two_prod(hi, lo, r, dvec::set1(0.6931471805599453)); \
+    \
+    lo = dvec::add(lo, dvec::mul(r, dvec::set1(2.3190468138462996e-17))); \
+    \
+    return dvec::mul( exp_reduced(hi, dvec::neg(lo)), pow2_int(t) ); \
+    } \
+  \
+  arma_simd_##isa##_fn static dvT \
+  math_log(dmT& special, const dvT x) \
+    { \
+    special = log_special(x); \
+    \
+    dvT hi, lo; \
+    \
+    log_dd(hi, lo, x); \
+    \
+    return hi; \
+    } \
+  \
+  arma_simd_##isa##_fn static dvT \
+  math_log2(dmT& special, const dvT x) \
+    { \
+    special = log_special(x); \
+    \
+    dvT hi, lo; \
+    \
+    log_dd(hi, lo, x); \
+    \
+    return mul_dd(hi, lo, 1.4426950408889634, 2.0355273740931033e-17); \
+    } \
+  \
+  arma_simd_##isa##_fn static dvT \
+  math_log10(dmT& special, const dvT x) \
+    { \
+    special = log_special(x); \
+    \
+    dvT hi, lo; \
+    \
+    log_dd(hi, lo, x); \
+    \
+    return mul_dd(hi, lo, 0.4342944819032518, 1.098319650216765e-17); \
+    } \
+  \
+  arma_simd_##isa##_fn static dvT \
+  math_log1p(dmT& special, const dvT x) \
+    { \
+    special = dvec::mask_or( dvec::not_lt(dvec::set1(-1.0), x), dvec::not_lt(x, dvec::set1(Datum<double>::inf)) ); \
+    \
+    dvT u, u_lo; \
+    \
+    two_sum(u, u_lo, dvec::set1(1.0), x); \
+    \
+    dvT hi, lo; \
+    \
+    log_dd(hi, lo, u); \
+    \
+    const dvT out = dvec::add( hi, dvec::add(lo, dvec::div(u_lo, u)) ); \
+    \
+    return dvec::select( dvec::eq(x, dvec::set1(0.0)), x, out ); \
+    } \
+  \
+  arma_simd_##isa##_fn static dvT \
+  math_pow(dmT& special, const dvT x, const double y) \
+    { \
+    if(y == double(1))  { special = dvec::lt(x, x);  return x;               } \
+    if(y == double(2))  { special = dvec::lt(x, x);  return dvec::mul(x, x); } \
+    \
+    if( (std::abs(y) < double(1e290)) == false )  { special = dvec::not_lt(x, x);  return x; } \
+    \
+    dvT hi, lo; \
+    \
+    log_dd(hi, lo, x); \
+    \
+    dvT p, p_lo; \
+    \
+    two_prod(p, p_lo, hi, dvec::set1(y)); \
+    \
+    p_lo = dvec::add(p_lo, dvec::mul(lo, dvec::set1(y))); \
+    \
+    special = dvec::mask_or( log_special(x), dvec::not_lt(dvec::abs(p), dvec::set1(708.0)) ); \
+    \
+    return exp_dd(p, p_lo); \
+    } \
+  \
+  arma_simd_##isa##_fn static dvT \
+  math_sincos(dmT& special, const dvT x, const bool is_cos) \
+    { \
+    const double S[] = { 1.58969099521155010221e-10, -2.50507602534068634195e-08, 2.75573137070700676789e-06, -1.98412698298579493134e-04, 8.33333333332248946124e-03 }; \
+    const double C[] = { -1.13596475577881948265e-11, 2.08757232129817482790e-09, -2.75573143513906633035e-07, 2.48015872894767294178e-05, -1.38888888888741095749e-03, 4.16666666666666019037e-02 }; \
+    \
+    special = dvec::not_lt(dvec::abs(x), dvec::set1(524288.0)); \
+    \
+    dvT n; \
+    \
+    round_int(n, dvec::mul(x, dvec::set1(0.6366197723675814))); \
+    \
+    const dvT a = dvec::sub(x, dvec::mul(n, dvec::set1(1.5707963267341256))); \
+    const dvT b = dvec::mul(n, dvec::set1(6.077100506303966e-11)); \
+    \
+    dvT r, r_lo; \
+    \
+    two_sum(r, r_lo, a, dvec::neg(b)); \
+    \
+    r_lo = dvec::sub(r_lo, dvec::mul(n, dvec::set1(2.0222662487959506e-21))); \
+    \
+    dvT y, y_lo; \
+    \
+    fast_two_sum(y, y_lo, r, r_lo); \
+    \
+    const dvT z = dvec::mul(y, y); \
+    const dvT v = dvec::mul(z, y); \
+    \
+    const dvT sin_tmp = dvec::sub( dvec::mul( z, dvec::sub( dvec::mul(dvec::set1(0.5), y_lo), dvec::mul(v, horner(z, S, 5)) ) ), y_lo ); \
+    const dvT sin_val = dvec::sub( y, dvec::sub( sin_tmp, dvec::mul(v, dvec::set1(-1.66666666666666324348e-01)) ) ); \
+    \
+    const dvT hz = dvec::mul(dvec::set1(0.5), z); \
+    const dvT w  = dvec::sub(dvec::set1(1.0), hz); \
+    \
+    const dvT cos_tmp = dvec::sub( dvec::mul( z, dvec::mul(z, horner(z, C, 6)) ), dvec::mul(y, y_lo) ); \
+    const dvT cos_val = dvec::add( w, dvec::add( dvec::sub( dvec::sub(dvec::set1(1.0), w), hz ), cos_tmp ) ); \
+    \
+    dvT q = (is_cos) ? dvec::add(n, dvec::set1(1.0)) : n; \
+    dvT q_div_4; \
+    \
+    round_int(q_div_4, dvec::mul(q, dvec::set1(0.25))); \
+    \
+    q = dvec::sub(q, dvec::mul(q_div_4, dvec::set1(4.0))); \
+    \
+    const dmT use_cos = dvec::eq(dvec::abs(q), dvec::set1(1.0)); \
+    const dmT use_neg = dvec::mask_or( dvec::lt(q, dvec::set1(-0.5)), dvec::lt(dvec::set1(1.5), q) ); \
+    \
+    const dvT out = dvec::select(use_cos, cos_val, sin_val); \
+    \
+    return (is_cos) ? dvec::select(use_neg, dvec::neg(out), out) : dvec::select( dvec::eq(x, dvec::set1(0.0)), x, dvec::select(use_neg, dvec::neg(out), out) ); \
+    } \
+  \
+  arma_simd_##isa##_fn static dvT \
+  math_tanh(dmT& special, const dvT x) \
+    { \
+    const double P[] = { -2.060276537636634e-05, 8.511313685577672e-05, -0.0002346347410887237, 0.0005889360520074057, -0.001455661830100716, 0.003592110378689024, -0.008863234397814355, 0.021869488493666944, -0.053968253967434016, 0.13333333333332714, -0.3333333333333333 }; \
+    \
+    special = dvec::not_le(x, x); \
+    \
+    const dvT ax = dvec::abs(x); \
+    const dvT z  = dvec::mul(ax, ax); \
+    \
+    const dvT small_val = dvec::add( ax, dvec::mul( ax, dvec::mul(z, horner(z, P, 11)) ) ); \
+    \
+    const dvT e = exp_dd( dvec::mul(dvec::set1(2.0), dvec::min(ax, dvec::set1(22.0))), dvec::set1(0.0) ); \
+    \
+    const dvT large_val = dvec::sub( dvec::set1(1.0), dvec::div( dvec::set1(2.0), dvec::add(e, dvec::set1(1.0)) ) ); \
+    \
+    const dvT out = dvec::select( dvec::lt(ax, dvec::set1(0.55)), small_val, large_val ); \
+    \
+    return dvec::bit_or( out, dvec::bit_and(x, dvec::set1(-0.0)) ); \
+    } \
+  \
+  arma_simd_##isa##_inline static dvT \
+  erf_small(const dvT x) \
+    { \
+    const double E[] = { -7.795898827002142e-10, 1.3720064546777686e-08, -1.6208483801871705e-07, 1.6447424703317362e-06, -1.492473690741966e-05, 0.00012055294904839707, -0.0008548325975389692, 0.0052239776071164225, -0.02686617064323777, 0.11283791670945006, -0.37612638903183543, 1.1283791670955126 }; \
+    \
+    dvT p, p_lo; \
+    \
+    two_prod(p, p_lo, x, dvec::set1(E[11])); \
+    \
+    const dvT z = dvec::mul(x, x); \
+    \
+    return dvec::add( p, dvec::add( p_lo, dvec::mul( dvec::mul(x, z), horner(z, E, 11) ) ) ); \
+    } \
+  \
+  arma_simd_##isa##_fn static dvT \
+  erfc_large(const dvT x) \
+    { \
+    const double Q[] = { -1.2251792500929509e-08, 1.2253367244026697e-09, 1.1975891491015912e-07, -7.587623591599915e-08, -8.428778695384686e-07, 1.4243334900217533e-06, 4.69289067207852e-06, -1.8860891574885405e-05, -3.6347319162172117e-06, 0.0001768128028396945, -0.000455052763932119, -0.0002809588597464579, 0.006112055664646263, -0.026370053341240225, 0.076381514908731, -0.1740109372398642, 0.33085158787803076, -0.5408538313132374, 0.7732087022652369, -0.976548729080882, 1.095995661000491 }; \
+    \
+    dvT z, z_lo; \
+    \
+    two_prod(z, z_lo, x, x); \
+    \
+    const dvT x_plus_4 = dvec::add(x, dvec::set1(4.0)); \
+    \
+    const dvT t = dvec::div( dvec::sub(x, dvec::set1(4.0)), x_plus_4 ); \
+    \
+    return dvec::mul( exp_dd(dvec::neg(z), dvec::neg(z_lo)), dvec::div(horner(t, Q, 21), x_plus_4) ); \
+    } \
+  \
+  arma_simd_##isa##_fn static dvT \
+  math_erf(dmT& special, const dvT x) \
+    { \
+    special = dvec::not_le(x, x); \
+    \
+    const dvT ax = dvec::abs(x); \
+    \
+    const dvT large_val = dvec::sub( dvec::set1(1.0), erfc_large( dvec::min(dvec::max(ax, dvec::set1(1.0)), dvec::set1(6.0)) ) ); \
+    \
+    const dvT out = dvec::bit_or( large_val, dvec::bit_and(x, dvec::set1(-0.0)) ); \
+    \
+    return dvec::select( dvec::lt(ax, dvec::set1(1.0)), erf_small(x), out ); \
+    } \
+  \
+  arma_simd_##isa##_fn static dvT \
+  math_erfc(dmT& special, const dvT x) \
+    { \
+    special = dvec::not_lt(x, dvec::set1(26.5)); \
+    \
+    const dvT ax = dvec::abs(x); \
+    \
+    const dvT large_val = erfc_large( dvec::min(dvec::max(ax, dvec::set1(0.5)), dvec::set1(26.5)) ); \
+    \
+    const dvT out = dvec::select( dvec::lt(x, dvec::set1(0.0)), dvec::sub(dvec::set1(2.0), large_val), large_val ); \
+    \
+    return dvec::select( dvec::lt(ax, dvec::set1(0.5)), dvec::sub(dvec::set1(1.0), erf_small(x)), out ); \
+    } \
+  \
+  template<typename eop_type> \
+  arma_simd_##isa##_fn static dvT \
+  math(const dvT x, const double k) \
+    { \
+    dmT special = dvec::not_lt(x, x); \
+    dvT out     = x; \
+    \
+         if(is_same_type<eop_type, eop_exp  >::yes)  { out = math_exp  (special, x);        } \
+    else if(is_same_type<eop_type, eop_exp2 >::yes)  { out = math_exp2 (special, x);        } \
+    else if(is_same_type<eop_type, eop_log  >::yes)  { out = math_log  (special, x);        } \
+    else if(is_same_type<eop_type, eop_log2 >::yes)  { out = math_log2 (special, x);        } \
+    else if(is_same_type<eop_type, eop_log10>::yes)  { out = math_log10(special, x);        } \
+    else if(is_same_type<eop_type, eop_log1p>::yes)  { out = math_log1p(special, x);        } \
+    else if(is_same_type<eop_type, eop_pow  >::yes)  { out = math_pow  (special, x, k);     } \
+    else if(is_same_type<eop_type, eop_sin  >::yes)  { out = math_sincos(special, x, false); } \
+    else if(is_same_type<eop_type, eop_cos  >::yes)  { out = math_sincos(special, x, true ); } \
+    else if(is_same_type<eop_type, eop_tanh >::yes)  { out = math_tanh (special, x);        } \
+    else if(is_same_type<eop_type, eop_erf  >::yes)  { out = math_erf  (special, x);        } \
+    else if(is_same_type<eop_type, eop_erfc >::yes)  { out = math_erfc (special, x);        } \
+    \
+    const int special_bits = dvec::mask_bits(special); \
+    \
+    if(special_bits != 0) \
+      { \
+      double x_mem[dvec::width]; \
+      double o_mem[dvec::width]; \
+      \
+      dvec::store(x_mem, x  ); \
+      dvec::store(o_mem, out); \
+      \
+      for(uword i=0; i < dvec::width; ++i) \
+        { \
+        if(special_bits & (int(1) << i))  { o_mem[i] = eop_core<eop_type>::process(x_mem[i], k); } \
+        } \
+      \
+      out = dvec::load(o_mem); \
+      } \
+    \
+    return out; \
+    } \
+  \
+  template<typename eop_type> \
+  arma_simd_##isa##_inline static typename eop_simd_##isa##_vec<float>::vT \
+  math(const typename eop_simd_##isa##_vec<float>::vT x, const float k) \
+    { \
+    typedef eop_simd_##isa##_vec<float> float_vec; \
+    \
+    return float_vec::from_double( math<eop_type>(float_vec::lo_to_double(x), double(k)), math<eop_type>(float_vec::hi_to_double(x), double(k)) ); \
+    }
+
+
+
+struct eop_simd_sse2
+  {
+  arma_simd_engine(sse2)
+  arma_simd_math(sse2)
+  };
+
+
+struct eop_simd_avx2
+  {
+  arma_simd_engine(avx2)
+  arma_simd_math(avx2)
+  };
+
+
+struct eop_simd_avx512
+  {
+  arma_simd_engine(avx512)
+  arma_simd_math(avx512)
+  };
+
+
+#undef arma_simd_engine
+#undef arma_simd_math
+
+#endif
+
+
+
+inline
+uword
+eop_simd::get_level()
+  {
+  static const uword level = eop_simd::detect_level();
+  
+  return level;
+  }
+
+
+
+inline
+uword
+eop_simd::detect_level()
+  {
+  #if defined(ARMA_USE_SIMD_DISPATCH)
+    {
+    __builtin_cpu_init();
+    
+    if(__builtin_cpu_supports("avx512f"))  { return level_avx512; }
+    if(__builtin_cpu_supports("avx2"   ))  { return level_avx2;   }
+    
+    return level_sse2;
+    }
+  #else
+    {
+    return level_none;
+    }
+  #endif
+  }
+
+
+
+template<const uword mode, typename expr_type>
+inline
+typename enable_if2< (eop_simd_expr<expr_type>::value == true), bool >::result
+eop_simd::apply(typename expr_type::elem_type* out_mem, const expr_type& x, const uword n_elem)
+  {
+  #if defined(ARMA_USE_SIMD_DISPATCH)
+    {
+    if(n_elem < min_n_elem)  { return false; }
+    
+    const uword level = eop_simd::get_level();
+    
+    if(level == level_avx512)  { eop_simd_avx512::apply<mode>(out_mem, x, uword(0), n_elem); return true; }
+    if(level == level_avx2  )  { eop_simd_avx2::apply<mode>  (out_mem, x, uword(0), n_elem); return true; }
+    if(level == level_sse2  )  { eop_simd_sse2::apply<mode>  (out_mem, x, uword(0), n_elem); return true; }
+    
+    return false;
+    }
+  #else
+    {
+    arma_ignore(out_mem);
+    arma_ignore(x);
+    arma_ignore(n_elem);
+    
+    return false;
+    }
+  #endif
+  }
+
+
+
+template<const uword mode, typename expr_type>
+inline
+typename enable_if2< (eop_simd_expr<expr_type>::value == false), bool >::result
+eop_simd::apply(typename expr_type::elem_type* out_mem, const expr_type& x, const uword n_elem)
+  {
+  arma_ignore(out_mem);
+  arma_ignore(x);
+  arma_ignore(n_elem);
+  
+  return false;
+  }
+
+
+
+template<const uword mode, typename expr_type>
+inline
+typename enable_if2< (eop_simd_expr<expr_type>::value == true), bool >::result
+eop_simd::apply_mp(typename expr_type::elem_type* out_mem, const expr_type& x, const uword n_elem)
+  {
+  #if defined(ARMA_USE_SIMD_DISPATCH) && defined(ARMA_USE_OPENMP)
+    {
+    if(n_elem < min_n_elem)  { return false; }
+    
+    const uword level = eop_simd::get_level();
+    
+    if(level == level_none)  { return false; }
+    
+    const int   n_threads = mp_thread_limit::get();
+    const uword n_chunks  = eop_simd::mp_n_chunks(n_elem, n_threads);
+    
+    #pragma omp parallel for schedule(static) num_threads(n_threads)
+    for(uword c=0; c < n_chunks; ++c)
+      {
+      const uword i_start = mp_chunk::start(c,   n_elem, n_chunks);
+      const uword i_end   = mp_chunk::start(c+1, n_elem, n_chunks);
+      
+           if(level == level_avx512)  { eop_simd_avx512::apply<mode>(out_mem, x, i_start, i_end); }
+      else if(level == level_avx2  )  { eop_simd_avx2::apply<mode>  (out_mem, x, i_start, i_end); }
+      else                            { eop_simd_sse2::apply<mode>  (out_mem, x, i_start, i_end); }
+      }
+    
+    return true;
+    }
+  #else
+    {
+    arma_ignore(out_mem);
+    arma_ignore(x);
+    arma_ignore(n_elem);
+    
+    return false;
+    }
+  #endif
+  }
+
+
+
+template<const uword mode, typename expr_type>
+inline
+typename enable_if2< (eop_simd_expr<expr_type>::value == false), bool >::result
+eop_simd::apply_mp(typename expr_type::elem_type* out_mem, const expr_type& x, const uword n_elem)
+  {
+  arma_ignore(out_mem);
+  arma_ignore(x);
+  arma_ignore(n_elem);
+  
+  return false;
+  }
+
+
+
+inline
+uword
+eop_simd::mp_n_chunks(const uword n_elem, const int n_threads)
+  {
+  const uword n_chunks_max = (std::max)(uword(1), uword(n_elem / min_n_elem));
+  
+  return (std::min)(uword((std::max)(int(1), n_threads)), n_chunks_max);
+  }
+
+
+
+template<typename eT>
+inline
+typename enable_if2< (eop_simd_elem<eT>::value == true), bool >::result
+eop_simd::clamp(eT* out_mem, const eT* X_mem, const uword n_elem, const eT min_val, const eT max_val)
+  {
+  #if defined(ARMA_USE_SIMD_DISPATCH)
+    {
+    if(n_elem < min_n_elem)  { return false; }
+    
+    const uword level = eop_simd::get_level();
+    
+    if(level == level_avx512)  { eop_simd_avx512::clamp(out_mem, X_mem, n_elem, min_val, max_val); return true; }
+    if(level == level_avx2  )  { eop_simd_avx2::clamp  (out_mem, X_mem, n_elem, min_val, max_val); return true; }
+    if(level == level_sse2  )  { eop_simd_sse2::clamp  (out_mem, X_mem, n_elem, min_val, max_val); return true; }
+    
+    return false;
+    }
+  #else
+    {
+    arma_ignore(out_mem);
+    arma_ignore(X_mem);
+    arma_ignore(n_elem);
+    arma_ignore(min_val);
+    arma_ignore(max_val);
+    
+    return false;
+    }
+  #endif
+  }
+
+
+
+template<typename eT>
+inline
+typename enable_if2< (eop_simd_elem<eT>::value == false), bool >::result
+eop_simd::clamp(eT* out_mem, const eT* X_mem, const uword n_elem, const eT min_val, const eT max_val)
+  {
+  arma_ignore(out_mem);
+  arma_ignore(X_mem);
+  arma_ignore(n_elem);
+  arma_ignore(min_val);
+  arma_ignore(max_val);
+  
+  return false;
+  }
+
+
+
+template<typename eop_type, typename eT>
+inline
+bool
+eop_simd::can_process(const uword n_elem)
+  {
+  #if defined(ARMA_USE_SIMD_DISPATCH)
+    {
+    constexpr bool supported = eop_simd_elem<eT>::value && eop_simd_op<eop_type>::value;
+    
+    return supported && (n_elem >= min_n_elem) && (eop_simd::get_level() != level_none);
+    }
+  #else
+    {
+    arma_ignore(n_elem);
+    
+    return false;
+    }
+  #endif
+  }
+
+
+
+template<typename eop_type, typename eT>
+inline
+typename enable_if2< (eop_simd_elem<eT>::value && eop_simd_op<eop_type>::value) == true, bool >::result
+eop_simd::process(eT* out_mem, const eT* X_mem, const uword n_elem, const eT k)
+  {
+  #if defined(ARMA_USE_SIMD_DISPATCH)
+    {
+    if(n_elem < min_n_elem)  { return false; }
+    
+    const uword level = eop_simd::get_level();
+    
+    if(level == level_avx512)  { eop_simd_avx512::process<eop_type>(out_mem, X_mem, n_elem, k); return true; }
+    if(level == level_avx2  )  { eop_simd_avx2::process<eop_type>  (out_mem, X_mem, n_elem, k); return true; }
+    if(level == level_sse2  )  { eop_simd_sse2::process<eop_type>  (out_mem, X_mem, n_elem, k); return true; }
+    
+    return false;
+    }
+  #else
+    {
+    arma_ignore(out_mem);
+    arma_ignore(X_mem);
+    arma_ignore(n_elem);
+    arma_ignore(k);
+    
+    return false;
+    }
+  #endif
+  }
+
+
+
+template<typename eop_type, typename eT>
+inline
+typename enable_if2< (eop_simd_elem<eT>::value && eop_simd_op<eop_type>::value) == false, bool >::result
+eop_simd::process(eT* out_mem, const eT* X_mem, const uword n_elem, const eT k)
+  {
+  arma_ignore(out_mem);
+  arma_ignore(X_mem);
+  arma_ignore(n_elem);
+  arma_ignore(k);
+  
+  return false;
+  }
+
+
+
+//! @}
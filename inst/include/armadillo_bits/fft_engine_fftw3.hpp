@@ -40,13 +40,16 @@ struct fft_engine_fftw3
   static constexpr unsigned int fftw3_flag_preserve = (1u << 4);
   static constexpr unsigned int fftw3_flag_estimate = (1u << 6);
   
+  // the input and output arrays within the scratch memory are placed at offsets
+  // which are multiples of 16 elements, to keep the alignment used when creating the plan
+  static constexpr uword align_n_elem = 16;
+  
   const uword N;
+  const uword N_aligned;
+  const uword scratch_size;
   
   void_ptr fftw3_plan;
   
-  podarray<cx_type> X_work;  // for storing copy of input (can be overwritten by FFTW3)
-  podarray<cx_type> Y_work;  // for storing output
-  
   inline
   void
   finish()
@@ -92,8 +95,10 @@ struct fft_engine_fftw3
   
   inline
   fft_engine_fftw3(const uword in_N)
-    : N         (in_N   )
-    , fftw3_plan(nullptr)
+    : N           (in_N   )
+    , N_aligned   ( ((in_N + align_n_elem - 1) / align_n_elem) * align_n_elem )
+    , scratch_size( 2 * N_aligned )
+    , fftw3_plan  (nullptr)
     {
     arma_debug_sigprint();
     
@@ -104,9 +109,11 @@ struct fft_engine_fftw3
       arma_stop_runtime_error("integer overflow: FFT size too large for integer type used by FFTW3");
       }
     
-    arma_debug_print("fft_engine_fftw3::constructor: allocating work arrays");
-    X_work.set_size(N);
-    Y_work.set_size(N);
+    arma_debug_print("fft_engine_fftw3::constructor: allocating work array");
+    podarray<cx_type> work(scratch_size);
+    
+    cx_type* X_work = work.memptr();
+    cx_type* Y_work = work.memptr() + N_aligned;
     
     const int fftw3_sign  = (inverse) ? fftw3_sign_backward : fftw3_sign_forward;
     const int fftw3_flags = fftw3_flag_destroy | fftw3_flag_estimate;
@@ -120,7 +127,7 @@ struct fft_engine_fftw3
       {
       #pragma omp critical (arma_fft_engine_fftw3)
         {
-        fftw3_plan = fftw3::plan_dft_1d<cx_type>(N, X_work.memptr(), Y_work.memptr(), fftw3_sign, fftw3_flags);
+        fftw3_plan = fftw3::plan_dft_1d<cx_type>(N, X_work, Y_work, fftw3_sign, fftw3_flags);
         }
       }
     #elif defined(ARMA_USE_STD_MUTEX)
@@ -129,33 +136,39 @@ struct fft_engine_fftw3
       
       const std::lock_guard<std::mutex> lock(plan_mutex);
       
-      fftw3_plan = fftw3::plan_dft_1d<cx_type>(N, X_work.memptr(), Y_work.memptr(), fftw3_sign, fftw3_flags);
+      fftw3_plan = fftw3::plan_dft_1d<cx_type>(N, X_work, Y_work, fftw3_sign, fftw3_flags);
       }
     #else
       {
-      fftw3_plan = fftw3::plan_dft_1d<cx_type>(N, X_work.memptr(), Y_work.memptr(), fftw3_sign, fftw3_flags);
+      fftw3_plan = fftw3::plan_dft_1d<cx_type>(N, X_work, Y_work, fftw3_sign, fftw3_flags);
       }
     #endif
     
     if(fftw3_plan == nullptr)  { arma_stop_runtime_error("fft_engine_fftw3::constructor: failed to create plan"); }
     }
   
+  //! the plan is executed via the new-array interface, which is thread safe;
+  //! each thread must provide its own scratch memory (scratch_size elements),
+  //! with the same alignment as memory obtained via podarray
   inline
   void
-  run(cx_type* Y, const cx_type* X)
+  run(cx_type* Y, const cx_type* X, cx_type* scratch) const
     {
     arma_debug_sigprint();
     
     if(fftw3_plan == nullptr)  { return; }
     
+    cx_type* X_work = scratch;
+    cx_type* Y_work = scratch + N_aligned;
+    
     arma_debug_print("fft_engine_fftw3::run(): copying input array");
-    arrayops::copy(X_work.memptr(), X, N);
+    arrayops::copy(X_work, X, N);
     
     arma_debug_print("fft_engine_fftw3::run(): executing plan");
-    fftw3::execute<cx_type>(fftw3_plan);
+    fftw3::execute_dft<cx_type>(fftw3_plan, X_work, Y_work);
     
     arma_debug_print("fft_engine_fftw3::run(): copying output array");
-    arrayops::copy(Y, Y_work.memptr(), N);
+    arrayops::copy(Y, Y_work, N);
     }
   };
 
@@ -63,11 +63,15 @@ struct fft_engine_kissfft
   const uword N;
   
   podarray<cx_type> coeffs_array;
-  podarray<cx_type> tmp_array;
   
   podarray<uword>   residue;
   podarray<uword>   radix;
   
+  podarray<cx_type> stage_coeffs_array;  // contiguous twiddles for radix-2 and radix-4 stages
+  podarray<uword>   stage_offset;
+  
+  uword scratch_size;  // number of elements of scratch memory required by run()
+  
   
   template<bool fill>
   inline
@@ -106,7 +110,8 @@ struct fft_engine_kissfft
   
   inline
   fft_engine_kissfft(const uword in_N)
-    : N(in_N)
+    : N           (in_N)
+    , scratch_size(0   )
     {
     arma_debug_sigprint();
     
@@ -117,6 +122,13 @@ struct fft_engine_kissfft
     
     calc_radix<true>();
     
+    for(uword stage=0; stage < len; ++stage)
+      {
+      const uword r = radix[stage];
+      
+      if( (r > 5) && (r > scratch_size) )  { scratch_size = r; }
+      }
+    
     
     // calculate the constant coefficients
     
@@ -127,6 +139,48 @@ struct fft_engine_kissfft
     const T k = T( (inverse) ? +2 : -2 ) * std::acos( T(-1) ) / T(N);
     
     for(uword i=0; i < N; ++i)  { coeffs[i] = std::exp( cx_type(T(0), i*k) ); }
+    
+    
+    // gather the twiddles used by each radix-2 and radix-4 stage into contiguous blocks,
+    // so that the corresponding butterflies can be processed with unit-stride access
+    
+    stage_offset.set_size(len);
+    
+    uword stage_n_coeffs = 0;
+    
+    for(uword stage=0; stage < len; ++stage)
+      {
+      const uword r = radix[stage];
+      
+      stage_offset[stage] = stage_n_coeffs;
+      
+      if( (r == 2) || (r == 4) )  { stage_n_coeffs += (r-1) * residue[stage]; }
+      }
+    
+    stage_coeffs_array.set_size(stage_n_coeffs);
+    
+    cx_type* stage_coeffs = stage_coeffs_array.memptr();
+    
+    uword stride = 1;
+    
+    for(uword stage=0; stage < len; ++stage)
+      {
+      const uword r = radix[stage];
+      const uword m = residue[stage];
+      
+      if( (r == 2) || (r == 4) )
+        {
+        cx_type* tw = &(stage_coeffs[ stage_offset[stage] ]);
+        
+        for(uword j=1; j < r; ++j)
+        for(uword i=0; i < m; ++i)
+          {
+          (*tw) = coeffs[i*stride*j];  ++tw;
+          }
+        }
+      
+      stride *= r;
+      }
     }
   
   
@@ -134,18 +188,32 @@ struct fft_engine_kissfft
   arma_hot
   inline
   void
-  butterfly_2(cx_type* Y, const uword stride, const uword m) const
+  butterfly_2(cx_type* Y, const cx_type* tw, const uword m) const
     {
     // arma_debug_sigprint();
     
-    const cx_type* coeffs = coeffs_array.memptr();
+    // NOTE: the complex arithmetic is written out explicitly, as the std::complex operators
+    // NOTE: prevent vectorisation due to their handling of non-finite values
+    
+    cx_type* Y0 = Y;
+    cx_type* Y1 = Y + m;
     
     for(uword i=0; i < m; ++i)
       {
-      const cx_type t = Y[i+m] * coeffs[i*stride];
+      const T w_re = tw[i].real();
+      const T w_im = tw[i].imag();
+      
+      const T a_re = Y0[i].real();
+      const T a_im = Y0[i].imag();
+      
+      const T b_re = Y1[i].real();
+      const T b_im = Y1[i].imag();
       
-      Y[i+m] =  Y[i] - t;
-      Y[i  ] += t;
+      const T t_re = (b_re * w_re) - (b_im * w_im);
+      const T t_im = (b_re * w_im) + (b_im * w_re);
+      
+      Y0[i] = cx_type( (a_re + t_re), (a_im + t_im) );
+      Y1[i] = cx_type( (a_re - t_re), (a_im - t_im) );
       }
     }
   
@@ -200,41 +268,49 @@ struct fft_engine_kissfft
   arma_hot
   inline
   void
-  butterfly_4(cx_type* Y, const uword stride, const uword m) const
+  butterfly_4(cx_type* Y, const cx_type* tw, const uword m) const
     {
     // arma_debug_sigprint();
     
-    arma_aligned cx_type tmp[7];
-    
-    const cx_type* coeffs = coeffs_array.memptr();
-    
-    const uword m2 = m*2;
-    const uword m3 = m*3;
+    cx_type* Y0 = Y;
+    cx_type* Y1 = Y + m;
+    cx_type* Y2 = Y + m*2;
+    cx_type* Y3 = Y + m*3;
     
-    // TODO: rearrange the indices within tmp[] into a more sane order
+    const cx_type* tw1 = tw;
+    const cx_type* tw2 = tw + m;
+    const cx_type* tw3 = tw + m*2;
     
     for(uword i=0; i < m; ++i)
       {
-      tmp[0] = Y[i + m ] * coeffs[i*stride  ];
-      tmp[2] = Y[i + m3] * coeffs[i*stride*3];
-      tmp[3] = tmp[0] + tmp[2];
+      const T x0_re = Y0[i].real();
+      const T x0_im = Y0[i].imag();
+      
+      const T x1_re = (Y1[i].real() * tw1[i].real()) - (Y1[i].imag() * tw1[i].imag());
+      const T x1_im = (Y1[i].real() * tw1[i].imag()) + (Y1[i].imag() * tw1[i].real());
       
-      //tmp[4] = tmp[0] - tmp[2];
-      //tmp[4] = (inverse) ? cx_type( -(tmp[4].imag()), tmp[4].real() ) : cx_type( tmp[4].imag(), -tmp[4].real() );
+      const T x2_re = (Y2[i].real() * tw2[i].real()) - (Y2[i].imag() * tw2[i].imag());
+      const T x2_im = (Y2[i].real() * tw2[i].imag()) + (Y2[i].imag() * tw2[i].real());
       
-      tmp[4] = (inverse)
-                 ? cx_type( (tmp[2].imag() - tmp[0].imag()), (tmp[0].real() - tmp[2].real()) )
-                 : cx_type( (tmp[0].imag() - tmp[2].imag()), (tmp[2].real() - tmp[0].real()) );
+      const T x3_re = (Y3[i].real() * tw3[i].real()) - (Y3[i].imag() * tw3[i].imag());
+      const T x3_im = (Y3[i].real() * tw3[i].imag()) + (Y3[i].imag() * tw3[i].real());
       
-      tmp[1] = Y[i + m2] * coeffs[i*stride*2];
-      tmp[5] = Y[i] - tmp[1];
+      const T s02_re = x0_re + x2_re;
+      const T s02_im = x0_im + x2_im;
+      const T d02_re = x0_re - x2_re;
+      const T d02_im = x0_im - x2_im;
       
+      const T s13_re = x1_re + x3_re;
+      const T s13_im = x1_im + x3_im;
       
-      Y[i     ] += tmp[1];
-      Y[i + m2]  = Y[i] - tmp[3];
-      Y[i     ] += tmp[3];
-      Y[i + m ]  = tmp[5] + tmp[4];
-      Y[i + m3]  = tmp[5] - tmp[4];
+      // d13 rotated by -i (forward) or +i (inverse)
+      const T r13_re = (inverse) ? (x3_im - x1_im) : (x1_im - x3_im);
+      const T r13_im = (inverse) ? (x1_re - x3_re) : (x3_re - x1_re);
+      
+      Y0[i] = cx_type( (s02_re + s13_re), (s02_im + s13_im) );
+      Y1[i] = cx_type( (d02_re + r13_re), (d02_im + r13_im) );
+      Y2[i] = cx_type( (s02_re - s13_re), (s02_im - s13_im) );
+      Y3[i] = cx_type( (d02_re - r13_re), (d02_im - r13_im) );
       }
     }
   
@@ -307,15 +383,12 @@ struct fft_engine_kissfft
   arma_hot
   inline
   void
-  butterfly_N(cx_type* Y, const uword stride, const uword m, const uword r)
+  butterfly_N(cx_type* Y, const uword stride, const uword m, const uword r, cx_type* tmp) const
     {
     // arma_debug_sigprint();
     
     const cx_type* coeffs = coeffs_array.memptr();
     
-    tmp_array.set_min_size(r);
-    cx_type* tmp = tmp_array.memptr();
-    
     for(uword u=0; u < m; ++u)
       {
       uword k = u;
@@ -350,12 +423,25 @@ struct fft_engine_kissfft
   
   
   
+  //! the engine is not modified by run(), so one engine can be shared by several threads,
+  //! as long as each thread provides its own scratch memory (scratch_size elements)
   inline
   void
-  run(cx_type* Y, const cx_type* X, const uword stage = 0, const uword stride = 1)
+  run(cx_type* Y, const cx_type* X, cx_type* scratch) const
     {
     arma_debug_sigprint();
     
+    if(N <= 1)  { if(N == 1)  { Y[0] = X[0]; }  return; }
+    
+    run_stage(Y, X, scratch, 0, 1);
+    }
+  
+  
+  
+  inline
+  void
+  run_stage(cx_type* Y, const cx_type* X, cx_type* scratch, const uword stage, const uword stride) const
+    {
     const uword m = residue[stage];
     const uword r =   radix[stage];
     
@@ -370,19 +456,218 @@ struct fft_engine_kissfft
       const uword next_stage  = stage + 1;
       const uword next_stride = stride * r;
       
-      for(cx_type* Yi = Y; Yi != Y_end; Yi += m, X += stride)  { run(Yi, X, next_stage, next_stride); }
+      for(cx_type* Yi = Y; Yi != Y_end; Yi += m, X += stride)  { run_stage(Yi, X, scratch, next_stage, next_stride); }
       }
     
+    const cx_type* tw = stage_coeffs_array.memptr() + stage_offset[stage];
+    
     switch(r)
       {
-      case 2:  butterfly_2(Y, stride, m   );  break;
+      case 2:  butterfly_2(Y, tw,     m   );  break;
       case 3:  butterfly_3(Y, stride, m   );  break;
-      case 4:  butterfly_4(Y, stride, m   );  break;
+      case 4:  butterfly_4(Y, tw,     m   );  break;
       case 5:  butterfly_5(Y, stride, m   );  break;
-      default: butterfly_N(Y, stride, m, r);  break;
+      default: butterfly_N(Y, stride, m, r, scratch);  break;
       }
     }
   };
 
 
+
+//! real-to-complex transform;
+//! for even N the real input is packed into a complex sequence of length N/2,
+//! which is transformed and then split into the spectrum of the real input;
+//! odd N falls back to the full-length complex transform
+template<typename T>
+struct fft_engine_kissfft_r2c
+  {
+  typedef std::complex<T> cx_type;
+  
+  const uword N;
+  const uword M;
+  const bool  use_half;
+  
+  const fft_engine_kissfft<cx_type,false> worker;
+  
+  podarray<cx_type> split_coeffs;
+  
+  const uword scratch_size;
+  
+  
+  inline
+  fft_engine_kissfft_r2c(const uword in_N)
+    : N           (in_N)
+    , M           (in_N / 2)
+    , use_half    ( (in_N >= 4) && ((in_N % 2) == 0) )
+    , worker      ( (use_half) ? (in_N / 2) : in_N )
+    , scratch_size( ((use_half) ? M : N) + worker.scratch_size )
+    {
+    arma_debug_sigprint();
+    
+    if(use_half)
+      {
+      split_coeffs.set_size(M);
+      
+      cx_type* coeffs = split_coeffs.memptr();
+      
+      const T k = T(-2) * std::acos( T(-1) ) / T(N);
+      
+      for(uword i=0; i < M; ++i)  { coeffs[i] = std::exp( cx_type(T(0), i*k) ); }
+      }
+    }
+  
+  
+  //! Y must have space for N elements; the full (conjugate symmetric) spectrum is written
+  inline
+  void
+  run(cx_type* Y, const T* X, cx_type* scratch) const
+    {
+    arma_debug_sigprint();
+    
+    if(use_half == false)
+      {
+      for(uword i=0; i < N; ++i)  { scratch[i] = cx_type(X[i], T(0)); }
+      
+      worker.run(Y, scratch, scratch + N);
+      
+      return;
+      }
+    
+    // pack into the upper half of Y, and transform into the scratch memory
+    
+    cx_type* Y_hi = Y + M;
+    
+    for(uword i=0; i < M; ++i)  { Y_hi[i] = cx_type(X[2*i], X[2*i+1]); }
+    
+    worker.run(scratch, Y_hi, scratch + M);
+    
+    const cx_type* Z      = scratch;
+    const cx_type* coeffs = split_coeffs.memptr();
+    
+    Y[0] = cx_type( (Z[0].real() + Z[0].imag()), T(0) );
+    Y[M] = cx_type( (Z[0].real() - Z[0].imag()), T(0) );
+    
+    for(uword k=1; k < M; ++k)
+      {
+      const cx_type& Zk = Z[k  ];
+      const cx_type& Zj = Z[M-k];
+      
+      // even part: (Zk + conj(Zj)) / 2
+      const T e_re = T(0.5) * (Zk.real() + Zj.real());
+      const T e_im = T(0.5) * (Zk.imag() - Zj.imag());
+      
+      // odd part: (Zk - conj(Zj)) / (2i)
+      const T o_re = T(0.5) * (Zk.imag() + Zj.imag());
+      const T o_im = T(0.5) * (Zj.real() - Zk.real());
+      
+      const T w_re = coeffs[k].real();
+      const T w_im = coeffs[k].imag();
+      
+      const T y_re = e_re + (o_re * w_re) - (o_im * w_im);
+      const T y_im = e_im + (o_re * w_im) + (o_im * w_re);
+      
+      Y[k  ] = cx_type(y_re,  y_im);
+      Y[N-k] = cx_type(y_re, -y_im);
+      }
+    }
+  };
+
+
+
+//! complex-to-real transform (unscaled inverse);
+//! the input must be conjugate symmetric, ie. X[k] == conj(X[N-k]);
+//! only X[0] to X[N/2] are accessed when N is even
+template<typename T>
+struct fft_engine_kissfft_c2r
+  {
+  typedef std::complex<T> cx_type;
+  
+  const uword N;
+  const uword M;
+  const bool  use_half;
+  
+  const fft_engine_kissfft<cx_type,true> worker;
+  
+  podarray<cx_type> split_coeffs;
+  
+  const uword scratch_size;
+  
+  
+  inline
+  fft_engine_kissfft_c2r(const uword in_N)
+    : N           (in_N)
+    , M           (in_N / 2)
+    , use_half    ( (in_N >= 4) && ((in_N % 2) == 0) )
+    , worker      ( (use_half) ? (in_N / 2) : in_N )
+    , scratch_size( ((use_half) ? (2*M) : N) + worker.scratch_size )
+    {
+    arma_debug_sigprint();
+    
+    if(use_half)
+      {
+      split_coeffs.set_size(M);
+      
+      cx_type* coeffs = split_coeffs.memptr();
+      
+      const T k = T(+2) * std::acos( T(-1) ) / T(N);
+      
+      for(uword i=0; i < M; ++i)  { coeffs[i] = std::exp( cx_type(T(0), i*k) ); }
+      }
+    }
+  
+  
+  inline
+  void
+  run(T* Y, const cx_type* X, cx_type* scratch) const
+    {
+    arma_debug_sigprint();
+    
+    if(use_half == false)
+      {
+      worker.run(scratch, X, scratch + N);
+      
+      for(uword i=0; i < N; ++i)  { Y[i] = scratch[i].real(); }
+      
+      return;
+      }
+    
+          cx_type* Z       = scratch;
+          cx_type* out_mem = scratch + M;
+    const cx_type* coeffs  = split_coeffs.memptr();
+    
+    for(uword k=0; k < M; ++k)
+      {
+      const cx_type& Xk = X[k  ];
+      const cx_type& Xj = X[M-k];
+      
+      // even part: Xk + conj(Xj)
+      const T e_re = Xk.real() + Xj.real();
+      const T e_im = Xk.imag() - Xj.imag();
+      
+      // odd part: (Xk - conj(Xj)) * exp(+2 pi i k / N)
+      const T d_re = Xk.real() - Xj.real();
+      const T d_im = Xk.imag() + Xj.imag();
+      
+      const T w_re = coeffs[k].real();
+      const T w_im = coeffs[k].imag();
+      
+      const T o_re = (d_re * w_re) - (d_im * w_im);
+      const T o_im = (d_re * w_im) + (d_im * w_re);
+      
+      // Z = even + i*odd
+      Z[k] = cx_type( (e_re - o_im), (e_im + o_re) );
+      }
+    
+    worker.run(out_mem, Z, scratch + 2*M);
+    
+    for(uword i=0; i < M; ++i)
+      {
+      Y[2*i  ] = out_mem[i].real();
+      Y[2*i+1] = out_mem[i].imag();
+      }
+    }
+  };
+
+
+
 //! @}
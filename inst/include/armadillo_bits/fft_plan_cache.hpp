@@ -0,0 +1,153 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 The RcppArmadillo Authors
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup fft_plan_cache
+//! @{
+
+
+
+//! process-wide cache of FFT engines (plans), keyed by transform length;
+//! the direction and kind of transform (complex, real-to-complex, complex-to-real)
+//! are part of engine_type, so each combination has its own cache;
+//! cached engines are immutable and can be used by several threads at once;
+//! when the cache is full, the least recently used engine is evicted
+template<typename engine_type>
+struct fft_plan_cache
+  {
+  static constexpr uword max_n_plans = 16;
+  
+  typedef std::shared_ptr<const engine_type> plan_ptr;
+  
+  struct cache_entry
+    {
+    plan_ptr plan;
+    uword    last_use;
+    };
+  
+  struct cache_state
+    {
+    std::map<uword, cache_entry> plans;
+    uword                        n_uses = 0;
+    };
+  
+  
+  static
+  inline
+  cache_state&
+  get_state()
+    {
+    #if defined(ARMA_USE_FFTW3) && defined(ARMA_USE_STD_MUTEX)
+      {
+      // ensure the FFTW3 plan mutex outlives the cache, as destroying FFTW3 plans requires the mutex
+      fft_engine_fftw3_aux::get_plan_mutex();
+      }
+    #endif
+    
+    static cache_state state;
+    
+    return state;
+    }
+  
+  
+  #if defined(ARMA_USE_STD_MUTEX)
+  static inline std::mutex& get_cache_mutex() { static std::mutex cache_mutex; return cache_mutex; }
+  #endif
+  
+  
+  static
+  inline
+  plan_ptr
+  get_plan_nolock(const uword N)
+    {
+    cache_state& state = fft_plan_cache::get_state();
+    
+    std::map<uword, cache_entry>& plans = state.plans;
+    
+    ++state.n_uses;
+    
+    typename std::map<uword, cache_entry>::iterator it = plans.find(N);
+    
+    if(it != plans.end())
+      {
+      it->second.last_use = state.n_uses;
+      
+      return it->second.plan;
+      }
+    
+    arma_debug_print("fft_plan_cache: creating plan");
+    
+    plan_ptr plan = std::make_shared<const engine_type>(N);
+    
+    // engines currently in use are kept alive by their shared pointers
+    if(plans.size() >= max_n_plans)
+      {
+      typename std::map<uword, cache_entry>::iterator lru = plans.begin();
+      
+      for(it = plans.begin(); it != plans.end(); ++it)  { if(it->second.last_use < lru->second.last_use)  { lru = it; } }
+      
+      arma_debug_print("fft_plan_cache: evicting plan");
+      
+      plans.erase(lru);
+      }
+    
+    cache_entry& entry = plans[N];
+    
+    entry.plan     = plan;
+    entry.last_use = state.n_uses;
+    
+    return plan;
+    }
+  
+  
+  static
+  inline
+  plan_ptr
+  get_plan(const uword N)
+    {
+    arma_debug_sigprint();
+    
+    plan_ptr plan;
+    
+    #if defined(ARMA_USE_OPENMP)
+      {
+      #pragma omp critical (arma_fft_plan_cache)
+        {
+        plan = fft_plan_cache::get_plan_nolock(N);
+        }
+      }
+    #elif defined(ARMA_USE_STD_MUTEX)
+      {
+      std::mutex& cache_mutex = fft_plan_cache::get_cache_mutex();
+      
+      const std::lock_guard<std::mutex> lock(cache_mutex);
+      
+      plan = fft_plan_cache::get_plan_nolock(N);
+      }
+    #else
+      {
+      plan = fft_plan_cache::get_plan_nolock(N);
+      }
+    #endif
+    
+    return plan;
+    }
+  };
+
+
+
+//! @}
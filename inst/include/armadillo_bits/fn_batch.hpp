@@ -0,0 +1,315 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 The RcppArmadillo Authors
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup fn_batch
+//! @{
+
+
+
+//! Cholesky decomposition of each slice of X
+template<typename T1>
+inline
+typename enable_if2< is_blas_type<typename T1::elem_type>::value, bool >::result
+chol_batch
+  (
+             Cube<typename T1::elem_type>&    out,
+  const BaseCube<typename T1::elem_type,T1>& X,
+  const char* layout = "upper"
+  )
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const char sig = (layout != nullptr) ? layout[0] : char(0);
+  
+  arma_conform_check( ((sig != 'u') && (sig != 'l')), "chol_batch(): layout must be \"upper\" or \"lower\"" );
+  
+  const unwrap_cube_check<T1> U(X.get_ref(), out);
+  
+  const Cube<eT>& A = U.M;
+  
+  arma_conform_check( (A.n_rows != A.n_cols), "chol_batch(): given slices must be square sized" );
+  
+  arma_conform_assert_blas_size(A);
+  
+  const bool status = batch_linalg::chol(out, A, ((sig == 'u') ? 0 : 1));
+  
+  if(status == false)
+    {
+    out.soft_reset();
+    arma_warn(3, "chol_batch(): decomposition failed");
+    }
+  
+  return status;
+  }
+
+
+
+//! inverse of each slice of X, where each slice is symmetric/hermitian positive definite
+template<typename T1>
+inline
+typename enable_if2< is_blas_type<typename T1::elem_type>::value, bool >::result
+inv_sympd_batch
+  (
+             Cube<typename T1::elem_type>&    out,
+  const BaseCube<typename T1::elem_type,T1>& X
+  )
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const unwrap_cube_check<T1> U(X.get_ref(), out);
+  
+  const Cube<eT>& A = U.M;
+  
+  arma_conform_check( (A.n_rows != A.n_cols), "inv_sympd_batch(): given slices must be square sized" );
+  
+  arma_conform_assert_blas_size(A);
+  
+  const bool status = batch_linalg::inv_sympd(out, A);
+  
+  if(status == false)
+    {
+    out.soft_reset();
+    arma_warn(3, "inv_sympd_batch(): matrix is singular or not positive definite");
+    }
+  
+  return status;
+  }
+
+
+
+//! out.slice(i) = solve(A.slice(i), B.slice(i));
+//! if A or B has only one slice, it is used for all systems;
+//! systems which are singular or close to singular are solved approximately, as done by solve()
+template<typename T1, typename T2>
+inline
+typename enable_if2< is_blas_type<typename T1::elem_type>::value, bool >::result
+solve_batch
+  (
+             Cube<typename T1::elem_type>&    out,
+  const BaseCube<typename T1::elem_type,T1>& A_expr,
+  const BaseCube<typename T1::elem_type,T2>& B_expr
+  )
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const unwrap_cube_check<T1> UA(A_expr.get_ref(), out);
+  const unwrap_cube_check<T2> UB(B_expr.get_ref(), out);
+  
+  const Cube<eT>& A = UA.M;
+  const Cube<eT>& B = UB.M;
+  
+  arma_conform_check( (A.n_rows != A.n_cols), "solve_batch(): given slices must be square sized" );
+  
+  arma_conform_check( (A.n_rows != B.n_rows), "solve_batch(): number of rows in given objects must be the same" );
+  
+  arma_conform_check( ((A.n_slices != B.n_slices) && (A.n_slices != 1) && (B.n_slices != 1)), "solve_batch(): number of slices in given objects must be the same" );
+  
+  arma_conform_assert_blas_size(A,B);
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  Col<T> rcond;
+  
+  bool status = batch_linalg::solve(out, rcond, A, B);
+  
+  // as done by solve(), systems which are singular or close to singular are solved approximately via SVD;
+  // this is done outside of the batched kernel so that warnings are not emitted from within parallel regions
+  
+  for(uword s=0; (status == true) && (s < rcond.n_elem); ++s)
+    {
+    const T rcond_s = rcond[s];
+    
+    if( (rcond_s >= std::numeric_limits<T>::epsilon()) && (arma_isnan(rcond_s) == false) )  { continue; }
+    
+    if(rcond_s == T(0))
+      {
+      arma_warn(2, "solve_batch(): system in slice ", s, " is singular; attempting approx solution");
+      }
+    else
+      {
+      arma_warn(2, "solve_batch(): system in slice ", s, " is singular; attempting approx solution; rcond: ", rcond_s);
+      }
+    
+    Mat<eT> AA = A.slice( (A.n_slices == 1) ? uword(0) : s );
+    
+    Mat<eT> XX;
+    
+    status = auxlib::solve_approx_svd(XX, AA, B.slice( (B.n_slices == 1) ? uword(0) : s ));  // AA is overwritten
+    
+    if(status)  { out.slice(s) = XX; }
+    }
+  
+  if(status == false)
+    {
+    out.soft_reset();
+    arma_warn(3, "solve_batch(): solution not found");
+    }
+  
+  return status;
+  }
+
+
+
+//! determinant of each slice of X
+template<typename T1>
+inline
+typename enable_if2< is_blas_type<typename T1::elem_type>::value, bool >::result
+det_batch
+  (
+                 Col<typename T1::elem_type>&    out,
+  const BaseCube<typename T1::elem_type,T1>& X
+  )
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const unwrap_cube<T1> U(X.get_ref());
+  
+  const Cube<eT>& A = U.M;
+  
+  arma_conform_check( (A.n_rows != A.n_cols), "det_batch(): given slices must be square sized" );
+  
+  arma_conform_assert_blas_size(A);
+  
+  const bool status = batch_linalg::det(out, A);
+  
+  if(status == false)
+    {
+    out.soft_reset();
+    arma_warn(3, "det_batch(): failed to find determinant");
+    }
+  
+  return status;
+  }
+
+
+
+//! log determinant of each slice of X
+template<typename T1>
+inline
+typename enable_if2< is_blas_type<typename T1::elem_type>::value, bool >::result
+log_det_batch
+  (
+                 Col<typename T1::elem_type>&    out_val,
+                 Col<typename T1::pod_type >&    out_sign,
+  const BaseCube<typename T1::elem_type,T1>& X
+  )
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  arma_conform_check( ((void*)(&out_val) == (void*)(&out_sign)), "log_det_batch(): out_val and out_sign are the same object" );
+  
+  const unwrap_cube<T1> U(X.get_ref());
+  
+  const Cube<eT>& A = U.M;
+  
+  arma_conform_check( (A.n_rows != A.n_cols), "log_det_batch(): given slices must be square sized" );
+  
+  arma_conform_assert_blas_size(A);
+  
+  const bool status = batch_linalg::log_det(out_val, out_sign, A);
+  
+  if(status == false)
+    {
+    out_val.soft_reset();
+    out_sign.soft_reset();
+    arma_warn(3, "log_det_batch(): failed to find determinant");
+    }
+  
+  return status;
+  }
+
+
+
+//! log determinant of each slice of X, where each slice is symmetric/hermitian positive definite
+template<typename T1>
+inline
+typename enable_if2< is_blas_type<typename T1::elem_type>::value, bool >::result
+log_det_sympd_batch
+  (
+                 Col<typename T1::pod_type>&     out,
+  const BaseCube<typename T1::elem_type,T1>& X
+  )
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const unwrap_cube<T1> U(X.get_ref());
+  
+  const Cube<eT>& A = U.M;
+  
+  arma_conform_check( (A.n_rows != A.n_cols), "log_det_sympd_batch(): given slices must be square sized" );
+  
+  arma_conform_assert_blas_size(A);
+  
+  const bool status = batch_linalg::log_det_sympd(out, A);
+  
+  if(status == false)
+    {
+    out.soft_reset();
+    arma_warn(3, "log_det_sympd_batch(): given matrix is not symmetric positive definite");
+    }
+  
+  return status;
+  }
+
+
+
+//! out.slice(i) = A.slice(i) * B.slice(i);
+//! if A or B has only one slice, it is used for all products
+template<typename T1, typename T2>
+inline
+typename enable_if2< is_blas_type<typename T1::elem_type>::value, void >::result
+times_batch
+  (
+             Cube<typename T1::elem_type>&    out,
+  const BaseCube<typename T1::elem_type,T1>& A_expr,
+  const BaseCube<typename T1::elem_type,T2>& B_expr
+  )
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const unwrap_cube_check<T1> UA(A_expr.get_ref(), out);
+  const unwrap_cube_check<T2> UB(B_expr.get_ref(), out);
+  
+  const Cube<eT>& A = UA.M;
+  const Cube<eT>& B = UB.M;
+  
+  arma_conform_assert_mul_size(A.n_rows, A.n_cols, B.n_rows, B.n_cols, "times_batch()");
+  
+  arma_conform_check( ((A.n_slices != B.n_slices) && (A.n_slices != 1) && (B.n_slices != 1)), "times_batch(): number of slices in given objects must be the same" );
+  
+  arma_conform_assert_blas_size(A,B);
+  
+  batch_linalg::times(out, A, B);
+  }
+
+
+
+//! @}
@@ -146,4 +146,79 @@ chol
 
 
 
+//! update the Cholesky factor R of X in place to that of X + V*V' (method "+") or X - V*V' (method "-"), in O(n^2) operations per column of V;
+//! R is unchanged if the downdated matrix is not positive definite
+template<typename T1>
+inline
+typename enable_if2< is_blas_type<typename T1::elem_type>::value, bool >::result
+chol_update
+  (
+         Mat<typename T1::elem_type>&    R,
+  const Base<typename T1::elem_type,T1>& V,
+  const char*                            method = "+",
+  const char*                            layout = "upper"
+  )
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const char sig_method = (method != nullptr) ? method[0] : char(0);
+  const char sig_layout = (layout != nullptr) ? layout[0] : char(0);
+  
+  arma_conform_check( ((sig_method != '+') && (sig_method != '-')), "chol_update(): argument 'method' must be \"+\" or \"-\""       );
+  arma_conform_check( ((sig_layout != 'u') && (sig_layout != 'l')), "chol_update(): argument 'layout' must be \"upper\" or \"lower\"" );
+  
+  const unwrap_check<T1> U(V.get_ref(), R);
+  const Mat<eT>& VV    = U.M;
+  
+  arma_conform_check( (R.is_square() == false), "chol_update(): given factor must be square sized" );
+  
+  arma_conform_check( (VV.n_rows != R.n_rows), "chol_update(): number of rows in V must match the size of the given factor" );
+  
+  if(VV.internal_has_nonfinite())
+    {
+    arma_warn(3, "chol_update(): detected non-finite elements");
+    return false;
+    }
+  
+  const bool status = auxlib::chol_update(R, VV, (sig_method == '-'), ((sig_layout == 'u') ? 0 : 1));
+  
+  if(status == false)  { arma_warn(3, "chol_update(): downdated matrix is not positive definite"); }
+  
+  return status;
+  }
+
+
+
+//! Cholesky decomposition computed directly in the memory of X, without a copy of X;
+//! X is overwritten by the factor
+template<typename eT>
+inline
+typename enable_if2< is_blas_type<eT>::value, bool >::result
+chol_inplace
+  (
+  Mat<eT>&    X,
+  const char* layout = "upper"
+  )
+  {
+  arma_debug_sigprint();
+  
+  const char sig = (layout != nullptr) ? layout[0] : char(0);
+  
+  arma_conform_check( ((sig != 'u') && (sig != 'l')), "chol_inplace(): layout must be \"upper\" or \"lower\"" );
+  
+  const bool status = op_chol::apply_direct(X, X, ((sig == 'u') ? 0 : 1));
+  
+  if(status == false)
+    {
+    X.soft_reset();
+    arma_warn(3, "chol_inplace(): decomposition failed");
+    }
+  
+  return status;
+  }
+
+
+
 //! @}
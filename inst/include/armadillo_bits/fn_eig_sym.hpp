@@ -36,6 +36,12 @@ eig_sym
   
   Mat<eT> A(X.get_ref());
   
+  if((arma_config::check_conform) && (auxlib::rudimentary_sym_check(A) == false))
+    {
+    if(is_cx<eT>::no )  { arma_warn(1, "eig_sym(): given matrix is not symmetric"); }
+    if(is_cx<eT>::yes)  { arma_warn(1, "eig_sym(): given matrix is not hermitian"); }
+    }
+  
   const bool status = auxlib::eig_sym(eigval, A);
   
   if(status == false)
@@ -67,6 +73,12 @@ eig_sym
   Col< T> eigval;
   Mat<eT> A(X.get_ref());
   
+  if((arma_config::check_conform) && (auxlib::rudimentary_sym_check(A) == false))
+    {
+    if(is_cx<eT>::no )  { arma_warn(1, "eig_sym(): given matrix is not symmetric"); }
+    if(is_cx<eT>::yes)  { arma_warn(1, "eig_sym(): given matrix is not hermitian"); }
+    }
+  
   const bool status = auxlib::eig_sym(eigval, A);
 
   if(status == false)
@@ -80,6 +92,98 @@ eig_sym
 
 
 
+//! internal helper function
+template<typename eT>
+inline
+bool
+eig_sym_range_helper
+  (
+        Col<typename get_pod_type<eT>::result>& eigval,
+        Mat<eT>&                                eigvec,
+  const Mat<eT>&                                X,
+  const eig_range&                              range,
+  const bool                                    calc_vec
+  )
+  {
+  arma_debug_sigprint();
+  
+  if((arma_config::check_conform) && (auxlib::rudimentary_sym_check(X) == false))
+    {
+    if(is_cx<eT>::no )  { arma_warn(1, "eig_sym(): given matrix is not symmetric"); }
+    if(is_cx<eT>::yes)  { arma_warn(1, "eig_sym(): given matrix is not hermitian"); }
+    }
+  
+  return auxlib::eig_sym_range(eigval, eigvec, X, range, calc_vec);
+  }
+
+
+
+//! Subset of eigenvalues of real/complex symmetric/hermitian matrix X, selected by index or value range
+template<typename T1>
+inline
+typename enable_if2< is_blas_type<typename T1::elem_type>::value, bool >::result
+eig_sym
+  (
+         Col<typename T1::pod_type>&     eigval,
+  const Base<typename T1::elem_type,T1>& X,
+  const eig_range&                       range
+  )
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const quasi_unwrap<T1> U(X.get_ref());
+  
+  Mat<eT> eigvec_junk;
+  
+  const bool status = eig_sym_range_helper(eigval, eigvec_junk, U.M, range, false);
+  
+  if(status == false)
+    {
+    eigval.soft_reset();
+    arma_warn(3, "eig_sym(): decomposition failed");
+    }
+  
+  return status;
+  }
+
+
+
+//! Subset of eigenvalues of real/complex symmetric/hermitian matrix X, selected by index or value range
+template<typename T1>
+arma_warn_unused
+inline
+typename enable_if2< is_blas_type<typename T1::elem_type>::value, Col<typename T1::pod_type> >::result
+eig_sym
+  (
+  const Base<typename T1::elem_type,T1>& X,
+  const eig_range&                       range
+  )
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  typedef typename T1::pod_type   T;
+  
+  const quasi_unwrap<T1> U(X.get_ref());
+  
+  Col< T> eigval;
+  Mat<eT> eigvec_junk;
+  
+  const bool status = eig_sym_range_helper(eigval, eigvec_junk, U.M, range, false);
+  
+  if(status == false)
+    {
+    eigval.reset();
+    arma_stop_runtime_error("eig_sym(): decomposition failed");
+    }
+  
+  return eigval;
+  }
+
+
+
 //! internal helper function
 template<typename eT>
 inline
@@ -173,4 +277,124 @@ eig_sym
 
 
 
+//! Subset of eigenvalues and eigenvectors of real/complex symmetric/hermitian matrix X, selected by index or value range;
+//! only the selected eigenvectors are computed
+template<typename T1> 
+inline
+typename enable_if2< is_blas_type<typename T1::elem_type>::value, bool >::result
+eig_sym
+  (
+         Col<typename T1::pod_type>&     eigval,
+         Mat<typename T1::elem_type>&    eigvec,
+  const Base<typename T1::elem_type,T1>& expr,
+  const eig_range&                       range
+  )
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  arma_conform_check( void_ptr(&eigval) == void_ptr(&eigvec), "eig_sym(): parameter 'eigval' is an alias of parameter 'eigvec'" );
+  
+  const quasi_unwrap<T1> U(expr.get_ref());
+  
+  const bool is_alias = U.is_alias(eigvec);
+  
+  Mat<eT>  eigvec_tmp;
+  Mat<eT>& eigvec_out = (is_alias == false) ? eigvec : eigvec_tmp;
+  
+  const bool status = eig_sym_range_helper(eigval, eigvec_out, U.M, range, true);
+  
+  if(status == false)
+    {
+    eigval.soft_reset();
+    eigvec.soft_reset();
+    arma_warn(3, "eig_sym(): decomposition failed");
+    }
+  else
+    {
+    if(is_alias)  { eigvec.steal_mem(eigvec_tmp); }
+    }
+  
+  return status;
+  }
+
+
+
+//! Eigenvalues of real/complex symmetric/hermitian matrix X, computed directly in the memory of X, without a copy of X;
+//! X is used as workspace and is left empty (or set to zero if its size cannot be changed)
+template<typename eT>
+inline
+typename enable_if2< is_blas_type<eT>::value, bool >::result
+eig_sym_inplace
+  (
+  Col<typename get_pod_type<eT>::result>& eigval,
+  Mat<eT>&                                X
+  )
+  {
+  arma_debug_sigprint();
+  
+  if((arma_config::check_conform) && (auxlib::rudimentary_sym_check(X) == false))
+    {
+    if(is_cx<eT>::no )  { arma_warn(1, "eig_sym_inplace(): given matrix is not symmetric"); }
+    if(is_cx<eT>::yes)  { arma_warn(1, "eig_sym_inplace(): given matrix is not hermitian"); }
+    }
+  
+  const bool status = auxlib::eig_sym(eigval, X);
+  
+  X.soft_reset();
+  
+  if(status == false)
+    {
+    eigval.soft_reset();
+    arma_warn(3, "eig_sym_inplace(): decomposition failed");
+    }
+  
+  return status;
+  }
+
+
+
+//! Eigenvalues and eigenvectors of real/complex symmetric/hermitian matrix X, computed directly in the memory of X, without a copy of X;
+//! X is overwritten by the eigenvectors
+template<typename eT>
+inline
+typename enable_if2< is_blas_type<eT>::value, bool >::result
+eig_sym_inplace
+  (
+  Col<typename get_pod_type<eT>::result>& eigval,
+  Mat<eT>&                                X,
+  const char*                             method
+  )
+  {
+  arma_debug_sigprint();
+  
+  const char sig = (method != nullptr) ? method[0] : char(0);
+  
+  arma_conform_check( ((sig != 's') && (sig != 'd')), "eig_sym_inplace(): unknown method specified" );
+  
+  if((arma_config::check_conform) && (auxlib::rudimentary_sym_check(X) == false))
+    {
+    if(is_cx<eT>::no )  { arma_warn(1, "eig_sym_inplace(): given matrix is not symmetric"); }
+    if(is_cx<eT>::yes)  { arma_warn(1, "eig_sym_inplace(): given matrix is not hermitian"); }
+    }
+  
+  // unlike eig_sym(), there is no fallback to the standard algorithm, as X has already been overwritten
+  
+  const bool allow_dc = (sizeof(blas_int) >= std::size_t(8)) ? true : (X.n_rows <= uword(32000));
+  
+  const bool status = ((sig == 'd') && allow_dc) ? auxlib::eig_sym_dc(eigval, X, X) : auxlib::eig_sym(eigval, X, X);
+  
+  if(status == false)
+    {
+    eigval.soft_reset();
+    X.soft_reset();
+    arma_warn(3, "eig_sym_inplace(): decomposition failed");
+    }
+  
+  return status;
+  }
+
+
+
 //! @}
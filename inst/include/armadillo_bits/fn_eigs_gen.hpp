@@ -422,4 +422,40 @@ eigs_gen
 
 
 
+//! eigenvalues and eigenvectors of a general real linear operator, given as an object instead of a matrix;
+//! the object provides the member n_rows, as well as perform_op(T* x_in, T* y_out) to evaluate y_out = A*x_in
+//! and/or perform_op_block(const Mat<T>& X_in, Mat<T>& Y_out) to evaluate Y_out = A*X_in
+template<typename T, typename OpType>
+inline
+typename enable_if2< (is_blas_real<T>::value && (is_arma_type<OpType>::value == false) && (is_arma_sparse_type<OpType>::value == false)), bool >::result
+eigs_gen
+  (
+         Col< std::complex<T> >& eigval,
+         Mat< std::complex<T> >& eigvec,
+  const  OpType&                 op,
+  const  uword                   n_eigvals,
+  const  char*                   form = "lm",
+  const  eigs_opts               opts = eigs_opts()
+  )
+  {
+  arma_debug_sigprint();
+  
+  arma_conform_check( void_ptr(&eigval) == void_ptr(&eigvec), "eigs_gen(): parameter 'eigval' is an alias of parameter 'eigvec'" );
+  
+  sp_auxlib::form_type form_val = sp_auxlib::interpret_form_str(form);
+  
+  const bool status = sp_auxlib::eigs_gen_op(eigval, eigvec, op, n_eigvals, form_val, opts);
+  
+  if(status == false)
+    {
+    eigval.soft_reset();
+    eigvec.soft_reset();
+    arma_warn(3, "eigs_gen(): decomposition failed");
+    }
+  
+  return status;
+  }
+
+
+
 //! @}
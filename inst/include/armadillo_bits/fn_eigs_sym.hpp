@@ -287,4 +287,40 @@ eigs_sym
 
 
 
+//! eigenvalues and eigenvectors of a symmetric real linear operator, given as an object instead of a matrix;
+//! the object provides the member n_rows, as well as perform_op(eT* x_in, eT* y_out) to evaluate y_out = A*x_in
+//! and/or perform_op_block(const Mat<eT>& X_in, Mat<eT>& Y_out) to evaluate Y_out = A*X_in
+template<typename eT, typename OpType>
+inline
+typename enable_if2< (is_blas_real<eT>::value && (is_arma_type<OpType>::value == false) && (is_arma_sparse_type<OpType>::value == false)), bool >::result
+eigs_sym
+  (
+           Col<eT>&  eigval,
+           Mat<eT>&  eigvec,
+  const    OpType&   op,
+  const    uword     n_eigvals,
+  const    char*     form = "lm",
+  const    eigs_opts opts = eigs_opts()
+  )
+  {
+  arma_debug_sigprint();
+  
+  arma_conform_check( void_ptr(&eigval) == void_ptr(&eigvec), "eigs_sym(): parameter 'eigval' is an alias of parameter 'eigvec'" );
+  
+  sp_auxlib::form_type form_val = sp_auxlib::interpret_form_str(form);
+  
+  const bool status = sp_auxlib::eigs_sym_op(eigval, eigvec, op, n_eigvals, form_val, opts);
+  
+  if(status == false)
+    {
+    eigval.soft_reset();
+    eigvec.soft_reset();
+    arma_warn(3, "eigs_sym(): decomposition failed");
+    }
+  
+  return status;
+  }
+
+
+
 //! @}
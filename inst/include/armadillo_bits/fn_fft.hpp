@@ -133,4 +133,126 @@ ifft(const T1& A, const uword N)
 
 
 
+// 1D FFT & 1D IFFT of cubes, along the specified dimension
+
+
+
+template<typename T1>
+arma_warn_unused
+inline
+Cube< std::complex<typename T1::pod_type> >
+fft(const BaseCube<typename T1::elem_type,T1>& X, const uword N, const uword dim)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  typedef typename T1::pod_type   T;
+  
+  arma_conform_check( (dim > 2), "fft(): parameter 'dim' must be 0 or 1 or 2" );
+  
+  const unwrap_cube<T1> U(X.get_ref());
+  
+  Cube< std::complex<T> > out;
+  
+  op_fft_cube::apply_noalias<false, eT>(out, U.M, N, dim);
+  
+  return out;
+  }
+
+
+
+template<typename T1>
+arma_warn_unused
+inline
+Cube< std::complex<typename T1::pod_type> >
+fft(const BaseCube<typename T1::elem_type,T1>& X, const uword N)
+  {
+  arma_debug_sigprint();
+  
+  return fft(X, N, uword(0));
+  }
+
+
+
+template<typename T1>
+arma_warn_unused
+inline
+Cube< std::complex<typename T1::pod_type> >
+fft(const BaseCube<typename T1::elem_type,T1>& X)
+  {
+  arma_debug_sigprint();
+  
+  const unwrap_cube<T1> U(X.get_ref());
+  
+  return fft(U.M, U.M.n_rows, uword(0));
+  }
+
+
+
+template<typename T1>
+arma_warn_unused
+inline
+typename
+enable_if2
+  <
+  is_cx<typename T1::elem_type>::yes,
+  Cube<typename T1::elem_type>
+  >::result
+ifft(const BaseCube<typename T1::elem_type,T1>& X, const uword N, const uword dim)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  arma_conform_check( (dim > 2), "ifft(): parameter 'dim' must be 0 or 1 or 2" );
+  
+  const unwrap_cube<T1> U(X.get_ref());
+  
+  Cube<eT> out;
+  
+  op_fft_cube::apply_noalias<true, eT>(out, U.M, N, dim);
+  
+  return out;
+  }
+
+
+
+template<typename T1>
+arma_warn_unused
+inline
+typename
+enable_if2
+  <
+  is_cx<typename T1::elem_type>::yes,
+  Cube<typename T1::elem_type>
+  >::result
+ifft(const BaseCube<typename T1::elem_type,T1>& X, const uword N)
+  {
+  arma_debug_sigprint();
+  
+  return ifft(X, N, uword(0));
+  }
+
+
+
+template<typename T1>
+arma_warn_unused
+inline
+typename
+enable_if2
+  <
+  is_cx<typename T1::elem_type>::yes,
+  Cube<typename T1::elem_type>
+  >::result
+ifft(const BaseCube<typename T1::elem_type,T1>& X)
+  {
+  arma_debug_sigprint();
+  
+  const unwrap_cube<T1> U(X.get_ref());
+  
+  return ifft(U.M, U.M.n_rows, uword(0));
+  }
+
+
+
 //! @}
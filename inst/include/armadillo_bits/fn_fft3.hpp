@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 The RcppArmadillo Authors
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup fn_fft3
+//! @{
+
+
+
+// 3D FFT & 3D IFFT
+
+
+
+template<typename T1>
+arma_warn_unused
+inline
+Cube< std::complex<typename T1::pod_type> >
+fft3(const BaseCube<typename T1::elem_type,T1>& X)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  typedef typename T1::pod_type   T;
+  
+  const unwrap_cube<T1> U(X.get_ref());
+  const Cube<eT>&       A = U.M;
+  
+  Cube< std::complex<T> > out;
+  
+  op_fft_cube::apply_fft3<false, eT>(out, A, A.n_rows, A.n_cols, A.n_slices);
+  
+  return out;
+  }
+
+
+
+template<typename T1>
+arma_warn_unused
+inline
+Cube< std::complex<typename T1::pod_type> >
+fft3(const BaseCube<typename T1::elem_type,T1>& X, const uword n_rows, const uword n_cols, const uword n_slices)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  typedef typename T1::pod_type   T;
+  
+  const unwrap_cube<T1> U(X.get_ref());
+  
+  // zero-padding or truncation along each dimension is applied by the corresponding 1D pass
+  
+  Cube< std::complex<T> > out;
+  
+  op_fft_cube::apply_fft3<false, eT>(out, U.M, n_rows, n_cols, n_slices);
+  
+  return out;
+  }
+
+
+
+template<typename T1>
+arma_warn_unused
+inline
+typename
+enable_if2
+  <
+  is_cx<typename T1::elem_type>::yes,
+  Cube<typename T1::elem_type>
+  >::result
+ifft3(const BaseCube<typename T1::elem_type,T1>& X)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const unwrap_cube<T1> U(X.get_ref());
+  const Cube<eT>&       A = U.M;
+  
+  Cube<eT> out;
+  
+  op_fft_cube::apply_fft3<true, eT>(out, A, A.n_rows, A.n_cols, A.n_slices);
+  
+  return out;
+  }
+
+
+
+template<typename T1>
+arma_warn_unused
+inline
+typename
+enable_if2
+  <
+  is_cx<typename T1::elem_type>::yes,
+  Cube<typename T1::elem_type>
+  >::result
+ifft3(const BaseCube<typename T1::elem_type,T1>& X, const uword n_rows, const uword n_cols, const uword n_slices)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const unwrap_cube<T1> U(X.get_ref());
+  
+  Cube<eT> out;
+  
+  op_fft_cube::apply_fft3<true, eT>(out, U.M, n_rows, n_cols, n_slices);
+  
+  return out;
+  }
+
+
+
+//! @}
@@ -135,4 +135,29 @@ inv
 
 
 
+//! inverse computed directly in the memory of X, without a copy of X;
+//! X is overwritten by the inverse
+template<typename eT>
+inline
+typename enable_if2< is_blas_type<eT>::value, bool >::result
+inv_inplace
+  (
+  Mat<eT>& X
+  )
+  {
+  arma_debug_sigprint();
+  
+  const bool status = op_inv_gen_default::apply_direct(X, X, "inv_inplace()");
+  
+  if(status == false)
+    {
+    X.soft_reset();
+    arma_warn(3, "inv_inplace(): matrix is singular");
+    }
+  
+  return status;
+  }
+
+
+
 //! @}
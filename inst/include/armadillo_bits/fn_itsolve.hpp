@@ -0,0 +1,245 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 The RcppArmadillo Authors
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup fn_itsolve
+//! @{
+
+
+
+//! sparse matrix A
+template<typename TA, typename eT>
+inline
+typename enable_if2< is_arma_sparse_type<TA>::value, bool >::result
+itsolve_dispatch(Mat<eT>& out, itsolve_info& info, const TA& A_expr, const Mat<eT>& B, const char sig, const itsolve_opts& opts)
+  {
+  arma_debug_sigprint();
+  
+  arma_type_check(( is_same_type< eT, typename TA::elem_type >::no ));
+  
+  const unwrap_spmat<TA> U(A_expr);
+  
+  const SpMat<eT>& A = U.M;
+  
+  arma_conform_check( (A.n_rows != A.n_cols), "itsolve(): matrix A must be square sized" );
+  arma_conform_check( (A.n_rows != B.n_rows), "itsolve(): number of rows in A and B must be the same" );
+  
+  const itsolve_op_spmat<eT> op(A);
+  
+  itsolve_precond<eT> M;
+  
+  M.init(A, opts.precond);
+  
+  return itsolve_worker::solve(out, info, op, M, B, sig, opts);
+  }
+
+
+
+//! dense matrix A
+template<typename TA, typename eT>
+inline
+typename enable_if2< is_arma_type<TA>::value, bool >::result
+itsolve_dispatch(Mat<eT>& out, itsolve_info& info, const TA& A_expr, const Mat<eT>& B, const char sig, const itsolve_opts& opts)
+  {
+  arma_debug_sigprint();
+  
+  arma_type_check(( is_same_type< eT, typename TA::elem_type >::no ));
+  
+  const quasi_unwrap<TA> U(A_expr);
+  
+  if(U.is_alias(out))
+    {
+    const Mat<eT> A_copy(U.M);
+    
+    return itsolve_dispatch(out, info, A_copy, B, sig, opts);
+    }
+  
+  const Mat<eT>& A = U.M;
+  
+  arma_conform_check( (A.n_rows != A.n_cols), "itsolve(): matrix A must be square sized" );
+  arma_conform_check( (A.n_rows != B.n_rows), "itsolve(): number of rows in A and B must be the same" );
+  
+  const itsolve_op_mat<eT> op(A);
+  
+  itsolve_precond<eT> M;
+  
+  if(opts.precond == itsolve_opts::PREC_NONE)
+    {
+    M.n = A.n_rows;
+    }
+  else
+    {
+    M.init(SpMat<eT>(A), opts.precond);
+    }
+  
+  return itsolve_worker::solve(out, info, op, M, B, sig, opts);
+  }
+
+
+
+//! matrix-free operator, called as A(y, x) to evaluate y = A*x
+template<typename TA, typename eT>
+inline
+typename enable_if2< ((is_arma_type<TA>::value == false) && (is_arma_sparse_type<TA>::value == false)), bool >::result
+itsolve_dispatch(Mat<eT>& out, itsolve_info& info, const TA& A_op, const Mat<eT>& B, const char sig, const itsolve_opts& opts)
+  {
+  arma_debug_sigprint();
+  
+  if(opts.precond != itsolve_opts::PREC_NONE)
+    {
+    arma_warn(1, "itsolve(): preconditioners are not applicable to matrix-free operators; ignoring preconditioner");
+    }
+  
+  const itsolve_op_functor<eT,TA> op(A_op, B.n_rows);
+  
+  itsolve_precond<eT> M;
+  
+  M.n = B.n_rows;
+  
+  return itsolve_worker::solve(out, info, op, M, B, sig, opts);
+  }
+
+
+
+template<typename TA, typename T2>
+inline
+bool
+itsolve_helper
+  (
+         Mat<typename T2::elem_type>&     out,
+         itsolve_info&                    info,
+  const  TA&                              A,
+  const Base<typename T2::elem_type, T2>& B_expr,
+  const char*                             method,
+  const itsolve_opts&                     opts
+  )
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T2::elem_type eT;
+  
+  const char sig = (method != nullptr) ? method[0] : char(0);
+  
+  arma_conform_check( ((sig != 'c') && (sig != 'm') && (sig != 'g') && (sig != 'b')), "itsolve(): unknown method" );
+  arma_conform_check( (opts.restart == 0), "itsolve(): restart must be greater than zero" );
+  
+  const quasi_unwrap<T2> UB(B_expr.get_ref());
+  
+  if(UB.is_alias(out))
+    {
+    const Mat<eT> B_copy(UB.M);
+    
+    return itsolve_dispatch(out, info, A, B_copy, sig, opts);
+    }
+  
+  return itsolve_dispatch(out, info, A, UB.M, sig, opts);
+  }
+
+
+
+//! solve A*X = B via a Krylov subspace method;
+//! A is a sparse matrix, a dense matrix, or a function object called as A(y, x) to evaluate y = A*x;
+//! method is one of: "cg", "minres", "gmres", "bicgstab";
+//! returns false if the solution did not converge to the required tolerance, in which case X holds the last iterate
+template<typename TA, typename T2>
+inline
+bool
+itsolve
+  (
+         Mat<typename T2::elem_type>&     out,
+         itsolve_info&                    info,
+  const  TA&                              A,
+  const Base<typename T2::elem_type, T2>& B,
+  const char*                             method = "gmres",
+  const itsolve_opts&                     opts   = itsolve_opts(),
+  const typename arma_blas_real_or_cx_only<typename T2::elem_type>::result* junk = nullptr
+  )
+  {
+  arma_debug_sigprint();
+  arma_ignore(junk);
+  
+  const bool status = itsolve_helper(out, info, A, B, method, opts);
+  
+  if(status == false)
+    {
+    arma_warn(3, "itsolve(): solution did not converge; relative residual: ", info.rel_resid);
+    }
+  
+  return status;
+  }
+
+
+
+template<typename TA, typename T2>
+inline
+bool
+itsolve
+  (
+         Mat<typename T2::elem_type>&     out,
+  const  TA&                              A,
+  const Base<typename T2::elem_type, T2>& B,
+  const char*                             method = "gmres",
+  const itsolve_opts&                     opts   = itsolve_opts(),
+  const typename arma_blas_real_or_cx_only<typename T2::elem_type>::result* junk = nullptr
+  )
+  {
+  arma_debug_sigprint();
+  arma_ignore(junk);
+  
+  itsolve_info info;
+  
+  return itsolve(out, info, A, B, method, opts);
+  }
+
+
+
+template<typename TA, typename T2>
+arma_warn_unused
+inline
+Mat<typename T2::elem_type>
+itsolve
+  (
+  const  TA&                              A,
+  const Base<typename T2::elem_type, T2>& B,
+  const char*                             method = "gmres",
+  const itsolve_opts&                     opts   = itsolve_opts(),
+  const typename arma_blas_real_or_cx_only<typename T2::elem_type>::result* junk = nullptr
+  )
+  {
+  arma_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename T2::elem_type eT;
+  
+  Mat<eT> out;
+  
+  itsolve_info info;
+  
+  const bool status = itsolve_helper(out, info, A, B, method, opts);
+  
+  if(status == false)
+    {
+    out.soft_reset();
+    arma_stop_runtime_error("itsolve(): solution did not converge");
+    }
+  
+  return out;
+  }
+
+
+
+//! @}
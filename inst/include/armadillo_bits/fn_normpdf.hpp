@@ -21,6 +21,45 @@
 
 
 
+//! elements i_start to i_end-1 of normpdf()
+template<typename eT, typename ea_type1, typename ea_type2, typename ea_type3>
+inline
+void
+normpdf_range(eT* out_mem, const ea_type1& X_ea, const ea_type2& M_ea, const ea_type3& S_ea, const uword i_start, const uword i_end)
+  {
+  if(eop_simd::can_process<eop_exp, eT>(i_end - i_start))
+    {
+    // the arguments of exp() are stored in out, and then processed by the SIMD kernel for exp()
+    
+    for(uword i=i_start; i<i_end; ++i)
+      {
+      const eT tmp = (X_ea[i] - M_ea[i]) / S_ea[i];
+      
+      out_mem[i] = eT(-0.5) * (tmp*tmp);
+      }
+    
+    eop_simd::process<eop_exp>(&(out_mem[i_start]), &(out_mem[i_start]), (i_end - i_start));
+    
+    for(uword i=i_start; i<i_end; ++i)
+      {
+      out_mem[i] /= (S_ea[i] * Datum<eT>::sqrt2pi);
+      }
+    }
+  else
+    {
+    for(uword i=i_start; i<i_end; ++i)
+      {
+      const eT sigma = S_ea[i];
+      
+      const eT tmp = (X_ea[i] - M_ea[i]) / sigma;
+      
+      out_mem[i] = std::exp(eT(-0.5) * (tmp*tmp)) / (sigma * Datum<eT>::sqrt2pi);
+      }
+    }
+  }
+
+
+
 template<typename T1, typename T2, typename T3>
 inline
 typename enable_if2< (is_real<typename T1::elem_type>::value), void >::result
@@ -63,29 +102,22 @@ normpdf_helper(Mat<typename T1::elem_type>& out, const Base<typename T1::elem_ty
     {
     #if defined(ARMA_USE_OPENMP)
       {
-      const int n_threads = mp_thread_limit::get();
+      // each thread processes a contiguous chunk, so that the SIMD kernel for exp() can also be used within each chunk
+      
+      const int   n_threads = mp_thread_limit::get();
+      const uword n_chunks  = eop_simd::mp_n_chunks(N, n_threads);
+      
       #pragma omp parallel for schedule(static) num_threads(n_threads)
-      for(uword i=0; i<N; ++i)
+      for(uword c=0; c < n_chunks; ++c)
         {
-        const eT sigma = S_ea[i];
-        
-        const eT tmp = (X_ea[i] - M_ea[i]) / sigma;
-        
-        out_mem[i] = std::exp(eT(-0.5) * (tmp*tmp)) / (sigma * Datum<eT>::sqrt2pi);
+        normpdf_range(out_mem, X_ea, M_ea, S_ea, mp_chunk::start(c, N, n_chunks), mp_chunk::start(c+1, N, n_chunks));
         }
       }
     #endif
     }
   else
     {
-    for(uword i=0; i<N; ++i)
-      {
-      const eT sigma = S_ea[i];
-      
-      const eT tmp = (X_ea[i] - M_ea[i]) / sigma;
-      
-      out_mem[i] = std::exp(eT(-0.5) * (tmp*tmp)) / (sigma * Datum<eT>::sqrt2pi);
-      }
+    normpdf_range(out_mem, X_ea, M_ea, S_ea, uword(0), N);
     }
   }
 
@@ -159,6 +159,82 @@ princomp
 
 
 
+//! \brief
+//! principal component analysis of the k leading components, via randomised SVD -- 3 arguments version
+//! coeff_out    -> principal component coefficients
+//! score_out    -> projected samples
+//! latent_out   -> eigenvalues of principal vectors
+template<typename T1>
+inline
+bool
+princomp
+  (
+         Mat<typename T1::elem_type>&    coeff_out,
+         Mat<typename T1::elem_type>&    score_out,
+         Col<typename T1::pod_type>&     latent_out,
+  const Base<typename T1::elem_type,T1>& X,
+  const uword                            k,
+  const svd_rand_opts&                   opts = svd_rand_opts(),
+  const typename arma_blas_real_or_cx_only<typename T1::elem_type>::result* junk = nullptr
+  )
+  {
+  arma_debug_sigprint();
+  arma_ignore(junk);
+  
+  const bool status = op_princomp::direct_princomp_rand(coeff_out, score_out, latent_out, X, k, opts);
+  
+  if(status == false)
+    {
+    coeff_out.soft_reset();
+    score_out.soft_reset();
+    latent_out.soft_reset();
+    
+    arma_warn(3, "princomp(): decomposition failed");
+    }
+  
+  return status;
+  }
+
+
+
+//! \brief
+//! principal component analysis of the k leading components of sparse matrix X, via randomised SVD -- 3 arguments version
+//! coeff_out    -> principal component coefficients
+//! score_out    -> projected samples
+//! latent_out   -> eigenvalues of principal vectors
+template<typename T1>
+inline
+bool
+princomp
+  (
+           Mat<typename T1::elem_type>&    coeff_out,
+           Mat<typename T1::elem_type>&    score_out,
+           Col<typename T1::pod_type>&     latent_out,
+  const SpBase<typename T1::elem_type,T1>& X,
+  const uword                              k,
+  const svd_rand_opts&                     opts = svd_rand_opts(),
+  const typename arma_blas_real_or_cx_only<typename T1::elem_type>::result* junk = nullptr
+  )
+  {
+  arma_debug_sigprint();
+  arma_ignore(junk);
+  
+  const bool status = op_princomp::direct_princomp_rand(coeff_out, score_out, latent_out, X, k, opts);
+  
+  if(status == false)
+    {
+    coeff_out.soft_reset();
+    score_out.soft_reset();
+    latent_out.soft_reset();
+    
+    arma_warn(3, "princomp(): decomposition failed");
+    }
+  
+  return status;
+  }
+
+
+
 template<typename T1>
 arma_warn_unused
 inline
@@ -142,4 +142,116 @@ qr
 
 
 
+//! update the QR decomposition of X in place to that of X with column x inserted before column col, in O(m*n) operations;
+//! if Q is not square, the economical form is kept
+template<typename T1>
+inline
+bool
+qr_insert_col
+  (
+         Mat<typename T1::elem_type>&    Q,
+         Mat<typename T1::elem_type>&    R,
+  const uword                            col,
+  const Base<typename T1::elem_type,T1>& x,
+  const typename arma_blas_real_or_cx_only<typename T1::elem_type>::result* junk = nullptr
+  )
+  {
+  arma_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename T1::elem_type eT;
+  
+  arma_conform_check( (&Q == &R), "qr_insert_col(): Q and R are the same object" );
+  
+  const quasi_unwrap<T1> U(x.get_ref());
+  
+  const Col<eT> xx(U.M.memptr(), U.M.n_elem);
+  
+  arma_conform_check( (Q.n_cols != R.n_rows),  "qr_insert_col(): size mismatch between Q and R"   );
+  arma_conform_check( (col > R.n_cols),        "qr_insert_col(): index out of bounds"             );
+  arma_conform_check( (xx.n_elem != Q.n_rows), "qr_insert_col(): given vector has incorrect size" );
+  
+  if(xx.internal_has_nonfinite())
+    {
+    arma_warn(3, "qr_insert_col(): detected non-finite elements");
+    return false;
+    }
+  
+  auxlib::qr_insert_col(Q, R, col, xx, (Q.n_cols < Q.n_rows));
+  
+  return true;
+  }
+
+
+
+//! update the QR decomposition of X in place to that of X with column col removed, in O(m*n) operations;
+//! if Q is not square, the economical form is kept
+template<typename eT>
+inline
+bool
+qr_delete_col
+  (
+         Mat<eT>& Q,
+         Mat<eT>& R,
+  const uword     col,
+  const typename arma_blas_real_or_cx_only<eT>::result* junk = nullptr
+  )
+  {
+  arma_debug_sigprint();
+  arma_ignore(junk);
+  
+  arma_conform_check( (&Q == &R), "qr_delete_col(): Q and R are the same object" );
+  
+  arma_conform_check( (Q.n_cols != R.n_rows), "qr_delete_col(): size mismatch between Q and R" );
+  arma_conform_check( (col >= R.n_cols),      "qr_delete_col(): index out of bounds"           );
+  
+  auxlib::qr_delete_col(Q, R, col, (Q.n_cols < Q.n_rows));
+  
+  return true;
+  }
+
+
+
+//! update the QR decomposition of X in place to that of X with row x inserted before row 'row', in O(m*n) operations;
+//! if Q is not square, the economical form is kept
+template<typename T1>
+inline
+bool
+qr_insert_row
+  (
+         Mat<typename T1::elem_type>&    Q,
+         Mat<typename T1::elem_type>&    R,
+  const uword                            row,
+  const Base<typename T1::elem_type,T1>& x,
+  const typename arma_blas_real_or_cx_only<typename T1::elem_type>::result* junk = nullptr
+  )
+  {
+  arma_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename T1::elem_type eT;
+  
+  arma_conform_check( (&Q == &R), "qr_insert_row(): Q and R are the same object" );
+  
+  const quasi_unwrap<T1> U(x.get_ref());
+  
+  const Col<eT> xx(U.M.memptr(), U.M.n_elem);
+  
+  arma_conform_check( (Q.n_cols != R.n_rows),  "qr_insert_row(): size mismatch between Q and R"   );
+  arma_conform_check( (row > Q.n_rows),        "qr_insert_row(): index out of bounds"             );
+  arma_conform_check( (xx.n_elem != R.n_cols), "qr_insert_row(): given vector has incorrect size" );
+  
+  if(xx.internal_has_nonfinite())
+    {
+    arma_warn(3, "qr_insert_row(): detected non-finite elements");
+    return false;
+    }
+  
+  auxlib::qr_insert_row(Q, R, row, xx, (Q.n_cols < Q.n_rows));
+  
+  return true;
+  }
+
+
+
 //! @}
@@ -111,6 +111,82 @@ solve
 
 
 
+template<typename T1, typename T2>
+inline
+typename enable_if2< is_blas_type<typename T1::elem_type>::value, bool >::result
+solve
+  (
+         Mat<typename T1::elem_type>&    out,
+  const Base<typename T1::elem_type,T1>& A,
+  const Base<typename T1::elem_type,T2>& B,
+  const solve_opts::opts&                opts,
+         solve_info&                     info
+  )
+  {
+  arma_debug_sigprint();
+  
+  const bool status = glue_solve_gen_full::apply(out, A.get_ref(), B.get_ref(), opts.flags, info);
+  
+  if(status == false)
+    {
+    out.soft_reset();
+    arma_warn(3, "solve(): solution not found");
+    }
+  
+  return status;
+  }
+
+
+
+//! non-const A: with option 'destroy_A', the memory of A can be used by the solver, in which case A is left empty
+template<typename eT, typename T2>
+inline
+typename enable_if2< is_blas_type<eT>::value, bool >::result
+solve
+  (
+         Mat<eT>&                out,
+         Mat<eT>&                A,
+  const Base<eT,T2>&             B,
+  const solve_opts::opts&        opts
+  )
+  {
+  arma_debug_sigprint();
+  
+  solve_info info;
+  
+  return solve(out, A, B, opts, info);
+  }
+
+
+
+template<typename eT, typename T2>
+inline
+typename enable_if2< is_blas_type<eT>::value, bool >::result
+solve
+  (
+         Mat<eT>&                out,
+         Mat<eT>&                A,
+  const Base<eT,T2>&             B,
+  const solve_opts::opts&        opts,
+         solve_info&             info
+  )
+  {
+  arma_debug_sigprint();
+  
+  const bool status = glue_solve_gen_full::apply(out, A, B.get_ref(), opts.flags, info, &A);
+  
+  if(status == false)
+    {
+    out.soft_reset();
+    arma_warn(3, "solve(): solution not found");
+    }
+  
+  return status;
+  }
+
+
+
+
 //
 // solve_tri
 
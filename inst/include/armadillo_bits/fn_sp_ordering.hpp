@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 The RcppArmadillo Authors
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup fn_sp_ordering
+//! @{
+
+
+
+//! fill-reducing symmetric permutation of square sparse matrix X, via approximate minimum degree ordering of X+X';
+//! X(p,p) tends to have sparser Cholesky and LU factors than X
+template<typename T1>
+arma_warn_unused
+inline
+uvec
+amd(const SpBase<typename T1::elem_type,T1>& X)
+  {
+  arma_debug_sigprint();
+  
+  const unwrap_spmat<T1> U(X.get_ref());
+  
+  arma_conform_check( (U.M.n_rows != U.M.n_cols), "amd(): given matrix must be square sized" );
+  
+  podarray<uword> perm;
+  
+  sp_ordering::amd(perm, U.M);
+  
+  return uvec(perm.memptr(), perm.n_elem);
+  }
+
+
+
+//! fill-reducing column permutation of sparse matrix X, via approximate minimum degree ordering of X'*X;
+//! X.cols(q) tends to have sparser LU and QR factors than X
+template<typename T1>
+arma_warn_unused
+inline
+uvec
+colamd(const SpBase<typename T1::elem_type,T1>& X)
+  {
+  arma_debug_sigprint();
+  
+  const unwrap_spmat<T1> U(X.get_ref());
+  
+  podarray<uword> perm;
+  
+  sp_ordering::colamd(perm, U.M);
+  
+  return uvec(perm.memptr(), perm.n_elem);
+  }
+
+
+
+//! bandwidth-reducing symmetric permutation of square sparse matrix X, via reverse Cuthill-McKee ordering of X+X';
+//! the nonzero elements of X(p,p) tend to be closer to the diagonal
+template<typename T1>
+arma_warn_unused
+inline
+uvec
+symrcm(const SpBase<typename T1::elem_type,T1>& X)
+  {
+  arma_debug_sigprint();
+  
+  const unwrap_spmat<T1> U(X.get_ref());
+  
+  arma_conform_check( (U.M.n_rows != U.M.n_cols), "symrcm(): given matrix must be square sized" );
+  
+  podarray<uword> perm;
+  
+  sp_ordering::rcm(perm, U.M);
+  
+  return uvec(perm.memptr(), perm.n_elem);
+  }
+
+
+
+//! symmetric permutation of square sparse matrix X: out = X(p,p) = P*X*P', where P(i,p(i)) = 1
+template<typename T1, typename T2>
+arma_warn_unused
+inline
+SpMat<typename T1::elem_type>
+symperm(const SpBase<typename T1::elem_type,T1>& X, const Base<uword,T2>& P)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const unwrap_spmat<T1> UX(X.get_ref());
+  const quasi_unwrap<T2> UP(P.get_ref());
+  
+  const SpMat<eT>&   A = UX.M;
+  const Mat<uword>& PP = UP.M;
+  
+  const uword n = A.n_rows;
+  
+  arma_conform_check( (A.n_rows != A.n_cols),                               "symperm(): given matrix must be square sized"               );
+  arma_conform_check( ((PP.is_vec() == false) && (PP.is_empty() == false)), "symperm(): given object must be a vector"                   );
+  arma_conform_check( (PP.n_elem != n),                                     "symperm(): size of given vector must match size of matrix" );
+  
+  const uword* p = PP.memptr();
+  
+  podarray<uword> mark(n);  mark.zeros();
+  
+  for(uword k=0; k < n; ++k)
+    {
+    const uword i = p[k];
+    
+    arma_conform_check( ((i >= n) || (mark[i] != 0)), "symperm(): given vector is not a permutation" );
+    
+    mark[i] = 1;
+    }
+  
+  SpMat<eT> out;
+  
+  sp_ordering::permute_sym(out, A, p);
+  
+  return out;
+  }
+
+
+
+//! @}
@@ -59,13 +59,34 @@ spsolve_helper
   
   if(sig == 's')  // SuperLU solver
     {
-    if( (opts.equilibrate == false) && (opts.refine == superlu_opts::REF_NONE) )
-      {
-      status = sp_auxlib::spsolve_simple(out, A.get_ref(), B.get_ref(), opts);
-      }
-    else
+    const unwrap_spmat<T1> UA(A.get_ref());
+    const SpMat<eT>& AA  = UA.M;
+    
+    // if enabled via superlu_opts::try_chol, symmetric/hermitian positive definite matrices are first attempted via sparse Cholesky;
+    // the LU based solvers are used if the matrix does not appear to be positive definite, or turns out not to be
+    
+    status = sp_auxlib::spsolve_chol(out, rcond, AA, B.get_ref(), opts);
+    
+    if(status == false)
       {
-      status = sp_auxlib::spsolve_refine(out, rcond, A.get_ref(), B.get_ref(), opts);
+      #if defined(ARMA_USE_SUPERLU)
+        {
+        if( (opts.equilibrate == false) && (opts.refine == superlu_opts::REF_NONE) )
+          {
+          status = sp_auxlib::spsolve_simple(out, AA, B.get_ref(), opts);
+          }
+        else
+          {
+          status = sp_auxlib::spsolve_refine(out, rcond, AA, B.get_ref(), opts);
+          }
+        }
+      #else
+        {
+        arma_debug_print("spsolve(): SuperLU not enabled; using built-in sparse LU solver");
+        
+        status = sp_auxlib::spsolve_builtin(out, rcond, AA, B.get_ref(), opts);
+        }
+      #endif
       }
     }
   else
@@ -99,9 +120,10 @@ spsolve_helper
       
       uword flags = solve_opts::flag_none;
       
-      if(opts.refine      != superlu_opts::REF_NONE)  { flags |= solve_opts::flag_refine;      }
-      if(opts.equilibrate == true                  )  { flags |= solve_opts::flag_equilibrate; }
-      if(opts.allow_ugly  == true                  )  { flags |= solve_opts::flag_allow_ugly;  }
+      if(opts.refine       != superlu_opts::REF_NONE)  { flags |= solve_opts::flag_refine;       }
+      if(opts.equilibrate  == true                  )  { flags |= solve_opts::flag_equilibrate;  }
+      if(opts.allow_ugly   == true                  )  { flags |= solve_opts::flag_allow_ugly;   }
+      if(opts.likely_sympd == true                  )  { flags |= solve_opts::flag_likely_sympd; }
       
       status = glue_solve_gen_full::apply(out, AA, B.get_ref(), flags);
       }
@@ -243,4 +243,209 @@ svd_econ
 
 
 
+//! internal helper function: subset of singular values and vectors via eigendecomposition of the Gram matrix.
+//! For tall X the Gram matrix is X'*X (formed by syrk/herk), otherwise X*X'.
+//! Accuracy contract: forming the Gram matrix squares the condition number,
+//! so the computed singular value s_i has an absolute error of roughly eps * s_max^2 / s_i,
+//! in contrast to roughly eps * s_max for the "std" method.
+//! Singular values below sqrt(eps) * s_max have no correct digits, and the corresponding singular vectors are unreliable.
+//! Suitable for the leading singular values and vectors of well-conditioned, very tall or very wide matrices,
+//! where it needs only one pass over X to form the Gram matrix plus one pass to recover the other set of singular vectors.
+template<typename eT>
+inline
+bool
+svd_gram_helper
+  (
+        Mat<eT>&                                U,
+        Col<typename get_pod_type<eT>::result>& S,
+        Mat<eT>&                                V,
+  const Mat<eT>&                                A,
+  const svd_range&                              range,
+  const bool                                    calc_UV
+  )
+  {
+  arma_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const uword p = (std::min)(A.n_rows, A.n_cols);
+  
+  if(range.type == svd_range::RANGE_INDEX)
+    {
+    arma_conform_check( ((range.first > range.last) || (uword(range.last) >= p)), "svd(): index range is out of bounds" );
+    }
+  
+  if(range.type == svd_range::RANGE_VALUE)
+    {
+    arma_conform_check( ((range.lo < double(0)) || (range.lo >= range.hi)), "svd(): value range must satisfy 0 <= lo < hi" );
+    }
+  
+  if(p == 0)
+    {
+    S.reset();
+    
+    if(calc_UV)  { U.set_size(A.n_rows, 0); V.set_size(A.n_cols, 0); }
+    
+    return true;
+    }
+  
+  if(A.internal_has_nonfinite())  { return false; }
+  
+  const bool tall = (A.n_rows >= A.n_cols);
+  
+  const Mat<eT> G = (tall) ? Mat<eT>(A.t() * A) : Mat<eT>(A * A.t());
+  
+  // eigenvalues of G are in ascending order, while singular values are in descending order
+  
+  eig_range er;
+  
+  if(range.type == svd_range::RANGE_INDEX)
+    {
+    er = eig_range::by_index( (unsigned int)(p - 1 - uword(range.last)), (unsigned int)(p - 1 - uword(range.first)) );
+    }
+  
+  if(range.type == svd_range::RANGE_VALUE)
+    {
+    // eigenvalues of G that are zero in exact arithmetic may be computed as tiny negative values
+    
+    er = eig_range::by_value( ((range.lo > double(0)) ? (range.lo * range.lo) : -(range.hi * range.hi)), (range.hi * range.hi) );
+    }
+  
+  Col<T>  lambda;
+  Mat<eT> W;
+  
+  if(auxlib::eig_sym_range(lambda, W, G, er, calc_UV) == false)  { return false; }
+  
+  if(range.type == svd_range::RANGE_VALUE)
+    {
+    // the value range excludes zero, so drop the eigenvalues that are zero to working precision;
+    // as the eigenvalues are in ascending order, these are at the start
+    
+    const T lambda_tol = T(p) * std::numeric_limits<T>::epsilon() * norm(G, "inf");
+    
+    uword n_zero = 0;
+    
+    while( (n_zero < lambda.n_elem) && (lambda[n_zero] <= lambda_tol) )  { ++n_zero; }
+    
+    if(n_zero > 0)
+      {
+      lambda = lambda.tail(lambda.n_elem - n_zero);
+      
+      if(calc_UV)  { W = W.tail_cols(W.n_cols - n_zero); }
+      }
+    }
+  
+  const uword k = lambda.n_elem;
+  
+  S.set_size(k);
+  
+  for(uword i=0; i < k; ++i)  { S[i] = std::sqrt( (std::max)( lambda[k-1-i], T(0) ) ); }
+  
+  if(calc_UV == false)  { return true; }
+  
+  Mat<eT>& W_out = (tall) ? V : U;
+  Mat<eT>& Z_out = (tall) ? U : V;
+  
+  W_out = fliplr(W);
+  Z_out = (tall) ? Mat<eT>(A * W_out) : Mat<eT>(A.t() * W_out);
+  
+  for(uword i=0; i < k; ++i)
+    {
+    if(S[i] > T(0))  { Z_out.col(i) /= S[i]; }
+    }
+  
+  return true;
+  }
+
+
+
+//! subset of singular values of X, selected by index or value range;
+//! the "std" method uses ?gesvdx, while the faster but less accurate "gram" method uses the eigendecomposition of the Gram matrix
+//! (see svd_gram_helper() for the accuracy contract)
+template<typename T1>
+inline
+bool
+svd
+  (
+         Col<typename T1::pod_type>&     S,
+  const Base<typename T1::elem_type,T1>& X,
+  const svd_range&                       range,
+  const char*                            method = "std",
+  const typename arma_blas_real_or_cx_only<typename T1::elem_type>::result* junk = nullptr
+  )
+  {
+  arma_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename T1::elem_type eT;
+  
+  const char sig = (method != nullptr) ? method[0] : char(0);
+  
+  arma_conform_check( ((sig != 's') && (sig != 'g')), "svd(): unknown method specified" );
+  
+  Mat<eT> A(X.get_ref());
+  Mat<eT> U;
+  Mat<eT> V;
+  
+  const bool status = (sig == 'g') ? svd_gram_helper(U, S, V, A, range, false) : auxlib::svd_subset(U, S, V, A, range, false);
+  
+  if(status == false)
+    {
+    S.soft_reset();
+    arma_warn(3, "svd(): decomposition failed");
+    }
+  
+  return status;
+  }
+
+
+
+//! subset of singular values and corresponding singular vectors of X, selected by index or value range;
+//! only the selected singular vectors are computed
+template<typename T1>
+inline
+bool
+svd_econ
+  (
+         Mat<typename T1::elem_type>&    U,
+         Col<typename T1::pod_type >&    S,
+         Mat<typename T1::elem_type>&    V,
+  const Base<typename T1::elem_type,T1>& X,
+  const svd_range&                       range,
+  const char*                            method = "std",
+  const typename arma_blas_real_or_cx_only<typename T1::elem_type>::result* junk = nullptr
+  )
+  {
+  arma_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename T1::elem_type eT;
+  
+  arma_conform_check
+    (
+    ( (void_ptr(&U) == void_ptr(&S)) || (&U == &V) || (void_ptr(&S) == void_ptr(&V)) ),
+    "svd_econ(): two or more output objects are the same object"
+    );
+  
+  const char sig = (method != nullptr) ? method[0] : char(0);
+  
+  arma_conform_check( ((sig != 's') && (sig != 'g')), "svd_econ(): unknown method specified" );
+  
+  Mat<eT> A(X.get_ref());
+  
+  const bool status = (sig == 'g') ? svd_gram_helper(U, S, V, A, range, true) : auxlib::svd_subset(U, S, V, A, range, true);
+  
+  if(status == false)
+    {
+    U.soft_reset();
+    S.soft_reset();
+    V.soft_reset();
+    arma_warn(3, "svd_econ(): decomposition failed");
+    }
+  
+  return status;
+  }
+
+
+
 //! @}
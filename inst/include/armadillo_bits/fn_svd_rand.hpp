@@ -0,0 +1,259 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 The RcppArmadillo Authors
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup fn_svd_rand
+//! @{
+
+
+
+template<typename eT, typename op_type>
+inline
+bool
+svd_rand_helper
+  (
+         Mat<eT>&                                  U,
+         Col<typename get_pod_type<eT>::result>&   S,
+         Mat<eT>&                                  V,
+  const  op_type&                                  op,
+  const  uword                                     k,
+  const  svd_rand_opts&                            opts,
+  const  bool                                      calc_UV
+  )
+  {
+  arma_debug_sigprint();
+  
+  const bool status = svd_rand_worker::apply(U, S, V, op, Row<eT>(), k, opts, calc_UV);
+  
+  if(status == false)
+    {
+    U.soft_reset();
+    S.soft_reset();
+    V.soft_reset();
+    
+    return false;
+    }
+  
+  if(S.n_elem < k)  { arma_warn(1, "svd_rand(): found fewer singular values than specified"); }
+  
+  return true;
+  }
+
+
+
+//! approximate k largest singular values and corresponding singular vectors of dense matrix X, via randomised range finding
+template<typename T1>
+inline
+bool
+svd_rand
+  (
+         Mat<typename T1::elem_type>&    U,
+         Col<typename T1::pod_type >&    S,
+         Mat<typename T1::elem_type>&    V,
+  const Base<typename T1::elem_type,T1>& X,
+  const uword                            k,
+  const svd_rand_opts&                   opts = svd_rand_opts(),
+  const typename arma_blas_real_or_cx_only<typename T1::elem_type>::result* junk = nullptr
+  )
+  {
+  arma_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename T1::elem_type eT;
+  
+  arma_conform_check
+    (
+    ( ((void*)(&U) == (void*)(&S)) || (&U == &V) || ((void*)(&S) == (void*)(&V)) ),
+    "svd_rand(): two or more output objects are the same object"
+    );
+  
+  const quasi_unwrap<T1> UX(X.get_ref());
+  
+  if(UX.is_alias(U) || UX.is_alias(V))
+    {
+    const Mat<eT> X_copy(UX.M);
+    
+    return svd_rand(U, S, V, X_copy, k, opts);
+    }
+  
+  const Mat<eT>& A = UX.M;
+  
+  if(A.internal_has_nonfinite())
+    {
+    U.soft_reset();
+    S.soft_reset();
+    V.soft_reset();
+    
+    arma_warn(3, "svd_rand(): detected non-finite elements");
+    
+    return false;
+    }
+  
+  const svd_rand_op_mat<eT> op(A);
+  
+  const bool status = svd_rand_helper(U, S, V, op, k, opts, true);
+  
+  if(status == false)  { arma_warn(3, "svd_rand(): decomposition failed"); }
+  
+  return status;
+  }
+
+
+
+//! approximate k largest singular values of dense matrix X, via randomised range finding
+template<typename T1>
+inline
+bool
+svd_rand
+  (
+         Col<typename T1::pod_type >&    S,
+  const Base<typename T1::elem_type,T1>& X,
+  const uword                            k,
+  const svd_rand_opts&                   opts = svd_rand_opts(),
+  const typename arma_blas_real_or_cx_only<typename T1::elem_type>::result* junk = nullptr
+  )
+  {
+  arma_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename T1::elem_type eT;
+  
+  const quasi_unwrap<T1> UX(X.get_ref());
+  
+  const Mat<eT>& A = UX.M;
+  
+  if(A.internal_has_nonfinite())
+    {
+    S.soft_reset();
+    
+    arma_warn(3, "svd_rand(): detected non-finite elements");
+    
+    return false;
+    }
+  
+  Mat<eT> U;
+  Mat<eT> V;
+  
+  const svd_rand_op_mat<eT> op(A);
+  
+  const bool status = svd_rand_helper(U, S, V, op, k, opts, false);
+  
+  if(status == false)  { arma_warn(3, "svd_rand(): decomposition failed"); }
+  
+  return status;
+  }
+
+
+
+//! approximate k largest singular values and corresponding singular vectors of sparse matrix X, via randomised range finding
+template<typename T1>
+inline
+bool
+svd_rand
+  (
+           Mat<typename T1::elem_type>&    U,
+           Col<typename T1::pod_type >&    S,
+           Mat<typename T1::elem_type>&    V,
+  const SpBase<typename T1::elem_type,T1>& X,
+  const uword                              k,
+  const svd_rand_opts&                     opts = svd_rand_opts(),
+  const typename arma_blas_real_or_cx_only<typename T1::elem_type>::result* junk = nullptr
+  )
+  {
+  arma_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename T1::elem_type eT;
+  
+  arma_conform_check
+    (
+    ( ((void*)(&U) == (void*)(&S)) || (&U == &V) || ((void*)(&S) == (void*)(&V)) ),
+    "svd_rand(): two or more output objects are the same object"
+    );
+  
+  const unwrap_spmat<T1> UX(X.get_ref());
+  
+  const SpMat<eT>& A = UX.M;
+  
+  if(arrayops::is_finite(A.values, A.n_nonzero) == false)
+    {
+    U.soft_reset();
+    S.soft_reset();
+    V.soft_reset();
+    
+    arma_warn(3, "svd_rand(): detected non-finite elements");
+    
+    return false;
+    }
+  
+  const svd_rand_op_spmat<eT> op(A);
+  
+  const bool status = svd_rand_helper(U, S, V, op, k, opts, true);
+  
+  if(status == false)  { arma_warn(3, "svd_rand(): decomposition failed"); }
+  
+  return status;
+  }
+
+
+
+//! approximate k largest singular values of sparse matrix X, via randomised range finding
+template<typename T1>
+inline
+bool
+svd_rand
+  (
+           Col<typename T1::pod_type >&    S,
+  const SpBase<typename T1::elem_type,T1>& X,
+  const uword                              k,
+  const svd_rand_opts&                     opts = svd_rand_opts(),
+  const typename arma_blas_real_or_cx_only<typename T1::elem_type>::result* junk = nullptr
+  )
+  {
+  arma_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename T1::elem_type eT;
+  
+  const unwrap_spmat<T1> UX(X.get_ref());
+  
+  const SpMat<eT>& A = UX.M;
+  
+  if(arrayops::is_finite(A.values, A.n_nonzero) == false)
+    {
+    S.soft_reset();
+    
+    arma_warn(3, "svd_rand(): detected non-finite elements");
+    
+    return false;
+    }
+  
+  Mat<eT> U;
+  Mat<eT> V;
+  
+  const svd_rand_op_spmat<eT> op(A);
+  
+  const bool status = svd_rand_helper(U, S, V, op, k, opts, false);
+  
+  if(status == false)  { arma_warn(3, "svd_rand(): decomposition failed"); }
+  
+  return status;
+  }
+
+
+
+//! @}
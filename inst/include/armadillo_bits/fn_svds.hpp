@@ -264,6 +264,99 @@ svds_helper
 
 
 
+//! k largest singular values of a real linear operator object, via the augmented operator [0 A; A' 0]
+template<typename eT, typename OpType>
+inline
+bool
+svds_op_helper
+  (
+           Mat<eT>&  U,
+           Col<eT>&  S,
+           Mat<eT>&  V,
+  const    OpType&   op,
+  const    uword     k,
+  const    eT        tol,
+  const    bool      calc_UV
+  )
+  {
+  arma_debug_sigprint();
+  
+  arma_conform_check
+    (
+    ( ((void*)(&U) == (void*)(&S)) || (&U == &V) || ((void*)(&S) == (void*)(&V)) ),
+    "svds(): two or more output objects are the same object"
+    );
+  
+  arma_conform_check( ((tol >= eT(0)) == false), "svds(): tol must be >= 0" );
+  
+  #if defined(ARMA_USE_NEWARP)
+    {
+    const uword m = op.n_rows;
+    const uword n = op.n_cols;
+    
+    const uword kk = (std::min)( (std::min)(m, n), k );
+    
+    if(kk == 0)
+      {
+      S.reset();
+      
+      if(calc_UV)  { U.set_size(m, 0);  V.set_size(n, 0); }
+      
+      return true;
+      }
+    
+    const newarp::SVDAugmentedOp<eT,OpType> aug_op(op);
+    
+    Col<eT> eigval;
+    Mat<eT> eigvec;
+    
+    eigs_opts opts;
+    opts.tol = (tol / Datum<eT>::sqrt2);
+    
+    const bool status = sp_auxlib::eigs_sym_op(eigval, eigvec, aug_op, kk, sp_auxlib::form_la, opts);
+    
+    if(status == false)
+      {
+      U.soft_reset();
+      S.soft_reset();
+      V.soft_reset();
+      
+      return false;
+      }
+    
+    const uvec sorted_indices = sort_index(eigval, "descend");
+    
+    S = eigval.elem(sorted_indices);
+    
+    if(calc_UV)
+      {
+      const Mat<eT> W = eigvec.cols(sorted_indices);
+      
+      U = Datum<eT>::sqrt2 * W.rows(0, m-1  );
+      V = Datum<eT>::sqrt2 * W.rows(m, m+n-1);
+      }
+    
+    if(S.n_elem < k)  { arma_warn(1, "svds(): found fewer singular values than specified"); }
+    
+    return true;
+    }
+  #else
+    {
+    arma_ignore(op);
+    arma_ignore(k);
+    arma_ignore(calc_UV);
+    
+    arma_stop_logic_error("svds(): use of NEWARP must be enabled for operator objects");
+    
+    return false;
+    }
+  #endif
+  }
+
+
+
+
+
 //! find the k largest singular values and corresponding singular vectors of sparse matrix X
 template<typename T1>
 inline
@@ -349,4 +442,57 @@ svds
 
 
 
+//! find the k largest singular values and corresponding singular vectors of a real linear operator object;
+//! the object provides the members n_rows and n_cols, as well as
+//! perform_op(eT* x_in, eT* y_out) to evaluate y_out = A*x_in, and perform_op_trans(eT* x_in, eT* y_out) to evaluate y_out = A'*x_in
+template<typename eT, typename OpType>
+inline
+typename enable_if2< (is_blas_real<eT>::value && (is_arma_type<OpType>::value == false) && (is_arma_sparse_type<OpType>::value == false)), bool >::result
+svds
+  (
+           Mat<eT>&  U,
+           Col<eT>&  S,
+           Mat<eT>&  V,
+  const    OpType&   op,
+  const    uword     k,
+  const    eT        tol = eT(0)
+  )
+  {
+  arma_debug_sigprint();
+  
+  const bool status = svds_op_helper(U, S, V, op, k, tol, true);
+  
+  if(status == false)  { arma_warn(3, "svds(): decomposition failed"); }
+  
+  return status;
+  }
+
+
+
+//! find the k largest singular values of a real linear operator object
+template<typename eT, typename OpType>
+inline
+typename enable_if2< (is_blas_real<eT>::value && (is_arma_type<OpType>::value == false) && (is_arma_sparse_type<OpType>::value == false)), bool >::result
+svds
+  (
+           Col<eT>&  S,
+  const    OpType&   op,
+  const    uword     k,
+  const    eT        tol = eT(0)
+  )
+  {
+  arma_debug_sigprint();
+  
+  Mat<eT> U;
+  Mat<eT> V;
+  
+  const bool status = svds_op_helper(U, S, V, op, k, tol, false);
+  
+  if(status == false)  { arma_warn(3, "svds(): decomposition failed"); }
+  
+  return status;
+  }
+
+
+
 //! @}
@@ -80,10 +80,26 @@ glue_solve_gen_full::apply(Mat<typename T1::elem_type>& out, const Glue<T1,T2,gl
 template<typename eT, typename T1, typename T2, const bool has_user_flags>
 inline
 bool
-glue_solve_gen_full::apply(Mat<eT>& actual_out, const Base<eT,T1>& A_expr, const Base<eT,T2>& B_expr, const uword flags)
+glue_solve_gen_full::apply(Mat<eT>& out, const Base<eT,T1>& A_expr, const Base<eT,T2>& B_expr, const uword flags)
   {
   arma_debug_sigprint();
   
+  solve_info info;
+  
+  return glue_solve_gen_full::apply<eT,T1,T2,has_user_flags>(out, A_expr, B_expr, flags, info);
+  }
+
+
+
+template<typename eT, typename T1, typename T2, const bool has_user_flags>
+inline
+bool
+glue_solve_gen_full::apply(Mat<eT>& actual_out, const Base<eT,T1>& A_expr, const Base<eT,T2>& B_expr, const uword flags, solve_info& info, Mat<eT>* A_destroy)
+  {
+  arma_debug_sigprint();
+  
+  info = solve_info();
+  
   typedef typename get_pod_type<eT>::result T;
   
   if(has_user_flags == true )  { arma_debug_print("glue_solve_gen_full::apply(): has_user_flags = true" ); }
@@ -100,6 +116,8 @@ glue_solve_gen_full::apply(Mat<eT>& actual_out, const Base<eT,T1>& A_expr, const
   const bool no_trimat    = has_user_flags && bool(flags & solve_opts::flag_no_trimat   );
   const bool force_approx = has_user_flags && bool(flags & solve_opts::flag_force_approx);
   const bool force_sym    = has_user_flags && bool(flags & solve_opts::flag_force_sym   );
+  const bool destroy_A    = has_user_flags && bool(flags & solve_opts::flag_destroy_A   );
+  const bool mixed_prec   = has_user_flags && bool(flags & solve_opts::flag_mixed_precision);
   
   if(has_user_flags)
     {
@@ -116,13 +134,26 @@ glue_solve_gen_full::apply(Mat<eT>& actual_out, const Base<eT,T1>& A_expr, const
     if(no_trimat   )  { arma_debug_print("no_trimat");    }
     if(force_approx)  { arma_debug_print("force_approx"); }
     if(force_sym   )  { arma_debug_print("force_sym");    }
+    if(destroy_A   )  { arma_debug_print("destroy_A");    }
+    if(mixed_prec  )  { arma_debug_print("mixed_precision"); }
     
     arma_conform_check( (fast      && equilibrate ), "solve(): options 'fast' and 'equilibrate' are mutually exclusive"      );
     arma_conform_check( (fast      && refine      ), "solve(): options 'fast' and 'refine' are mutually exclusive"           );
     arma_conform_check( (no_sympd  && likely_sympd), "solve(): options 'no_sympd' and 'likely_sympd' are mutually exclusive" );
+    arma_conform_check( (mixed_prec && refine     ), "solve(): options 'mixed_precision' and 'refine' are mutually exclusive"      );
+    arma_conform_check( (mixed_prec && equilibrate), "solve(): options 'mixed_precision' and 'equilibrate' are mutually exclusive" );
     }
   
-  Mat<eT> A = A_expr.get_ref();
+  if(destroy_A && (refine || equilibrate))  { arma_warn(2, "solve(): option 'destroy_A' ignored as option 'refine' or 'equilibrate' is enabled"); }
+  
+  // with option 'destroy_A', A takes over the memory of the non-const matrix given as A_destroy, which is then overwritten by LAPACK;
+  // the original matrix can no longer be recreated for the fallback solvers
+  
+  Mat<eT> A;
+  
+  const bool A_is_stolen = glue_solve_gen_full::acquire_A(A, A_expr.get_ref(), B_expr, ((destroy_A && (refine == false) && (equilibrate == false)) ? A_destroy : nullptr));
+  
+  if(A_is_stolen)  { arma_debug_print("glue_solve_gen_full::apply(): using memory of given matrix"); }
   
   if(force_approx)
     {
@@ -135,6 +166,7 @@ glue_solve_gen_full::apply(Mat<eT>& actual_out, const Base<eT,T1>& A_expr, const
     if(refine)        { arma_warn(2, "solve(): option 'refine' ignored for forced approximate solution"       ); }
     if(likely_sympd)  { arma_warn(2, "solve(): option 'likely_sympd' ignored for forced approximate solution" ); }
     if(force_sym)     { arma_warn(2, "solve(): option 'force_sym' ignored for forced approximate solution"    ); }
+    if(mixed_prec)    { arma_warn(2, "solve(): option 'mixed_precision' ignored for forced approximate solution" ); }
     
     return auxlib::solve_approx_svd(actual_out, A, B_expr.get_ref());  // A is overwritten
     }
@@ -150,8 +182,20 @@ glue_solve_gen_full::apply(Mat<eT>& actual_out, const Base<eT,T1>& A_expr, const
     if(likely_sympd)  { arma_warn(2, "solve(): option 'likely_sympd' ignored for forced symmetric solver"                                       ); }
     if(equilibrate)   { arma_warn(2, "solve(): option 'force_sym' ignored as option 'equilibrate' is enabled (combination not implemented yet)" ); }
     if(refine)        { arma_warn(2, "solve(): option 'force_sym' ignored as option 'refine' is enabled (combination not implemented yet)"      ); }
+    if(mixed_prec)    { arma_warn(2, "solve(): option 'mixed_precision' ignored for forced symmetric solver"                                    ); }
     }
   
+  // mixed precision is only worthwhile when single precision is faster than the element type,
+  // ie. for double and cx_double
+  
+  #if defined(ARMA_USE_MIXED_SOLVE)
+    const bool use_mixed = mixed_prec && (force_sym == false) && is_same_type<T,double>::yes;
+    
+    if(mixed_prec && is_same_type<T,float>::yes)  { arma_warn(2, "solve(): option 'mixed_precision' ignored for single precision matrices"); }
+  #else
+    if(mixed_prec)  { arma_warn(2, "solve(): option 'mixed_precision' ignored as ARMA_USE_MIXED_SOLVE is not enabled"); }
+  #endif
+  
   // A_expr and B_expr can be used more than once (sympd optimisation fails or approximate solution required),
   // so ensure they are not overwritten in case we have aliasing
   
@@ -169,6 +213,55 @@ glue_solve_gen_full::apply(Mat<eT>& actual_out, const Base<eT,T1>& A_expr, const
     {
     arma_debug_print("glue_solve_gen_full::apply(): detected square system");
     
+    bool is_fixed = false;
+    
+    if( (is_cx<eT>::no) && (is_Mat<T1>::value) && (A.n_rows <= batch_linalg::small_n) && (refine == false) && (equilibrate == false) && (likely_sympd == false) && (force_sym == false) && (A_is_stolen == false) )
+      {
+      const unwrap<T1> U(A_expr.get_ref());
+      
+      is_fixed = (U.M.mem_state == 3);
+      }
+    
+    if(is_fixed)
+      {
+      arma_debug_print("glue_solve_gen_full::apply(): fixed size optimisation");
+      
+      const bool calc_rcond = (fast == false) && (allow_ugly == false);
+      
+      const bool fixed_status = glue_solve_gen_full::apply_fixed(out, rcond, A, B_expr, calc_rcond);
+      
+      if( fixed_status && ((calc_rcond == false) || (rcond >= std::numeric_limits<T>::epsilon())) )
+        {
+        if(is_alias)  { actual_out.steal_mem(out); }
+        
+        return true;
+        }
+      
+      // the system is exactly singular or badly conditioned; the general solvers would reach the same conclusion,
+      // so the approximate solution is attempted directly, keeping the rcond computed above for the warning
+      
+      arma_debug_print("glue_solve_gen_full::apply(): fixed size optimisation: solving rank deficient system");
+      
+      if(fixed_status == false)  { rcond = T(0); }
+      
+      if(no_approx)  { return false; }
+      
+      if(rcond == T(0))
+        {
+        arma_warn(2, "solve(): system is singular; attempting approx solution");
+        }
+      else
+        {
+        arma_warn(2, "solve(): system is singular; rcond: ", rcond, "; attempting approx solution");
+        }
+      
+      status = auxlib::solve_approx_svd(out, A, B_expr.get_ref());  // A is overwritten
+      
+      if(is_alias)  { actual_out.steal_mem(out); }
+      
+      return status;
+      }
+    
     uword KL = 0;
     uword KU = 0;
     
@@ -178,7 +271,14 @@ glue_solve_gen_full::apply(Mat<eT>& actual_out, const Base<eT,T1>& A_expr, const
     const bool is_tril = (no_trimat || refine || equilibrate || likely_sympd || force_sym || is_band || is_triu) ? false : trimat_helper::is_tril(A);
     
     const bool is_sym    = arma_config::optimise_sym && ( (refine || equilibrate || likely_sympd || force_sym || is_band || is_triu || is_tril) ? false : is_sym_expr<T1>::eval(A_expr.get_ref()) );
-    const bool try_sympd = arma_config::optimise_sym && ( (          no_sympd    || is_sym       || force_sym || is_band || is_triu || is_tril) ? false : (likely_sympd ? true : sym_helper::guess_sympd(A, uword(16))) );
+    const bool try_sympd = arma_config::optimise_sym && ( (          no_sympd    || is_sym       || force_sym || is_band || is_triu || is_tril) ? false : (likely_sympd ? true : sym_helper::guess_sympd(A, uword(16))) ) && ( (A_is_stolen) ? A.is_hermitian() : true );
+    
+    // the Cholesky solvers only overwrite the lower triangle and the diagonal;
+    // if A was taken over, it is recreated from its upper triangle for the retry, which requires A to be exactly symmetric/hermitian
+    
+    Col<eT> A_diag;
+    
+    if(A_is_stolen && try_sympd)  { A_diag = A.diag(); }
     
     arma_debug_print("glue_solve_gen_full::apply(): internal flags:");
     arma_debug_print("is_band:   ", is_band  );
@@ -187,6 +287,34 @@ glue_solve_gen_full::apply(Mat<eT>& actual_out, const Base<eT,T1>& A_expr, const
     arma_debug_print("is_sym:    ", is_sym   );
     arma_debug_print("try_sympd: ", try_sympd);
     
+    #if defined(ARMA_USE_MIXED_SOLVE)
+      {
+      if(use_mixed && (is_band == false) && (is_triu == false) && (is_tril == false))
+        {
+        // factorise in single precision and refine the solution in double precision;
+        // if the refinement does not converge (eg. badly conditioned system), the full precision solvers below are used
+        
+        arma_debug_print("glue_solve_gen_full::apply(): mixed precision");
+        
+        uword n_iter = 0;
+        
+        const bool mixed_status = auxlib::solve_square_mixed(out, n_iter, A, B_expr.get_ref(), try_sympd);
+        
+        if(mixed_status)
+          {
+          info.n_iter          = (unsigned int)(n_iter);
+          info.mixed_precision = true;
+          
+          if(is_alias)  { actual_out.steal_mem(out); }
+          
+          return true;
+          }
+        
+        arma_debug_print("glue_solve_gen_full::apply(): mixed precision refinement failed; using full precision");
+        }
+      }
+    #endif
+    
     if(fast)
       {
       // fast mode: solvers without refinement and without rcond estimate
@@ -238,7 +366,7 @@ glue_solve_gen_full::apply(Mat<eT>& actual_out, const Base<eT,T1>& A_expr, const
           
           arma_debug_print("glue_solve_gen_full::apply(): auxlib::solve_sympd_fast() failed; retrying");
           
-          A = A_expr.get_ref();
+          if(A_is_stolen)  { A.diag() = A_diag; A = symmatu(A); }  else  { A = A_expr.get_ref(); }
           
           status = auxlib::solve_square_fast(out, A, B_expr.get_ref());  // A is overwritten
           }
@@ -333,7 +461,7 @@ glue_solve_gen_full::apply(Mat<eT>& actual_out, const Base<eT,T1>& A_expr, const
           {
           arma_debug_print("glue_solve_gen_full::apply(): auxlib::solve_sympd_rcond() failed; retrying");
           
-          A = A_expr.get_ref();
+          if(A_is_stolen)  { A.diag() = A_diag; A = symmatu(A); }  else  { A = A_expr.get_ref(); }
           
           status = auxlib::solve_square_rcond(out, rcond, A, B_expr.get_ref());  // A is overwritten
           }
@@ -352,6 +480,7 @@ glue_solve_gen_full::apply(Mat<eT>& actual_out, const Base<eT,T1>& A_expr, const
     if(refine)        { arma_warn(2,  "solve(): option 'refine' ignored for non-square matrix"       ); }
     if(likely_sympd)  { arma_warn(2,  "solve(): option 'likely_sympd' ignored for non-square matrix" ); }
     if(force_sym)     { arma_warn(2,  "solve(): option 'force_sym' ignored for non-square matrix"    ); }
+    if(mixed_prec)    { arma_warn(2,  "solve(): option 'mixed_precision' ignored for non-square matrix" ); }
     
     if(fast)
       {
@@ -370,7 +499,13 @@ glue_solve_gen_full::apply(Mat<eT>& actual_out, const Base<eT,T1>& A_expr, const
     }
   
   
-  if( (status == false) && (no_approx == false) )
+  if( (status == false) && (no_approx == false) && A_is_stolen )
+    {
+    arma_warn(2, "solve(): system is singular; approximate solution not attempted as option 'destroy_A' is enabled");
+    }
+  
+  
+  if( (status == false) && (no_approx == false) && (A_is_stolen == false) )
     {
     arma_debug_print("glue_solve_gen_full::apply(): solving rank deficient system");
     
@@ -397,6 +532,111 @@ glue_solve_gen_full::apply(Mat<eT>& actual_out, const Base<eT,T1>& A_expr, const
 
 
 
+//! A_destroy is either nullptr or the given matrix, in which case A takes over its memory,
+//! provided it does not use preallocated memory and is not used by B_expr;
+//! returns true if the given matrix has been left empty
+template<typename eT, typename T1, typename T2>
+inline
+bool
+glue_solve_gen_full::acquire_A(Mat<eT>& A, const T1& A_src, const Base<eT,T2>& B_expr, Mat<eT>* A_destroy)
+  {
+  arma_debug_sigprint();
+  
+  if( (A_destroy == nullptr) || (A_destroy->mem_state > 1) || B_expr.get_ref().is_alias(*A_destroy) )
+    {
+    A = A_src;
+    
+    return false;
+    }
+  
+  const eT* A_destroy_mem = A_destroy->memptr();
+  
+  A.steal_mem(*A_destroy);  // copies instead of stealing for matrices that use preallocated memory
+  
+  return ( (A.n_elem > 0) && (A.memptr() == A_destroy_mem) );
+  }
+
+
+
+//! solve a square system where A is a fixed size matrix with up to 16 rows, via LU decomposition with partial pivoting;
+//! returns false if A is exactly singular
+template<typename eT, typename T2>
+inline
+bool
+glue_solve_gen_full::apply_fixed(Mat<eT>& out, typename get_pod_type<eT>::result& out_rcond, const Mat<eT>& A, const Base<eT,T2>& B_expr, const bool calc_rcond)
+  {
+  arma_debug_sigprint();
+  
+  out = B_expr.get_ref();
+  
+  arma_conform_check( (A.n_rows != out.n_rows), "solve(): number of rows in given matrices must be the same", [&](){ out.soft_reset(); } );
+  
+  const uword N = A.n_rows;
+  
+  if(N <=  4)  { return glue_solve_gen_full::apply_fixed_pad<eT, 4>(out, out_rcond, A, calc_rcond); }
+  if(N <=  8)  { return glue_solve_gen_full::apply_fixed_pad<eT, 8>(out, out_rcond, A, calc_rcond); }
+  if(N <= 12)  { return glue_solve_gen_full::apply_fixed_pad<eT,12>(out, out_rcond, A, calc_rcond); }
+  
+  return glue_solve_gen_full::apply_fixed_pad<eT,16>(out, out_rcond, A, calc_rcond);
+  }
+
+
+
+//! out is overwritten with the solution;
+//! A is padded to N_pad x N_pad in the same way as in op_inv_gen_full::apply_fixed_pad()
+template<typename eT, const uword N_pad>
+inline
+bool
+glue_solve_gen_full::apply_fixed_pad(Mat<eT>& out, typename get_pod_type<eT>::result& out_rcond, const Mat<eT>& A, const bool calc_rcond)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const uword N = A.n_rows;
+  
+  eT    LU[N_pad*N_pad];
+  uword piv[N_pad];
+  
+  for(uword i=0; i < N_pad*N_pad; ++i)  { LU[i] = eT(0); }
+  
+  for(uword c=0; c < N;     ++c)  { arrayops::copy(&(LU[c*N_pad]), A.colptr(c), N); }
+  for(uword i=N; i < N_pad; ++i)  { LU[i + i*N_pad] = eT(1); }
+  
+  if(batch_linalg::lu_small<eT,N_pad>(LU, piv, N_pad) == false)  { return false; }
+  
+  if(calc_rcond)
+    {
+    // reciprocal condition number in the 1-norm, estimated by gecon() from the leading N x N block of the decomposition,
+    // as done by auxlib::solve_square_rcond(); the padding does not change this block
+    
+    eT LU_N[N_pad*N_pad];
+    
+    for(uword c=0; c < N; ++c)  { arrayops::copy(&(LU_N[c*N]), &(LU[c*N_pad]), N); }
+    
+    const Mat<eT> LU_N_mat(LU_N, N, N, false, true);
+    
+    out_rcond = auxlib::lu_rcond<T>(LU_N_mat, auxlib::norm1_gen(A));
+    }
+  
+  eT x[N_pad];
+  
+  for(uword c=0; c < out.n_cols; ++c)
+    {
+    eT* out_col = out.colptr(c);
+    
+    for(uword i=0; i < N_pad; ++i)  { x[i] = (i < N) ? out_col[i] : eT(0); }
+    
+    batch_linalg::lu_solve_small<eT,N_pad>(LU, piv, x, N_pad, 1);
+    
+    arrayops::copy(out_col, x, N);
+    }
+  
+  return true;
+  }
+
+
+
 //
 // glue_solve_tri_default
 
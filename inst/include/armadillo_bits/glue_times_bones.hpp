@@ -131,6 +131,18 @@ struct glue_times
   template<typename T1, typename T2>
   arma_hot inline static void apply_inplace_plus(Mat<typename T1::elem_type>& out, const Glue<T1, T2, glue_times>& X, const sword sign);
   
+  template<bool check_alias, typename T1, typename T2>
+  arma_hot inline static void apply_trimat(Mat<typename T1::elem_type>& out, const Glue<T1,T2,glue_times>& X);
+  
+  template<bool check_alias, typename T1, typename T2>
+  arma_hot inline static bool apply_symmat(Mat<typename T1::elem_type>& out, const Glue<T1,T2,glue_times>& X);
+  
+  template<bool check_alias, bool is_left, typename T1, typename T2>
+  arma_hot inline static void apply_trmm(Mat<typename T1::elem_type>& out, const T1& X_tri, const T2& X_other);
+  
+  template<bool check_alias, bool is_left, typename T1, typename T2>
+  arma_hot inline static bool apply_symm(Mat<typename T1::elem_type>& out, const T1& X_sym, const T2& X_other);
+  
   //
   
   template<typename eT, const bool do_trans_A, const bool do_trans_B, typename TA, typename TB>
@@ -160,6 +172,12 @@ struct glue_times_diag
   
   template<typename T1, typename T2>
   arma_hot inline static void apply(Mat<typename T1::elem_type>& out, const Glue<T1, T2, glue_times_diag>& X);
+  
+  template<typename T1, typename T2>
+  inline static bool apply_scaling(Mat<typename T1::elem_type>& out, const Glue<T1, T2, glue_times_diag>& X);
+  
+  template<typename T1, typename T2, typename T3>
+  inline static bool apply_scaling(Mat<typename T1::elem_type>& out, const Glue< Glue<T1, T2, glue_times_diag>, T3, glue_times_diag>& X);
   };
 
 
@@ -216,6 +216,30 @@ glue_times_redirect2_helper<true, check_alias>::apply(Mat<typename T1::elem_type
     return;
     }
   
+  #if defined(ARMA_USE_BLAS)
+    {
+    if(strip_trimat<T1>::do_trimat || strip_trimat<T2>::do_trimat)
+      {
+      arma_debug_print("glue_times_redirect<2>::apply(): detected trimatu(A)*B or B*trimatu(A)");
+      
+      glue_times::apply_trimat<check_alias>(out, X);
+      
+      return;
+      }
+    
+    if(strip_symmat<T1>::do_symmat || strip_symmat<T2>::do_symmat)
+      {
+      arma_debug_print("glue_times_redirect<2>::apply(): detected symmatu(A)*B or B*symmatu(A)");
+      
+      if(glue_times::apply_symmat<check_alias>(out, X))  { return; }
+      
+      arma_debug_print("glue_times_redirect<2>::apply(): symmat optimisation not applicable");
+      
+      // fallthrough if optimisation not applicable
+      }
+    }
+  #endif
+  
   glue_times_redirect2_helper<false, check_alias>::apply(out, X);
   }
 
@@ -562,6 +586,19 @@ glue_times::apply(Mat<typename T1::elem_type>& out, const Glue<T1,T2,glue_times>
   
   arma_debug_print(arma_str::format("glue_times::apply(): N_mat: %u") % N_mat);
   
+  typedef mul_chain_length< Glue<T1,T2,glue_times> > chain;
+  
+  constexpr uword N_chain = chain::num;
+  
+  if( (N_chain >= 4) && (chain::has_fixed == false) )
+    {
+    arma_debug_print(arma_str::format("glue_times::apply(): chain ordering for %u operands") % N_chain);
+    
+    mul_chain::apply<true>(out, X);
+    
+    return;
+    }
+  
   glue_times_redirect<N_mat, true>::apply(out, X);
   }
 
@@ -578,6 +615,19 @@ glue_times::apply(Mat_noalias<typename T1::elem_type>& out, const Glue<T1,T2,glu
   
   arma_debug_print(arma_str::format("glue_times::apply(): N_mat: %u") % N_mat);
   
+  typedef mul_chain_length< Glue<T1,T2,glue_times> > chain;
+  
+  constexpr uword N_chain = chain::num;
+  
+  if( (N_chain >= 4) && (chain::has_fixed == false) )
+    {
+    arma_debug_print(arma_str::format("glue_times::apply(): chain ordering for %u operands") % N_chain);
+    
+    mul_chain::apply<false>(out, X);
+    
+    return;
+    }
+  
   glue_times_redirect<N_mat, false>::apply(out, X);
   }
 
@@ -710,6 +760,237 @@ glue_times::apply_inplace_plus(Mat<typename T1::elem_type>& out, const Glue<T1,
 
 
 
+template<bool check_alias, typename T1, typename T2>
+inline
+void
+glue_times::apply_trimat(Mat<typename T1::elem_type>& out, const Glue<T1,T2,glue_times>& X)
+  {
+  arma_debug_sigprint();
+  
+  if(strip_trimat<T1>::do_trimat)
+    {
+    glue_times::apply_trmm<check_alias, true >(out, X.A, X.B);
+    }
+  else
+    {
+    glue_times::apply_trmm<check_alias, false>(out, X.B, X.A);
+    }
+  }
+
+
+
+template<bool check_alias, typename T1, typename T2>
+inline
+bool
+glue_times::apply_symmat(Mat<typename T1::elem_type>& out, const Glue<T1,T2,glue_times>& X)
+  {
+  arma_debug_sigprint();
+  
+  if(strip_symmat<T1>::do_symmat)
+    {
+    return glue_times::apply_symm<check_alias, true >(out, X.A, X.B);
+    }
+  else
+    {
+    return glue_times::apply_symm<check_alias, false>(out, X.B, X.A);
+    }
+  }
+
+
+
+//! trimatu(A)*B or B*trimatu(A), evaluated in-place via trmm() without generating the triangular matrix;
+//! is_left indicates whether the triangular matrix is on the left hand side of the product
+template<bool check_alias, bool is_left, typename T1, typename T2>
+inline
+void
+glue_times::apply_trmm(Mat<typename T1::elem_type>& actual_out, const T1& X_tri, const T2& X_other)
+  {
+  arma_debug_sigprint();
+  
+  #if defined(ARMA_USE_BLAS)
+    {
+    typedef typename T1::elem_type eT;
+    
+    typedef typename strip_trimat<T1>::stored_type T1_stripped;
+    
+    const strip_trimat<T1> S(X_tri);
+    
+    const partial_unwrap<T1_stripped> UA(S.M);
+    const partial_unwrap<T2>          UB(X_other);
+    
+    const typename partial_unwrap<T1_stripped>::stored_type& A = UA.M;
+    const typename partial_unwrap<T2         >::stored_type& B = UB.M;
+    
+    constexpr bool do_trans_A = partial_unwrap<T1_stripped>::do_trans;
+    constexpr bool do_trans_B = partial_unwrap<T2         >::do_trans;
+    
+    constexpr bool use_alpha = partial_unwrap<T1_stripped>::do_times || partial_unwrap<T2>::do_times;
+    const     eT       alpha = use_alpha ? (UA.get_val() * UB.get_val()) : eT(1);
+    
+    arma_conform_check( (A.is_square() == false), "trimatu()/trimatl(): given matrix must be square sized" );
+    
+    if(is_left)  { arma_conform_assert_mul_size(A, B, do_trans_A, do_trans_B, "matrix multiplication"); }
+    else         { arma_conform_assert_mul_size(B, A, do_trans_B, do_trans_A, "matrix multiplication"); }
+    
+    const bool is_alias = (check_alias) && (UA.is_alias(actual_out) || UB.is_alias(actual_out));
+    
+    if(is_alias)  { arma_debug_print("glue_times::apply_trmm(): aliasing detected"); }
+    
+    Mat<eT>  tmp;
+    Mat<eT>& out = (is_alias) ? tmp : actual_out;
+    
+    // the other operand is copied into the output, which trmm() then overwrites with the product
+    
+    if(do_trans_B)  { op_htrans::apply_mat_noalias(out, B); }
+    else            { out = B;                              }
+    
+    if(out.n_elem > 0)
+      {
+      arma_conform_assert_blas_size(A, out);
+      
+      // the triangle of trimatu(A.t()) is the transposed lower triangle of A
+      
+      const char side   = (is_left) ? 'L' : 'R';
+      const char uplo   = (S.do_triu != do_trans_A) ? 'U' : 'L';
+      const char transA = (do_trans_A) ? ( is_cx<eT>::yes ? 'C' : 'T' ) : 'N';
+      const char diag   = 'N';
+      
+      const blas_int m   = blas_int(out.n_rows);
+      const blas_int n   = blas_int(out.n_cols);
+      const blas_int lda = blas_int(A.n_rows);
+      
+      arma_debug_print( arma_str::format("blas::trmm(): side: %c  uplo: %c  transA: %c") % side % uplo % transA );
+      
+      blas::trmm<eT>(&side, &uplo, &transA, &diag, &m, &n, &alpha, A.memptr(), &lda, out.memptr(), &m);
+      }
+    
+    if(is_alias)  { actual_out.steal_mem(tmp); }
+    }
+  #else
+    {
+    arma_ignore(actual_out);
+    arma_ignore(X_tri);
+    arma_ignore(X_other);
+    arma_stop_logic_error("matrix multiplication: use of BLAS must be enabled");
+    }
+  #endif
+  }
+
+
+
+//! symmatu(A)*B or B*symmatu(A), evaluated via symm() or hemm() using only one triangle of A;
+//! returns false if the product can't be expressed in this form, in which case out is not modified
+template<bool check_alias, bool is_left, typename T1, typename T2>
+inline
+bool
+glue_times::apply_symm(Mat<typename T1::elem_type>& actual_out, const T1& X_sym, const T2& X_other)
+  {
+  arma_debug_sigprint();
+  
+  #if defined(ARMA_USE_BLAS)
+    {
+    typedef typename T1::elem_type eT;
+    typedef typename get_pod_type<eT>::result T;
+    
+    typedef typename strip_symmat<T1>::stored_type T1_stripped;
+    
+    const strip_symmat<T1> S(X_sym);
+    
+    constexpr bool do_trans_A = partial_unwrap<T1_stripped>::do_trans;
+    constexpr bool do_trans_B = partial_unwrap<T2         >::do_trans;
+    
+    // for complex matrices, symmatu(A.t(),false) can't be expressed via the triangles of A
+    
+    if( (is_cx<eT>::yes) && (do_trans_A) && (S.do_conj == false) )  { return false; }
+    
+    const partial_unwrap<T1_stripped> UA(S.M);
+    const partial_unwrap<T2>          UB(X_other);
+    
+    const typename partial_unwrap<T1_stripped>::stored_type& A = UA.M;
+    const typename partial_unwrap<T2         >::stored_type& B = UB.M;
+    
+    constexpr bool use_alpha = partial_unwrap<T1_stripped>::do_times || partial_unwrap<T2>::do_times;
+    const     eT       alpha = use_alpha ? (UA.get_val() * UB.get_val()) : eT(1);
+    
+    arma_conform_check( (A.is_square() == false), ( (S.do_symmatu) ? "symmatu(): given matrix must be square sized" : "symmatl(): given matrix must be square sized" ) );
+    
+    if(is_left)  { arma_conform_assert_mul_size(A, B, do_trans_A, do_trans_B, "matrix multiplication"); }
+    else         { arma_conform_assert_mul_size(B, A, do_trans_B, do_trans_A, "matrix multiplication"); }
+    
+    const uword N = A.n_rows;
+    
+    if( (is_cx<eT>::yes) && (S.do_conj) )
+      {
+      // hemm() only uses the real part of the diagonal
+      
+      for(uword i=0; i < N; ++i)  { if(access::tmp_imag(A.at(i,i)) != T(0))  { return false; } }
+      }
+    
+    const Mat<eT>& B_ref = B;
+    
+    Mat<eT> BB;
+    
+    if(do_trans_B)  { op_htrans::apply_mat_noalias(BB, B_ref); }
+    
+    const Mat<eT>& BBB = (do_trans_B) ? BB : B_ref;
+    
+    const bool is_alias = (check_alias) && (UA.is_alias(actual_out) || UB.is_alias(actual_out));
+    
+    if(is_alias)  { arma_debug_print("glue_times::apply_symm(): aliasing detected"); }
+    
+    Mat<eT>  tmp;
+    Mat<eT>& out = (is_alias) ? tmp : actual_out;
+    
+    if(is_left)  { out.set_size(N, BBB.n_cols); }
+    else         { out.set_size(BBB.n_rows, N); }
+    
+    if(out.n_elem > 0)
+      {
+      arma_conform_assert_blas_size(A, out);
+      
+      // symmatu(A.t()) is equivalent to symmatl(A)
+      
+      const char side = (is_left) ? 'L' : 'R';
+      const char uplo = (S.do_symmatu != do_trans_A) ? 'U' : 'L';
+      
+      const blas_int m   = blas_int(out.n_rows);
+      const blas_int n   = blas_int(out.n_cols);
+      const blas_int lda = blas_int(N);
+      const blas_int ldb = blas_int(BBB.n_rows);
+      
+      const eT beta = eT(0);
+      
+      if( (is_cx<eT>::yes) && (S.do_conj) )
+        {
+        arma_debug_print( arma_str::format("blas::hemm(): side: %c  uplo: %c") % side % uplo );
+        
+        blas::hemm<eT>(&side, &uplo, &m, &n, &alpha, A.memptr(), &lda, BBB.memptr(), &ldb, &beta, out.memptr(), &m);
+        }
+      else
+        {
+        arma_debug_print( arma_str::format("blas::symm(): side: %c  uplo: %c") % side % uplo );
+        
+        blas::symm<eT>(&side, &uplo, &m, &n, &alpha, A.memptr(), &lda, BBB.memptr(), &ldb, &beta, out.memptr(), &m);
+        }
+      }
+    
+    if(is_alias)  { actual_out.steal_mem(tmp); }
+    
+    return true;
+    }
+  #else
+    {
+    arma_ignore(actual_out);
+    arma_ignore(X_sym);
+    arma_ignore(X_other);
+    
+    return false;
+    }
+  #endif
+  }
+
+
+
 template<typename eT, const bool do_trans_A, const bool do_trans_B, typename TA, typename TB>
 arma_inline
 uword
@@ -754,6 +1035,17 @@ glue_times::apply
   
   if( (A.n_elem == 0) || (B.n_elem == 0) )  { out.zeros(); return; }
   
+  typedef gemm_fixed_dims<do_trans_A, do_trans_B, TA, TB> fixed_dims;
+  
+  if( (fixed_dims::use) && (is_cx<eT>::no) )
+    {
+    arma_debug_print("glue_times::apply(): fixed size optimisation");
+    
+    gemm_fixed<fixed_dims::N, fixed_dims::K, fixed_dims::M, do_trans_A, do_trans_B, use_alpha>::apply(out.memptr(), A.memptr(), B.memptr(), alpha);
+    
+    return;
+    }
+  
   if( (do_trans_A == false) && (do_trans_B == false) && (use_alpha == false) )
     {
          if( ((A.n_rows == 1) || (TA::is_row)) && (is_cx<eT>::no) )  { gemv<true,         false, false>::apply(out.memptr(), B, A.memptr()); }
@@ -931,6 +1223,21 @@ glue_times_diag::apply(Mat<typename T1::elem_type>& actual_out, const Glue<T1, T
   
   typedef typename T1::elem_type eT;
   
+  typedef mul_chain_length< Glue<T1, T2, glue_times_diag> > chain;
+  
+  constexpr uword N_chain = chain::num;
+  
+  if( (N_chain >= 4) && (chain::has_fixed == false) )
+    {
+    arma_debug_print(arma_str::format("glue_times_diag::apply(): chain ordering for %u operands") % N_chain);
+    
+    mul_chain::apply<true>(actual_out, X);
+    
+    return;
+    }
+  
+  if(glue_times_diag::apply_scaling(actual_out, X))  { return; }
+  
   const strip_diagmat<T1> S1(X.A);
   const strip_diagmat<T2> S2(X.B);
   
@@ -1046,4 +1353,72 @@ glue_times_diag::apply(Mat<typename T1::elem_type>& actual_out, const Glue<T1, T
 
 
 
+template<typename T1, typename T2>
+inline
+bool
+glue_times_diag::apply_scaling(Mat<typename T1::elem_type>& out, const Glue<T1, T2, glue_times_diag>& X)
+  {
+  arma_ignore(out);
+  arma_ignore(X);
+  
+  return false;
+  }
+
+
+
+//! diagmat(A) * B * diagmat(C), evaluated as a single scaling pass over B
+template<typename T1, typename T2, typename T3>
+inline
+bool
+glue_times_diag::apply_scaling(Mat<typename T1::elem_type>& actual_out, const Glue< Glue<T1, T2, glue_times_diag>, T3, glue_times_diag>& X)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  if( (strip_diagmat<T1>::do_diagmat == false) || (strip_diagmat<T2>::do_diagmat == true) || (strip_diagmat<T3>::do_diagmat == false) )  { return false; }
+  
+  arma_debug_print("glue_times_diag::apply(): diagmat(A) * B * diagmat(C)");
+  
+  const strip_diagmat<T1> S1(X.A.A);
+  const strip_diagmat<T3> S3(X.B);
+  
+  const diagmat_proxy<typename strip_diagmat<T1>::stored_type> A(S1.M);
+  const diagmat_proxy<typename strip_diagmat<T3>::stored_type> C(S3.M);
+  
+  const quasi_unwrap<T2> UB(X.A.B);
+  const Mat<eT>& B     = UB.M;
+  
+  arma_conform_assert_mul_size(A.n_rows, A.n_cols, B.n_rows, B.n_cols, "matrix multiplication");
+  arma_conform_assert_mul_size(A.n_rows, B.n_cols, C.n_rows, C.n_cols, "matrix multiplication");
+  
+  const bool is_alias = (A.is_alias(actual_out) || UB.is_alias(actual_out) || C.is_alias(actual_out));
+  
+  if(is_alias)  { arma_debug_print("glue_times_diag::apply(): aliasing detected"); }
+  
+  Mat<eT>  tmp;
+  Mat<eT>& out = (is_alias) ? tmp : actual_out;
+  
+  out.zeros(A.n_rows, C.n_cols);
+  
+  const uword A_length = (std::min)(A.n_rows, A.n_cols);
+  const uword C_length = (std::min)(C.n_rows, C.n_cols);
+  
+  for(uword col=0; col < C_length; ++col)
+    {
+    const eT  val = C[col];
+    
+          eT* out_coldata = out.colptr(col);
+    const eT*   B_coldata =   B.colptr(col);
+    
+    for(uword i=0; i < A_length; ++i)  { out_coldata[i] = (A[i] * B_coldata[i]) * val; }
+    }
+  
+  if(is_alias)  { actual_out.steal_mem(tmp); }
+  
+  return true;
+  }
+
+
+
 //! @}
@@ -24,10 +24,33 @@
 struct dense_sparse_helper
   {
   template<typename eT>
-  arma_inline static typename  arma_not_cx<eT>::result dot(const eT* A_mem, const SpMat<eT>& B, const uword col);
+  arma_inline static eT dot(const eT* A_mem, const SpMat<eT>& B, const uword col);
   
   template<typename eT>
-  arma_inline static typename arma_cx_only<eT>::result dot(const eT* A_mem, const SpMat<eT>& B, const uword col);
+  inline static typename arma_not_cx<eT>::result dot_range(const eT* A_mem, const SpMat<eT>& B, const uword start, const uword end);
+  
+  template<typename eT>
+  inline static typename arma_cx_only<eT>::result dot_range(const eT* A_mem, const SpMat<eT>& B, const uword start, const uword end);
+  
+  inline static void merge_path_search(uword& out_col, uword& out_pos, const uword diagonal, const uword* col_ptrs, const uword n_cols, const uword n_nonzero);
+  
+  template<typename eT>
+  inline static void dot_cols(eT* out_mem, const eT* A_mem, const SpMat<eT>& B);
+  
+  template<typename eT>
+  inline static void dot_cols_part(eT* out_mem, const eT* A_mem, const SpMat<eT>& B, const uword diag_start, const uword diag_end, uword& carry_col, eT& carry_val);
+  
+  template<typename eT>
+  inline static void dense_times_sparse(Mat<eT>& out, const Mat<eT>& A, const SpMat<eT>& B);
+  
+  template<typename eT>
+  inline static void dense_times_sparse_part(Mat<eT>& out, const Mat<eT>& A, const SpMat<eT>& B, const uword diag_start, const uword diag_end, uword& carry_col, eT* carry_mem);
+  
+  template<typename eT>
+  inline static void sparse_times_vec(eT* out_mem, const SpMat<eT>& A, const eT* B_mem);
+  
+  template<typename eT>
+  inline static void sparse_times_dense(Mat<eT>& out, const SpMat<eT>& A, const Mat<eT>& B);
   };
 
 
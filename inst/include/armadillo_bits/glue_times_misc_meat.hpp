@@ -23,28 +23,27 @@
 
 template<typename eT>
 arma_inline
-typename arma_not_cx<eT>::result
+eT
 dense_sparse_helper::dot(const eT* A_mem, const SpMat<eT>& B, const uword col)
   {
-  arma_debug_sigprint();
-  
-        uword      col_offset = B.col_ptrs[col    ];
-  const uword next_col_offset = B.col_ptrs[col + 1];
-  
-  const uword* start_ptr = &(B.row_indices[     col_offset]);
-  const uword*   end_ptr = &(B.row_indices[next_col_offset]);
-  
-  const eT* B_values = B.values;
+  return dense_sparse_helper::dot_range(A_mem, B, B.col_ptrs[col], B.col_ptrs[col + 1]);
+  }
+
+
+
+template<typename eT>
+inline
+typename arma_not_cx<eT>::result
+dense_sparse_helper::dot_range(const eT* A_mem, const SpMat<eT>& B, const uword start, const uword end)
+  {
+  const uword* B_row_indices = B.row_indices;
+  const eT*    B_values      = B.values;
   
   eT acc = eT(0);
   
-  for(const uword* ptr = start_ptr; ptr != end_ptr; ++ptr)
+  for(uword i = start; i < end; ++i)
     {
-    const uword index = (*ptr);
-    
-    acc += A_mem[index] * B_values[col_offset];
-    
-    ++col_offset;
+    acc += A_mem[ B_row_indices[i] ] * B_values[i];
     }
   
   return acc;
@@ -53,31 +52,22 @@ dense_sparse_helper::dot(const eT* A_mem, const SpMat<eT>& B, const uword col)
 
 
 template<typename eT>
-arma_inline
+inline
 typename arma_cx_only<eT>::result
-dense_sparse_helper::dot(const eT* A_mem, const SpMat<eT>& B, const uword col)
+dense_sparse_helper::dot_range(const eT* A_mem, const SpMat<eT>& B, const uword start, const uword end)
   {
-  arma_debug_sigprint();
-  
   typedef typename get_pod_type<eT>::result T;
   
-        uword      col_offset = B.col_ptrs[col    ];
-  const uword next_col_offset = B.col_ptrs[col + 1];
-  
-  const uword* start_ptr = &(B.row_indices[     col_offset]);
-  const uword*   end_ptr = &(B.row_indices[next_col_offset]);
-  
-  const eT* B_values = B.values;
+  const uword* B_row_indices = B.row_indices;
+  const eT*    B_values      = B.values;
   
   T acc_real = T(0);
   T acc_imag = T(0);
   
-  for(const uword* ptr = start_ptr; ptr != end_ptr; ++ptr)
+  for(uword i = start; i < end; ++i)
     {
-    const uword index = (*ptr);
-    
-    const std::complex<T>& X = A_mem[index];
-    const std::complex<T>& Y = B_values[col_offset];
+    const std::complex<T>& X = A_mem[ B_row_indices[i] ];
+    const std::complex<T>& Y = B_values[i];
     
     const T a = X.real();
     const T b = X.imag();
@@ -87,8 +77,6 @@ dense_sparse_helper::dot(const eT* A_mem, const SpMat<eT>& B, const uword col)
     
     acc_real += (a*c) - (b*d);
     acc_imag += (a*d) + (b*c);
-    
-    ++col_offset;
     }
   
   return std::complex<T>(acc_real, acc_imag);
@@ -96,6 +84,360 @@ dense_sparse_helper::dot(const eT* A_mem, const SpMat<eT>& B, const uword col)
 
 
 
+//! Find where the given diagonal crosses the merge path formed by
+//! the column end offsets (col_ptrs[1] ... col_ptrs[n_cols]) and the nonzero indices (0 ... n_nonzero-1).
+//! Splitting the path at equally spaced diagonals gives each thread the same amount of work
+//! (columns + nonzeros), regardless of how the nonzeros are distributed across the columns.
+//! Based on: D. Merrill, M. Garland. Merge-based Parallel Sparse Matrix-Vector Multiplication. SC'16, 2016.
+inline
+void
+dense_sparse_helper::merge_path_search(uword& out_col, uword& out_pos, const uword diagonal, const uword* col_ptrs, const uword n_cols, const uword n_nonzero)
+  {
+  uword x_min = (diagonal > n_nonzero) ? (diagonal - n_nonzero) : uword(0);
+  uword x_max = (std::min)(diagonal, n_cols);
+  
+  while(x_min < x_max)
+    {
+    const uword pivot = x_min + (x_max - x_min) / uword(2);
+    
+    if(col_ptrs[pivot + 1] <= (diagonal - pivot - 1))
+      {
+      x_min = pivot + 1;
+      }
+    else
+      {
+      x_max = pivot;
+      }
+    }
+  
+  out_col = x_min;
+  out_pos = diagonal - x_min;
+  }
+
+
+
+//! out_mem[col] = dot(A_mem, B.col(col)) for all columns of B
+template<typename eT>
+inline
+void
+dense_sparse_helper::dot_cols(eT* out_mem, const eT* A_mem, const SpMat<eT>& B)
+  {
+  arma_debug_sigprint();
+  
+  const uword B_n_cols = B.n_cols;
+  
+  if( (arma_config::openmp) && (mp_thread_limit::in_parallel() == false) && (B_n_cols >= 2) && mp_gate<eT>::eval(B.n_nonzero) )
+    {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      arma_debug_print("dense_sparse_helper::dot_cols(): merge path openmp implementation");
+      
+      const int   n_threads = mp_thread_limit::get();
+      const uword n_parts   = uword(n_threads);
+      const uword n_diags   = B_n_cols + B.n_nonzero;
+      
+      podarray<uword> carry_col(n_parts);
+      podarray<eT>    carry_val(n_parts);
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword part=0; part < n_parts; ++part)
+        {
+        const uword diag_start = (n_diags * (part    )) / n_parts;
+        const uword diag_end   = (n_diags * (part + 1)) / n_parts;
+        
+        dense_sparse_helper::dot_cols_part(out_mem, A_mem, B, diag_start, diag_end, carry_col[part], carry_val[part]);
+        }
+      
+      for(uword part=0; part < n_parts; ++part)
+        {
+        if(carry_col[part] < B_n_cols)  { out_mem[ carry_col[part] ] += carry_val[part]; }
+        }
+      }
+    #endif
+    }
+  else
+    {
+    for(uword col=0; col < B_n_cols; ++col)
+      {
+      out_mem[col] = dense_sparse_helper::dot(A_mem, B, col);
+      }
+    }
+  }
+
+
+
+//! process the part of the merge path between diag_start and diag_end;
+//! columns completed within the part are written to out_mem,
+//! while the partial sum of the column cut by diag_end is returned via carry_col and carry_val
+template<typename eT>
+inline
+void
+dense_sparse_helper::dot_cols_part(eT* out_mem, const eT* A_mem, const SpMat<eT>& B, const uword diag_start, const uword diag_end, uword& carry_col, eT& carry_val)
+  {
+  const uword* B_col_ptrs = B.col_ptrs;
+  
+  uword col_start, pos_start;
+  uword col_end,   pos_end;
+  
+  dense_sparse_helper::merge_path_search(col_start, pos_start, diag_start, B_col_ptrs, B.n_cols, B.n_nonzero);
+  dense_sparse_helper::merge_path_search(col_end,   pos_end,   diag_end,   B_col_ptrs, B.n_cols, B.n_nonzero);
+  
+  uword pos = pos_start;
+  
+  for(uword col = col_start; col < col_end; ++col)
+    {
+    const uword pos_next = B_col_ptrs[col + 1];
+    
+    out_mem[col] = dense_sparse_helper::dot_range(A_mem, B, pos, pos_next);
+    
+    pos = pos_next;
+    }
+  
+  carry_col = col_end;
+  carry_val = (pos < pos_end) ? dense_sparse_helper::dot_range(A_mem, B, pos, pos_end) : eT(0);
+  }
+
+
+
+//! out = A * B, with B traversed column-wise;
+//! all columns of out are overwritten
+template<typename eT>
+inline
+void
+dense_sparse_helper::dense_times_sparse(Mat<eT>& out, const Mat<eT>& A, const SpMat<eT>& B)
+  {
+  arma_debug_sigprint();
+  
+  const uword B_n_cols = B.n_cols;
+  
+  if( (arma_config::openmp) && (mp_thread_limit::in_parallel() == false) && (B_n_cols >= 2) && mp_gate<eT>::eval(A.n_rows * B.n_nonzero) )
+    {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      arma_debug_print("dense_sparse_helper::dense_times_sparse(): merge path openmp implementation");
+      
+      const int   n_threads = mp_thread_limit::get();
+      const uword n_parts   = uword(n_threads);
+      const uword n_diags   = B_n_cols + B.n_nonzero;
+      
+      podarray<uword> carry_col(n_parts);
+      Mat<eT>         carry_val(A.n_rows, n_parts, arma_nozeros_indicator());
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword part=0; part < n_parts; ++part)
+        {
+        const uword diag_start = (n_diags * (part    )) / n_parts;
+        const uword diag_end   = (n_diags * (part + 1)) / n_parts;
+        
+        dense_sparse_helper::dense_times_sparse_part(out, A, B, diag_start, diag_end, carry_col[part], carry_val.colptr(part));
+        }
+      
+      for(uword part=0; part < n_parts; ++part)
+        {
+        if(carry_col[part] < B_n_cols)  { arrayops::inplace_plus(out.colptr(carry_col[part]), carry_val.colptr(part), out.n_rows); }
+        }
+      }
+    #endif
+    }
+  else
+    {
+    uword carry_col = 0;
+    
+    dense_sparse_helper::dense_times_sparse_part(out, A, B, uword(0), (B_n_cols + B.n_nonzero), carry_col, out.memptr());
+    }
+  }
+
+
+
+template<typename eT>
+inline
+void
+dense_sparse_helper::dense_times_sparse_part(Mat<eT>& out, const Mat<eT>& A, const SpMat<eT>& B, const uword diag_start, const uword diag_end, uword& carry_col, eT* carry_mem)
+  {
+  const uword* B_col_ptrs    = B.col_ptrs;
+  const uword* B_row_indices = B.row_indices;
+  const eT*    B_values      = B.values;
+  
+  const uword out_n_rows = out.n_rows;
+  
+  uword col_start, pos_start;
+  uword col_end,   pos_end;
+  
+  dense_sparse_helper::merge_path_search(col_start, pos_start, diag_start, B_col_ptrs, B.n_cols, B.n_nonzero);
+  dense_sparse_helper::merge_path_search(col_end,   pos_end,   diag_end,   B_col_ptrs, B.n_cols, B.n_nonzero);
+  
+  uword pos = pos_start;
+  
+  for(uword col = col_start; col <= col_end; ++col)
+    {
+    const bool is_carry = (col == col_end);
+    
+    if(is_carry && (col_end >= B.n_cols))  { break; }
+    
+    const uword pos_next = (is_carry) ? pos_end : B_col_ptrs[col + 1];
+    
+    eT* out_col = (is_carry) ? carry_mem : out.colptr(col);
+    
+    arrayops::fill_zeros(out_col, out_n_rows);
+    
+    for(; pos < pos_next; ++pos)
+      {
+      const eT  B_val = B_values[pos];
+      const eT* A_col = A.colptr(B_row_indices[pos]);
+      
+      for(uword row = 0; row < out_n_rows; ++row)
+        {
+        out_col[row] += A_col[row] * B_val;
+        }
+      }
+    }
+  
+  carry_col = col_end;
+  }
+
+
+
+//! out_mem = A * B_mem, where out_mem has A.n_rows elements
+template<typename eT>
+inline
+void
+dense_sparse_helper::sparse_times_vec(eT* out_mem, const SpMat<eT>& A, const eT* B_mem)
+  {
+  arma_debug_sigprint();
+  
+  const uword A_n_rows = A.n_rows;
+  const uword A_n_cols = A.n_cols;
+  
+  const uword* A_col_ptrs    = A.col_ptrs;
+  const uword* A_row_indices = A.row_indices;
+  const eT*    A_values      = A.values;
+  
+  // the scatter into out_mem requires a private accumulator per thread,
+  // so only go parallel when there is sufficient work to amortise the reduction
+  
+  const int n_threads_max = mp_thread_limit::get();
+  
+  if( (arma_config::openmp) && (mp_thread_limit::in_parallel() == false) && (n_threads_max >= 2) && mp_gate<eT>::eval(A.n_nonzero) && (A.n_nonzero >= (A_n_rows * uword(n_threads_max))) )
+    {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      arma_debug_print("dense_sparse_helper::sparse_times_vec(): merge path openmp implementation");
+      
+      const int   n_threads = n_threads_max;
+      const uword n_parts   = uword(n_threads);
+      const uword n_diags   = A_n_cols + A.n_nonzero;
+      
+      Mat<eT> acc(A_n_rows, n_parts, arma_zeros_indicator());
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword part=0; part < n_parts; ++part)
+        {
+        uword col_start, pos_start;
+        uword col_end,   pos_end;
+        
+        dense_sparse_helper::merge_path_search(col_start, pos_start, (n_diags * (part    )) / n_parts, A_col_ptrs, A_n_cols, A.n_nonzero);
+        dense_sparse_helper::merge_path_search(col_end,   pos_end,   (n_diags * (part + 1)) / n_parts, A_col_ptrs, A_n_cols, A.n_nonzero);
+        
+        eT* acc_mem = acc.colptr(part);
+        
+        uword col = col_start;
+        
+        for(uword pos = pos_start; pos < pos_end; ++pos)
+          {
+          while(A_col_ptrs[col + 1] <= pos)  { ++col; }
+          
+          acc_mem[ A_row_indices[pos] ] += A_values[pos] * B_mem[col];
+          }
+        }
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword row=0; row < A_n_rows; ++row)
+        {
+        eT val = eT(0);
+        
+        for(uword part=0; part < n_parts; ++part)  { val += acc.at(row, part); }
+        
+        out_mem[row] = val;
+        }
+      }
+    #endif
+    }
+  else
+    {
+    arrayops::fill_zeros(out_mem, A_n_rows);
+    
+    for(uword col=0; col < A_n_cols; ++col)
+      {
+      const eT    B_val = B_mem[col];
+      const uword end   = A_col_ptrs[col + 1];
+      
+      for(uword pos = A_col_ptrs[col]; pos < end; ++pos)
+        {
+        out_mem[ A_row_indices[pos] ] += A_values[pos] * B_val;
+        }
+      }
+    }
+  }
+
+
+
+//! out = A * B, processed one column of B at a time;
+//! each column of out depends only on the corresponding column of B,
+//! so the columns are distributed across threads without any reduction
+template<typename eT>
+inline
+void
+dense_sparse_helper::sparse_times_dense(Mat<eT>& out, const SpMat<eT>& A, const Mat<eT>& B)
+  {
+  arma_debug_sigprint();
+  
+  const uword B_n_cols = B.n_cols;
+  
+  if( (arma_config::openmp) && (mp_thread_limit::in_parallel() == false) && (B_n_cols >= 2) && mp_gate<eT>::eval(A.n_nonzero * B_n_cols) )
+    {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      arma_debug_print("dense_sparse_helper::sparse_times_dense(): openmp implementation");
+      
+      const int n_threads = mp_thread_limit::get();
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword col=0; col < B_n_cols; ++col)
+        {
+        const uword* A_col_ptrs    = A.col_ptrs;
+        const uword* A_row_indices = A.row_indices;
+        const eT*    A_values      = A.values;
+        
+        const eT* B_col = B.colptr(col);
+              eT* O_col = out.colptr(col);
+        
+        arrayops::fill_zeros(O_col, out.n_rows);
+        
+        for(uword A_col=0; A_col < A.n_cols; ++A_col)
+          {
+          const eT    B_val = B_col[A_col];
+          const uword end   = A_col_ptrs[A_col + 1];
+          
+          for(uword pos = A_col_ptrs[A_col]; pos < end; ++pos)
+            {
+            O_col[ A_row_indices[pos] ] += A_values[pos] * B_val;
+            }
+          }
+        }
+      }
+    #endif
+    }
+  else
+    {
+    for(uword col=0; col < B_n_cols; ++col)
+      {
+      dense_sparse_helper::sparse_times_vec(out.colptr(col), A, B.colptr(col));
+      }
+    }
+  }
+
+
+
 template<typename T1, typename T2>
 inline
 void
@@ -150,40 +492,7 @@ glue_times_dense_sparse::apply_noalias(Mat<typename T1::elem_type>& out, const T
     {
     arma_debug_print("using row vector specialisation");
     
-    if( (arma_config::openmp) && (mp_thread_limit::in_parallel() == false) && (B.n_cols >= 2) && mp_gate<eT>::eval(B.n_nonzero) )
-      {
-      #if defined(ARMA_USE_OPENMP)
-        {
-        arma_debug_print("openmp implementation");
-        
-              eT* out_mem = out.memptr();
-        const eT*   A_mem =   A.memptr();
-        
-        const uword B_n_cols  = B.n_cols;
-        const int   n_threads = mp_thread_limit::get();
-        
-        #pragma omp parallel for schedule(static) num_threads(n_threads)
-        for(uword col=0; col < B_n_cols; ++col)
-          {
-          out_mem[col] = dense_sparse_helper::dot(A_mem, B, col);
-          }
-        }
-      #endif
-      }
-    else
-      {
-      arma_debug_print("serial implementation");
-      
-            eT* out_mem = out.memptr();
-      const eT*   A_mem =   A.memptr();
-      
-      const uword B_n_cols = B.n_cols;
-      
-      for(uword col=0; col < B_n_cols; ++col)
-        {
-        out_mem[col] = dense_sparse_helper::dot(A_mem, B, col);
-        }
-      }
+    dense_sparse_helper::dot_cols(out.memptr(), A.memptr(), B);
     }
   else
   if( (arma_config::openmp) && (mp_thread_limit::in_parallel() == false) && (A.n_rows <= (A.n_cols / uword(100))) )
@@ -215,27 +524,7 @@ glue_times_dense_sparse::apply_noalias(Mat<typename T1::elem_type>& out, const T
     {
     arma_debug_print("using standard multiplication");
     
-    out.zeros();
-    
-    typename SpMat<eT>::const_iterator B_it = B.begin();
-    
-    const uword nnz        = B.n_nonzero;
-    const uword out_n_rows = out.n_rows;
-    
-    for(uword count = 0; count < nnz; ++count, ++B_it)
-      {
-      const eT    B_it_val = (*B_it);
-      const uword B_it_col = B_it.col();
-      const uword B_it_row = B_it.row();
-      
-      const eT*   A_col =   A.colptr(B_it_row);
-            eT* out_col = out.colptr(B_it_col);
-      
-      for(uword row = 0; row < out_n_rows; ++row)
-        {
-        out_col[row] += A_col[row] * B_it_val;
-        }
-      }
+    dense_sparse_helper::dense_times_sparse(out, A, B);
     }
   }
 
@@ -394,23 +683,9 @@ glue_times_sparse_dense::apply_noalias(Mat<typename T1::elem_type>& out, const T
     {
     arma_debug_print("using column vector specialisation");
     
-    out.zeros(A_n_rows, 1);
+    out.set_size(A_n_rows, 1);
     
-          eT* out_mem = out.memptr();
-    const eT*   B_mem =   B.memptr();
-    
-    typename SpMat<eT>::const_iterator A_it = A.begin();
-    
-    const uword nnz = A.n_nonzero;
-    
-    for(uword count = 0; count < nnz; ++count, ++A_it)
-      {
-      const eT    A_it_val = (*A_it);
-      const uword A_it_row = A_it.row();
-      const uword A_it_col = A_it.col();
-      
-      out_mem[A_it_row] += A_it_val * B_mem[A_it_col];
-      }
+    dense_sparse_helper::sparse_times_vec(out.memptr(), A, B.memptr());
     }
   else
   if(B_n_cols >= (B_n_rows / uword(100)))
@@ -439,23 +714,9 @@ glue_times_sparse_dense::apply_noalias(Mat<typename T1::elem_type>& out, const T
     {
     arma_debug_print("using standard multiplication");
     
-    out.zeros(A_n_rows, B_n_cols);
-    
-    typename SpMat<eT>::const_iterator A_it = A.begin();
-    
-    const uword nnz = A.n_nonzero;
+    out.set_size(A_n_rows, B_n_cols);
     
-    for(uword count = 0; count < nnz; ++count, ++A_it)
-      {
-      const eT    A_it_val = (*A_it);
-      const uword A_it_row = A_it.row();
-      const uword A_it_col = A_it.col();
-      
-      for(uword col = 0; col < B_n_cols; ++col)
-        {
-        out.at(A_it_row, col) += A_it_val * B.at(A_it_col, col);
-        }
-      }
+    dense_sparse_helper::sparse_times_dense(out, A, B);
     }
   }
 
@@ -488,41 +749,9 @@ glue_times_sparse_dense::apply_noalias_trans(Mat<typename T1::elem_type>& out, c
     {
     arma_debug_print("using column vector specialisation (avoiding transpose of A)");
     
-    if( (arma_config::openmp) && (mp_thread_limit::in_parallel() == false) && (A_n_cols >= 2) && mp_gate<eT>::eval(A.n_nonzero) )
-      {
-      arma_debug_print("opemp implementation");
-      
-      #if defined(ARMA_USE_OPENMP)
-        {
-        out.zeros(A_n_cols, 1);
-        
-              eT* out_mem = out.memptr();
-        const eT*   B_mem =   B.memptr();
-        
-        const int n_threads = mp_thread_limit::get();
-        
-        #pragma omp parallel for schedule(static) num_threads(n_threads)
-        for(uword col=0; col < A_n_cols; ++col)
-          {
-          out_mem[col] = dense_sparse_helper::dot(B_mem, A, col);
-          }
-        }
-      #endif
-      }
-    else
-      {
-      arma_debug_print("serial implementation");
-      
-      out.zeros(A_n_cols, 1);
-      
-            eT* out_mem = out.memptr();
-      const eT*   B_mem =   B.memptr();
-      
-      for(uword col=0; col < A_n_cols; ++col)
-        {
-        out_mem[col] = dense_sparse_helper::dot(B_mem, A, col);
-        }
-      }
+    out.set_size(A_n_cols, 1);
+    
+    dense_sparse_helper::dot_cols(out.memptr(), B.memptr(), A);
     }
   else
   if(B_n_cols >= (B_n_rows / uword(100)))
@@ -550,22 +779,11 @@ glue_times_sparse_dense::apply_noalias_trans(Mat<typename T1::elem_type>& out, c
     {
     arma_debug_print("using standard multiplication (avoiding transpose of A)");
     
-    out.zeros(A_n_cols, B_n_cols);
-    
-    typename SpMat<eT>::const_iterator A_it = A.begin();
+    out.set_size(A_n_cols, B_n_cols);
     
-    const uword nnz = A.n_nonzero;
-    
-    for(uword count = 0; count < nnz; ++count, ++A_it)
+    for(uword col = 0; col < B_n_cols; ++col)
       {
-      const eT    A_it_val = (*A_it);
-      const uword A_it_row = A_it.row();
-      const uword A_it_col = A_it.col();
-      
-      for(uword col = 0; col < B_n_cols; ++col)
-        {
-        out.at(A_it_col, col) += A_it_val * B.at(A_it_row, col);
-        }
+      dense_sparse_helper::dot_cols(out.colptr(col), B.colptr(col), A);
       }
     }
   }
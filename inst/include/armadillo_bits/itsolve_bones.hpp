@@ -0,0 +1,134 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 The RcppArmadillo Authors
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup itsolve
+//! @{
+
+
+//! y = A*x for sparse A;
+//! the transpose of A (ie. A in compressed sparse row form) is stored,
+//! so that each element of y is obtained as an independent dot product
+template<typename eT>
+struct itsolve_op_spmat
+  {
+  const uword n_rows;
+  
+  SpMat<eT> At;
+  
+  inline itsolve_op_spmat(const SpMat<eT>& A);
+  
+  inline void apply(eT* y, const eT* x) const;
+  };
+
+
+
+//! y = A*x for dense A
+template<typename eT>
+struct itsolve_op_mat
+  {
+  const uword n_rows;
+  
+  const Mat<eT>& A;
+  
+  inline itsolve_op_mat(const Mat<eT>& in_A);
+  
+  inline void apply(eT* y, const eT* x) const;
+  };
+
+
+
+//! y = A*x for a user supplied operator, called as op(y, x) with y and x of type Col<eT>;
+//! y is already set to the correct size and must not be resized
+template<typename eT, typename op_type>
+struct itsolve_op_functor
+  {
+  const uword n_rows;
+  
+  const op_type& op;
+  
+  inline itsolve_op_functor(const op_type& in_op, const uword in_n_rows);
+  
+  inline void apply(eT* y, const eT* x) const;
+  };
+
+
+
+//! z = inv(M)*r, where M is a Jacobi, ILU(0) or IC(0) approximation of A
+template<typename eT>
+struct itsolve_precond
+  {
+  typedef typename get_pod_type<eT>::result T;
+  
+  itsolve_opts::precond_type type = itsolve_opts::PREC_NONE;
+  
+  uword n = 0;
+  
+  podarray<eT> inv_diag;  // Jacobi
+  
+  podarray<uword> Fp;     // ILU(0): rows of L and U in compressed sparse row form, with unit diagonal of L not stored;
+  podarray<uword> Fi;     // IC(0):  rows of L in compressed sparse row form;
+  podarray<eT>    Fx;     // column indices within each row are in ascending order
+  podarray<uword> Fd;     // position of the diagonal element of each row
+  
+  inline void init(const SpMat<eT>& A, const itsolve_opts::precond_type in_type);
+  
+  inline bool init_jacobi(const SpMat<eT>& A);
+  inline bool init_ilu0  (const SpMat<eT>& A);
+  inline bool init_ic0   (const SpMat<eT>& A);
+  
+  inline void apply(eT* z, const eT* r) const;
+  };
+
+
+
+struct itsolve_worker
+  {
+  template<typename eT, typename op_type>
+  inline static bool solve(Mat<eT>& X, itsolve_info& info, const op_type& op, const itsolve_precond<eT>& M, const Mat<eT>& B, const char sig, const itsolve_opts& opts);
+  
+  
+  //
+  // each method starts from the given x and returns when the estimated residual norm is below abs_tol,
+  // after max_iter iterations, or on breakdown (in which case false is returned)
+  
+  template<typename eT, typename op_type>
+  inline static bool cg      (Col<eT>& x, uword& n_iter, const Col<eT>& b, const op_type& op, const itsolve_precond<eT>& M, const typename get_pod_type<eT>::result abs_tol, const uword max_iter);
+  
+  template<typename eT, typename op_type>
+  inline static bool minres  (Col<eT>& x, uword& n_iter, const Col<eT>& b, const op_type& op, const itsolve_precond<eT>& M, const typename get_pod_type<eT>::result abs_tol, const uword max_iter);
+  
+  template<typename eT, typename op_type>
+  inline static bool gmres   (Col<eT>& x, uword& n_iter, const Col<eT>& b, const op_type& op, const itsolve_precond<eT>& M, const typename get_pod_type<eT>::result abs_tol, const uword max_iter);
+  
+  template<typename eT, typename op_type>
+  inline static bool bicgstab(Col<eT>& x, uword& n_iter, const Col<eT>& b, const op_type& op, const itsolve_precond<eT>& M, const typename get_pod_type<eT>::result abs_tol, const uword max_iter);
+  
+  
+  //
+  // internal functions
+  
+  template<typename eT, typename op_type>
+  inline static void residual(Col<eT>& r, const Col<eT>& x, const Col<eT>& b, const op_type& op);
+  
+  template<typename eT>
+  inline static void givens(typename get_pod_type<eT>::result& c, eT& s, eT& a, const eT b);
+  };
+
+
+
+//! @}
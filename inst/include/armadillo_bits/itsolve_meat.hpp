@@ -0,0 +1,943 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 The RcppArmadillo Authors
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup itsolve
+//! @{
+
+
+
+template<typename eT>
+inline
+itsolve_op_spmat<eT>::itsolve_op_spmat(const SpMat<eT>& A)
+  : n_rows(A.n_rows)
+  , At    (A.st())
+  {
+  arma_debug_sigprint();
+  }
+
+
+
+template<typename eT>
+inline
+void
+itsolve_op_spmat<eT>::apply(eT* y, const eT* x) const
+  {
+  arma_debug_sigprint();
+  
+  // y[i] = dot(x, At.col(i)) = dot(A.row(i), x)
+  
+  dense_sparse_helper::dot_cols(y, x, At);
+  }
+
+
+
+template<typename eT>
+inline
+itsolve_op_mat<eT>::itsolve_op_mat(const Mat<eT>& in_A)
+  : n_rows(in_A.n_rows)
+  , A     (in_A)
+  {
+  arma_debug_sigprint();
+  }
+
+
+
+template<typename eT>
+inline
+void
+itsolve_op_mat<eT>::apply(eT* y, const eT* x) const
+  {
+  arma_debug_sigprint();
+  
+  gemv<>::apply(y, A, x);
+  }
+
+
+
+template<typename eT, typename op_type>
+inline
+itsolve_op_functor<eT,op_type>::itsolve_op_functor(const op_type& in_op, const uword in_n_rows)
+  : n_rows(in_n_rows)
+  , op    (in_op)
+  {
+  arma_debug_sigprint();
+  }
+
+
+
+template<typename eT, typename op_type>
+inline
+void
+itsolve_op_functor<eT,op_type>::apply(eT* y, const eT* x) const
+  {
+  arma_debug_sigprint();
+  
+  const Col<eT> x_wrap(const_cast<eT*>(x), n_rows, false, true);
+        Col<eT> y_wrap(                y,  n_rows, false, true);
+  
+  op(y_wrap, x_wrap);
+  }
+
+
+
+// 
+// itsolve_precond
+
+
+
+template<typename eT>
+inline
+void
+itsolve_precond<eT>::init(const SpMat<eT>& A, const itsolve_opts::precond_type in_type)
+  {
+  arma_debug_sigprint();
+  
+  n    = A.n_rows;
+  type = in_type;
+  
+  if(type == itsolve_opts::PREC_ILU0)
+    {
+    if(init_ilu0(A) == false)
+      {
+      arma_warn(2, "itsolve(): ILU(0) preconditioner failed; using Jacobi preconditioner instead");
+      
+      type = itsolve_opts::PREC_JACOBI;
+      }
+    }
+  
+  if(type == itsolve_opts::PREC_IC0)
+    {
+    if(init_ic0(A) == false)
+      {
+      arma_warn(2, "itsolve(): IC(0) preconditioner failed; using Jacobi preconditioner instead");
+      
+      type = itsolve_opts::PREC_JACOBI;
+      }
+    }
+  
+  if(type == itsolve_opts::PREC_JACOBI)
+    {
+    if(init_jacobi(A) == false)
+      {
+      arma_warn(2, "itsolve(): matrix A has zero elements on the diagonal; preconditioner not used");
+      
+      type = itsolve_opts::PREC_NONE;
+      }
+    }
+  }
+
+
+
+template<typename eT>
+inline
+bool
+itsolve_precond<eT>::init_jacobi(const SpMat<eT>& A)
+  {
+  arma_debug_sigprint();
+  
+  inv_diag.set_size(n);
+  
+  for(uword i=0; i < n; ++i)
+    {
+    const eT val = A.at(i,i);
+    
+    if( (std::abs(val) > T(0)) == false )  { return false; }
+    
+    inv_diag[i] = eT(1) / val;
+    }
+  
+  return true;
+  }
+
+
+
+//! incomplete LU factorisation with no fill-in, computed row by row (IKJ variant) on the rows of A
+template<typename eT>
+inline
+bool
+itsolve_precond<eT>::init_ilu0(const SpMat<eT>& A)
+  {
+  arma_debug_sigprint();
+  
+  const SpMat<eT> At = A.st();
+  
+  const uword nnz = At.n_nonzero;
+  
+  Fp.set_size(n+1);
+  Fi.set_size(nnz);
+  Fx.set_size(nnz);
+  Fd.set_size(n);
+  
+  arrayops::copy(Fp.memptr(), At.col_ptrs,    n+1);
+  arrayops::copy(Fi.memptr(), At.row_indices, nnz);
+  arrayops::copy(Fx.memptr(), At.values,      nnz);
+  
+  podarray<uword> pos(n);  // position of each column within the current row; nnz if not present
+  
+  pos.fill(nnz);
+  
+  for(uword i=0; i < n; ++i)
+    {
+    const uword row_start = Fp[i  ];
+    const uword row_end   = Fp[i+1];
+    
+    for(uword p=row_start; p < row_end; ++p)  { pos[ Fi[p] ] = p; }
+    
+    uword p = row_start;
+    
+    for(; (p < row_end) && (Fi[p] < i); ++p)
+      {
+      const uword k = Fi[p];
+      
+      const eT l_ik = Fx[p] / Fx[ Fd[k] ];
+      
+      Fx[p] = l_ik;
+      
+      for(uword q = Fd[k]+1; q < Fp[k+1]; ++q)
+        {
+        const uword pos_j = pos[ Fi[q] ];
+        
+        if(pos_j != nnz)  { Fx[pos_j] -= l_ik * Fx[q]; }
+        }
+      }
+    
+    const bool has_diag = (p < row_end) && (Fi[p] == i);
+    
+    for(uword q=row_start; q < row_end; ++q)  { pos[ Fi[q] ] = nnz; }
+    
+    if(has_diag == false)  { return false; }
+    
+    if( (std::abs(Fx[p]) > T(0)) == false )  { return false; }
+    
+    Fd[i] = p;
+    }
+  
+  return true;
+  }
+
+
+
+//! incomplete Cholesky factorisation with no fill-in, computed row by row on the lower triangle of A;
+//! A is assumed to be symmetric/hermitian
+template<typename eT>
+inline
+bool
+itsolve_precond<eT>::init_ic0(const SpMat<eT>& A)
+  {
+  arma_debug_sigprint();
+  
+  // row i of tril(A) is the conjugate of column i of triu(A)
+  
+  Fp.set_size(n+1);
+  Fd.set_size(n);
+  
+  Fp[0] = 0;
+  
+  for(uword i=0; i < n; ++i)
+    {
+    uword count = 0;
+    
+    for(uword p = A.col_ptrs[i]; p < A.col_ptrs[i+1]; ++p)  { count += (A.row_indices[p] <= i) ? uword(1) : uword(0); }
+    
+    Fp[i+1] = Fp[i] + count;
+    }
+  
+  const uword nnz = Fp[n];
+  
+  Fi.set_size(nnz);
+  Fx.set_size(nnz);
+  
+  for(uword i=0; i < n; ++i)
+    {
+    uword pos_out = Fp[i];
+    
+    for(uword p = A.col_ptrs[i]; p < A.col_ptrs[i+1]; ++p)
+      {
+      const uword k = A.row_indices[p];
+      
+      if(k <= i)  { Fi[pos_out] = k; Fx[pos_out] = eop_aux::conj(A.values[p]); ++pos_out; }
+      }
+    }
+  
+  podarray<uword> pos(n);  // position of each column within the current row; nnz if not present
+  
+  pos.fill(nnz);
+  
+  for(uword i=0; i < n; ++i)
+    {
+    const uword row_start = Fp[i  ];
+    const uword row_end   = Fp[i+1];
+    
+    if( (row_start == row_end) || (Fi[row_end-1] != i) )  { return false; }
+    
+    for(uword p=row_start; p < row_end; ++p)  { pos[ Fi[p] ] = p; }
+    
+    // L(i,j) = (A(i,j) - sum_k L(i,k)*conj(L(j,k))) / L(j,j), for j < i and k < j
+    
+    for(uword p=row_start; p < (row_end-1); ++p)
+      {
+      const uword j = Fi[p];
+      
+      eT val = Fx[p];
+      
+      for(uword q = Fp[j]; q < Fd[j]; ++q)
+        {
+        const uword pos_k = pos[ Fi[q] ];
+        
+        if(pos_k != nnz)  { val -= Fx[pos_k] * eop_aux::conj(Fx[q]); }
+        }
+      
+      Fx[p] = val / Fx[ Fd[j] ];
+      }
+    
+    T diag_val = access::tmp_real(Fx[row_end-1]);
+    
+    for(uword p=row_start; p < (row_end-1); ++p)
+      {
+      const T abs_val = std::abs(Fx[p]);
+      
+      diag_val -= abs_val*abs_val;
+      }
+    
+    for(uword p=row_start; p < row_end; ++p)  { pos[ Fi[p] ] = nnz; }
+    
+    if( (diag_val > T(0)) == false )  { return false; }
+    
+    Fx[row_end-1] = eT( std::sqrt(diag_val) );
+    Fd[i]         = row_end-1;
+    }
+  
+  return true;
+  }
+
+
+
+template<typename eT>
+inline
+void
+itsolve_precond<eT>::apply(eT* z, const eT* r) const
+  {
+  arma_debug_sigprint();
+  
+  if(type == itsolve_opts::PREC_JACOBI)
+    {
+    const eT* inv_diag_mem = inv_diag.memptr();
+    
+    for(uword i=0; i < n; ++i)  { z[i] = inv_diag_mem[i] * r[i]; }
+    }
+  else
+  if(type == itsolve_opts::PREC_ILU0)
+    {
+    // solve L*y = r, with L having unit diagonal
+    
+    for(uword i=0; i < n; ++i)
+      {
+      eT acc = r[i];
+      
+      for(uword p = Fp[i]; p < Fd[i]; ++p)  { acc -= Fx[p] * z[ Fi[p] ]; }
+      
+      z[i] = acc;
+      }
+    
+    // solve U*z = y
+    
+    for(uword ii=n; ii > 0; --ii)
+      {
+      const uword i = ii-1;
+      
+      eT acc = z[i];
+      
+      for(uword p = Fd[i]+1; p < Fp[i+1]; ++p)  { acc -= Fx[p] * z[ Fi[p] ]; }
+      
+      z[i] = acc / Fx[ Fd[i] ];
+      }
+    }
+  else
+  if(type == itsolve_opts::PREC_IC0)
+    {
+    // solve L*y = r
+    
+    for(uword i=0; i < n; ++i)
+      {
+      eT acc = r[i];
+      
+      for(uword p = Fp[i]; p < Fd[i]; ++p)  { acc -= Fx[p] * z[ Fi[p] ]; }
+      
+      z[i] = acc / Fx[ Fd[i] ];
+      }
+    
+    // solve L'*z = y, using the rows of L as columns of L'
+    
+    for(uword ii=n; ii > 0; --ii)
+      {
+      const uword i = ii-1;
+      
+      const eT z_i = z[i] / Fx[ Fd[i] ];
+      
+      z[i] = z_i;
+      
+      for(uword p = Fp[i]; p < Fd[i]; ++p)  { z[ Fi[p] ] -= eop_aux::conj(Fx[p]) * z_i; }
+      }
+    }
+  else
+    {
+    arrayops::copy(z, r, n);
+    }
+  }
+
+
+
+// 
+// itsolve_worker
+
+
+
+template<typename eT, typename op_type>
+inline
+bool
+itsolve_worker::solve(Mat<eT>& X, itsolve_info& info, const op_type& op, const itsolve_precond<eT>& M, const Mat<eT>& B, const char sig, const itsolve_opts& opts)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const uword N        = B.n_rows;
+  const uword B_n_cols = B.n_cols;
+  
+  const T     tol      = (opts.tol > double(0)) ? T(opts.tol) : std::sqrt(std::numeric_limits<T>::epsilon());
+  const uword max_iter = uword(opts.maxiter);
+  const uword restart  = (std::min)(uword(opts.restart), (std::max)(N, uword(1)));
+  
+  if(opts.warm_start)
+    {
+    if( (X.n_rows != N) || (X.n_cols != B_n_cols) )
+      {
+      arma_warn(1, "itsolve(): size of X does not match B; ignoring warm start");
+      
+      X.zeros(N, B_n_cols);
+      }
+    }
+  else
+    {
+    X.zeros(N, B_n_cols);
+    }
+  
+  info.n_iter    = 0;
+  info.rel_resid = 0.0;
+  info.converged = true;
+  
+  Col<eT> x(N, arma_nozeros_indicator());
+  Col<eT> r(N, arma_nozeros_indicator());
+  
+  for(uword col=0; col < B_n_cols; ++col)
+    {
+    const Col<eT> b(const_cast<eT*>(B.colptr(col)), N, false, true);
+    
+    arrayops::copy(x.memptr(), X.colptr(col), N);
+    
+    const T b_norm = norm(b, 2);
+    
+    T     rel_resid = T(0);
+    uword n_iter    = 0;
+    
+    if(b_norm > T(0))
+      {
+      const T abs_tol = tol * b_norm;
+      
+      itsolve_worker::residual(r, x, b, op);
+      
+      T r_norm = norm(r, 2);
+      
+      // each method is restarted from the current solution whenever its internal residual estimate
+      // has met the tolerance but the true residual has not; gmres is additionally restarted every 'restart' iterations
+      
+      bool ok = true;
+      
+      while( (r_norm > abs_tol) && (n_iter < max_iter) && ok )
+        {
+        const uword max_iter_part = (sig == 'g') ? (std::min)(restart, max_iter - n_iter) : (max_iter - n_iter);
+        
+        uword n_iter_part = 0;
+        
+        if(sig == 'c')  { ok = itsolve_worker::cg      (x, n_iter_part, b, op, M, abs_tol, max_iter_part); }
+        if(sig == 'm')  { ok = itsolve_worker::minres  (x, n_iter_part, b, op, M, abs_tol, max_iter_part); }
+        if(sig == 'g')  { ok = itsolve_worker::gmres   (x, n_iter_part, b, op, M, abs_tol, max_iter_part); }
+        if(sig == 'b')  { ok = itsolve_worker::bicgstab(x, n_iter_part, b, op, M, abs_tol, max_iter_part); }
+        
+        n_iter += n_iter_part;
+        
+        itsolve_worker::residual(r, x, b, op);
+        
+        r_norm = norm(r, 2);
+        
+        if(n_iter_part == 0)  { break; }
+        }
+      
+      if(ok == false)  { arma_debug_print("itsolve(): breakdown"); }
+      
+      rel_resid = r_norm / b_norm;
+      }
+    else
+      {
+      x.zeros();
+      }
+    
+    arrayops::copy(X.colptr(col), x.memptr(), N);
+    
+    info.n_iter    = (std::max)(info.n_iter, (unsigned int)(n_iter));
+    info.rel_resid = (std::max)(info.rel_resid, double(rel_resid));
+    
+    if( (rel_resid <= tol) == false )  { info.converged = false; }
+    }
+  
+  return info.converged;
+  }
+
+
+
+//! preconditioned conjugate gradient, for symmetric/hermitian positive definite A
+template<typename eT, typename op_type>
+inline
+bool
+itsolve_worker::cg(Col<eT>& x, uword& n_iter, const Col<eT>& b, const op_type& op, const itsolve_precond<eT>& M, const typename get_pod_type<eT>::result abs_tol, const uword max_iter)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const uword N = x.n_elem;
+  
+  Col<eT> r(N, arma_nozeros_indicator());
+  Col<eT> z(N, arma_nozeros_indicator());
+  Col<eT> q(N, arma_nozeros_indicator());
+  
+  itsolve_worker::residual(r, x, b, op);
+  
+  M.apply(z.memptr(), r.memptr());
+  
+  Col<eT> p = z;
+  
+  eT rz = cdot(r, z);
+  
+  n_iter = 0;
+  
+  while(n_iter < max_iter)
+    {
+    ++n_iter;
+    
+    op.apply(q.memptr(), p.memptr());
+    
+    const eT pq = cdot(p, q);
+    
+    if( (std::abs(pq) > T(0)) == false )  { return false; }
+    
+    const eT alpha = rz / pq;
+    
+    x += alpha * p;
+    r -= alpha * q;
+    
+    if(norm(r, 2) <= abs_tol)  { break; }
+    
+    M.apply(z.memptr(), r.memptr());
+    
+    const eT rz_new = cdot(r, z);
+    
+    if( (std::abs(rz) > T(0)) == false )  { return false; }
+    
+    const eT beta = rz_new / rz;
+    
+    p = z + beta * p;
+    
+    rz = rz_new;
+    }
+  
+  return true;
+  }
+
+
+
+//! preconditioned MINRES, for symmetric/hermitian A and symmetric/hermitian positive definite preconditioner;
+//! follows the formulation by Paige and Saunders
+template<typename eT, typename op_type>
+inline
+bool
+itsolve_worker::minres(Col<eT>& x, uword& n_iter, const Col<eT>& b, const op_type& op, const itsolve_precond<eT>& M, const typename get_pod_type<eT>::result abs_tol, const uword max_iter)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const uword N = x.n_elem;
+  
+  Col<eT> r1(N, arma_nozeros_indicator());
+  Col<eT> r2(N, arma_nozeros_indicator());
+  Col<eT> y (N, arma_nozeros_indicator());
+  Col<eT> v (N, arma_nozeros_indicator());
+  Col<eT> w (N, arma_zeros_indicator()  );
+  Col<eT> w1(N, arma_zeros_indicator()  );
+  Col<eT> w2(N, arma_zeros_indicator()  );
+  
+  n_iter = 0;
+  
+  itsolve_worker::residual(r1, x, b, op);
+  
+  M.apply(y.memptr(), r1.memptr());
+  
+  T beta1 = access::tmp_real( cdot(r1, y) );
+  
+  if( (beta1 >= T(0)) == false )  { return false; }  // preconditioner is not positive definite
+  
+  if(beta1 == T(0))  { return true; }
+  
+  beta1 = std::sqrt(beta1);
+  
+  // phibar estimates the residual norm in the metric given by the preconditioner;
+  // the tolerance is scaled to match the 2-norm of the initial residual
+  
+  const T phibar_tol = abs_tol * (beta1 / norm(r1, 2));
+  
+  r2 = r1;
+  
+  T oldb   =  T(0);
+  T beta   =  beta1;
+  T dbar   =  T(0);
+  T epsln  =  T(0);
+  T phibar =  beta1;
+  T cs     = -T(1);
+  T sn     =  T(0);
+  
+  while(n_iter < max_iter)
+    {
+    ++n_iter;
+    
+    v = y * (T(1) / beta);
+    
+    op.apply(y.memptr(), v.memptr());
+    
+    if(n_iter >= 2)  { y -= (beta / oldb) * r1; }
+    
+    const T alfa = access::tmp_real( cdot(v, y) );
+    
+    y -= (alfa / beta) * r2;
+    
+    r1.swap(r2);
+    r2 = y;
+    
+    M.apply(y.memptr(), r2.memptr());
+    
+    oldb = beta;
+    beta = access::tmp_real( cdot(r2, y) );
+    
+    if( (beta >= T(0)) == false )  { return false; }
+    
+    beta = std::sqrt(beta);
+    
+    // apply previous rotation, then compute and apply the next rotation
+    
+    const T oldeps = epsln;
+    const T delta  = cs*dbar + sn*alfa;
+    const T gbar   = sn*dbar - cs*alfa;
+    
+    epsln =  sn*beta;
+    dbar  = -cs*beta;
+    
+    const T gamma = (std::max)( std::hypot(gbar, beta), std::numeric_limits<T>::epsilon() );
+    
+    cs = gbar / gamma;
+    sn = beta / gamma;
+    
+    const T phi = cs * phibar;
+    
+    phibar = sn * phibar;
+    
+    // w1 = w2;  w2 = w;  w = (v - oldeps*w1 - delta*w2) / gamma;
+    
+    w1.swap(w2);
+    w2.swap(w );
+    
+    w = (v - oldeps*w1 - delta*w2) * (T(1) / gamma);
+    
+    x += phi * w;
+    
+    if(phibar <= phibar_tol)  { break; }
+    }
+  
+  return true;
+  }
+
+
+
+//! restarted GMRES with right preconditioning; one cycle of at most max_iter iterations is done
+template<typename eT, typename op_type>
+inline
+bool
+itsolve_worker::gmres(Col<eT>& x, uword& n_iter, const Col<eT>& b, const op_type& op, const itsolve_precond<eT>& M, const typename get_pod_type<eT>::result abs_tol, const uword max_iter)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const uword N = x.n_elem;
+  const uword m = max_iter;
+  
+  n_iter = 0;
+  
+  if(m == 0)  { return true; }
+  
+  Mat<eT> V(N, m+1, arma_nozeros_indicator());  // orthonormal basis of the Krylov subspace
+  Mat<eT> H(m+1, m, arma_zeros_indicator()  );  // Hessenberg matrix, reduced to upper triangular form by Givens rotations
+  
+  podarray<T>  cs(m);
+  podarray<eT> sn(m);
+  podarray<eT> g(m+1);
+  
+  g.zeros();
+  
+  Col<eT> w(N, arma_nozeros_indicator());
+  Col<eT> z(N, arma_nozeros_indicator());
+  
+  itsolve_worker::residual(w, x, b, op);
+  
+  const T beta = norm(w, 2);
+  
+  if(beta == T(0))  { return true; }
+  
+  arrayops::copy(V.colptr(0), w.memptr(), N);
+  
+  V.col(0) *= (T(1) / beta);
+  
+  g[0] = eT(beta);
+  
+  uword k = 0;
+  
+  for(uword j=0; j < m; ++j)
+    {
+    M.apply(z.memptr(), V.colptr(j));
+    
+    op.apply(w.memptr(), z.memptr());
+    
+    // modified Gram-Schmidt
+    
+    for(uword i=0; i <= j; ++i)
+      {
+      const Col<eT> v_i(V.colptr(i), N, false, true);
+      
+      const eT h = cdot(v_i, w);
+      
+      H.at(i,j) = h;
+      
+      w -= h * v_i;
+      }
+    
+    const T h_next = norm(w, 2);
+    
+    for(uword i=0; i < j; ++i)
+      {
+      const eT a = H.at(i  ,j);
+      const eT c = H.at(i+1,j);
+      
+      H.at(i  ,j) =  cs[i] * a + sn[i] * c;
+      H.at(i+1,j) = -eop_aux::conj(sn[i]) * a + cs[i] * c;
+      }
+    
+    eT h_jj = H.at(j,j);
+    
+    itsolve_worker::givens(cs[j], sn[j], h_jj, eT(h_next));
+    
+    H.at(j,j) = h_jj;
+    
+    g[j+1] = -eop_aux::conj(sn[j]) * g[j];
+    g[j  ] = cs[j] * g[j];
+    
+    k      = j+1;
+    n_iter = k;
+    
+    if( (std::abs(g[j+1]) <= abs_tol) || ((h_next > T(0)) == false) )  { break; }
+    
+    Col<eT> v_next(V.colptr(j+1), N, false, true);
+    
+    v_next = w * (T(1) / h_next);
+    }
+  
+  // solve the triangular system H(0:k-1,0:k-1) * y = g(0:k-1)
+  
+  Col<eT> y(k, arma_nozeros_indicator());
+  
+  for(uword ii=k; ii > 0; --ii)
+    {
+    const uword i = ii-1;
+    
+    eT acc = g[i];
+    
+    for(uword l=i+1; l < k; ++l)  { acc -= H.at(i,l) * y[l]; }
+    
+    const eT h_ii = H.at(i,i);
+    
+    if( (std::abs(h_ii) > T(0)) == false )  { return false; }
+    
+    y[i] = acc / h_ii;
+    }
+  
+  const Mat<eT> V_k(V.memptr(), N, k, false, true);
+  
+  w = V_k * y;
+  
+  M.apply(z.memptr(), w.memptr());
+  
+  x += z;
+  
+  return true;
+  }
+
+
+
+//! BiCGSTAB with right preconditioning
+template<typename eT, typename op_type>
+inline
+bool
+itsolve_worker::bicgstab(Col<eT>& x, uword& n_iter, const Col<eT>& b, const op_type& op, const itsolve_precond<eT>& M, const typename get_pod_type<eT>::result abs_tol, const uword max_iter)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const uword N = x.n_elem;
+  
+  Col<eT> r   (N, arma_nozeros_indicator());
+  Col<eT> p   (N, arma_zeros_indicator()  );
+  Col<eT> v   (N, arma_zeros_indicator()  );
+  Col<eT> s   (N, arma_nozeros_indicator());
+  Col<eT> t   (N, arma_nozeros_indicator());
+  Col<eT> phat(N, arma_nozeros_indicator());
+  Col<eT> shat(N, arma_nozeros_indicator());
+  
+  itsolve_worker::residual(r, x, b, op);
+  
+  const Col<eT> rhat = r;
+  
+  eT rho   = eT(1);
+  eT alpha = eT(1);
+  eT omega = eT(1);
+  
+  n_iter = 0;
+  
+  while(n_iter < max_iter)
+    {
+    ++n_iter;
+    
+    const eT rho_new = cdot(rhat, r);
+    
+    if( (std::abs(rho_new) > T(0)) == false )  { return false; }
+    
+    if(n_iter == 1)
+      {
+      p = r;
+      }
+    else
+      {
+      const eT beta = (rho_new / rho) * (alpha / omega);
+      
+      p = r + beta * (p - omega * v);
+      }
+    
+    M.apply(phat.memptr(), p.memptr());
+    
+    op.apply(v.memptr(), phat.memptr());
+    
+    const eT rv = cdot(rhat, v);
+    
+    if( (std::abs(rv) > T(0)) == false )  { return false; }
+    
+    alpha = rho_new / rv;
+    
+    s = r - alpha * v;
+    
+    if(norm(s, 2) <= abs_tol)  { x += alpha * phat; break; }
+    
+    M.apply(shat.memptr(), s.memptr());
+    
+    op.apply(t.memptr(), shat.memptr());
+    
+    const T tt = access::tmp_real( cdot(t, t) );
+    
+    if( (tt > T(0)) == false )  { return false; }
+    
+    omega = cdot(t, s) / tt;
+    
+    x += alpha * phat + omega * shat;
+    
+    r = s - omega * t;
+    
+    if(norm(r, 2) <= abs_tol)  { break; }
+    
+    if( (std::abs(omega) > T(0)) == false )  { return false; }
+    
+    rho = rho_new;
+    }
+  
+  return true;
+  }
+
+
+
+//! r = b - A*x
+template<typename eT, typename op_type>
+inline
+void
+itsolve_worker::residual(Col<eT>& r, const Col<eT>& x, const Col<eT>& b, const op_type& op)
+  {
+  arma_debug_sigprint();
+  
+  op.apply(r.memptr(), x.memptr());
+  
+  r = b - r;
+  }
+
+
+
+//! compute the rotation [c s; -conj(s) c], with real c, which maps [a; b] to [a_new; 0]; a is overwritten with a_new
+template<typename eT>
+inline
+void
+itsolve_worker::givens(typename get_pod_type<eT>::result& c, eT& s, eT& a, const eT b)
+  {
+  typedef typename get_pod_type<eT>::result T;
+  
+  const T abs_a = std::abs(a);
+  const T abs_b = std::abs(b);
+  
+  if(abs_a == T(0))
+    {
+    c = T(0);
+    s = eT(1);
+    a = b;
+    
+    return;
+    }
+  
+  const T  rr    = std::hypot(abs_a, abs_b);
+  const eT phase = a / abs_a;
+  
+  c = abs_a / rr;
+  s = phase * eop_aux::conj(b) / rr;
+  a = phase * rr;
+  }
+
+
+
+//! @}
@@ -83,4 +83,19 @@ struct mp_thread_limit
 
 
 
+//! division of n_elem elements into n_chunks contiguous chunks, with the chunk sizes differing by at most one;
+//! chunk c covers the elements from start(c) to start(c+1)-1
+struct mp_chunk
+  {
+  arma_inline
+  static
+  uword
+  start(const uword c, const uword n_elem, const uword n_chunks)
+    {
+    return c * (n_elem / n_chunks) + (std::min)(c, (n_elem % n_chunks));
+    }
+  };
+
+
+
 //! @}
@@ -0,0 +1,709 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 The RcppArmadillo Authors
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup mul_chain
+//! @{
+
+
+
+//! number of operands in a chain of multiplications such as A*B*diagmat(d)*C,
+//! ie. nested Glue objects with glue_times or glue_times_diag;
+//! as in depth_lhs, only the left hand side of each Glue is expanded, so a bracketed product such as (A*B) is a single operand.
+//! has_fixed indicates that an operand is a fixed size matrix, for which the product is better handled by gemm_fixed
+
+template<typename T1>
+struct mul_chain_length
+  {
+  static constexpr uword num       = 1;
+  static constexpr bool  has_fixed = is_Mat_fixed<typename partial_unwrap<T1>::stored_type>::value;
+  };
+
+template<typename T1, typename T2>
+struct mul_chain_length< Glue<T1,T2,glue_times> >
+  {
+  static constexpr uword num       = 1 + mul_chain_length<T1>::num;
+  static constexpr bool  has_fixed = mul_chain_length<T1>::has_fixed || mul_chain_length<T2>::has_fixed;
+  };
+
+template<typename T1, typename T2>
+struct mul_chain_length< Glue<T1,T2,glue_times_diag> >
+  {
+  static constexpr uword num       = 1 + mul_chain_length<T1>::num;
+  static constexpr bool  has_fixed = mul_chain_length<T1>::has_fixed || mul_chain_length<T2>::has_fixed;
+  };
+
+
+
+struct mul_chain_kind
+  {
+  static constexpr uword dense   = 0;  // M or trans(M)
+  static constexpr uword diag    = 1;  // diagmat(M), where M holds the diagonal
+  static constexpr uword inv_gen = 2;  // inv(M)
+  static constexpr uword inv_spd = 3;  // inv_sympd(M)
+  };
+
+
+
+//! description of one operand of a chain, or of an intermediate product
+template<typename eT>
+struct mul_chain_operand
+  {
+  const Mat<eT>* M;
+  
+  uword n_rows;    // size of the operand as it appears in the product
+  uword n_cols;
+  uword kind;
+  bool  do_trans;  // only used by mul_chain_kind::dense
+  };
+
+
+
+template<typename T1, const bool do_inv_detect>
+struct mul_chain_leaf_kind
+  {
+  static constexpr uword value = (strip_diagmat<T1>::do_diagmat) ? mul_chain_kind::diag : ( (do_inv_detect && strip_inv<T1>::do_inv_gen) ? mul_chain_kind::inv_gen : ( (do_inv_detect && strip_inv<T1>::do_inv_spd) ? mul_chain_kind::inv_spd : mul_chain_kind::dense ) );
+  };
+
+
+
+//! operand of kind inv_gen or inv_spd; the matrix is not inverted, as the product is obtained by solving a system
+template<typename T1, const uword kind>
+struct mul_chain_leaf
+  {
+  typedef typename T1::elem_type              eT;
+  typedef typename strip_inv<T1>::stored_type T1_stripped;
+  
+  const strip_inv<T1>             S;
+  const quasi_unwrap<T1_stripped> U;
+  
+  inline
+  mul_chain_leaf(const T1& X, mul_chain_operand<eT>& op, eT& alpha, bool& use_alpha)
+    : S(X)
+    , U(S.M)
+    {
+    arma_debug_sigprint();
+    arma_ignore(alpha);
+    arma_ignore(use_alpha);
+    
+    op.M        = &(U.M);
+    op.n_rows   = U.M.n_rows;
+    op.n_cols   = U.M.n_cols;
+    op.kind     = kind;
+    op.do_trans = false;
+    }
+  
+  template<typename eT2>
+  arma_inline bool is_alias(const Mat<eT2>& X) const { return U.is_alias(X); }
+  };
+
+
+
+template<typename T1>
+struct mul_chain_leaf<T1, mul_chain_kind::dense>
+  {
+  typedef typename T1::elem_type eT;
+  
+  const partial_unwrap<T1> U;
+  
+  inline
+  mul_chain_leaf(const T1& X, mul_chain_operand<eT>& op, eT& alpha, bool& use_alpha)
+    : U(X)
+    {
+    arma_debug_sigprint();
+    
+    constexpr bool do_trans = partial_unwrap<T1>::do_trans;
+    
+    op.M        = &(U.M);
+    op.n_rows   = (do_trans) ? U.M.n_cols : U.M.n_rows;
+    op.n_cols   = (do_trans) ? U.M.n_rows : U.M.n_cols;
+    op.kind     = mul_chain_kind::dense;
+    op.do_trans = do_trans;
+    
+    if(partial_unwrap<T1>::do_times)  { alpha *= U.get_val(); use_alpha = true; }
+    }
+  
+  template<typename eT2>
+  arma_inline bool is_alias(const Mat<eT2>& X) const { return U.is_alias(X); }
+  };
+
+
+
+template<typename T1>
+struct mul_chain_leaf<T1, mul_chain_kind::diag>
+  {
+  typedef typename T1::elem_type eT;
+  
+  Col<eT> d;
+  
+  inline
+  mul_chain_leaf(const T1& X, mul_chain_operand<eT>& op, eT& alpha, bool& use_alpha)
+    {
+    arma_debug_sigprint();
+    arma_ignore(alpha);
+    arma_ignore(use_alpha);
+    
+    const strip_diagmat<T1> S(X);
+    
+    const diagmat_proxy<typename strip_diagmat<T1>::stored_type> P(S.M);
+    
+    const uword N = (std::min)(P.n_rows, P.n_cols);
+    
+    d.set_size(N);
+    
+    eT* d_mem = d.memptr();
+    
+    for(uword i=0; i < N; ++i)  { d_mem[i] = P[i]; }
+    
+    op.M        = &d;
+    op.n_rows   = P.n_rows;
+    op.n_cols   = P.n_cols;
+    op.kind     = mul_chain_kind::diag;
+    op.do_trans = false;
+    }
+  
+  template<typename eT2>
+  constexpr bool is_alias(const Mat<eT2>&) const { return false; }  // the diagonal is copied
+  };
+
+
+
+//! unwraps all operands of a chain, and keeps the unwrapped objects alive while the chain is evaluated
+template<typename T1, const bool do_inv_detect>
+struct mul_chain_unwrap
+  {
+  typedef typename T1::elem_type eT;
+  
+  static constexpr uword n_ops = 1;
+  
+  const mul_chain_leaf<T1, mul_chain_leaf_kind<T1,do_inv_detect>::value> L;
+  
+  inline
+  mul_chain_unwrap(const T1& X, mul_chain_operand<eT>* ops, eT& alpha, bool& use_alpha)
+    : L(X, ops[0], alpha, use_alpha)
+    {
+    arma_debug_sigprint();
+    }
+  
+  template<typename eT2>
+  arma_inline bool is_alias(const Mat<eT2>& X) const { return L.is_alias(X); }
+  };
+
+
+
+template<typename T1, typename T2, const bool do_inv_detect>
+struct mul_chain_unwrap< Glue<T1,T2,glue_times>, do_inv_detect >
+  {
+  typedef typename T1::elem_type eT;
+  
+  static constexpr uword n_ops = 1 + mul_chain_unwrap<T1,do_inv_detect>::n_ops;
+  
+  const mul_chain_unwrap<T1, do_inv_detect>                               U1;
+  const mul_chain_leaf  <T2, mul_chain_leaf_kind<T2,do_inv_detect>::value> L2;
+  
+  inline
+  mul_chain_unwrap(const Glue<T1,T2,glue_times>& X, mul_chain_operand<eT>* ops, eT& alpha, bool& use_alpha)
+    : U1(X.A, ops,             alpha, use_alpha)
+    , L2(X.B, ops[n_ops - 1], alpha, use_alpha)
+    {
+    arma_debug_sigprint();
+    }
+  
+  template<typename eT2>
+  arma_inline bool is_alias(const Mat<eT2>& X) const { return (U1.is_alias(X) || L2.is_alias(X)); }
+  };
+
+
+
+template<typename T1, typename T2, const bool do_inv_detect>
+struct mul_chain_unwrap< Glue<T1,T2,glue_times_diag>, do_inv_detect >
+  {
+  typedef typename T1::elem_type eT;
+  
+  static constexpr uword n_ops = 1 + mul_chain_unwrap<T1,do_inv_detect>::n_ops;
+  
+  const mul_chain_unwrap<T1, do_inv_detect>                               U1;
+  const mul_chain_leaf  <T2, mul_chain_leaf_kind<T2,do_inv_detect>::value> L2;
+  
+  inline
+  mul_chain_unwrap(const Glue<T1,T2,glue_times_diag>& X, mul_chain_operand<eT>* ops, eT& alpha, bool& use_alpha)
+    : U1(X.A, ops,             alpha, use_alpha)
+    , L2(X.B, ops[n_ops - 1], alpha, use_alpha)
+    {
+    arma_debug_sigprint();
+    }
+  
+  template<typename eT2>
+  arma_inline bool is_alias(const Mat<eT2>& X) const { return (U1.is_alias(X) || L2.is_alias(X)); }
+  };
+
+
+
+//! \brief
+//! Evaluation of a chain of multiplications in the order which needs the fewest operations,
+//! found via dynamic programming over the sizes of the operands (the classic matrix chain ordering problem).
+//! The sizes take transposes into account, so that eg. A*B*C*x is evaluated as A*(B*(C*x)) via matrix-vector products.
+//! Multiplication with diagmat() is done by scaling rows or columns,
+//! and inv(A)*B or B*inv_sympd(A) is done by solving a system, without explicitly forming the inverse.
+
+struct mul_chain
+  {
+  template<const bool check_alias, typename T1>
+  inline
+  static
+  void
+  apply(Mat<typename T1::elem_type>& out, const T1& X)
+    {
+    arma_debug_sigprint();
+    
+    typedef typename T1::elem_type eT;
+    
+    constexpr bool do_inv_detect = is_blas_type<eT>::value && arma_config::optimise_invexpr;
+    
+    typedef mul_chain_unwrap<T1, do_inv_detect> unwrap_type;
+    
+    constexpr uword N = unwrap_type::n_ops;
+    
+    mul_chain_operand<eT> ops[N];
+    
+    eT   alpha     = eT(1);
+    bool use_alpha = false;
+    
+    const unwrap_type U(X, ops, alpha, use_alpha);
+    
+    bool is_empty = false;
+    
+    for(uword i=0; i < N; ++i)
+      {
+      const mul_chain_operand<eT>& op = ops[i];
+      
+      if( (op.kind == mul_chain_kind::inv_gen) || (op.kind == mul_chain_kind::inv_spd) )
+        {
+        arma_conform_check( (op.n_rows != op.n_cols), "inv(): given matrix must be square sized" );
+        }
+      
+      if(i > 0)  { arma_conform_assert_mul_size(ops[i-1].n_rows, ops[i-1].n_cols, op.n_rows, op.n_cols, "matrix multiplication"); }
+      
+      if( (op.n_rows == 0) || (op.n_cols == 0) )  { is_empty = true; }
+      }
+    
+    if(is_empty)  { out.zeros(ops[0].n_rows, ops[N-1].n_cols); return; }
+    
+    podarray<uword> split(N*N);
+    
+    mul_chain::find_order(split.memptr(), ops, N);
+    
+    const bool alias = (check_alias) && U.is_alias(out);
+    
+    if(alias == false)
+      {
+      mul_chain::eval_root(out, ops, split.memptr(), N, use_alpha, alpha);
+      }
+    else
+      {
+      Mat<eT> tmp;
+      
+      mul_chain::eval_root(tmp, ops, split.memptr(), N, use_alpha, alpha);
+      
+      out.steal_mem(tmp);
+      }
+    }
+  
+  
+  //! estimated number of multiply-add operations for evaluating op(A)*op(B), where op(A) is n_rows x K and op(B) is K x n_cols
+  inline
+  static
+  double
+  cost(const uword kind_A, const uword kind_B, const double n_rows, const double K, const double n_cols)
+    {
+    const bool is_diag_A = (kind_A == mul_chain_kind::diag);
+    const bool is_diag_B = (kind_B == mul_chain_kind::diag);
+    
+    const bool is_inv_A = (kind_A == mul_chain_kind::inv_gen) || (kind_A == mul_chain_kind::inv_spd);
+    const bool is_inv_B = (kind_B == mul_chain_kind::inv_gen) || (kind_B == mul_chain_kind::inv_spd);
+    
+    // an operand with inv() which is not combined via a solver is explicitly inverted
+    
+    if(is_diag_A && is_diag_B)  { return (std::min)(n_rows, n_cols);                                   }
+    if(is_diag_A            )  { return n_rows*n_cols + ( (is_inv_B) ? (K*K*K) : double(0) );          }
+    if(is_diag_B            )  { return n_rows*n_cols + ( (is_inv_A) ? (K*K*K) : double(0) );          }
+    if(is_inv_A && is_inv_B )  { return K*K*K + (K*K*K)/double(3) + n_rows*K*n_cols;                   }
+    if(is_inv_A             )  { return (K*K*K)/double(3) + K*K*n_cols;                                }
+    if(is_inv_B             )  { return (K*K*K)/double(3) + n_rows*K*K;                                }
+    
+    return n_rows*K*n_cols;
+    }
+  
+  
+  //! split[i + j*N] = k indicates that the product of operands i to j is best evaluated as (i..k)*(k+1..j)
+  template<typename eT>
+  inline
+  static
+  void
+  find_order(uword* split, const mul_chain_operand<eT>* ops, const uword N)
+    {
+    arma_debug_sigprint();
+    
+    podarray<double> dims(N+1);
+    podarray<double> costs(N*N);
+    podarray<uword>  kinds(N*N);
+    
+    for(uword i=0; i < N; ++i)
+      {
+      dims[i] = double(ops[i].n_rows);
+      
+      costs[i + i*N] = double(0);
+      kinds[i + i*N] = ops[i].kind;
+      split[i + i*N] = i;
+      }
+    
+    dims[N] = double(ops[N-1].n_cols);
+    
+    for(uword len=2; len <= N; ++len)
+    for(uword i=0;   i <= (N-len); ++i)
+      {
+      const uword j = i + len - 1;
+      
+      double best_cost  = Datum<double>::inf;
+      uword  best_split = i;
+      
+      for(uword k=i; k < j; ++k)
+        {
+        const double c = costs[i + k*N] + costs[(k+1) + j*N] + mul_chain::cost(kinds[i + k*N], kinds[(k+1) + j*N], dims[i], dims[k+1], dims[j+1]);
+        
+        // on ties the later split is used, which gives the usual left to right evaluation
+        
+        if(c <= best_cost)  { best_cost = c; best_split = k; }
+        }
+      
+      const bool is_diag = (kinds[i + best_split*N] == mul_chain_kind::diag) && (kinds[(best_split+1) + j*N] == mul_chain_kind::diag);
+      
+      costs[i + j*N] = best_cost;
+      kinds[i + j*N] = (is_diag) ? mul_chain_kind::diag : mul_chain_kind::dense;
+      split[i + j*N] = best_split;
+      }
+    }
+  
+  
+  template<typename eT>
+  inline
+  static
+  void
+  eval_root(Mat<eT>& out, const mul_chain_operand<eT>* ops, const uword* split, const uword N, const bool use_alpha, const eT alpha)
+    {
+    arma_debug_sigprint();
+    
+    mul_chain_operand<eT> out_op;
+    
+    mul_chain::eval(out, out_op, ops, split, N, 0, N-1, use_alpha, alpha);
+    
+    if(out_op.kind == mul_chain_kind::diag)
+      {
+      const Col<eT> d(out);
+      
+      out.zeros(out_op.n_rows, out_op.n_cols);
+      
+      out.diag() = d;
+      }
+    }
+  
+  
+  //! out = product of operands i to j
+  template<typename eT>
+  inline
+  static
+  void
+  eval(Mat<eT>& out, mul_chain_operand<eT>& out_op, const mul_chain_operand<eT>* ops, const uword* split, const uword N, const uword i, const uword j, const bool use_alpha, const eT alpha)
+    {
+    arma_debug_sigprint();
+    
+    const uword k = split[i + j*N];
+    
+    arma_debug_print(arma_str::format("mul_chain::eval(): (%u..%u) * (%u..%u)") % i % k % (k+1) % j);
+    
+    Mat<eT> tmp_A;
+    Mat<eT> tmp_B;
+    
+    mul_chain_operand<eT> A = ops[i  ];
+    mul_chain_operand<eT> B = ops[k+1];
+    
+    if(k   > i)  { mul_chain::eval(tmp_A, A, ops, split, N, i,   k, false, eT(0)); }
+    if(k+1 < j)  { mul_chain::eval(tmp_B, B, ops, split, N, k+1, j, false, eT(0)); }
+    
+    mul_chain::mul(out, out_op, A, B, use_alpha, alpha);
+    }
+  
+  
+  template<typename eT>
+  inline
+  static
+  void
+  mul(Mat<eT>& out, mul_chain_operand<eT>& out_op, const mul_chain_operand<eT>& A, const mul_chain_operand<eT>& B, const bool use_alpha, const eT alpha)
+    {
+    arma_debug_sigprint();
+    
+    const bool is_diag_A = (A.kind == mul_chain_kind::diag);
+    const bool is_diag_B = (B.kind == mul_chain_kind::diag);
+    
+    const bool is_inv_A = (A.kind == mul_chain_kind::inv_gen) || (A.kind == mul_chain_kind::inv_spd);
+    const bool is_inv_B = (B.kind == mul_chain_kind::inv_gen) || (B.kind == mul_chain_kind::inv_spd);
+    
+    out_op.M        = &out;
+    out_op.n_rows   = A.n_rows;
+    out_op.n_cols   = B.n_cols;
+    out_op.kind     = mul_chain_kind::dense;
+    out_op.do_trans = false;
+    
+    if(is_diag_A && is_diag_B)
+      {
+      const Mat<eT>& a = *(A.M);
+      const Mat<eT>& b = *(B.M);
+      
+      const uword N = (std::min)(a.n_elem, b.n_elem);
+      
+      out.zeros( (std::min)(A.n_rows, B.n_cols), 1 );
+      
+      for(uword i=0; i < N; ++i)  { out[i] = a[i] * b[i]; }
+      
+      out_op.kind = mul_chain_kind::diag;
+      }
+    else
+    if(is_diag_A)
+      {
+      Mat<eT> B_tmp;
+      
+      const mul_chain_operand<eT> BB = (is_inv_B) ? mul_chain::to_dense(B_tmp, B) : B;
+      
+      const Mat<eT>& a   = *(A.M);
+      const Mat<eT>& B_M = *(BB.M);
+      
+      const uword a_n_elem = a.n_elem;
+      
+      out.zeros(A.n_rows, B.n_cols);
+      
+      for(uword col=0; col < B.n_cols; ++col)
+        {
+        eT* out_colmem = out.colptr(col);
+        
+        if(BB.do_trans)
+          {
+          for(uword i=0; i < a_n_elem; ++i)  { out_colmem[i] = a[i] * access::alt_conj( B_M.at(col,i) ); }
+          }
+        else
+          {
+          const eT* B_colmem = B_M.colptr(col);
+          
+          for(uword i=0; i < a_n_elem; ++i)  { out_colmem[i] = a[i] * B_colmem[i]; }
+          }
+        }
+      }
+    else
+    if(is_diag_B)
+      {
+      Mat<eT> A_tmp;
+      
+      const mul_chain_operand<eT> AA = (is_inv_A) ? mul_chain::to_dense(A_tmp, A) : A;
+      
+      const Mat<eT>& A_M = *(AA.M);
+      const Mat<eT>& b   = *(B.M);
+      
+      const uword b_n_elem = b.n_elem;
+      const uword A_n_rows = A.n_rows;
+      
+      out.zeros(A.n_rows, B.n_cols);
+      
+      for(uword col=0; col < b_n_elem; ++col)
+        {
+        const eT val = b[col];
+        
+        eT* out_colmem = out.colptr(col);
+        
+        if(AA.do_trans)
+          {
+          for(uword i=0; i < A_n_rows; ++i)  { out_colmem[i] = access::alt_conj( A_M.at(col,i) ) * val; }
+          }
+        else
+          {
+          const eT* A_colmem = A_M.colptr(col);
+          
+          for(uword i=0; i < A_n_rows; ++i)  { out_colmem[i] = A_colmem[i] * val; }
+          }
+        }
+      }
+    else
+    if(is_inv_A)
+      {
+      // inv(A)*B = solve(A,B)
+      
+      Mat<eT> B_tmp;
+      
+      const Mat<eT>& B_M = *( mul_chain::to_dense(B_tmp, B, false).M );
+      
+      mul_chain::solve(out, *(A.M), (A.kind == mul_chain_kind::inv_spd), B_M);
+      }
+    else
+    if(is_inv_B)
+      {
+      // A*inv(B) = trans( solve(trans(B), trans(A)) )
+      
+      const bool is_spd = (B.kind == mul_chain_kind::inv_spd);
+      
+      Mat<eT> At_tmp;
+      Mat<eT> Bt_tmp;
+      
+      if(A.do_trans == false)  { At_tmp = trans(*(A.M)); }
+      if(is_spd     == false)  { Bt_tmp = trans(*(B.M)); }
+      
+      const Mat<eT>& At = (A.do_trans) ? *(A.M) : At_tmp;
+      const Mat<eT>& Bt = (is_spd    ) ? *(B.M) : Bt_tmp;
+      
+      Mat<eT> tmp;
+      
+      mul_chain::solve(tmp, Bt, is_spd, At);
+      
+      out = trans(tmp);
+      }
+    else
+      {
+      const Mat<eT>& A_M = *(A.M);
+      const Mat<eT>& B_M = *(B.M);
+      
+      if(use_alpha)
+        {
+             if( (A.do_trans == false) && (B.do_trans == false) )  { glue_times::apply<eT, false, false, true>(out, A_M, B_M, alpha); }
+        else if( (A.do_trans == true ) && (B.do_trans == false) )  { glue_times::apply<eT, true,  false, true>(out, A_M, B_M, alpha); }
+        else if( (A.do_trans == false) && (B.do_trans == true ) )  { glue_times::apply<eT, false, true,  true>(out, A_M, B_M, alpha); }
+        else                                                       { glue_times::apply<eT, true,  true,  true>(out, A_M, B_M, alpha); }
+        }
+      else
+        {
+             if( (A.do_trans == false) && (B.do_trans == false) )  { glue_times::apply<eT, false, false, false>(out, A_M, B_M, eT(0)); }
+        else if( (A.do_trans == true ) && (B.do_trans == false) )  { glue_times::apply<eT, true,  false, false>(out, A_M, B_M, eT(0)); }
+        else if( (A.do_trans == false) && (B.do_trans == true ) )  { glue_times::apply<eT, false, true,  false>(out, A_M, B_M, eT(0)); }
+        else                                                       { glue_times::apply<eT, true,  true,  false>(out, A_M, B_M, eT(0)); }
+        }
+      
+      return;
+      }
+    
+    if(use_alpha)  { arrayops::inplace_mul(out.memptr(), alpha, out.n_elem); }
+    }
+  
+  
+  //! dense form of an operand; if allow_trans is false, a transposed operand is also explicitly transposed
+  template<typename eT>
+  inline
+  static
+  mul_chain_operand<eT>
+  to_dense(Mat<eT>& tmp, const mul_chain_operand<eT>& X, const bool allow_trans = true)
+    {
+    arma_debug_sigprint();
+    
+    mul_chain_operand<eT> out_op = X;
+    
+    if(X.kind == mul_chain_kind::dense)
+      {
+      if( (X.do_trans == false) || allow_trans )  { return out_op; }
+      
+      tmp = trans(*(X.M));
+      }
+    else
+    if(X.kind == mul_chain_kind::diag)
+      {
+      tmp.zeros(X.n_rows, X.n_cols);
+      
+      tmp.diag() = *(X.M);
+      }
+    else
+      {
+      mul_chain::inverse(tmp, *(X.M), (X.kind == mul_chain_kind::inv_spd));
+      }
+    
+    out_op.M        = &tmp;
+    out_op.kind     = mul_chain_kind::dense;
+    out_op.do_trans = false;
+    
+    return out_op;
+    }
+  
+  
+  //! out = inv(A)*B
+  template<typename eT>
+  inline
+  static
+  typename enable_if2< is_blas_type<eT>::value, void >::result
+  solve(Mat<eT>& out, const Mat<eT>& A, const bool is_spd, const Mat<eT>& B)
+    {
+    arma_debug_sigprint();
+    
+    if( (is_spd) && (arma_config::check_conform) && (auxlib::rudimentary_sym_check(A) == false) )
+      {
+      if(is_cx<eT>::no )  { arma_warn(1, "inv_sympd(): given matrix is not symmetric"); }
+      if(is_cx<eT>::yes)  { arma_warn(1, "inv_sympd(): given matrix is not hermitian"); }
+      }
+    
+    Mat<eT> AA(A);
+    
+    const bool status = (is_spd) ? auxlib::solve_sympd_fast(out, AA, B) : auxlib::solve_square_fast(out, AA, B);  // AA is overwritten
+    
+    if(status == false)
+      {
+      out.soft_reset();
+      arma_stop_runtime_error("matrix multiplication: problem with matrix inverse; suggest to use solve() instead");
+      }
+    }
+  
+  
+  template<typename eT>
+  inline
+  static
+  typename enable_if2< is_blas_type<eT>::value == false, void >::result
+  solve(Mat<eT>& out, const Mat<eT>& A, const bool is_spd, const Mat<eT>& B)
+    {
+    arma_ignore(out);
+    arma_ignore(A);
+    arma_ignore(is_spd);
+    arma_ignore(B);
+    }
+  
+  
+  template<typename eT>
+  inline
+  static
+  typename enable_if2< is_blas_type<eT>::value, void >::result
+  inverse(Mat<eT>& out, const Mat<eT>& A, const bool is_spd)
+    {
+    arma_debug_sigprint();
+    
+    if(is_spd)  { out = inv_sympd(A); }  else  { out = inv(A); }
+    }
+  
+  
+  template<typename eT>
+  inline
+  static
+  typename enable_if2< is_blas_type<eT>::value == false, void >::result
+  inverse(Mat<eT>& out, const Mat<eT>& A, const bool is_spd)
+    {
+    arma_ignore(out);
+    arma_ignore(A);
+    arma_ignore(is_spd);
+    }
+  };
+
+
+
+//! @}
@@ -0,0 +1,229 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 The RcppArmadillo Authors
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup gemm_fixed
+//! @{
+
+
+
+//! dimensions of op(A)*op(B) when A and B are both fixed size matrices;
+//! use is false when the product is not handled by gemm_fixed, in which case the dimensions are dummy values
+template<const bool do_trans_A, const bool do_trans_B, typename TA, typename TB, const bool both_fixed = (is_Mat_fixed<TA>::value && is_Mat_fixed<TB>::value)>
+struct gemm_fixed_dims
+  {
+  static constexpr bool  use = false;
+  static constexpr uword N   = 1;
+  static constexpr uword K   = 1;
+  static constexpr uword M   = 1;
+  };
+
+
+
+template<const bool do_trans_A, const bool do_trans_B, typename TA, typename TB>
+struct gemm_fixed_dims<do_trans_A, do_trans_B, TA, TB, true>
+  {
+  static constexpr uword A_N = (do_trans_A) ? TA::n_cols : TA::n_rows;
+  static constexpr uword A_K = (do_trans_A) ? TA::n_rows : TA::n_cols;
+  static constexpr uword B_K = (do_trans_B) ? TB::n_cols : TB::n_rows;
+  static constexpr uword B_M = (do_trans_B) ? TB::n_rows : TB::n_cols;
+  
+  // without 256 bit vector registers, a tuned BLAS is faster for matrix-matrix products of this size;
+  // the kernels are then only used for matrix-vector products, where the overhead of calling BLAS dominates
+  
+  #if defined(__AVX__)
+    static constexpr bool allow_mat_mat = true;
+  #else
+    static constexpr bool allow_mat_mat = false;
+  #endif
+  
+  static constexpr uword max_n = 12;
+  
+  static constexpr bool valid_size = (A_K == B_K) && (A_N > 0) && (A_K > 0) && (B_M > 0) && (A_N <= max_n) && (A_K <= max_n) && (B_M <= max_n);
+  
+  // products of square matrices up to 4x4 are already handled by gemm_emul_tinysq
+  
+  static constexpr bool use = valid_size && (allow_mat_mat || (A_N == 1) || (B_M == 1)) && ((A_N > 4) || (A_K > 4) || (B_M > 4));
+  
+  static constexpr uword N = (use) ? A_N : 1;
+  static constexpr uword K = (use) ? A_K : 1;
+  static constexpr uword M = (use) ? B_M : 1;
+  };
+
+
+
+//! \brief
+//! Matrix multiplication where all dimensions are known at compile time, ie. for fixed size matrices.
+//! op(A) is N x K, op(B) is K x M, and C is N x M.
+//! C is computed in 4x4 blocks, each accumulated in 16 local variables which the compiler keeps in (vector) registers;
+//! the remaining columns are handled by 4x1 blocks, and the number of rows is padded to a multiple of 4.
+//! Only for real element types; C must not alias A or B.
+//! Matrix-vector products always use these kernels.
+//! Matrix-matrix products use them only when the code is compiled with 256 bit vector support (__AVX__, eg. via -mavx or -march=native);
+//! otherwise they are evaluated by BLAS as for other matrices (see gemm_fixed_dims::allow_mat_mat).
+
+template<const uword N, const uword K, const uword M, const bool do_trans_A=false, const bool do_trans_B=false, const bool use_alpha=false>
+struct gemm_fixed
+  {
+  static constexpr uword N_pad  = N + ((N % 4) ? (4 - (N % 4)) : 0);  // number of rows rounded up to a multiple of 4
+  static constexpr uword M_main = M - (M % 4);
+  
+  
+  //! C(0:3,0:3) = A(0:3,:) * B(:,0:3), where A and C have N_pad rows and B has K rows
+  template<typename eT>
+  arma_hot
+  arma_inline
+  static
+  void
+  block_4x4(eT* C, const eT* A, const eT* B, const eT alpha)
+    {
+    const eT* B0 = &(B[0  ]);
+    const eT* B1 = &(B[K  ]);
+    const eT* B2 = &(B[K*2]);
+    const eT* B3 = &(B[K*3]);
+    
+    eT c00 = eT(0);  eT c01 = eT(0);  eT c02 = eT(0);  eT c03 = eT(0);
+    eT c10 = eT(0);  eT c11 = eT(0);  eT c12 = eT(0);  eT c13 = eT(0);
+    eT c20 = eT(0);  eT c21 = eT(0);  eT c22 = eT(0);  eT c23 = eT(0);
+    eT c30 = eT(0);  eT c31 = eT(0);  eT c32 = eT(0);  eT c33 = eT(0);
+    
+    for(uword k=0; k < K; ++k)
+      {
+      const eT* A_k = &(A[k*N_pad]);
+      
+      const eT a0 = A_k[0];  const eT a1 = A_k[1];  const eT a2 = A_k[2];  const eT a3 = A_k[3];
+      const eT b0 = B0[k];   const eT b1 = B1[k];   const eT b2 = B2[k];   const eT b3 = B3[k];
+      
+      c00 += a0*b0;  c10 += a1*b0;  c20 += a2*b0;  c30 += a3*b0;
+      c01 += a0*b1;  c11 += a1*b1;  c21 += a2*b1;  c31 += a3*b1;
+      c02 += a0*b2;  c12 += a1*b2;  c22 += a2*b2;  c32 += a3*b2;
+      c03 += a0*b3;  c13 += a1*b3;  c23 += a2*b3;  c33 += a3*b3;
+      }
+    
+    eT* C0 = &(C[0  ]);
+    eT* C1 = &(C[N_pad  ]);
+    eT* C2 = &(C[N_pad*2]);
+    eT* C3 = &(C[N_pad*3]);
+    
+    if(use_alpha)
+      {
+      C0[0] = alpha*c00;  C0[1] = alpha*c10;  C0[2] = alpha*c20;  C0[3] = alpha*c30;
+      C1[0] = alpha*c01;  C1[1] = alpha*c11;  C1[2] = alpha*c21;  C1[3] = alpha*c31;
+      C2[0] = alpha*c02;  C2[1] = alpha*c12;  C2[2] = alpha*c22;  C2[3] = alpha*c32;
+      C3[0] = alpha*c03;  C3[1] = alpha*c13;  C3[2] = alpha*c23;  C3[3] = alpha*c33;
+      }
+    else
+      {
+      C0[0] = c00;  C0[1] = c10;  C0[2] = c20;  C0[3] = c30;
+      C1[0] = c01;  C1[1] = c11;  C1[2] = c21;  C1[3] = c31;
+      C2[0] = c02;  C2[1] = c12;  C2[2] = c22;  C2[3] = c32;
+      C3[0] = c03;  C3[1] = c13;  C3[2] = c23;  C3[3] = c33;
+      }
+    }
+  
+  
+  //! C(0:3,0) = A(0:3,:) * B(:,0)
+  template<typename eT>
+  arma_hot
+  arma_inline
+  static
+  void
+  block_4x1(eT* C, const eT* A, const eT* B, const eT alpha)
+    {
+    eT c0 = eT(0);  eT c1 = eT(0);  eT c2 = eT(0);  eT c3 = eT(0);
+    
+    for(uword k=0; k < K; ++k)
+      {
+      const eT* A_k = &(A[k*N_pad]);
+      
+      const eT b = B[k];
+      
+      c0 += A_k[0]*b;  c1 += A_k[1]*b;  c2 += A_k[2]*b;  c3 += A_k[3]*b;
+      }
+    
+    if(use_alpha)  { C[0] = alpha*c0;  C[1] = alpha*c1;  C[2] = alpha*c2;  C[3] = alpha*c3; }
+    else           { C[0] =       c0;  C[1] =       c1;  C[2] =       c2;  C[3] =       c3; }
+    }
+  
+  
+  template<typename eT>
+  arma_hot
+  inline
+  static
+  void
+  apply(eT* C_mem, const eT* A_mem, const eT* B_mem, const eT alpha = eT(1))
+    {
+    arma_debug_sigprint();
+    
+    // the blocks require op(A) to be stored column by column (N_pad x K) and op(B) to be stored column by column (K x M);
+    // if N is not a multiple of 4, op(A) is padded with zero rows and C is computed in a local buffer
+    
+    constexpr bool use_A_buf = (do_trans_A) || (N_pad != N);
+    
+    arma_align_mem eT A_buf[ (use_A_buf ) ? (N_pad*K) : 1 ];
+    arma_align_mem eT B_buf[ (do_trans_B) ? (K*M)     : 1 ];
+    arma_align_mem eT C_buf[ (N_pad != N) ? (N_pad*M) : 1 ];
+    
+    if(use_A_buf)
+      {
+      for(uword k=0; k < K; ++k)
+        {
+        eT* A_buf_k = &(A_buf[k*N_pad]);
+        
+        for(uword i=0; i < N; ++i)  { A_buf_k[i] = (do_trans_A) ? A_mem[k + i*K] : A_mem[i + k*N]; }
+        
+        for(uword i=N; i < N_pad; ++i)  { A_buf_k[i] = eT(0); }
+        }
+      }
+    
+    if(do_trans_B)
+      {
+      for(uword j=0; j < M; ++j)
+      for(uword k=0; k < K; ++k)
+        {
+        B_buf[k + j*K] = B_mem[j + k*M];
+        }
+      }
+    
+    const eT* A = (use_A_buf ) ? A_buf : A_mem;
+    const eT* B = (do_trans_B) ? B_buf : B_mem;
+          eT* C = (N_pad != N) ? C_buf : C_mem;
+    
+    for(uword j=0; j < M_main; j += 4)
+    for(uword i=0; i < N_pad;  i += 4)
+      {
+      block_4x4(&(C[i + j*N_pad]), &(A[i]), &(B[j*K]), alpha);
+      }
+    
+    for(uword j=M_main; j < M;     ++j   )
+    for(uword i=0;      i < N_pad; i += 4)
+      {
+      block_4x1(&(C[i + j*N_pad]), &(A[i]), &(B[j*K]), alpha);
+      }
+    
+    if(N_pad != N)
+      {
+      for(uword j=0; j < M; ++j)
+        {
+        arrayops::copy(&(C_mem[j*N]), &(C_buf[j*N_pad]), N);
+        }
+      }
+    }
+  };
+
+
+
+//! @}
@@ -37,6 +37,8 @@ class DenseGenMatProd
   inline DenseGenMatProd(const Mat<eT>& mat_obj);
 
   inline void perform_op(eT* x_in, eT* y_out) const;
+  
+  inline void perform_op_block(const Mat<eT>& X_in, Mat<eT>& Y_out) const;
   };
 
 
@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 The RcppArmadillo Authors
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+namespace newarp
+{
+
+
+//! Locally optimal block preconditioned conjugate gradient (LOBPCG) eigen solver for real symmetric matrices.
+//! Finds the nev smallest or largest algebraic eigenvalues via Rayleigh-Ritz on the span of [X W P],
+//! where X is the current block of Ritz vectors, W holds the preconditioned residuals of the unconverged Ritz vectors,
+//! and P holds the previous search directions.
+//! The matrix is only accessed through op.perform_op_block(X_in, Y_out), so that it is applied to whole blocks of vectors.
+//! The preconditioner approximates inv(A) and provides apply(eT* z, const eT* r) to evaluate z = inv(M)*r.
+template<typename eT, int SelectionRule, typename OpType, typename PrecType>
+class LOBPCGSolver
+  {
+  private:
+  
+  const OpType&     op;        // object to conduct matrix operation on blocks of vectors
+  const PrecType&   prec;      // preconditioner
+  const uword       nev;       // number of eigenvalues requested
+  const uword       dim_n;     // dimension of matrix A
+  const uword       bs;        // block size; nev plus guard vectors
+  const eT          sgn;       // +1 for smallest algebraic eigenvalues, -1 for largest;
+                               // the solver works on sgn*A and always seeks its smallest eigenvalues
+  uword             nmatop;    // number of matrix-vector products
+  uword             niter;     // number of iterations
+  Mat<eT>           X;         // Ritz vectors
+  Mat<eT>           AX;        // sgn*A*X, updated implicitly
+  Col<eT>           theta;     // Ritz values of sgn*A, in ascending order
+  Col<eT>           res_norm;  // residual norms of the Ritz pairs
+  std::vector<bool> ritz_conv; // indicator of the convergence of Ritz pairs
+  eT                a_norm;    // estimate of norm(A), from the largest Ritz value seen
+  const eT          eps;       // the machine precision
+  const eT          eps23;     // eps^(2/3), used in convergence test and for detecting linear dependence
+  
+  std::mt19937_64   local_rng; // local random number generator
+  
+  inline void fill_rand(eT* dest, const uword N, const uword seed_val);
+  
+  // Y = sgn*A*Z
+  inline void apply_op(Mat<eT>& Y, const Mat<eT>& Z);
+  
+  // Z = Z - Q*Q'*Z, and the same update for AZ
+  inline void project_out(Mat<eT>& Z, Mat<eT>* AZ, const Mat<eT>& Q, const Mat<eT>* AQ);
+  
+  // orthonormalise the columns of Z via eigendecomposition of Z'*Z, dropping nearly dependent columns;
+  // returns the number of remaining columns; out_ratio is the smallest to largest retained eigenvalue of Z'*Z
+  inline uword svqb(Mat<eT>& Z, Mat<eT>* AZ, eT& out_ratio);
+  
+  // orthonormalise Z against Q1 and Q2 and then internally; a second pass is done if cancellation is detected
+  inline uword orthonormalise(Mat<eT>& Z, Mat<eT>* AZ, const Mat<eT>& Q1, const Mat<eT>* AQ1, const Mat<eT>& Q2, const Mat<eT>* AQ2);
+  
+  // update the residuals R, their norms and the convergence indicators; returns the number of converged wanted Ritz pairs
+  inline uword num_converged(Mat<eT>& R, eT tol);
+  
+  // for small matrices, where the search space would be too large relative to the dimension
+  inline void compute_dense();
+  
+  
+  public:
+  
+  //! Constructor to create a solver object.
+  inline LOBPCGSolver(const OpType& op_, const PrecType& prec_, uword nev_, uword bs_);
+  
+  //! Providing the initial block; columns beyond X0.n_cols are filled with random values.
+  inline void init(const Mat<eT>& X0);
+  
+  //! Providing a random initial block.
+  inline void init();
+  
+  //! Conducting the major computation procedure.
+  inline uword compute(uword maxit = 1000, eT tol = 1e-10);
+  
+  //! Returning the number of iterations used in the computation.
+  inline uword num_iterations() { return niter; }
+  
+  //! Returning the number of matrix operations used in the computation.
+  inline uword num_operations() { return nmatop; }
+  
+  //! Returning the converged eigenvalues, in ascending algebraic order.
+  inline Col<eT> eigenvalues();
+  
+  //! Returning the eigenvectors associated with the converged eigenvalues.
+  inline Mat<eT> eigenvectors();
+  };
+
+
+}  // namespace newarp
@@ -0,0 +1,548 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 The RcppArmadillo Authors
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+namespace newarp
+{
+
+
+template<typename eT, int SelectionRule, typename OpType, typename PrecType>
+inline
+LOBPCGSolver<eT, SelectionRule, OpType, PrecType>::LOBPCGSolver(const OpType& op_, const PrecType& prec_, uword nev_, uword bs_)
+  : op(op_)
+  , prec(prec_)
+  , nev(nev_)
+  , dim_n(op.n_rows)
+  , bs( (std::min)( (std::max)(bs_, nev_), op.n_rows ) )
+  , sgn( (SelectionRule == EigsSelect::LARGEST_ALGE) ? eT(-1) : eT(+1) )
+  , nmatop(0)
+  , niter(0)
+  , a_norm(0)
+  , eps(std::numeric_limits<eT>::epsilon())
+  , eps23(std::pow(eps, eT(2.0) / 3))
+  {
+  arma_debug_sigprint();
+  
+  static_assert( ((SelectionRule == EigsSelect::LARGEST_ALGE) || (SelectionRule == EigsSelect::SMALLEST_ALGE)), "newarp::LOBPCGSolver: unsupported selection rule" );
+  
+  arma_conform_check( (nev_ < 1 || nev_ > dim_n - 1), "newarp::LOBPCGSolver: nev must satisfy 1 <= nev <= n - 1, n is the size of matrix" );
+  }
+
+
+
+template<typename eT, int SelectionRule, typename OpType, typename PrecType>
+inline
+void
+LOBPCGSolver<eT, SelectionRule, OpType, PrecType>::fill_rand(eT* dest, const uword N, const uword seed_val)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename std::mt19937_64::result_type seed_type;
+  
+  local_rng.seed( seed_type(seed_val) );
+  
+  std::uniform_real_distribution<double> dist(-1.0, +1.0);
+  
+  for(uword i=0; i < N; ++i)  { dest[i] = eT(dist(local_rng)); }
+  }
+
+
+
+template<typename eT, int SelectionRule, typename OpType, typename PrecType>
+inline
+void
+LOBPCGSolver<eT, SelectionRule, OpType, PrecType>::apply_op(Mat<eT>& Y, const Mat<eT>& Z)
+  {
+  arma_debug_sigprint();
+  
+  Y.set_size(dim_n, Z.n_cols);
+  
+  if(Z.n_cols == 0)  { return; }
+  
+  op.perform_op_block(Z, Y);
+  
+  if(sgn < eT(0))  { Y *= eT(-1); }
+  
+  nmatop += Z.n_cols;
+  }
+
+
+
+template<typename eT, int SelectionRule, typename OpType, typename PrecType>
+inline
+void
+LOBPCGSolver<eT, SelectionRule, OpType, PrecType>::project_out(Mat<eT>& Z, Mat<eT>* AZ, const Mat<eT>& Q, const Mat<eT>* AQ)
+  {
+  arma_debug_sigprint();
+  
+  if( (Z.n_cols == 0) || (Q.n_cols == 0) )  { return; }
+  
+  const Mat<eT> C = Q.t() * Z;
+  
+  Z -= Q * C;
+  
+  if( (AZ != nullptr) && (AQ != nullptr) )  { (*AZ) -= (*AQ) * C; }
+  }
+
+
+
+template<typename eT, int SelectionRule, typename OpType, typename PrecType>
+inline
+uword
+LOBPCGSolver<eT, SelectionRule, OpType, PrecType>::svqb(Mat<eT>& Z, Mat<eT>* AZ, eT& out_ratio)
+  {
+  arma_debug_sigprint();
+  
+  out_ratio = eT(0);
+  
+  const uword n_cols = Z.n_cols;
+  
+  if(n_cols == 0)  { return 0; }
+  
+  Mat<eT> G = Z.t() * Z;
+  
+  // scale to unit diagonal, so that the threshold below is relative to each column
+  
+  Col<eT> d_inv(n_cols, arma_nozeros_indicator());
+  
+  for(uword j=0; j < n_cols; ++j)
+    {
+    const eT d = G.at(j,j);
+    
+    d_inv[j] = (d > eT(0)) ? (eT(1) / std::sqrt(d)) : eT(0);
+    }
+  
+  G = diagmat(d_inv) * G * diagmat(d_inv);
+  
+  G = eT(0.5) * (G + G.t());
+  
+  Col<eT> lambda;
+  Mat<eT> V;
+  
+  const bool status = eig_sym(lambda, V, G);
+  
+  const eT lambda_max = (status && (lambda.n_elem > 0)) ? lambda[lambda.n_elem-1] : eT(0);
+  
+  const uvec keep = (lambda_max > eT(0)) ? uvec(find(lambda > (eps23 * lambda_max))) : uvec();
+  
+  if( (status == false) || (keep.n_elem == 0) )
+    {
+    Z.set_size(dim_n, 0);
+    
+    if(AZ != nullptr)  { AZ->set_size(dim_n, 0); }
+    
+    return 0;
+    }
+  
+  const Col<eT> lambda_keep = lambda.elem(keep);
+  
+  out_ratio = lambda_keep[0] / lambda_max;
+  
+  const Mat<eT> T = diagmat(d_inv) * V.cols(keep) * diagmat(eT(1) / sqrt(lambda_keep));
+  
+  Z = Z * T;
+  
+  if(AZ != nullptr)  { (*AZ) = (*AZ) * T; }
+  
+  return Z.n_cols;
+  }
+
+
+
+template<typename eT, int SelectionRule, typename OpType, typename PrecType>
+inline
+uword
+LOBPCGSolver<eT, SelectionRule, OpType, PrecType>::orthonormalise(Mat<eT>& Z, Mat<eT>* AZ, const Mat<eT>& Q1, const Mat<eT>* AQ1, const Mat<eT>& Q2, const Mat<eT>* AQ2)
+  {
+  arma_debug_sigprint();
+  
+  for(uword pass=0; pass < 2; ++pass)
+    {
+    if(Z.n_cols == 0)  { return 0; }
+    
+    const Row<eT> norm_before = sum(square(Z));
+    
+    project_out(Z, AZ, Q1, AQ1);
+    project_out(Z, AZ, Q2, AQ2);
+    
+    const Row<eT> norm_after = sum(square(Z));
+    
+    eT ratio = eT(0);
+    
+    if(svqb(Z, AZ, ratio) == 0)  { return 0; }
+    
+    // a second pass is only needed if the projection cancelled much of a column,
+    // or if the columns were far from orthogonal to each other
+    
+    const bool cancelled = any(norm_after < (eT(0.5) * norm_before));
+    
+    if( (cancelled == false) && (ratio > eT(0.01)) )  { break; }
+    }
+  
+  return Z.n_cols;
+  }
+
+
+
+template<typename eT, int SelectionRule, typename OpType, typename PrecType>
+inline
+uword
+LOBPCGSolver<eT, SelectionRule, OpType, PrecType>::num_converged(Mat<eT>& R, eT tol)
+  {
+  arma_debug_sigprint();
+  
+  // R = sgn*A*X - X*diag(theta)
+  
+  R = AX - (X.each_row() % theta.t());
+  
+  res_norm.set_size(bs);
+  
+  uword nconv = 0;
+  
+  for(uword j=0; j < bs; ++j)
+    {
+    res_norm[j] = norm(R.col(j));
+    
+    // residual relative to the eigenvalue, but no smaller than what can be resolved relative to norm(A)
+    const eT thresh = (std::max)( tol * std::abs(theta[j]), eps23 * a_norm );
+    
+    ritz_conv[j] = (res_norm[j] <= thresh);
+    
+    if( (j < nev) && ritz_conv[j] )  { ++nconv; }
+    }
+  
+  return nconv;
+  }
+
+
+
+template<typename eT, int SelectionRule, typename OpType, typename PrecType>
+inline
+void
+LOBPCGSolver<eT, SelectionRule, OpType, PrecType>::compute_dense()
+  {
+  arma_debug_sigprint();
+  
+  Mat<eT> A;
+  
+  apply_op(A, Mat<eT>(dim_n, dim_n, fill::eye));
+  
+  A = eT(0.5) * (A + A.t());
+  
+  Col<eT> lambda;
+  Mat<eT> V;
+  
+  const bool status = eig_sym(lambda, V, A);
+  
+  if(status == false)  { arma_stop_runtime_error("newarp::LOBPCGSolver::compute(): eigendecomposition failed"); }
+  
+  theta = lambda.head(bs);
+  X     = V.head_cols(bs);
+  
+  res_norm.zeros(bs);
+  ritz_conv.assign(bs, true);
+  
+  niter = 1;
+  }
+
+
+
+template<typename eT, int SelectionRule, typename OpType, typename PrecType>
+inline
+void
+LOBPCGSolver<eT, SelectionRule, OpType, PrecType>::init(const Mat<eT>& X0)
+  {
+  arma_debug_sigprint();
+  
+  X.set_size(dim_n, bs);
+  
+  const uword n_copy = (X0.n_rows == dim_n) ? (std::min)(X0.n_cols, bs) : uword(0);
+  
+  if(n_copy > 0)  { X.head_cols(n_copy) = X0.head_cols(n_copy); }
+  
+  if(n_copy < bs)  { fill_rand(X.colptr(n_copy), dim_n * (bs - n_copy), 0); }
+  
+  AX.reset();
+  theta.reset();
+  res_norm.reset();
+  ritz_conv.assign(bs, false);
+  
+  nmatop = 0;
+  niter  = 0;
+  a_norm = eT(0);
+  }
+
+
+
+template<typename eT, int SelectionRule, typename OpType, typename PrecType>
+inline
+void
+LOBPCGSolver<eT, SelectionRule, OpType, PrecType>::init()
+  {
+  arma_debug_sigprint();
+  
+  init(Mat<eT>());
+  }
+
+
+
+template<typename eT, int SelectionRule, typename OpType, typename PrecType>
+inline
+uword
+LOBPCGSolver<eT, SelectionRule, OpType, PrecType>::compute(uword maxit, eT tol)
+  {
+  arma_debug_sigprint();
+  
+  // the search space [X W P] has up to 3*bs columns;
+  // for small matrices a dense eigendecomposition is cheaper and more reliable
+  
+  if( (4 * bs) > dim_n )
+    {
+    compute_dense();
+    
+    return nev;
+    }
+  
+  // initial block: orthonormalise, replacing dependent columns (eg. from a rank deficient warm start) with random ones
+  
+  for(uword attempt=0; attempt < 3; ++attempt)
+    {
+    eT ratio = eT(0);
+    
+    const uword rank = svqb(X, nullptr, ratio);
+    
+    if(rank == bs)  { break; }
+    
+    Mat<eT> Z(dim_n, bs - rank, arma_nozeros_indicator());
+    
+    fill_rand(Z.memptr(), Z.n_elem, attempt + 1);
+    
+    project_out(Z, nullptr, X, nullptr);
+    
+    X = join_rows(X, Z);
+    }
+  
+  arma_check( (X.n_cols != bs), "newarp::LOBPCGSolver::compute(): unable to generate initial block" );
+  
+  apply_op(AX, X);
+  
+  // initial Rayleigh-Ritz
+  
+  Col<eT> lambda;
+  Mat<eT> C;
+  
+    {
+    Mat<eT> G = X.t() * AX;
+    
+    G = eT(0.5) * (G + G.t());
+    
+    const bool status = eig_sym(lambda, C, G);
+    
+    arma_check( (status == false), "newarp::LOBPCGSolver::compute(): eigendecomposition failed" );
+    
+    X     = X  * C;
+    AX    = AX * C;
+    theta = lambda;
+    
+    a_norm = max(abs(lambda));
+    }
+  
+  Mat<eT>  P;
+  Mat<eT> AP;
+  Mat<eT>  W;
+  Mat<eT> AW;
+  Mat<eT>  R;
+  
+  uword i, nconv = 0;
+  
+  for(i=0; i < maxit; ++i)
+    {
+    nconv = num_converged(R, tol);
+    
+    if(nconv >= nev)
+      {
+      // confirm convergence using an explicitly computed A*X, as AX is updated implicitly and may have drifted
+      
+      apply_op(AX, X);
+      
+      nconv = num_converged(R, tol);
+      
+      if(nconv >= nev)  { break; }
+      }
+    
+    // preconditioned residuals of the unconverged Ritz pairs (soft locking)
+    
+    uvec active(bs, arma_nozeros_indicator());
+    
+    uword n_active = 0;
+    
+    for(uword j=0; j < bs; ++j)  { if(ritz_conv[j] == false)  { active[n_active] = j; ++n_active; } }
+    
+    W.set_size(dim_n, n_active);
+    
+    if( (arma_config::openmp) && (mp_thread_limit::in_parallel() == false) && (n_active >= 2) && mp_gate<eT>::eval(W.n_elem) )
+      {
+      #if defined(ARMA_USE_OPENMP)
+        {
+        const int n_threads = (std::min)(mp_thread_limit::get(), int(n_active));
+        
+        #pragma omp parallel for schedule(static) num_threads(n_threads)
+        for(uword k=0; k < n_active; ++k)  { prec.apply(W.colptr(k), R.colptr(active[k])); }
+        }
+      #endif
+      }
+    else
+      {
+      for(uword k=0; k < n_active; ++k)  { prec.apply(W.colptr(k), R.colptr(active[k])); }
+      }
+    
+    // W orthonormal and orthogonal to X
+    
+    orthonormalise(W, nullptr, X, nullptr, Mat<eT>(), nullptr);
+    
+    apply_op(AW, W);
+    
+    // P orthonormal and orthogonal to X and W; A*P is updated implicitly
+    
+    orthonormalise(P, &AP, X, &AX, W, &AW);
+    
+    if( (W.n_cols == 0) && (P.n_cols == 0) )  { break; }  // stagnation
+    
+    // Rayleigh-Ritz on [X W P]; the basis is orthonormal, X'*A*X = diag(theta),
+    // and only the upper triangle of blocks of the symmetric projected matrix is formed
+    
+    const uword nw = W.n_cols;
+    const uword np = P.n_cols;
+    const uword ns = bs + nw + np;
+    
+    Mat<eT> G(ns, ns, arma_zeros_indicator());
+    
+    for(uword j=0; j < bs; ++j)  { G.at(j,j) = theta[j]; }
+    
+    if(nw > 0)
+      {
+      G.submat(0,  bs, bs-1,    bs+nw-1) = X.t() * AW;
+      G.submat(bs, bs, bs+nw-1, bs+nw-1) = W.t() * AW;
+      }
+    
+    if(np > 0)
+      {
+                    G.submat(0,     bs+nw, bs-1,    ns-1) = X.t() * AP;
+      if(nw > 0)  { G.submat(bs,    bs+nw, bs+nw-1, ns-1) = W.t() * AP; }
+                    G.submat(bs+nw, bs+nw, ns-1,    ns-1) = P.t() * AP;
+      }
+    
+    G = symmatu(G);
+    
+    G.submat(bs, bs, ns-1, ns-1) = eT(0.5) * (G.submat(bs, bs, ns-1, ns-1) + G.submat(bs, bs, ns-1, ns-1).t());
+    
+    const bool status = eig_sym(lambda, C, G);
+    
+    arma_check( (status == false), "newarp::LOBPCGSolver::compute(): eigendecomposition failed" );
+    
+    a_norm = (std::max)(a_norm, eT(max(abs(lambda))));
+    
+    // new search directions: the components of the new Ritz vectors outside the old ones
+    
+    const Mat<eT> C_X = C.submat(0, 0, bs-1, bs-1);
+    
+    Mat<eT>  P_new(dim_n, bs, arma_zeros_indicator());
+    Mat<eT> AP_new(dim_n, bs, arma_zeros_indicator());
+    
+    if(nw > 0)
+      {
+      const Mat<eT> C_W = C.submat(bs, 0, bs+nw-1, bs-1);
+      
+       P_new +=  W * C_W;
+      AP_new += AW * C_W;
+      }
+    
+    if(np > 0)
+      {
+      const Mat<eT> C_P = C.submat(bs+nw, 0, ns-1, bs-1);
+      
+       P_new +=  P * C_P;
+      AP_new += AP * C_P;
+      }
+    
+     P.steal_mem( P_new);
+    AP.steal_mem(AP_new);
+    
+     X =  X * C_X +  P;
+    AX = AX * C_X + AP;
+    
+    theta = lambda.head(bs);
+    }
+  
+  niter = i + 1;
+  
+  return (std::min)(nev, nconv);
+  }
+
+
+
+template<typename eT, int SelectionRule, typename OpType, typename PrecType>
+inline
+Col<eT>
+LOBPCGSolver<eT, SelectionRule, OpType, PrecType>::eigenvalues()
+  {
+  arma_debug_sigprint();
+  
+  uword nconv = std::count(ritz_conv.begin(), ritz_conv.begin() + nev, true);
+  
+  Col<eT> res(nconv, arma_zeros_indicator());
+  
+  uword j = 0;
+  
+  for(uword i=0; i < nev; ++i)
+    {
+    if(ritz_conv[i])  { res(j) = sgn * theta(i); j++; }
+    }
+  
+  // theta is in ascending order for sgn*A; restore ascending order for A
+  
+  if(sgn < eT(0))  { res = flipud(res); }
+  
+  return res;
+  }
+
+
+
+template<typename eT, int SelectionRule, typename OpType, typename PrecType>
+inline
+Mat<eT>
+LOBPCGSolver<eT, SelectionRule, OpType, PrecType>::eigenvectors()
+  {
+  arma_debug_sigprint();
+  
+  uword nconv = std::count(ritz_conv.begin(), ritz_conv.begin() + nev, true);
+  
+  Mat<eT> res(dim_n, nconv);
+  
+  uword j = 0;
+  
+  for(uword i=0; i < nev; ++i)
+    {
+    if(ritz_conv[i])  { res.col(j) = X.col(i); j++; }
+    }
+  
+  if(sgn < eT(0))  { res = fliplr(res); }
+  
+  return res;
+  }
+
+
+}  // namespace newarp
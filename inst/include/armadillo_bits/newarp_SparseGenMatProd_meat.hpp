@@ -53,10 +53,25 @@ SparseGenMatProd<eT>::perform_op(eT* x_in, eT* y_out) const
   
   // NEW METHOD
   
-  const Row<eT> x(x_in , n_cols, false, true);
-        Row<eT> y(y_out, n_rows, false, true);
+  // y = x * op_mat_st, evaluated directly on the given memory;
+  // the merge path partitioning keeps the work balanced across threads
+  // even when the nonzeros are concentrated in a few rows of op_mat
   
-  y =  x * op_mat_st;
+  dense_sparse_helper::dot_cols(y_out, x_in, op_mat_st);
+  }
+
+
+
+// Perform the matrix-matrix multiplication operation \f$Y=AX\f$.
+// Y_out = A * X_in
+template<typename eT>
+inline
+void
+SparseGenMatProd<eT>::perform_op_block(const Mat<eT>& X_in, Mat<eT>& Y_out) const
+  {
+  arma_debug_sigprint();
+  
+  Y_out = op_mat * X_in;
   }
 
 
@@ -0,0 +1,98 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 The RcppArmadillo Authors
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+namespace newarp
+{
+
+
+//! detect whether OpType provides perform_op(eT* x_in, eT* y_out) const
+template<typename OpType, typename eT>
+struct has_perform_op
+  {
+  template<typename X> static auto test(int) -> decltype( std::declval<const X&>().perform_op(std::declval<eT*>(), std::declval<eT*>()), char() );
+  template<typename X> static long test(...);
+  
+  static constexpr bool value = (sizeof(test<OpType>(0)) == sizeof(char));
+  };
+
+
+
+//! detect whether OpType provides perform_op_block(const Mat<eT>& X_in, Mat<eT>& Y_out) const
+template<typename OpType, typename eT>
+struct has_perform_op_block
+  {
+  template<typename X> static auto test(int) -> decltype( std::declval<const X&>().perform_op_block(std::declval<const Mat<eT>&>(), std::declval<Mat<eT>&>()), char() );
+  template<typename X> static long test(...);
+  
+  static constexpr bool value = (sizeof(test<OpType>(0)) == sizeof(char));
+  };
+
+
+
+//! Wrapper for a user-provided linear operator A of size n_rows x n_rows.
+//! The operator must provide the member n_rows and at least one of:
+//!   perform_op(eT* x_in, eT* y_out) const;                   // y_out = A * x_in, for vectors of length n_rows
+//!   perform_op_block(const Mat<eT>& X_in, Mat<eT>& Y_out) const;  // Y_out = A * X_in, for matrices with n_rows rows; Y_out is already sized
+//! The block form allows the operator to be applied to several vectors at once, eg. via BLAS-3 or sparse-dense products.
+//! Whichever form is missing is emulated via the other.
+template<typename eT, typename OpType>
+class UserOp
+  {
+  private:
+  
+  const OpType& op;
+  
+  
+  public:
+  
+  const uword n_rows;
+  const uword n_cols;
+  
+  inline UserOp(const OpType& in_op);
+  
+  inline void perform_op(eT* x_in, eT* y_out) const;
+  
+  inline void perform_op_block(const Mat<eT>& X_in, Mat<eT>& Y_out) const;
+  };
+
+
+
+//! Augmented operator [0 A; A' 0] of size (m+n) x (m+n), for a user-provided operator A of size m x n.
+//! The eigenvalues of the augmented operator are plus and minus the singular values of A.
+//! The operator must provide the members n_rows and n_cols, as well as:
+//!   perform_op      (eT* x_in, eT* y_out) const;  // y_out = A  * x_in, with x_in of length n_cols
+//!   perform_op_trans(eT* x_in, eT* y_out) const;  // y_out = A' * x_in, with x_in of length n_rows
+template<typename eT, typename OpType>
+class SVDAugmentedOp
+  {
+  private:
+  
+  const OpType& op;
+  
+  
+  public:
+  
+  const uword n_rows;
+  const uword n_cols;
+  
+  inline SVDAugmentedOp(const OpType& in_op);
+  
+  inline void perform_op(eT* x_in, eT* y_out) const;
+  };
+
+
+}  // namespace newarp
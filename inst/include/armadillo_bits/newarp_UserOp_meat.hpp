@@ -0,0 +1,134 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 The RcppArmadillo Authors
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+namespace newarp
+{
+
+
+template<typename eT, typename OpType>
+inline
+typename enable_if2< has_perform_op<OpType,eT>::value, void >::result
+user_op_single(const OpType& op, eT* x_in, eT* y_out, const uword)
+  {
+  op.perform_op(x_in, y_out);
+  }
+
+
+
+template<typename eT, typename OpType>
+inline
+typename enable_if2< (has_perform_op<OpType,eT>::value == false), void >::result
+user_op_single(const OpType& op, eT* x_in, eT* y_out, const uword n)
+  {
+  const Mat<eT> X(x_in,  n, 1, false, true);
+        Mat<eT> Y(y_out, n, 1, false, true);
+  
+  op.perform_op_block(X, Y);
+  }
+
+
+
+template<typename eT, typename OpType>
+inline
+typename enable_if2< has_perform_op_block<OpType,eT>::value, void >::result
+user_op_block(const OpType& op, const Mat<eT>& X_in, Mat<eT>& Y_out)
+  {
+  op.perform_op_block(X_in, Y_out);
+  }
+
+
+
+template<typename eT, typename OpType>
+inline
+typename enable_if2< (has_perform_op_block<OpType,eT>::value == false), void >::result
+user_op_block(const OpType& op, const Mat<eT>& X_in, Mat<eT>& Y_out)
+  {
+  for(uword col=0; col < X_in.n_cols; ++col)
+    {
+    op.perform_op(const_cast<eT*>(X_in.colptr(col)), Y_out.colptr(col));
+    }
+  }
+
+
+
+template<typename eT, typename OpType>
+inline
+UserOp<eT,OpType>::UserOp(const OpType& in_op)
+  : op    (in_op)
+  , n_rows(in_op.n_rows)
+  , n_cols(in_op.n_rows)
+  {
+  arma_debug_sigprint();
+  
+  static_assert( (has_perform_op<OpType,eT>::value || has_perform_op_block<OpType,eT>::value), "operator must provide perform_op() or perform_op_block()" );
+  }
+
+
+
+template<typename eT, typename OpType>
+inline
+void
+UserOp<eT,OpType>::perform_op(eT* x_in, eT* y_out) const
+  {
+  arma_debug_sigprint();
+  
+  user_op_single(op, x_in, y_out, n_rows);
+  }
+
+
+
+template<typename eT, typename OpType>
+inline
+void
+UserOp<eT,OpType>::perform_op_block(const Mat<eT>& X_in, Mat<eT>& Y_out) const
+  {
+  arma_debug_sigprint();
+  
+  Y_out.set_size(n_rows, X_in.n_cols);
+  
+  user_op_block(op, X_in, Y_out);
+  }
+
+
+
+template<typename eT, typename OpType>
+inline
+SVDAugmentedOp<eT,OpType>::SVDAugmentedOp(const OpType& in_op)
+  : op    (in_op)
+  , n_rows(in_op.n_rows + in_op.n_cols)
+  , n_cols(in_op.n_rows + in_op.n_cols)
+  {
+  arma_debug_sigprint();
+  }
+
+
+
+template<typename eT, typename OpType>
+inline
+void
+SVDAugmentedOp<eT,OpType>::perform_op(eT* x_in, eT* y_out) const
+  {
+  arma_debug_sigprint();
+  
+  const uword m = op.n_rows;
+  
+  op.perform_op      (x_in + m, y_out    );  // top:    A  * x_in[m:m+n-1]
+  op.perform_op_trans(x_in,     y_out + m);  // bottom: A' * x_in[0:m-1]
+  }
+
+
+}  // namespace newarp
@@ -22,6 +22,19 @@
 
 
 
+//! runs a 1D transform over each column, in parallel if possible;
+//! each thread uses its own scratch memory and zero-padding buffer
+struct op_fft_batch
+  {
+  template<typename scratch_eT, typename worker_type, typename out_eT, typename in_eT>
+  inline static void run(const worker_type& worker, out_eT* out_mem, const in_eT* X_mem, const uword X_n_rows, const uword n_cols, const uword N_orig, const uword N_user);
+  
+  template<typename scratch_eT, typename worker_type, typename out_eT, typename in_eT>
+  inline static void run_serial(const worker_type& worker, out_eT* out_mem, const in_eT* X_mem, const uword X_n_rows, const uword n_cols, const uword N_orig, const uword N_user);
+  };
+
+
+
 struct op_fft_real
   : public traits_op_passthru
   {
@@ -39,6 +52,12 @@ struct op_fft_cx
   
   template<typename eT, bool inverse>
   inline static void apply_noalias(Mat<eT>& out, const Mat<eT>& X, const uword a, const uword b);
+  
+  template<typename T>
+  inline static bool is_conj_sym(const Mat< std::complex<T> >& X, const uword N_user, const bool is_vec);
+  
+  template<typename T>
+  inline static void apply_noalias_c2r(Mat< std::complex<T> >& out, const Mat< std::complex<T> >& X, const uword N_user, const bool is_vec);
   };
 
 
@@ -52,4 +71,18 @@ struct op_ifft_cx
 
 
 
+//! transforms of cubes along a given dimension, and 3D transforms
+struct op_fft_cube
+  {
+  static constexpr uword block_size = 16;  //!< number of lines gathered at a time when transforming along dims 1 and 2
+  
+  template<bool inverse, typename in_eT>
+  inline static void apply_noalias(Cube< std::complex<typename get_pod_type<in_eT>::result> >& out, const Cube<in_eT>& X, const uword N, const uword dim);
+  
+  template<bool inverse, typename in_eT>
+  inline static void apply_fft3(Cube< std::complex<typename get_pod_type<in_eT>::result> >& out, const Cube<in_eT>& X, const uword N_rows, const uword N_cols, const uword N_slices);
+  };
+
+
+
 //! @}
@@ -17,27 +17,46 @@
 
 
 
+
 //! \addtogroup op_fft
 //! @{
 
 
-#if defined(ARMA_USE_FFTW3)
 
 template<typename cx_type, bool inverse>
 struct fft_engine_wrapper
   {
-  static constexpr uword threshold = 512;
+  typedef fft_engine_kissfft<cx_type,inverse> kissfft_type;
+  
+  std::shared_ptr<const kissfft_type> worker_kissfft;
+  
+  #if defined(ARMA_USE_FFTW3)
+    static constexpr uword threshold = 512;
+    
+    typedef fft_engine_fftw3<cx_type,inverse> fftw3_type;
+    
+    std::shared_ptr<const fftw3_type> worker_fftw3;
+  #endif
   
-  fft_engine_kissfft<cx_type,inverse>* worker_kissfft = nullptr;
-  fft_engine_fftw3  <cx_type,inverse>* worker_fftw3   = nullptr;
+  uword scratch_size = 0;
   
+  static
   inline
-  ~fft_engine_wrapper()
+  bool
+  use_fftw3(const uword N_samples, const uword N_exec)
     {
-    arma_debug_sigprint();
-    
-    if(worker_kissfft != nullptr)  { delete worker_kissfft; }
-    if(worker_fftw3   != nullptr)  { delete worker_fftw3;   }
+    #if defined(ARMA_USE_FFTW3)
+      {
+      return (is_cx_fp16<cx_type>::no) && (N_samples >= (threshold / N_exec));
+      }
+    #else
+      {
+      arma_ignore(N_samples);
+      arma_ignore(N_exec);
+      
+      return false;
+      }
+    #endif
     }
   
   inline
@@ -45,24 +64,204 @@ struct fft_engine_wrapper
     {
     arma_debug_sigprint();
     
-    const bool use_fftw3 = (is_cx_fp16<cx_type>::no) && (N_samples >= (threshold / N_exec));
+    #if defined(ARMA_USE_FFTW3)
+      {
+      if(fft_engine_wrapper::use_fftw3(N_samples, N_exec))
+        {
+        worker_fftw3 = fft_plan_cache<fftw3_type>::get_plan(N_samples);
+        scratch_size = (*worker_fftw3).scratch_size;
+        return;
+        }
+      }
+    #else
+      {
+      arma_ignore(N_exec);
+      }
+    #endif
     
-    worker_kissfft = (use_fftw3 == false) ? new fft_engine_kissfft<cx_type,inverse>(N_samples) : nullptr;
-    worker_fftw3   = (use_fftw3 == true ) ? new fft_engine_fftw3  <cx_type,inverse>(N_samples) : nullptr;
+    worker_kissfft = fft_plan_cache<kissfft_type>::get_plan(N_samples);
+    scratch_size   = (*worker_kissfft).scratch_size;
     }
   
   inline
   void
-  run(cx_type* Y, const cx_type* X)
+  run(cx_type* Y, const cx_type* X, cx_type* scratch) const
+    {
+    if(worker_kissfft)  { (*worker_kissfft).run(Y, X, scratch); return; }
+    
+    #if defined(ARMA_USE_FFTW3)
+      {
+      if(worker_fftw3)  { (*worker_fftw3).run(Y, X, scratch); }
+      }
+    #endif
+    }
+  };
+
+
+
+template<typename T>
+struct fft_engine_wrapper_r2c
+  {
+  typedef std::complex<T> cx_type;
+  
+  typedef fft_engine_kissfft_r2c<T> kissfft_type;
+  
+  std::shared_ptr<const kissfft_type> worker_kissfft;
+  
+  #if defined(ARMA_USE_FFTW3)
+    typedef fft_engine_fftw3<cx_type,false> fftw3_type;
+    
+    std::shared_ptr<const fftw3_type> worker_fftw3;
+  #endif
+  
+  uword N_offset     = 0;
+  uword scratch_size = 0;
+  
+  inline
+  fft_engine_wrapper_r2c(const uword N_samples, const uword N_exec)
     {
     arma_debug_sigprint();
     
-         if(worker_kissfft != nullptr)  { (*worker_kissfft).run(Y,X); }
-    else if(worker_fftw3   != nullptr)  {   (*worker_fftw3).run(Y,X); }
+    #if defined(ARMA_USE_FFTW3)
+      {
+      if(fft_engine_wrapper<cx_type,false>::use_fftw3(N_samples, N_exec))
+        {
+        // the real input is promoted to complex at the start of the scratch memory;
+        // the remainder is passed to FFTW3, keeping the alignment it requires
+        
+        const uword align_n_elem = fftw3_type::align_n_elem;
+        
+        worker_fftw3 = fft_plan_cache<fftw3_type>::get_plan(N_samples);
+        N_offset     = ((N_samples + align_n_elem - 1) / align_n_elem) * align_n_elem;
+        scratch_size = N_offset + (*worker_fftw3).scratch_size;
+        return;
+        }
+      }
+    #else
+      {
+      arma_ignore(N_exec);
+      }
+    #endif
+    
+    worker_kissfft = fft_plan_cache<kissfft_type>::get_plan(N_samples);
+    scratch_size   = (*worker_kissfft).scratch_size;
+    }
+  
+  inline
+  void
+  run(cx_type* Y, const T* X, cx_type* scratch) const
+    {
+    if(worker_kissfft)  { (*worker_kissfft).run(Y, X, scratch); return; }
+    
+    #if defined(ARMA_USE_FFTW3)
+      {
+      if(worker_fftw3)
+        {
+        const uword N = (*worker_fftw3).N;
+        
+        for(uword i=0; i < N; ++i)  { scratch[i] = cx_type(X[i], T(0)); }
+        
+        (*worker_fftw3).run(Y, scratch, scratch + N_offset);
+        }
+      }
+    #endif
     }
   };
 
-#endif
+
+
+//
+// op_fft_batch
+
+
+template<typename scratch_eT, typename worker_type, typename out_eT, typename in_eT>
+inline
+void
+op_fft_batch::run(const worker_type& worker, out_eT* out_mem, const in_eT* X_mem, const uword X_n_rows, const uword n_cols, const uword N_orig, const uword N_user)
+  {
+  arma_debug_sigprint();
+  
+  const bool use_mp = (arma_config::openmp) && (n_cols >= 2) && (mp_thread_limit::in_parallel() == false) && mp_gate<out_eT>::eval(N_user * n_cols);
+  
+  if(use_mp)
+    {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      arma_debug_print("op_fft_batch::run(): parallelised implementation");
+      
+      const bool  do_pad  = (N_user > N_orig);
+      const uword N_copy  = (std::min)(N_user, N_orig);
+      const uword N_pad   = (do_pad) ? N_user : uword(0);
+      
+      // keep the scratch block of each thread at a multiple of 16 elements, to maintain alignment
+      const uword N_scratch = ((worker.scratch_size + 15) / 16) * 16;
+      
+      const uword n_threads = uword( (std::min)( mp_thread_limit::get(), int((std::min)(n_cols, uword(INT_MAX))) ) );
+      
+      podarray<scratch_eT> scratch(N_scratch * n_threads, arma_nozeros_indicator());
+      podarray<in_eT>      pad    (N_pad     * n_threads, arma_zeros_indicator()  );
+      
+      scratch_eT* scratch_mem = scratch.memptr();
+      in_eT*      pad_mem     = pad.memptr();
+      
+      #pragma omp parallel for schedule(static) num_threads(int(n_threads))
+      for(uword col=0; col < n_cols; ++col)
+        {
+        const uword thread_id = uword(omp_get_thread_num());
+        
+        const in_eT* X_colmem = X_mem + (col * X_n_rows);
+        
+        if(do_pad)
+          {
+          in_eT* thread_pad_mem = pad_mem + (N_pad * thread_id);
+          
+          arrayops::copy(thread_pad_mem, X_colmem, N_copy);
+          
+          X_colmem = thread_pad_mem;
+          }
+        
+        worker.run( (out_mem + (col * N_user)), X_colmem, (scratch_mem + (N_scratch * thread_id)) );
+        }
+      }
+    #endif
+    }
+  else
+    {
+    op_fft_batch::run_serial<scratch_eT>(worker, out_mem, X_mem, X_n_rows, n_cols, N_orig, N_user);
+    }
+  }
+
+
+
+template<typename scratch_eT, typename worker_type, typename out_eT, typename in_eT>
+inline
+void
+op_fft_batch::run_serial(const worker_type& worker, out_eT* out_mem, const in_eT* X_mem, const uword X_n_rows, const uword n_cols, const uword N_orig, const uword N_user)
+  {
+  arma_debug_sigprint();
+  
+  const bool  do_pad  = (N_user > N_orig);
+  const uword N_copy  = (std::min)(N_user, N_orig);
+  const uword N_pad   = (do_pad) ? N_user : uword(0);
+  
+  podarray<scratch_eT> scratch(worker.scratch_size, arma_nozeros_indicator());
+  podarray<in_eT>      pad    (N_pad,               arma_zeros_indicator()  );
+  
+  for(uword col=0; col < n_cols; ++col)
+    {
+    const in_eT* X_colmem = X_mem + (col * X_n_rows);
+    
+    if(do_pad)
+      {
+      arrayops::copy(pad.memptr(), X_colmem, N_copy);
+      
+      X_colmem = pad.memptr();
+      }
+    
+    worker.run( (out_mem + (col * N_user)), X_colmem, scratch.memptr() );
+    }
+  }
+
 
 
 //
@@ -93,60 +292,29 @@ op_fft_real::apply( Mat< std::complex<typename T1::pod_type> >& out, const mtOp<
   const uword N_orig = (is_vec)              ? n_elem         : n_rows;
   const uword N_user = (in.aux_uword_b == 0) ? in.aux_uword_a : N_orig;
   
-  #if defined(ARMA_USE_FFTW3)
-    const uword N_exec = (is_vec) ? uword(1) : n_cols;
-    fft_engine_wrapper<out_eT,false> worker(N_user, N_exec);
-  #else
-    fft_engine_kissfft<out_eT,false> worker(N_user);
-  #endif
+  const uword N_exec = (is_vec) ? uword(1) : n_cols;
   
   if(is_vec)
     {
     (n_cols == 1) ? out.set_size(N_user, 1) : out.set_size(1, N_user);
-    
-    if( (out.n_elem == 0) || (N_orig == 0) )  { out.zeros(); return; }
-    
-    if( (N_user == 1) && (N_orig >= 1) )  { out[0] = out_eT( X[0] ); return; }
-    
-    podarray<out_eT> data(N_user, arma_zeros_indicator());
-    
-          out_eT* data_mem = data.memptr();
-    const  in_eT*    X_mem =    X.memptr();
-    
-    const uword N = (std::min)(N_user, N_orig);
-    
-    for(uword i=0; i < N; ++i)  { data_mem[i].real(X_mem[i]); }
-    
-    worker.run( out.memptr(), data_mem );
     }
   else
     {
-    // process each column separately
-    
     out.set_size(N_user, n_cols);
+    }
+  
+  if( (out.n_elem == 0) || (N_orig == 0) )  { out.zeros(); return; }
+  
+  if( (N_user == 1) && (N_orig >= 1) )
+    {
+    for(uword col=0; col < N_exec; ++col)  { out[col] = out_eT( X.at(0,col) ); }
     
-    if( (out.n_elem == 0) || (N_orig == 0) )  { out.zeros(); return; }
-    
-    if( (N_user == 1) && (N_orig >= 1) )
-      {
-      for(uword col=0; col < n_cols; ++col)  { out.at(0,col).real( X.at(0,col) ); }
-      
-      return;
-      }
-    
-    podarray<out_eT> data(N_user, arma_zeros_indicator());
-    
-    out_eT* data_mem = data.memptr();
-    
-    const uword N = (std::min)(N_user, N_orig);
-    
-    for(uword col=0; col < n_cols; ++col)
-      {
-      for(uword i=0; i < N; ++i)  { data_mem[i].real( X.at(i, col) ); }
-      
-      worker.run( out.colptr(col), data_mem );
-      }
+    return;
     }
+  
+  const fft_engine_wrapper_r2c<in_eT> worker(N_user, N_exec);
+  
+  op_fft_batch::run<out_eT>(worker, out.memptr(), X.memptr(), ((is_vec) ? n_elem : n_rows), N_exec, N_orig, N_user);
   }
 
 
@@ -198,79 +366,43 @@ op_fft_cx::apply_noalias(Mat<eT>& out, const Mat<eT>& X, const uword a, const uw
   const uword N_orig = (is_vec) ? n_elem : n_rows;
   const uword N_user = (b == 0) ? a      : N_orig;
   
-  #if defined(ARMA_USE_FFTW3)
-    const uword N_exec = (is_vec) ? uword(1) : n_cols;
-    fft_engine_wrapper<eT,inverse> worker(N_user, N_exec);
-  #else
-    fft_engine_kissfft<eT,inverse> worker(N_user);
-  #endif
+  const uword N_exec = (is_vec) ? uword(1) : n_cols;
   
-  if(is_vec)
+  if( (inverse) && (N_orig > 0) && (N_user >= 4) && ((N_user % 2) == 0) )
     {
-    (n_cols == 1) ? out.set_size(N_user, 1) : out.set_size(1, N_user);
+    const bool use_c2r = (fft_engine_wrapper<eT,inverse>::use_fftw3(N_user, N_exec) == false);
     
-    if( (out.n_elem == 0) || (N_orig == 0) )  { out.zeros(); return; }
-    
-    if( (N_user == 1) && (N_orig >= 1) )  { out[0] = X[0]; return; }
-    
-    if(N_user > N_orig)
+    if( use_c2r && op_fft_cx::is_conj_sym(X, N_user, is_vec) )
       {
-      podarray<eT> data(N_user);
-      
-      eT* data_mem = data.memptr();
+      arma_debug_print("op_fft_cx::apply_noalias(): conjugate symmetric input; using complex-to-real transform");
       
-      arrayops::fill_zeros( &data_mem[N_orig], (N_user - N_orig) );
+      op_fft_cx::apply_noalias_c2r(out, X, N_user, is_vec);
       
-      arrayops::copy(data_mem, X.memptr(), (std::min)(N_user, N_orig));
-      
-      worker.run( out.memptr(), data_mem );
-      }
-    else
-      {
-      worker.run( out.memptr(), X.memptr() );
+      return;
       }
     }
+  
+  if(is_vec)
+    {
+    (n_cols == 1) ? out.set_size(N_user, 1) : out.set_size(1, N_user);
+    }
   else
     {
-    // process each column separately
-    
     out.set_size(N_user, n_cols);
-    
-    if( (out.n_elem == 0) || (N_orig == 0) )  { out.zeros(); return; }
-    
-    if( (N_user == 1) && (N_orig >= 1) )
-      {
-      for(uword col=0; col < n_cols; ++col)  { out.at(0,col) = X.at(0,col); }
-      
-      return;
-      }
-    
-    if(N_user > N_orig)
-      {
-      podarray<eT> data(N_user);
-      
-      eT* data_mem = data.memptr();
-      
-      arrayops::fill_zeros( &data_mem[N_orig], (N_user - N_orig) );
-      
-      const uword N = (std::min)(N_user, N_orig);
-      
-      for(uword col=0; col < n_cols; ++col)
-        {
-        arrayops::copy(data_mem, X.colptr(col), N);
-        
-        worker.run( out.colptr(col), data_mem );
-        }
-      }
-    else
-      {
-      for(uword col=0; col < n_cols; ++col)
-        {
-        worker.run( out.colptr(col), X.colptr(col) );
-        }
-      }
     }
+  
+  if( (out.n_elem == 0) || (N_orig == 0) )  { out.zeros(); return; }
+  
+  if( (N_user == 1) && (N_orig >= 1) )
+    {
+    for(uword col=0; col < N_exec; ++col)  { out[col] = X.at(0,col); }
     
+    return;
+    }
+  
+  const fft_engine_wrapper<eT,inverse> worker(N_user, N_exec);
+  
+  op_fft_batch::run<eT>(worker, out.memptr(), X.memptr(), ((is_vec) ? n_elem : n_rows), N_exec, N_orig, N_user);
   
   // correct the scaling for the inverse transform
   if(inverse)
@@ -289,6 +421,82 @@ op_fft_cx::apply_noalias(Mat<eT>& out, const Mat<eT>& X, const uword a, const uw
 
 
 
+template<typename T>
+inline
+bool
+op_fft_cx::is_conj_sym(const Mat< std::complex<T> >& X, const uword N_user, const bool is_vec)
+  {
+  arma_debug_sigprint();
+  
+  typedef std::complex<T> eT;
+  
+  const uword N_orig = (is_vec) ? X.n_elem : X.n_rows;
+  const uword N_cols = (is_vec) ? uword(1) : X.n_cols;
+  const uword N_avail = (std::min)(N_user, N_orig);
+  
+  const uword N_half = N_user / 2;
+  
+  for(uword col=0; col < N_cols; ++col)
+    {
+    const eT* colmem = (is_vec) ? X.memptr() : X.colptr(col);
+    
+    if(colmem[0].imag() != T(0))  { return false; }
+    
+    for(uword k=1; k <= N_half; ++k)
+      {
+      const uword j = N_user - k;
+      
+      const eT val_k = (k < N_avail) ? colmem[k] : eT(0);
+      const eT val_j = (j < N_avail) ? colmem[j] : eT(0);
+      
+      if( (val_k.real() != val_j.real()) || (val_k.imag() != -(val_j.imag())) )  { return false; }
+      }
+    }
+  
+  return true;
+  }
+
+
+
+template<typename T>
+inline
+void
+op_fft_cx::apply_noalias_c2r(Mat< std::complex<T> >& out, const Mat< std::complex<T> >& X, const uword N_user, const bool is_vec)
+  {
+  arma_debug_sigprint();
+  
+  typedef std::complex<T> eT;
+  
+  const uword N_orig = (is_vec) ? X.n_elem : X.n_rows;
+  const uword N_cols = (is_vec) ? uword(1) : X.n_cols;
+  
+  if(is_vec)
+    {
+    (X.n_cols == 1) ? out.set_size(N_user, 1) : out.set_size(1, N_user);
+    }
+  else
+    {
+    out.set_size(N_user, N_cols);
+    }
+  
+  const std::shared_ptr< const fft_engine_kissfft_c2r<T> > worker = fft_plan_cache< fft_engine_kissfft_c2r<T> >::get_plan(N_user);
+  
+  Mat<T> result(N_user, N_cols, arma_nozeros_indicator());
+  
+  op_fft_batch::run<eT>( (*worker), result.memptr(), X.memptr(), ((is_vec) ? X.n_elem : X.n_rows), N_cols, N_orig, N_user );
+  
+  const T k = T(1) / T(N_user);
+  
+  const T* result_mem = result.memptr();
+        eT*   out_mem =    out.memptr();
+  
+  const uword out_n_elem = out.n_elem;
+  
+  for(uword i=0; i < out_n_elem; ++i)  { out_mem[i] = eT( (result_mem[i] * k), T(0) ); }
+  }
+
+
+
 //
 // op_ifft_cx
 
@@ -320,4 +528,195 @@ op_ifft_cx::apply(Mat<typename T1::elem_type>& out, const Op<T1,op_ifft_cx>& in)
   
 
 
+//
+// op_fft_cube
+
+
+template<bool inverse, typename in_eT>
+inline
+void
+op_fft_cube::apply_noalias(Cube< std::complex<typename get_pod_type<in_eT>::result> >& out, const Cube<in_eT>& X, const uword N, const uword dim)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename get_pod_type<in_eT>::result T;
+  typedef std::complex<T>                      out_eT;
+  
+  typedef typename std::conditional< is_cx<in_eT>::yes, fft_engine_wrapper<out_eT,inverse>, fft_engine_wrapper_r2c<T> >::type worker_type;
+  
+  const uword X_n_rows   = X.n_rows;
+  const uword X_n_cols   = X.n_cols;
+  const uword X_n_slices = X.n_slices;
+  
+  const uword L = (dim == 0) ? X_n_rows : ( (dim == 1) ? X_n_cols : X_n_slices );
+  
+  out.set_size( ((dim == 0) ? N : X_n_rows), ((dim == 1) ? N : X_n_cols), ((dim == 2) ? N : X_n_slices) );
+  
+  if(out.n_elem == 0)  { return; }
+  
+  if(L == 0)  { out.zeros(); return; }
+  
+  // each line to be transformed has L elements spaced P elements apart;
+  // lines are arranged in n_groups groups of P adjacent lines
+  
+  const uword P        = (dim == 0) ? uword(1)                : ( (dim == 1) ? X_n_rows   : (X_n_rows * X_n_cols) );
+  const uword n_groups = (dim == 0) ? (X_n_cols * X_n_slices) : ( (dim == 1) ? X_n_slices : uword(1)              );
+  
+  const worker_type worker(N, (P * n_groups));
+  
+  const in_eT*  X_mem =   X.memptr();
+        out_eT* out_mem = out.memptr();
+  
+  if(P == 1)
+    {
+    // lines are contiguous
+    op_fft_batch::run<out_eT>(worker, out_mem, X_mem, L, n_groups, L, N);
+    }
+  else
+    {
+    // cache-blocked transposition: gather a block of adjacent lines into contiguous memory,
+    // transform the lines, and scatter the results
+    
+    const uword B        = op_fft_cube::block_size;
+    const uword L_copy   = (std::min)(L, N);
+    const uword n_blocks = (P + B - 1) / B;
+    const uword n_items  = n_groups * n_blocks;
+    
+    const bool use_mp = (arma_config::openmp) && (n_items >= 2) && (mp_thread_limit::in_parallel() == false) && mp_gate<out_eT>::eval(out.n_elem);
+    
+    if(use_mp)
+      {
+      #if defined(ARMA_USE_OPENMP)
+        {
+        arma_debug_print("op_fft_cube::apply_noalias(): parallelised implementation");
+        
+        const uword n_threads = uword( (std::min)( mp_thread_limit::get(), int((std::min)(n_items, uword(INT_MAX))) ) );
+        
+        podarray<in_eT>  buf(L_copy * B * n_threads, arma_nozeros_indicator());
+        podarray<out_eT> res(N      * B * n_threads, arma_nozeros_indicator());
+        
+        in_eT*  buf_mem = buf.memptr();
+        out_eT* res_mem = res.memptr();
+        
+        #pragma omp parallel for schedule(static) num_threads(int(n_threads))
+        for(uword item=0; item < n_items; ++item)
+          {
+          const uword thread_id = uword(omp_get_thread_num());
+          
+          const uword group = item / n_blocks;
+          const uword p0    = (item % n_blocks) * B;
+          const uword nb    = (std::min)(B, (P - p0));
+          
+          in_eT*  thread_buf = buf_mem + (L_copy * B * thread_id);
+          out_eT* thread_res = res_mem + (N      * B * thread_id);
+          
+          const in_eT* src = X_mem + (group * P * L) + p0;
+          
+          for(uword l=0; l < L_copy; ++l)
+            {
+            for(uword j=0; j < nb; ++j)  { thread_buf[l + L_copy*j] = src[j]; }
+            
+            src += P;
+            }
+          
+          op_fft_batch::run_serial<out_eT>(worker, thread_res, thread_buf, L_copy, nb, L_copy, N);
+          
+          out_eT* dst = out_mem + (group * P * N) + p0;
+          
+          for(uword k=0; k < N; ++k)
+            {
+            for(uword j=0; j < nb; ++j)  { dst[j] = thread_res[k + N*j]; }
+            
+            dst += P;
+            }
+          }
+        }
+      #endif
+      }
+    else
+      {
+      arma_debug_print("op_fft_cube::apply_noalias(): serial implementation");
+      
+      podarray<in_eT>  buf(L_copy * B, arma_nozeros_indicator());
+      podarray<out_eT> res(N      * B, arma_nozeros_indicator());
+      
+      in_eT*  buf_mem = buf.memptr();
+      out_eT* res_mem = res.memptr();
+      
+      for(uword item=0; item < n_items; ++item)
+        {
+        const uword group = item / n_blocks;
+        const uword p0    = (item % n_blocks) * B;
+        const uword nb    = (std::min)(B, (P - p0));
+        
+        const in_eT* src = X_mem + (group * P * L) + p0;
+        
+        for(uword l=0; l < L_copy; ++l)
+          {
+          for(uword j=0; j < nb; ++j)  { buf_mem[l + L_copy*j] = src[j]; }
+          
+          src += P;
+          }
+        
+        op_fft_batch::run_serial<out_eT>(worker, res_mem, buf_mem, L_copy, nb, L_copy, N);
+        
+        out_eT* dst = out_mem + (group * P * N) + p0;
+        
+        for(uword k=0; k < N; ++k)
+          {
+          for(uword j=0; j < nb; ++j)  { dst[j] = res_mem[k + N*j]; }
+          
+          dst += P;
+          }
+        }
+      }
+    }
+  
+  // correct the scaling for the inverse transform
+  if(inverse)
+    {
+    const T k = T(1) / T(N);
+    
+    const uword out_n_elem = out.n_elem;
+    
+    for(uword i=0; i < out_n_elem; ++i)  { out_mem[i] *= k; }
+    }
+  }
+
+
+
+template<bool inverse, typename in_eT>
+inline
+void
+op_fft_cube::apply_fft3(Cube< std::complex<typename get_pod_type<in_eT>::result> >& out, const Cube<in_eT>& X, const uword N_rows, const uword N_cols, const uword N_slices)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename get_pod_type<in_eT>::result T;
+  typedef std::complex<T>                      out_eT;
+  
+  Cube<out_eT> tmp;
+  
+  op_fft_cube::apply_noalias<inverse>(tmp, X, N_rows, 0);
+  
+  // transforms of length 1 are the identity, so the corresponding passes can be omitted
+  
+  if( (N_cols == 1) && (tmp.n_cols == 1) )
+    {
+    out.steal_mem(tmp);
+    }
+  else
+    {
+    op_fft_cube::apply_noalias<inverse>(out, tmp, N_cols, 1);
+    }
+  
+  if( (N_slices == 1) && (out.n_slices == 1) )  { return; }
+  
+  op_fft_cube::apply_noalias<inverse>(tmp, out, N_slices, 2);
+  
+  out.steal_mem(tmp);
+  }
+
+
+
 //! @}
@@ -54,6 +54,12 @@ struct op_inv_gen_full
   
   template<typename eT>
   arma_cold inline static bool apply_tiny_3x3(Mat<eT>& X);
+  
+  template<typename eT>
+  inline static bool apply_fixed(Mat<eT>& X);
+  
+  template<typename eT, const uword N_pad>
+  inline static bool apply_fixed_pad(Mat<eT>& X);
   };
 
 
@@ -228,6 +228,18 @@ op_inv_gen_full::apply_direct(Mat<typename T1::elem_type>& out, const Base<typen
     return auxlib::inv_sym(out);
     }
   
+  if( (is_cx<eT>::no) && (is_Mat<T1>::value) && (N > 3) && (N <= batch_linalg::small_n) )
+    {
+    const unwrap<T1> U(expr.get_ref());
+    
+    if(U.M.mem_state == 3)
+      {
+      arma_debug_print("op_inv_gen_full: fixed size optimisation");
+      
+      return op_inv_gen_full::apply_fixed(out);
+      }
+    }
+  
   return auxlib::inv(out);
   }
 
@@ -318,6 +330,57 @@ op_inv_gen_full::apply_tiny_3x3(Mat<eT>& X)
 
 
 
+//! inverse of a fixed size matrix with up to 16 rows, avoiding the overhead of LAPACK;
+//! as with getrf() and getri(), fails only if the matrix is exactly singular
+template<typename eT>
+inline
+bool
+op_inv_gen_full::apply_fixed(Mat<eT>& X)
+  {
+  arma_debug_sigprint();
+  
+  const uword N = X.n_rows;
+  
+  if(N <=  4)  { return op_inv_gen_full::apply_fixed_pad<eT, 4>(X); }
+  if(N <=  8)  { return op_inv_gen_full::apply_fixed_pad<eT, 8>(X); }
+  if(N <= 12)  { return op_inv_gen_full::apply_fixed_pad<eT,12>(X); }
+  
+  return op_inv_gen_full::apply_fixed_pad<eT,16>(X);
+  }
+
+
+
+//! X is placed in the top left corner of an N_pad x N_pad matrix, with the identity matrix in the bottom right corner;
+//! the padding does not change the LU decomposition nor the inverse of X, but lets the compiler vectorise all loops
+template<typename eT, const uword N_pad>
+inline
+bool
+op_inv_gen_full::apply_fixed_pad(Mat<eT>& X)
+  {
+  arma_debug_sigprint();
+  
+  const uword N = X.n_rows;
+  
+  eT    LU[N_pad*N_pad];
+  eT    inv_LU[N_pad*N_pad];
+  uword piv[N_pad];
+  
+  for(uword i=0; i < N_pad*N_pad; ++i)  { LU[i] = eT(0); }
+  
+  for(uword c=0; c < N;     ++c)  { arrayops::copy(&(LU[c*N_pad]), X.colptr(c), N); }
+  for(uword i=N; i < N_pad; ++i)  { LU[i + i*N_pad] = eT(1); }
+  
+  if(batch_linalg::lu_small<eT,N_pad>(LU, piv, N_pad) == false)  { return false; }
+  
+  batch_linalg::lu_inv_small<eT,N_pad>(inv_LU, LU, piv, N_pad);
+  
+  for(uword c=0; c < N; ++c)  { arrayops::copy(X.colptr(c), &(inv_LU[c*N_pad]), N); }
+  
+  return true;
+  }
+
+
+
 template<typename T1>
 inline
 bool
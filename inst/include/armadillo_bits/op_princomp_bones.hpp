@@ -63,6 +63,43 @@ struct op_princomp
     const Base<typename T1::elem_type, T1>& X
     );
   
+  template<typename T1>
+  inline static bool
+  direct_princomp_rand
+    (
+           Mat<typename T1::elem_type>&     coeff_out,
+           Mat<typename T1::elem_type>&     score_out,
+           Col<typename T1::pod_type>&     latent_out,
+    const Base<typename T1::elem_type, T1>& X,
+    const uword                             k,
+    const svd_rand_opts&                    opts
+    );
+  
+  template<typename T1>
+  inline static bool
+  direct_princomp_rand
+    (
+             Mat<typename T1::elem_type>&     coeff_out,
+             Mat<typename T1::elem_type>&     score_out,
+             Col<typename T1::pod_type>&     latent_out,
+    const SpBase<typename T1::elem_type, T1>& X,
+    const uword                               k,
+    const svd_rand_opts&                      opts
+    );
+  
+  template<typename eT, typename op_type>
+  inline static bool
+  direct_princomp_rand_op
+    (
+           Mat<eT>&                                 coeff_out,
+           Mat<eT>&                                 score_out,
+           Col<typename get_pod_type<eT>::result>& latent_out,
+    const  op_type&                                 op,
+    const  Row<eT>&                                 mu,
+    const  uword                                    k,
+    const  svd_rand_opts&                           opts
+    );
+  
   template<typename T1>
   inline static void
   apply(Mat<typename T1::elem_type>& out, const Op<T1,op_princomp>& in);
@@ -293,6 +293,156 @@ op_princomp::direct_princomp
 
 
 
+//! \brief
+//! principal component analysis of the k leading components -- 3 arguments version
+//! computation is done via randomised singular value decomposition
+//! coeff_out    -> principal component coefficients
+//! score_out    -> projected samples
+//! latent_out   -> eigenvalues of principal vectors
+template<typename T1>
+inline
+bool
+op_princomp::direct_princomp_rand
+  (
+         Mat<typename T1::elem_type>&     coeff_out,
+         Mat<typename T1::elem_type>&     score_out,
+         Col<typename T1::pod_type>&      latent_out,
+  const Base<typename T1::elem_type, T1>& X,
+  const uword                             k,
+  const svd_rand_opts&                    opts
+  )
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const quasi_unwrap<T1> Y(X.get_ref());
+  
+  if(Y.is_alias(coeff_out) || Y.is_alias(score_out))
+    {
+    const Mat<eT> in_copy(Y.M);
+    
+    return op_princomp::direct_princomp_rand(coeff_out, score_out, latent_out, in_copy, k, opts);
+    }
+  
+  const Mat<eT>& in = Y.M;
+  
+  if(in.internal_has_nonfinite())  { return false; }
+  
+  const svd_rand_op_mat<eT> op(in);
+  
+  const Row<eT> mu = (in.n_rows > 0) ? Row<eT>(mean(in, 0)) : Row<eT>();
+  
+  return op_princomp::direct_princomp_rand_op(coeff_out, score_out, latent_out, op, mu, k, opts);
+  }
+
+
+
+//! \brief
+//! principal component analysis of the k leading components of a sparse matrix -- 3 arguments version
+//! computation is done via randomised singular value decomposition, with the mean subtracted implicitly
+//! so that the sparsity of the input is retained
+template<typename T1>
+inline
+bool
+op_princomp::direct_princomp_rand
+  (
+           Mat<typename T1::elem_type>&     coeff_out,
+           Mat<typename T1::elem_type>&     score_out,
+           Col<typename T1::pod_type>&      latent_out,
+  const SpBase<typename T1::elem_type, T1>& X,
+  const uword                               k,
+  const svd_rand_opts&                      opts
+  )
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const unwrap_spmat<T1> Y(X.get_ref());
+  
+  const SpMat<eT>& in = Y.M;
+  
+  if(arrayops::is_finite(in.values, in.n_nonzero) == false)  { return false; }
+  
+  const svd_rand_op_spmat<eT> op(in);
+  
+  const Row<eT> mu = (in.n_rows > 0) ? Row<eT>(Mat<eT>(mean(in, 0))) : Row<eT>();
+  
+  return op_princomp::direct_princomp_rand_op(coeff_out, score_out, latent_out, op, mu, k, opts);
+  }
+
+
+
+template<typename eT, typename op_type>
+inline
+bool
+op_princomp::direct_princomp_rand_op
+  (
+         Mat<eT>&                                 coeff_out,
+         Mat<eT>&                                 score_out,
+         Col<typename get_pod_type<eT>::result>& latent_out,
+  const  op_type&                                 op,
+  const  Row<eT>&                                 mu,
+  const  uword                                    k,
+  const  svd_rand_opts&                           opts
+  )
+  {
+  arma_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const uword n_rows = op.n_rows;
+  const uword n_cols = op.n_cols;
+  
+  // the centred matrix has rank at most n_rows-1
+  
+  const uword kk = (std::min)(k, n_cols);
+  
+  if(n_rows <= 1) // 0 or 1 samples
+    {
+    coeff_out.eye(n_cols, kk);
+    
+    score_out.zeros(n_rows, kk);
+    
+    latent_out.zeros(kk);
+    
+    return true;
+    }
+  
+  Mat<eT> U;
+  Col< T> s;
+  
+  const bool svd_ok = svd_rand_worker::apply(U, s, coeff_out, op, mu, kk, opts, true);
+  
+  if(svd_ok == false)  { return false; }
+  
+  // project the samples to the principals: (X - ones*mu) * coeff = U * diagmat(s)
+  
+  score_out = U;
+  
+  for(uword i=0; i < s.n_elem; ++i)  { score_out.col(i) *= s[i]; }
+  
+  // normalize the eigenvalues
+  s /= std::sqrt( double(n_rows - 1) );
+  
+  // compute the eigenvalues of the principal vectors
+  latent_out = s%s;
+  
+  if(s.n_elem < kk) // number of samples is less than the number of requested components
+    {
+    const uword n_extra = kk - s.n_elem;
+    
+    coeff_out  = join_rows(coeff_out,  Mat<eT>(n_cols, n_extra, arma_zeros_indicator()));
+    score_out  = join_rows(score_out,  Mat<eT>(n_rows, n_extra, arma_zeros_indicator()));
+    latent_out = join_cols(latent_out, Col< T>(n_extra, arma_zeros_indicator()));
+    }
+  
+  return true;
+  }
+
+
+
 template<typename T1>
 inline
 void
@@ -44,6 +44,15 @@ struct sp_auxlib
 
   template<typename eT>
   inline static bool eigs_sym_newarp(Col<eT>& eigval, Mat<eT>& eigvec, const SpMat<eT>& X, const uword n_eigvals, const eT sigma, const eigs_opts& opts);
+  
+  template<typename eT, typename OpType>
+  inline static bool eigs_sym_op(Col<eT>& eigval, Mat<eT>& eigvec, const OpType& op, const uword n_eigvals, const form_type form_val, const eigs_opts& opts);
+  
+  template<typename eT, typename OpType>
+  inline static bool eigs_sym_newarp_op(Col<eT>& eigval, Mat<eT>& eigvec, const OpType& op, const uword n_eigvals, const form_type form_val, const eigs_opts& opts);
+  
+  template<typename eT, typename OpType>
+  inline static bool eigs_sym_lobpcg(Col<eT>& eigval, Mat<eT>& eigvec, const OpType& op, const itsolve_precond<eT>& M, const uword n_eigvals, const form_type form_val, const eigs_opts& opts);
 
   template<typename eT, bool use_sigma>
   inline static bool eigs_sym_arpack(Col<eT>& eigval, Mat<eT>& eigvec, const SpMat<eT>& X, const uword n_eigvals, const form_type form_val, const eT sigma, const eigs_opts& opts);
@@ -60,6 +69,12 @@ struct sp_auxlib
   template<typename T>
   inline static bool eigs_gen_newarp(Col< std::complex<T> >& eigval, Mat< std::complex<T> >& eigvec, const SpMat<T>& X, const uword n_eigvals, const form_type form_val, const eigs_opts& opts);
   
+  template<typename T, typename OpType>
+  inline static bool eigs_gen_op(Col< std::complex<T> >& eigval, Mat< std::complex<T> >& eigvec, const OpType& op, const uword n_eigvals, const form_type form_val, const eigs_opts& opts);
+  
+  template<typename T, typename OpType>
+  inline static bool eigs_gen_newarp_op(Col< std::complex<T> >& eigval, Mat< std::complex<T> >& eigvec, const OpType& op, const uword n_eigvals, const form_type form_val, const eigs_opts& opts);
+  
   template<typename T, bool use_sigma>
   inline static bool eigs_gen_arpack(Col< std::complex<T> >& eigval, Mat< std::complex<T> >& eigvec, const SpMat<T>& X, const uword n_eigvals, const form_type form_val, const std::complex<T> sigma, const eigs_opts& opts);
   
@@ -84,6 +99,21 @@ struct sp_auxlib
   template<typename T1, typename T2>
   inline static bool spsolve_refine(Mat<typename T1::elem_type>& out, typename T1::pod_type& out_rcond, const SpBase<typename T1::elem_type, T1>& A, const Base<typename T1::elem_type, T2>& B, const superlu_opts& user_opts);
   
+  //
+  // spsolve() via built-in sparse LU, used when SuperLU is not enabled
+  
+  template<typename T1, typename T2>
+  inline static bool spsolve_builtin(Mat<typename T1::elem_type>& out, typename T1::pod_type& out_rcond, const SpBase<typename T1::elem_type, T1>& A, const Base<typename T1::elem_type, T2>& B, const superlu_opts& user_opts);
+  
+  //
+  // spsolve() via built-in sparse Cholesky; returns false if A does not appear to be symmetric/hermitian positive definite
+  
+  template<typename eT, typename T2>
+  inline static bool spsolve_chol(Mat<eT>& out, typename get_pod_type<eT>::result& out_rcond, const SpMat<eT>& A, const Base<eT, T2>& B, const superlu_opts& user_opts);
+  
+  template<typename eT, typename worker_type>
+  inline static void spsolve_builtin_refine(Mat<eT>& X, const worker_type& worker, const SpMat<eT>& A, const Mat<eT>& B);
+  
   //
   // support functions
   
@@ -244,10 +274,14 @@ struct superlu_worker
   
   superlu_stat_wrangler stat;
   
+  uword  n_rows        = 0;
+  double time_symbolic = 0.0;   // seconds spent on the column ordering and preordering
+  double time_numeric  = 0.0;   // seconds spent on the numeric factorisation, including the rcond estimate
+  
   inline ~superlu_worker();
   inline  superlu_worker();
   
-  inline bool factorise(typename get_pod_type<eT>::result& out_rcond, const SpMat<eT>& A, const superlu_opts& user_opts);
+  inline bool factorise(typename get_pod_type<eT>::result& out_rcond, const SpMat<eT>& A, const superlu_opts& user_opts, const bool reuse_ordering = false);
   
   inline bool solve(Mat<eT>& X, const Mat<eT>& B);
   
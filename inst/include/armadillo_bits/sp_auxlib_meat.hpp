@@ -173,6 +173,101 @@ sp_auxlib::eigs_sym_newarp(Col<eT>& eigval, Mat<eT>& eigvec, const SpMat<eT>& X,
     
     const newarp::SparseGenMatProd<eT> op(X);
     
+    if(opts.method == eigs_opts::METHOD_LOBPCG)
+      {
+      itsolve_precond<eT> M;
+      
+      M.n = X.n_rows;
+      
+      if(opts.precond != eigs_opts::PREC_NONE)
+        {
+        if(form_val == form_sa)
+          {
+          // for symmetric matrices, ILU(0) reduces to IC(0)
+          M.init(X, ((opts.precond == eigs_opts::PREC_ILU0) ? eigs_opts::PREC_IC0 : opts.precond));
+          }
+        else
+          {
+          arma_warn(1, "eigs_sym(): preconditioner is only used for form \"sa\"; ignoring preconditioner");
+          }
+        }
+      
+      return sp_auxlib::eigs_sym_lobpcg(eigval, eigvec, op, M, n_eigvals, form_val, opts);
+      }
+    
+    return sp_auxlib::eigs_sym_newarp_op(eigval, eigvec, op, n_eigvals, form_val, opts);
+    }
+  #else
+    {
+    arma_ignore(eigval);
+    arma_ignore(eigvec);
+    arma_ignore(X);
+    arma_ignore(n_eigvals);
+    arma_ignore(form_val);
+    arma_ignore(opts);
+    
+    return false;
+    }
+  #endif
+  }
+
+
+
+//! eigendecomposition of a symmetric real operator object; see newarp::UserOp for the requirements on the object
+template<typename eT, typename OpType>
+inline
+bool
+sp_auxlib::eigs_sym_op(Col<eT>& eigval, Mat<eT>& eigvec, const OpType& op, const uword n_eigvals, const form_type form_val, const eigs_opts& opts)
+  {
+  arma_debug_sigprint();
+  
+  #if defined(ARMA_USE_NEWARP)
+    {
+    const newarp::UserOp<eT,OpType> user_op(op);
+    
+    if(opts.method == eigs_opts::METHOD_LOBPCG)
+      {
+      if(opts.precond != eigs_opts::PREC_NONE)
+        {
+        arma_warn(1, "eigs_sym(): preconditioners are not applicable to operator objects; ignoring preconditioner");
+        }
+      
+      itsolve_precond<eT> M;
+      
+      M.n = user_op.n_rows;
+      
+      return sp_auxlib::eigs_sym_lobpcg(eigval, eigvec, user_op, M, n_eigvals, form_val, opts);
+      }
+    
+    return sp_auxlib::eigs_sym_newarp_op(eigval, eigvec, user_op, n_eigvals, form_val, opts);
+    }
+  #else
+    {
+    arma_ignore(eigval);
+    arma_ignore(eigvec);
+    arma_ignore(op);
+    arma_ignore(n_eigvals);
+    arma_ignore(form_val);
+    arma_ignore(opts);
+    
+    arma_stop_logic_error("eigs_sym(): use of NEWARP must be enabled for operator objects");
+    return false;
+    }
+  #endif
+  }
+
+
+
+//! eigs_sym() via NEWARP for an operator object providing n_rows and perform_op(x_in, y_out)
+template<typename eT, typename OpType>
+inline
+bool
+sp_auxlib::eigs_sym_newarp_op(Col<eT>& eigval, Mat<eT>& eigvec, const OpType& op, const uword n_eigvals, const form_type form_val, const eigs_opts& opts)
+  {
+  arma_debug_sigprint();
+  
+  #if defined(ARMA_USE_NEWARP)
+    {
     arma_conform_check( (n_eigvals >= op.n_rows), "eigs_sym(): n_eigvals must be less than the number of rows in the matrix" );
     
     // If the matrix is empty, the case is trivial.
@@ -231,7 +326,7 @@ sp_auxlib::eigs_sym_newarp(Col<eT>& eigval, Mat<eT>& eigvec, const SpMat<eT>& X,
       {
       if(form_val == form_lm)
         {
-        newarp::SymEigsSolver< eT, newarp::EigsSelect::LARGEST_MAGN, newarp::SparseGenMatProd<eT> > eigs(op, n_eigvals, ncv);
+        newarp::SymEigsSolver< eT, newarp::EigsSelect::LARGEST_MAGN, OpType > eigs(op, n_eigvals, ncv);
         eigs.init();
         nconv  = eigs.compute(maxiter, tol);
         eigval = eigs.eigenvalues();
@@ -240,7 +335,7 @@ sp_auxlib::eigs_sym_newarp(Col<eT>& eigval, Mat<eT>& eigvec, const SpMat<eT>& X,
       else
       if(form_val == form_sm)
         {
-        newarp::SymEigsSolver< eT, newarp::EigsSelect::SMALLEST_MAGN, newarp::SparseGenMatProd<eT> > eigs(op, n_eigvals, ncv);
+        newarp::SymEigsSolver< eT, newarp::EigsSelect::SMALLEST_MAGN, OpType > eigs(op, n_eigvals, ncv);
         eigs.init();
         nconv  = eigs.compute(maxiter, tol);
         eigval = eigs.eigenvalues();
@@ -249,7 +344,7 @@ sp_auxlib::eigs_sym_newarp(Col<eT>& eigval, Mat<eT>& eigvec, const SpMat<eT>& X,
       else
       if(form_val == form_la)
         {
-        newarp::SymEigsSolver< eT, newarp::EigsSelect::LARGEST_ALGE, newarp::SparseGenMatProd<eT> > eigs(op, n_eigvals, ncv);
+        newarp::SymEigsSolver< eT, newarp::EigsSelect::LARGEST_ALGE, OpType > eigs(op, n_eigvals, ncv);
         eigs.init();
         nconv  = eigs.compute(maxiter, tol);
         eigval = eigs.eigenvalues();
@@ -258,7 +353,7 @@ sp_auxlib::eigs_sym_newarp(Col<eT>& eigval, Mat<eT>& eigvec, const SpMat<eT>& X,
       else
       if(form_val == form_sa)
         {
-        newarp::SymEigsSolver< eT, newarp::EigsSelect::SMALLEST_ALGE, newarp::SparseGenMatProd<eT> > eigs(op, n_eigvals, ncv);
+        newarp::SymEigsSolver< eT, newarp::EigsSelect::SMALLEST_ALGE, OpType > eigs(op, n_eigvals, ncv);
         eigs.init();
         nconv  = eigs.compute(maxiter, tol);
         eigval = eigs.eigenvalues();
@@ -281,7 +376,122 @@ sp_auxlib::eigs_sym_newarp(Col<eT>& eigval, Mat<eT>& eigvec, const SpMat<eT>& X,
     {
     arma_ignore(eigval);
     arma_ignore(eigvec);
-    arma_ignore(X);
+    arma_ignore(op);
+    arma_ignore(n_eigvals);
+    arma_ignore(form_val);
+    arma_ignore(opts);
+    
+    return false;
+    }
+  #endif
+  }
+
+
+
+//! eigs_sym() via the LOBPCG block method; the operator must provide n_rows and perform_op_block(X_in, Y_out)
+template<typename eT, typename OpType>
+inline
+bool
+sp_auxlib::eigs_sym_lobpcg(Col<eT>& eigval, Mat<eT>& eigvec, const OpType& op, const itsolve_precond<eT>& M, const uword n_eigvals, const form_type form_val, const eigs_opts& opts)
+  {
+  arma_debug_sigprint();
+  
+  #if defined(ARMA_USE_NEWARP)
+    {
+    arma_conform_check( (n_eigvals >= op.n_rows), "eigs_sym(): n_eigvals must be less than the number of rows in the matrix" );
+    
+    if( (op.n_rows == 0) || (n_eigvals == 0) )
+      {
+      eigval.reset();
+      eigvec.reset();
+      return true;
+      }
+    
+    if( (form_val != form_la) && (form_val != form_sa) )
+      {
+      arma_warn(1, "eigs_sym(): LOBPCG only supports forms \"la\" and \"sa\"; using Lanczos instead");
+      
+      return sp_auxlib::eigs_sym_newarp_op(eigval, eigvec, op, n_eigvals, form_val, opts);
+      }
+    
+    if(arma_isnan(opts.tol))  { return false; }
+    
+    const eT tol = (std::max)(eT(opts.tol), std::numeric_limits<eT>::epsilon());
+    
+    const uword maxiter = uword(opts.maxiter);
+    
+    // a few guard vectors beyond n_eigvals speed up convergence of the last wanted eigenpairs
+    
+    uword blocksize = n_eigvals + (std::max)(uword(2), uword(n_eigvals/10));
+    
+    if(opts.blocksize != 0)
+      {
+      if(opts.blocksize < n_eigvals)
+        {
+        arma_warn(1, "eigs_sym(): opts.blocksize must be at least n_eigvals; using n_eigvals instead of ", opts.blocksize);
+        blocksize = n_eigvals;
+        }
+      else
+        {
+        blocksize = uword(opts.blocksize);
+        }
+      }
+    
+    Mat<eT> X0;
+    
+    if(opts.warm_start)
+      {
+      if(eigvec.n_rows == op.n_rows)
+        {
+        X0 = eigvec;
+        }
+      else
+        {
+        arma_warn(1, "eigs_sym(): number of rows in eigvec does not match the matrix; ignoring opts.warm_start");
+        }
+      }
+    
+    bool status = true;
+    
+    uword nconv = 0;
+    
+    try
+      {
+      if(form_val == form_sa)
+        {
+        newarp::LOBPCGSolver< eT, newarp::EigsSelect::SMALLEST_ALGE, OpType, itsolve_precond<eT> > eigs(op, M, n_eigvals, blocksize);
+        eigs.init(X0);
+        nconv  = eigs.compute(maxiter, tol);
+        eigval = eigs.eigenvalues();
+        eigvec = eigs.eigenvectors();
+        }
+      else
+        {
+        newarp::LOBPCGSolver< eT, newarp::EigsSelect::LARGEST_ALGE, OpType, itsolve_precond<eT> > eigs(op, M, n_eigvals, blocksize);
+        eigs.init(X0);
+        nconv  = eigs.compute(maxiter, tol);
+        eigval = eigs.eigenvalues();
+        eigvec = eigs.eigenvectors();
+        }
+      }
+    catch(const std::runtime_error&)
+      {
+      status = false;
+      }
+    
+    if(status == true)
+      {
+      if(nconv == 0)  { status = false; }
+      }
+    
+    return status;
+    }
+  #else
+    {
+    arma_ignore(eigval);
+    arma_ignore(eigvec);
+    arma_ignore(op);
+    arma_ignore(M);
     arma_ignore(n_eigvals);
     arma_ignore(form_val);
     arma_ignore(opts);
@@ -630,6 +840,65 @@ sp_auxlib::eigs_gen_newarp(Col< std::complex<T> >& eigval, Mat< std::complex<T>
     
     const newarp::SparseGenMatProd<T> op(X);
     
+    return sp_auxlib::eigs_gen_newarp_op(eigval, eigvec, op, n_eigvals, form_val, opts);
+    }
+  #else
+    {
+    arma_ignore(eigval);
+    arma_ignore(eigvec);
+    arma_ignore(X);
+    arma_ignore(n_eigvals);
+    arma_ignore(form_val);
+    arma_ignore(opts);
+    
+    return false;
+    }
+  #endif
+  }
+
+
+
+//! eigendecomposition of a real operator object; see newarp::UserOp for the requirements on the object
+template<typename T, typename OpType>
+inline
+bool
+sp_auxlib::eigs_gen_op(Col< std::complex<T> >& eigval, Mat< std::complex<T> >& eigvec, const OpType& op, const uword n_eigvals, const form_type form_val, const eigs_opts& opts)
+  {
+  arma_debug_sigprint();
+  
+  #if defined(ARMA_USE_NEWARP)
+    {
+    const newarp::UserOp<T,OpType> user_op(op);
+    
+    return sp_auxlib::eigs_gen_newarp_op(eigval, eigvec, user_op, n_eigvals, form_val, opts);
+    }
+  #else
+    {
+    arma_ignore(eigval);
+    arma_ignore(eigvec);
+    arma_ignore(op);
+    arma_ignore(n_eigvals);
+    arma_ignore(form_val);
+    arma_ignore(opts);
+    
+    arma_stop_logic_error("eigs_gen(): use of NEWARP must be enabled for operator objects");
+    return false;
+    }
+  #endif
+  }
+
+
+
+//! eigs_gen() via NEWARP for an operator object providing n_rows and perform_op(x_in, y_out)
+template<typename T, typename OpType>
+inline
+bool
+sp_auxlib::eigs_gen_newarp_op(Col< std::complex<T> >& eigval, Mat< std::complex<T> >& eigvec, const OpType& op, const uword n_eigvals, const form_type form_val, const eigs_opts& opts)
+  {
+  arma_debug_sigprint();
+  
+  #if defined(ARMA_USE_NEWARP)
+    {
     arma_conform_check( (n_eigvals + 1 >= op.n_rows), "eigs_gen(): n_eigvals + 1 must be less than the number of rows in the matrix" );
     
     // If the matrix is empty, the case is trivial.
@@ -688,7 +957,7 @@ sp_auxlib::eigs_gen_newarp(Col< std::complex<T> >& eigval, Mat< std::complex<T>
       {
       if(form_val == form_lm)
         {
-        newarp::GenEigsSolver< T, newarp::EigsSelect::LARGEST_MAGN, newarp::SparseGenMatProd<T> > eigs(op, n_eigvals, ncv);
+        newarp::GenEigsSolver< T, newarp::EigsSelect::LARGEST_MAGN, OpType > eigs(op, n_eigvals, ncv);
         eigs.init();
         nconv  = eigs.compute(maxiter, tol);
         eigval = eigs.eigenvalues();
@@ -697,7 +966,7 @@ sp_auxlib::eigs_gen_newarp(Col< std::complex<T> >& eigval, Mat< std::complex<T>
       else
       if(form_val == form_sm)
         {
-        newarp::GenEigsSolver< T, newarp::EigsSelect::SMALLEST_MAGN, newarp::SparseGenMatProd<T> > eigs(op, n_eigvals, ncv);
+        newarp::GenEigsSolver< T, newarp::EigsSelect::SMALLEST_MAGN, OpType > eigs(op, n_eigvals, ncv);
         eigs.init();
         nconv  = eigs.compute(maxiter, tol);
         eigval = eigs.eigenvalues();
@@ -706,7 +975,7 @@ sp_auxlib::eigs_gen_newarp(Col< std::complex<T> >& eigval, Mat< std::complex<T>
       else
       if(form_val == form_lr)
         {
-        newarp::GenEigsSolver< T, newarp::EigsSelect::LARGEST_REAL, newarp::SparseGenMatProd<T> > eigs(op, n_eigvals, ncv);
+        newarp::GenEigsSolver< T, newarp::EigsSelect::LARGEST_REAL, OpType > eigs(op, n_eigvals, ncv);
         eigs.init();
         nconv  = eigs.compute(maxiter, tol);
         eigval = eigs.eigenvalues();
@@ -715,7 +984,7 @@ sp_auxlib::eigs_gen_newarp(Col< std::complex<T> >& eigval, Mat< std::complex<T>
       else
       if(form_val == form_sr)
         {
-        newarp::GenEigsSolver< T, newarp::EigsSelect::SMALLEST_REAL, newarp::SparseGenMatProd<T> > eigs(op, n_eigvals, ncv);
+        newarp::GenEigsSolver< T, newarp::EigsSelect::SMALLEST_REAL, OpType > eigs(op, n_eigvals, ncv);
         eigs.init();
         nconv  = eigs.compute(maxiter, tol);
         eigval = eigs.eigenvalues();
@@ -724,7 +993,7 @@ sp_auxlib::eigs_gen_newarp(Col< std::complex<T> >& eigval, Mat< std::complex<T>
       else
       if(form_val == form_li)
         {
-        newarp::GenEigsSolver< T, newarp::EigsSelect::LARGEST_IMAG, newarp::SparseGenMatProd<T> > eigs(op, n_eigvals, ncv);
+        newarp::GenEigsSolver< T, newarp::EigsSelect::LARGEST_IMAG, OpType > eigs(op, n_eigvals, ncv);
         eigs.init();
         nconv  = eigs.compute(maxiter, tol);
         eigval = eigs.eigenvalues();
@@ -733,7 +1002,7 @@ sp_auxlib::eigs_gen_newarp(Col< std::complex<T> >& eigval, Mat< std::complex<T>
       else
       if(form_val == form_si)
         {
-        newarp::GenEigsSolver< T, newarp::EigsSelect::SMALLEST_IMAG, newarp::SparseGenMatProd<T> > eigs(op, n_eigvals, ncv);
+        newarp::GenEigsSolver< T, newarp::EigsSelect::SMALLEST_IMAG, OpType > eigs(op, n_eigvals, ncv);
         eigs.init();
         nconv  = eigs.compute(maxiter, tol);
         eigval = eigs.eigenvalues();
@@ -756,7 +1025,7 @@ sp_auxlib::eigs_gen_newarp(Col< std::complex<T> >& eigval, Mat< std::complex<T>
     {
     arma_ignore(eigval);
     arma_ignore(eigvec);
-    arma_ignore(X);
+    arma_ignore(op);
     arma_ignore(n_eigvals);
     arma_ignore(form_val);
     arma_ignore(opts);
@@ -1447,6 +1716,162 @@ sp_auxlib::spsolve_refine(Mat<typename T1::elem_type>& X, typename T1::pod_type&
 
 
 
+template<typename T1, typename T2>
+inline
+bool
+sp_auxlib::spsolve_builtin(Mat<typename T1::elem_type>& X, typename T1::pod_type& out_rcond, const SpBase<typename T1::elem_type, T1>& A_expr, const Base<typename T1::elem_type, T2>& B_expr, const superlu_opts& user_opts)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::pod_type   T;
+  typedef typename T1::elem_type eT;
+  
+  const unwrap_spmat<T1> tmp1(A_expr.get_ref());
+  const SpMat<eT>& A =   tmp1.M;
+  
+  const quasi_unwrap<T2> tmp2(B_expr.get_ref());
+  const Mat<eT>& B_unwrap = tmp2.M;
+  
+  const bool is_alias = tmp2.is_alias(X);
+  
+  Mat<eT> B_copy;  if(is_alias)  { B_copy = B_unwrap; }
+  
+  const Mat<eT>& B = (is_alias) ? B_copy : B_unwrap;
+  
+  if(A.is_square() == false)
+    {
+    X.soft_reset();
+    arma_stop_logic_error("spsolve(): solving under-determined / over-determined systems is currently not supported");
+    return false;
+    }
+  
+  arma_conform_check( (A.n_rows != B.n_rows), "spsolve(): number of rows in the given objects must be the same", [&](){ X.soft_reset(); } );
+  
+  if(A.is_empty() || B.is_empty())
+    {
+    X.zeros(A.n_cols, B.n_cols);
+    return true;
+    }
+  
+  if(A.n_nonzero == uword(0))  { X.soft_reset(); return false; }
+  
+  if(arma_config::check_nonfinite && (A.internal_has_nonfinite() || B.internal_has_nonfinite()))
+    {
+    arma_warn(3, "spsolve(): detected non-finite elements");
+    X.soft_reset();
+    return false;
+    }
+  
+  sp_lu_worker<eT> worker;
+  
+  T rcond = T(0);
+  
+  const bool status = worker.factorise(rcond, A, user_opts);
+  
+  out_rcond = rcond;
+  
+  if(status == false)  { X.soft_reset(); return false; }
+  
+  worker.solve(X, B);
+  
+  if(user_opts.refine != superlu_opts::REF_NONE)  { sp_auxlib::spsolve_builtin_refine(X, worker, A, B); }
+    
+  return true;
+  }
+
+
+
+template<typename eT, typename T2>
+inline
+bool
+sp_auxlib::spsolve_chol(Mat<eT>& X, typename get_pod_type<eT>::result& out_rcond, const SpMat<eT>& A, const Base<eT, T2>& B_expr, const superlu_opts& user_opts)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  if(user_opts.try_chol == false)  { return false; }
+  
+  if( (user_opts.likely_sympd == false) && (sym_helper::guess_sympd(A) == false) )  { return false; }
+  
+  arma_debug_print("spsolve(): attempting sparse Cholesky solver");
+  
+  const quasi_unwrap<T2> tmp2(B_expr.get_ref());
+  const Mat<eT>& B_unwrap = tmp2.M;
+  
+  const bool is_alias = tmp2.is_alias(X);
+      
+  Mat<eT> B_copy;  if(is_alias)  { B_copy = B_unwrap; }
+  
+  const Mat<eT>& B = (is_alias) ? B_copy : B_unwrap;
+  
+  if(A.is_square() == false)
+    {
+    X.soft_reset();
+    arma_stop_logic_error("spsolve(): solving under-determined / over-determined systems is currently not supported");
+    return false;
+    }
+  
+  arma_conform_check( (A.n_rows != B.n_rows), "spsolve(): number of rows in the given objects must be the same", [&](){ X.soft_reset(); } );
+  
+  if(A.is_empty() || B.is_empty())
+    {
+    X.zeros(A.n_cols, B.n_cols);
+    return true;
+    }
+  
+  if(A.n_nonzero == uword(0))  { return false; }
+  
+  sp_chol_worker<eT> worker;
+  
+  T rcond = T(0);
+  
+  const bool status = worker.factorise(rcond, A, user_opts);
+  
+  if(status == false)
+    {
+    arma_debug_print("spsolve(): sparse Cholesky solver failed; falling back to LU");
+    return false;
+    }
+  
+  out_rcond = rcond;
+  
+  worker.solve(X, B);
+  
+  if(user_opts.refine != superlu_opts::REF_NONE)  { sp_auxlib::spsolve_builtin_refine(X, worker, A, B); }
+  
+  return true;
+  }
+
+
+
+//! iterative refinement in working precision, for solutions obtained via sp_lu_worker or sp_chol_worker
+template<typename eT, typename worker_type>
+inline
+void
+sp_auxlib::spsolve_builtin_refine(Mat<eT>& X, const worker_type& worker, const SpMat<eT>& A, const Mat<eT>& B)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  Mat<eT> resid;
+  Mat<eT> delta;
+  
+  for(uword iter=0; iter < 3; ++iter)
+    {
+    resid = B - A*X;
+    
+    worker.solve(delta, resid);
+    
+    X += delta;
+    
+    if( norm(vectorise(delta), "inf") <= (std::numeric_limits<T>::epsilon() * norm(vectorise(X), "inf")) )  { break; }
+    }
+  }
+
+
+
 #if defined(ARMA_USE_SUPERLU)
   
   template<typename eT>
@@ -2667,7 +3092,7 @@ superlu_worker<eT>::superlu_worker()
 template<typename eT>
 inline
 bool
-superlu_worker<eT>::factorise(typename get_pod_type<eT>::result& out_rcond, const SpMat<eT>& A, const superlu_opts& user_opts)
+superlu_worker<eT>::factorise(typename get_pod_type<eT>::result& out_rcond, const SpMat<eT>& A, const superlu_opts& user_opts, const bool reuse_ordering)
   {
   arma_debug_sigprint();
   
@@ -2675,6 +3100,13 @@ superlu_worker<eT>::factorise(typename get_pod_type<eT>::result& out_rcond, cons
   
   factorisation_valid = false;
   
+  time_symbolic = 0.0;
+  time_numeric  = 0.0;
+  
+  const bool have_ordering = (reuse_ordering) && (A.n_rows == n_rows) && (perm_c.get_ptr() != nullptr);
+  
+  n_rows = A.n_rows;
+  
   if(l != nullptr)  { delete l; l = nullptr; }
   if(u != nullptr)  { delete u; u = nullptr; }
   
@@ -2704,8 +3136,11 @@ superlu_worker<eT>::factorise(typename get_pod_type<eT>::result& out_rcond, cons
     return false;
     }
   
-  (*this).perm_c.set_size(A.n_cols+1);  // paranoia: increase array length by 1
-  (*this).perm_r.set_size(A.n_rows+1);
+  if(have_ordering == false)
+    {
+    (*this).perm_c.set_size(A.n_cols+1);  // paranoia: increase array length by 1
+    (*this).perm_r.set_size(A.n_rows+1);
+    }
   
   superlu_array_wrangler<int> etree(A.n_cols+1);
   
@@ -2718,12 +3153,29 @@ superlu_worker<eT>::factorise(typename get_pod_type<eT>::result& out_rcond, cons
   superlu::int_t lwork = 0;
   superlu::int_t info  = 0;
   
-  arma_debug_print("superlu::superlu::get_permutation_c()");
-  superlu::get_permutation_c(options.ColPerm, AA.get_ptr(), perm_c.get_ptr());
+  wall_clock timer;
+  
+  timer.tic();
+  
+  if(have_ordering)
+    {
+    arma_debug_print("superlu_worker::factorise(): reusing column ordering");
+    
+    options.Fact = superlu::SamePattern;
+    }
+  else
+    {
+    arma_debug_print("superlu::superlu::get_permutation_c()");
+    superlu::get_permutation_c(options.ColPerm, AA.get_ptr(), perm_c.get_ptr());
+    }
   
   arma_debug_print("superlu::superlu::sp_preorder_mat()");
   superlu::sp_preorder_mat(&options, AA.get_ptr(), perm_c.get_ptr(), etree.get_ptr(), AAc.get_ptr());
   
+  time_symbolic = timer.toc();
+  
+  timer.tic();
+  
   arma_debug_print("superlu::gstrf()");
   superlu::gstrf<eT>(&options, AAc.get_ptr(), relax, panel_size, etree.get_ptr(), NULL, lwork, perm_c.get_ptr(), perm_r.get_ptr(), l_ref.get_ptr(), u_ref.get_ptr(), &Glu, stat.get_ptr(), &info);
   
@@ -2738,6 +3190,8 @@ superlu_worker<eT>::factorise(typename get_pod_type<eT>::result& out_rcond, cons
   
   out_rcond = AA_rcond;
   
+  time_numeric = timer.toc();
+  
   if(arma_isnan(AA_rcond))  { return false; }
   // if(AA_rcond == T(0))      { return false; }
   
@@ -2762,6 +3216,50 @@ superlu_worker<eT>::solve(Mat<eT>& X, const Mat<eT>& B)
   
   X = B;
   
+  const uword X_n_cols = X.n_cols;
+  
+  if( (arma_config::openmp) && (mp_thread_limit::in_parallel() == false) && (X_n_cols >= 2) && mp_gate<eT>::eval(X.n_elem) )
+    {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      arma_debug_print("superlu_worker::solve(): openmp implementation");
+      
+      // the columns of X are split into contiguous blocks;
+      // each block uses its own statistics structure, as gstrs() updates it
+      
+      const int   n_threads = (std::min)(mp_thread_limit::get(), int(X_n_cols));
+      const uword n_parts   = uword(n_threads);
+      
+      podarray<uword> part_status(n_parts);
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword part=0; part < n_parts; ++part)
+        {
+        const uword col_start = (X_n_cols * (part    )) / n_parts;
+        const uword col_end   = (X_n_cols * (part + 1)) / n_parts;
+        
+        Mat<eT> X_part(X.colptr(col_start), X.n_rows, (col_end - col_start), false, true);
+        
+        superlu_supermatrix_wrangler XX;
+        superlu_stat_wrangler        local_stat;
+        
+        const bool status_XX = sp_auxlib::wrap_to_supermatrix(XX.get_ref(), X_part);
+        
+        superlu::trans_t trans = superlu::NOTRANS;
+        int              info  = 0;
+        
+        if(status_XX)  { superlu::gstrs<eT>(trans, l_ref.get_ptr(), u_ref.get_ptr(), perm_c.get_ptr(), perm_r.get_ptr(), XX.get_ptr(), local_stat.get_ptr(), &info); }
+        
+        part_status[part] = (status_XX && (info == 0)) ? uword(1) : uword(0);
+        }
+      
+      for(uword part=0; part < n_parts; ++part)  { if(part_status[part] == uword(0))  { return false; } }
+      
+      return true;
+      }
+    #endif
+    }
+  
   superlu_supermatrix_wrangler XX;
   
   const bool status_XX = sp_auxlib::wrap_to_supermatrix(XX.get_ref(), X);
@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 The RcppArmadillo Authors
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup sp_chol
+//! @{
+
+
+//! built-in sparse Cholesky factorisation for symmetric/hermitian positive definite matrices,
+//! used by spsolve() and spsolve_factoriser.
+//! The factorisation is P*S*A*S*P' = L*L', where S is an optional diagonal scaling matrix
+//! and P is a fill-reducing permutation, postordered by the elimination tree.
+//! Columns of L with identical structure are grouped into supernodes, each stored as a dense block.
+//! The symbolic analysis is kept and reused when a matrix with the same nonzero pattern is factorised.
+template<typename eT>
+struct sp_chol_worker
+  {
+  typedef typename get_pod_type<eT>::result T;
+  
+  bool  symbolic_valid      = false;
+  bool  factorisation_valid = false;
+  uword n                   = 0;
+  
+  double time_symbolic = 0.0;   // seconds spent on the symbolic analysis; zero when the analysis is reused
+  double time_numeric  = 0.0;   // seconds spent on the numeric factorisation, including the rcond estimate
+  
+  podarray<uword> perm;         // column k of L corresponds to column perm[k] of A
+  bool            perm_natural = false;
+  
+  uword           n_super = 0;
+  podarray<uword> super_start;  // supernode s contains the columns super_start[s] to super_start[s+1]-1
+  podarray<uword> col_super;    // supernode containing each column
+  podarray<uword> Rp;           // row indices of supernode s are Ri[Rp[s]] to Ri[Rp[s+1]-1], in ascending order
+  podarray<uword> Ri;
+  podarray<uword> Xp;           // dense block of supernode s starts at Lx[Xp[s]], with Rp[s+1]-Rp[s] rows
+  podarray<eT>    Lx;
+  
+  podarray<uword> amap;         // position in Lx of each element of A; Lx.n_elem for elements in the upper triangle of P*A*P'
+  podarray<uword> pattern_col_ptrs;
+  podarray<uword> pattern_row_indices;
+  
+  bool        equilibrated = false;
+  podarray<T> S;                // symmetric scaling
+  
+  inline ~sp_chol_worker();
+  inline  sp_chol_worker();
+  
+  inline bool same_pattern(const SpMat<eT>& A, const superlu_opts& user_opts) const;
+  
+  inline void analyse(const SpMat<eT>& A, const superlu_opts& user_opts);
+  
+  inline bool factorise(T& out_rcond, const SpMat<eT>& A, const superlu_opts& user_opts);
+  
+  inline bool solve(Mat<eT>& X, const Mat<eT>& B) const;
+  
+  inline void solve_vec (eT* x, eT* work) const;  // x = inv(A) * x
+  inline void chol_solve(eT* x, eT* work) const;  // as solve_vec(), but for the scaled matrix
+  
+  inline T log_det() const;
+  
+  inline T rcond_est(const T norm_val) const;
+  
+  inline static void upper_pattern(podarray<uword>& Cp, podarray<uword>& Ci, const SpMat<eT>& A, const uword* pinv);
+  
+  inline static void etree(podarray<uword>& parent, const podarray<uword>& Cp, const podarray<uword>& Ci, const uword N);
+  
+  inline      sp_chol_worker(const sp_chol_worker&) = delete;
+  inline void operator=     (const sp_chol_worker&) = delete;
+  };
+
+
+
+//! @}
@@ -0,0 +1,855 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 The RcppArmadillo Authors
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup sp_chol
+//! @{
+
+
+
+template<typename eT>
+inline
+sp_chol_worker<eT>::~sp_chol_worker()
+  {
+  arma_debug_sigprint();
+  }
+
+
+
+template<typename eT>
+inline
+sp_chol_worker<eT>::sp_chol_worker()
+  {
+  arma_debug_sigprint();
+  }
+
+
+
+template<typename eT>
+inline
+bool
+sp_chol_worker<eT>::same_pattern(const SpMat<eT>& A, const superlu_opts& user_opts) const
+  {
+  arma_debug_sigprint();
+  
+  if(symbolic_valid == false)  { return false; }
+  
+  if( (A.n_rows != n) || (A.n_cols != n) )  { return false; }
+  
+  if(perm_natural != (user_opts.permutation == superlu_opts::NATURAL))  { return false; }
+  
+  if(A.n_nonzero != pattern_row_indices.n_elem)  { return false; }
+  
+  const bool same_col_ptrs    = std::equal(A.col_ptrs,    A.col_ptrs    + (n+1),         pattern_col_ptrs.memptr()   );
+  const bool same_row_indices = std::equal(A.row_indices, A.row_indices + A.n_nonzero, pattern_row_indices.memptr());
+  
+  return (same_col_ptrs && same_row_indices);
+  }
+
+
+
+//! symbolic analysis: fill-reducing ordering, elimination tree, column counts and supernodal structure of L
+template<typename eT>
+inline
+void
+sp_chol_worker<eT>::analyse(const SpMat<eT>& A, const superlu_opts& user_opts)
+  {
+  arma_debug_sigprint();
+  
+  symbolic_valid      = false;
+  factorisation_valid = false;
+  
+  n = A.n_rows;
+  
+  perm_natural = (user_opts.permutation == superlu_opts::NATURAL);
+  
+  podarray<uword> perm0;
+  
+  if(perm_natural)
+    {
+    perm0.set_size(n);
+    
+    for(uword i=0; i < n; ++i)  { perm0[i] = i; }
+    }
+  else
+    {
+    sp_ordering::amd(perm0, A);
+    }
+  
+  podarray<uword> pinv(n);
+  
+  for(uword k=0; k < n; ++k)  { pinv[ perm0[k] ] = k; }
+  
+  podarray<uword> Cp;
+  podarray<uword> Ci;
+  podarray<uword> parent;
+  
+  sp_chol_worker<eT>::upper_pattern(Cp, Ci, A, pinv.memptr());
+  sp_chol_worker<eT>::etree(parent, Cp, Ci, n);
+  
+  // postorder the elimination tree, so that the columns of each subtree (and hence each supernode) are contiguous
+  
+  podarray<uword> post;
+  
+  sp_ordering::postorder(post, parent, n);
+  
+  perm.set_size(n);
+  
+  for(uword k=0; k < n; ++k)  { perm[k] = perm0[ post[k] ]; }
+  for(uword k=0; k < n; ++k)  { pinv[ perm[k] ] = k;        }
+  
+  sp_chol_worker<eT>::upper_pattern(Cp, Ci, A, pinv.memptr());
+  sp_chol_worker<eT>::etree(parent, Cp, Ci, n);
+  
+  // column counts of L; the nonzeros in row k of L are found by walking up the elimination tree
+  // from each nonzero in column k of the upper triangle, stopping at already visited nodes
+  
+  const uword* Cp_mem     = Cp.memptr();
+  const uword* Ci_mem     = Ci.memptr();
+  const uword* parent_mem = parent.memptr();
+  
+  podarray<uword> colcount(n);
+  podarray<uword> mark(n);
+  
+  colcount.fill(uword(1));
+  mark.fill(n);
+  
+  for(uword k=0; k < n; ++k)
+    {
+    mark[k] = k;
+    
+    for(uword p = Cp_mem[k]; p < Cp_mem[k+1]; ++p)
+      {
+      uword i = Ci_mem[p];
+      
+      while(mark[i] != k)  { mark[i] = k;  ++colcount[i];  i = parent_mem[i]; }
+      }
+    }
+  
+  // fundamental supernodes: column j is merged with column j-1 if j is the only child of j-1 and L(:,j) has the structure of L(j:n,j-1)
+  
+  podarray<uword> n_child(n);
+  
+  n_child.zeros();
+  
+  for(uword j=0; j < n; ++j)  { if(parent_mem[j] != n)  { ++n_child[ parent_mem[j] ]; } }
+  
+  col_super.set_size(n);
+  
+  n_super = 0;
+  
+  for(uword j=0; j < n; ++j)
+    {
+    const bool merge = (j > 0) && (parent_mem[j-1] == j) && (colcount[j-1] == (colcount[j] + 1)) && (n_child[j] == 1);
+    
+    if(merge == false)  { ++n_super; }
+    
+    col_super[j] = n_super-1;
+    }
+  
+  super_start.set_size(n_super+1);
+  
+  for(uword jj=n; jj > 0; --jj)  { super_start[ col_super[jj-1] ] = jj-1; }
+  
+  super_start[n_super] = n;
+  
+  Rp.set_size(n_super+1);
+  Xp.set_size(n_super+1);
+  
+  Rp[0] = 0;
+  Xp[0] = 0;
+  
+  for(uword s=0; s < n_super; ++s)
+    {
+    const uword n_cols_s = super_start[s+1] - super_start[s];
+    const uword n_rows_s = colcount[ super_start[s] ];
+    
+    Rp[s+1] = Rp[s] + n_rows_s;
+    Xp[s+1] = Xp[s] + n_rows_s * n_cols_s;
+    }
+  
+  arma_debug_print("sp_chol_worker::analyse(): number of supernodes: ", n_super);
+  arma_debug_print("sp_chol_worker::analyse(): nnz(L) including supernodal padding: ", Xp[n_super]);
+  
+  // row structure of each supernode, in ascending order
+  
+  Ri.set_size(Rp[n_super]);
+  
+  podarray<uword> pos(n_super);
+  podarray<uword> last(n_super);
+  
+  arrayops::copy(pos.memptr(), Rp.memptr(), n_super);
+  
+  last.fill(n);
+  mark.fill(n);
+  
+  for(uword k=0; k < n; ++k)
+    {
+    mark[k] = k;
+    
+    const uword s_k = col_super[k];
+    
+    Ri[ pos[s_k]++ ] = k;  last[s_k] = k;
+    
+    for(uword p = Cp_mem[k]; p < Cp_mem[k+1]; ++p)
+      {
+      uword i = Ci_mem[p];
+      
+      while(mark[i] != k)
+        {
+        mark[i] = k;
+        
+        const uword s_i = col_super[i];
+        
+        if(last[s_i] != k)  { Ri[ pos[s_i]++ ] = k;  last[s_i] = k; }
+        
+        i = parent_mem[i];
+        }
+      }
+    }
+  
+  Lx.set_size(Xp[n_super]);
+  
+  // location of each element of A within the dense blocks; only the lower triangle of P*A*P' is used
+  
+  const uword* A_col_ptrs    = A.col_ptrs;
+  const uword* A_row_indices = A.row_indices;
+  
+  amap.set_size(A.n_nonzero);
+  
+  for(uword j=0; j < n; ++j)
+    {
+    const uword cj = pinv[j];
+    const uword s  = col_super[cj];
+    
+    const uword* Ri_start = Ri.memptr() + Rp[s  ];
+    const uword* Ri_end   = Ri.memptr() + Rp[s+1];
+    
+    const uword n_rows_s = Rp[s+1] - Rp[s];
+    const uword offset   = Xp[s] + (cj - super_start[s]) * n_rows_s;
+    
+    for(uword p = A_col_ptrs[j]; p < A_col_ptrs[j+1]; ++p)
+      {
+      const uword ci = pinv[ A_row_indices[p] ];
+      
+      if(ci < cj)  { amap[p] = Lx.n_elem; continue; }
+      
+      const uword* loc = std::lower_bound(Ri_start, Ri_end, ci);
+      
+      amap[p] = offset + uword(loc - Ri_start);
+      }
+    }
+  
+  pattern_col_ptrs.set_size(n+1);
+  pattern_row_indices.set_size(A.n_nonzero);
+  
+  arrayops::copy(pattern_col_ptrs.memptr(),    A_col_ptrs,    n+1        );
+  arrayops::copy(pattern_row_indices.memptr(), A_row_indices, A.n_nonzero);
+  
+  symbolic_valid = true;
+  }
+
+
+
+//! numeric factorisation via the left-looking supernodal method:
+//! each supernode is updated by its descendants via dense matrix multiplication,
+//! followed by a dense Cholesky factorisation of its diagonal block and a triangular solve for the remaining rows
+template<typename eT>
+inline
+bool
+sp_chol_worker<eT>::factorise(T& out_rcond, const SpMat<eT>& A, const superlu_opts& user_opts)
+  {
+  arma_debug_sigprint();
+  
+  factorisation_valid = false;
+  
+  out_rcond = T(0);
+  
+  time_symbolic = 0.0;
+  time_numeric  = 0.0;
+  
+  if(A.n_rows != A.n_cols)  { return false; }
+  
+  #if defined(ARMA_USE_LAPACK) && defined(ARMA_USE_BLAS)
+    {
+    wall_clock timer;
+    
+    if(same_pattern(A, user_opts))
+      {
+      arma_debug_print("sp_chol_worker::factorise(): reusing symbolic analysis");
+      }
+    else
+      {
+      timer.tic();
+      
+      analyse(A, user_opts);
+      
+      time_symbolic = timer.toc();
+      }
+    
+    timer.tic();
+    
+    const uword* A_col_ptrs    = A.col_ptrs;
+    const uword* A_row_indices = A.row_indices;
+    const eT*    A_values      = A.values;
+    
+    equilibrated = user_opts.equilibrate;
+    
+    if(equilibrated)
+      {
+      S.set_size(n);
+      S.zeros();
+      
+      for(uword j=0; j < n; ++j)
+      for(uword p = A_col_ptrs[j]; p < A_col_ptrs[j+1]; ++p)
+        {
+        if(A_row_indices[p] != j)  { continue; }
+        
+        const T A_jj_r = access::tmp_real(A_values[p]);
+        
+        if( (A_jj_r > T(0)) && arma_isfinite(A_jj_r) )  { S[j] = T(1) / std::sqrt(A_jj_r); }
+        }
+      
+      for(uword j=0; j < n; ++j)  { if(S[j] == T(0))  { return false; } }
+      }
+    
+    // scatter A into the dense blocks
+    
+    const uword Lx_n_elem = Lx.n_elem;
+    
+    eT* Lx_mem = Lx.memptr();
+    
+    arrayops::fill_zeros(Lx_mem, Lx_n_elem);
+    
+    for(uword j=0; j < n; ++j)
+    for(uword p = A_col_ptrs[j]; p < A_col_ptrs[j+1]; ++p)
+      {
+      const uword loc = amap[p];
+      
+      if(loc == Lx_n_elem)  { continue; }
+      
+      Lx_mem[loc] = (equilibrated) ? A_values[p] * (S[ A_row_indices[p] ] * S[j]) : A_values[p];
+      }
+    
+    //
+    
+    const uword* Ri_mem = Ri.memptr();
+    
+    const uword none = n_super;
+    
+    podarray<uword> head(n_super);   // head[s]: first supernode in the list of descendants with pending updates to supernode s
+    podarray<uword> next(n_super);
+    podarray<uword> lpos(n_super);   // lpos[d]: position in Ri of the first row of supernode d not yet used for updates
+    podarray<uword> relmap(n);
+    
+    head.fill(none);
+    
+    std::vector<eT> W;
+    
+    const char* trans = (is_cx<eT>::yes) ? "C" : "T";
+    
+    const eT alpha = eT(1);
+    const eT beta  = eT(0);
+    
+    for(uword s=0; s < n_super; ++s)
+      {
+      const uword f        = super_start[s];
+      const uword l        = super_start[s+1] - 1;
+      const uword n_cols_s = super_start[s+1] - f;
+      const uword n_rows_s = Rp[s+1] - Rp[s];
+      
+      eT* Ls = Lx_mem + Xp[s];
+      
+      for(uword p = Rp[s]; p < Rp[s+1]; ++p)  { relmap[ Ri_mem[p] ] = p - Rp[s]; }
+      
+      uword d = head[s];
+      
+      head[s] = none;
+      
+      while(d != none)
+        {
+        const uword next_d = next[d];
+        
+        const uword n_cols_d = super_start[d+1] - super_start[d];
+        const uword n_rows_d = Rp[d+1] - Rp[d];
+        
+        const uword p1 = lpos[d];
+        
+        uword p2 = p1;
+        
+        while( (p2 < Rp[d+1]) && (Ri_mem[p2] <= l) )  { ++p2; }
+        
+        const uword m  = Rp[d+1] - p1;   // rows of supernode d at or below column f
+        const uword nc = p2 - p1;        // rows of supernode d within columns f..l
+        
+        const eT* Ld = Lx_mem + Xp[d] + (p1 - Rp[d]);
+        
+        if( (m * nc * n_cols_d) <= uword(512) )
+          {
+          for(uword jj=0; jj < nc; ++jj)
+            {
+            eT* Ls_col = Ls + (Ri_mem[p1+jj] - f) * n_rows_s;
+            
+            for(uword kk=0; kk < n_cols_d; ++kk)
+              {
+              const eT* Ld_col = Ld + kk * n_rows_d;
+              
+              const eT val = eop_aux::conj(Ld_col[jj]);
+              
+              for(uword ii=jj; ii < m; ++ii)  { Ls_col[ relmap[ Ri_mem[p1+ii] ] ] -= Ld_col[ii] * val; }
+              }
+            }
+          }
+        else
+          {
+          // W = Ld(p1:end,:) * Ld(p1:p2-1,:)'
+          
+          if(W.size() < (m*nc))  { W.resize(m*nc); }
+          
+          const blas_int blas_m   = blas_int(m);
+          const blas_int blas_n   = blas_int(nc);
+          const blas_int blas_k   = blas_int(n_cols_d);
+          const blas_int blas_lda = blas_int(n_rows_d);
+          
+          arma_debug_print("blas::gemm()");
+          blas::gemm<eT>("N", trans, &blas_m, &blas_n, &blas_k, &alpha, Ld, &blas_lda, Ld, &blas_lda, &beta, W.data(), &blas_m);
+          
+          for(uword jj=0; jj < nc; ++jj)
+            {
+            eT* Ls_col = Ls + (Ri_mem[p1+jj] - f) * n_rows_s;
+            
+            const eT* W_col = W.data() + jj*m;
+            
+            for(uword ii=jj; ii < m; ++ii)  { Ls_col[ relmap[ Ri_mem[p1+ii] ] ] -= W_col[ii]; }
+            }
+          }
+        
+        lpos[d] = p2;
+        
+        if(p2 < Rp[d+1])
+          {
+          const uword t = col_super[ Ri_mem[p2] ];
+          
+          next[d] = head[t];
+          head[t] = d;
+          }
+        
+        d = next_d;
+        }
+      
+      // dense Cholesky factorisation of the diagonal block, followed by L21 = A21 * inv(L11')
+      
+      char     uplo = 'L';
+      blas_int n_s  = blas_int(n_cols_s);
+      blas_int ld_s = blas_int(n_rows_s);
+      blas_int info = 0;
+      
+      arma_debug_print("lapack::potrf()");
+      lapack::potrf<eT>(&uplo, &n_s, Ls, &ld_s, &info);
+      
+      if(info != 0)
+        {
+        arma_debug_print("sp_chol_worker::factorise(): matrix is not positive definite");
+        return false;
+        }
+      
+      if(n_rows_s > n_cols_s)
+        {
+        const blas_int m_s = blas_int(n_rows_s - n_cols_s);
+        
+        arma_debug_print("blas::trsm()");
+        blas::trsm<eT>("R", "L", trans, "N", &m_s, &n_s, &alpha, Ls, &ld_s, Ls + n_cols_s, &ld_s);
+        
+        lpos[s] = Rp[s] + n_cols_s;
+        
+        const uword t = col_super[ Ri_mem[ lpos[s] ] ];
+        
+        next[s] = head[t];
+        head[t] = s;
+        }
+      }
+    
+    factorisation_valid = true;
+    
+    // 1-norm of the factorised (scaled) matrix, for the rcond estimate
+    
+    T norm_val = T(0);
+    
+    for(uword j=0; j < n; ++j)
+      {
+      T acc = T(0);
+      
+      for(uword p = A_col_ptrs[j]; p < A_col_ptrs[j+1]; ++p)
+        {
+        acc += (equilibrated) ? std::abs(A_values[p]) * (S[ A_row_indices[p] ] * S[j]) : std::abs(A_values[p]);
+        }
+      
+      norm_val = (std::max)(norm_val, acc);
+      }
+    
+    out_rcond = rcond_est(norm_val);
+    
+    time_numeric = timer.toc();
+    
+    if(arma_isnan(out_rcond))  { factorisation_valid = false; return false; }
+    
+    return true;
+    }
+  #else
+    {
+    arma_ignore(user_opts);
+    
+    return false;
+    }
+  #endif
+  }
+
+
+
+template<typename eT>
+inline
+bool
+sp_chol_worker<eT>::solve(Mat<eT>& X, const Mat<eT>& B) const
+  {
+  arma_debug_sigprint();
+  
+  if(factorisation_valid == false)  { return false; }
+  
+  if(B.n_rows != n)  { return false; }
+  
+  X = B;
+  
+  const uword X_n_cols = X.n_cols;
+  
+  if( (arma_config::openmp) && (mp_thread_limit::in_parallel() == false) && (X_n_cols >= 2) && mp_gate<eT>::eval(X.n_elem) )
+    {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      arma_debug_print("sp_chol_worker::solve(): openmp implementation");
+      
+      // the columns of X are split into contiguous blocks, each solved with its own workspace
+      
+      const int   n_threads = (std::min)(mp_thread_limit::get(), int(X_n_cols));
+      const uword n_parts   = uword(n_threads);
+      
+      Mat<eT> work(n, n_parts, arma_nozeros_indicator());
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword part=0; part < n_parts; ++part)
+        {
+        const uword col_start = (X_n_cols * (part    )) / n_parts;
+        const uword col_end   = (X_n_cols * (part + 1)) / n_parts;
+        
+        for(uword col=col_start; col < col_end; ++col)  { solve_vec(X.colptr(col), work.colptr(part)); }
+        }
+      
+      return true;
+      }
+    #endif
+    }
+  
+  podarray<eT> work(n);
+  
+  for(uword col=0; col < X_n_cols; ++col)
+    {
+    solve_vec(X.colptr(col), work.memptr());
+    }
+  
+  return true;
+  }
+
+
+
+template<typename eT>
+inline
+void
+sp_chol_worker<eT>::solve_vec(eT* x, eT* work) const
+  {
+  if(equilibrated)  { for(uword i=0; i < n; ++i)  { x[i] *= S[i]; } }
+  
+  chol_solve(x, work);
+  
+  if(equilibrated)  { for(uword i=0; i < n; ++i)  { x[i] *= S[i]; } }
+  }
+
+
+
+template<typename eT>
+inline
+void
+sp_chol_worker<eT>::chol_solve(eT* x, eT* work) const
+  {
+  const uword* Ri_mem = Ri.memptr();
+  const eT*    Lx_mem = Lx.memptr();
+  
+  for(uword k=0; k < n; ++k)  { work[k] = x[ perm[k] ]; }
+  
+  // L is lower triangular
+  
+  for(uword s=0; s < n_super; ++s)
+    {
+    const uword  f        = super_start[s];
+    const uword  n_cols_s = super_start[s+1] - f;
+    const uword  n_rows_s = Rp[s+1] - Rp[s];
+    const uword* Ri_s     = Ri_mem + Rp[s];
+    const eT*    Ls       = Lx_mem + Xp[s];
+    
+    for(uword j=0; j < n_cols_s; ++j)
+      {
+      const eT* Ls_col = Ls + j*n_rows_s;
+      
+      work[f+j] /= Ls_col[j];
+      
+      const eT x_j = work[f+j];
+      
+      if(x_j == eT(0))  { continue; }
+      
+      for(uword i=j+1; i < n_rows_s; ++i)  { work[ Ri_s[i] ] -= Ls_col[i] * x_j; }
+      }
+    }
+  
+  // L' is upper triangular
+  
+  for(uword ss=n_super; ss > 0; --ss)
+    {
+    const uword  s        = ss-1;
+    const uword  f        = super_start[s];
+    const uword  n_cols_s = super_start[s+1] - f;
+    const uword  n_rows_s = Rp[s+1] - Rp[s];
+    const uword* Ri_s     = Ri_mem + Rp[s];
+    const eT*    Ls       = Lx_mem + Xp[s];
+    
+    for(uword jj=n_cols_s; jj > 0; --jj)
+      {
+      const uword j = jj-1;
+      
+      const eT* Ls_col = Ls + j*n_rows_s;
+      
+      eT acc = work[f+j];
+      
+      for(uword i=j+1; i < n_rows_s; ++i)  { acc -= eop_aux::conj(Ls_col[i]) * work[ Ri_s[i] ]; }
+      
+      work[f+j] = acc / Ls_col[j];   // diagonal of L is real
+      }
+    }
+  
+  for(uword k=0; k < n; ++k)  { x[ perm[k] ] = work[k]; }
+  }
+
+
+
+//! log determinant of A, obtained from the diagonal of L
+template<typename eT>
+inline
+typename get_pod_type<eT>::result
+sp_chol_worker<eT>::log_det() const
+  {
+  arma_debug_sigprint();
+  
+  T val = T(0);
+  
+  for(uword s=0; s < n_super; ++s)
+    {
+    const uword n_cols_s = super_start[s+1] - super_start[s];
+    const uword n_rows_s = Rp[s+1] - Rp[s];
+    const eT*   Ls       = Lx.memptr() + Xp[s];
+    
+    for(uword j=0; j < n_cols_s; ++j)  { val += std::log( access::tmp_real(Ls[j + j*n_rows_s]) ); }
+    }
+  
+  val *= T(2);
+  
+  if(equilibrated)  { for(uword i=0; i < n; ++i)  { val -= T(2) * std::log(S[i]); } }
+  
+  return val;
+  }
+
+
+
+//! estimate the reciprocal condition number in the 1-norm;
+//! as for sp_lu_worker::rcond_est(), but the matrix is hermitian, so only one type of solve is required
+template<typename eT>
+inline
+typename get_pod_type<eT>::result
+sp_chol_worker<eT>::rcond_est(const T norm_val) const
+  {
+  arma_debug_sigprint();
+  
+  if( (n == 0) || (norm_val <= T(0)) )  { return T(0); }
+  
+  podarray<eT> x(n);
+  podarray<eT> work(n);
+  
+  x.fill( eT(T(1) / T(n)) );
+  
+  T     est    = T(0);
+  uword j_prev = n;
+  
+  for(uword iter=0; iter < 5; ++iter)
+    {
+    chol_solve(x.memptr(), work.memptr());
+    
+    T est_new = T(0);
+    
+    for(uword i=0; i < n; ++i)  { est_new += std::abs(x[i]); }
+    
+    if( (iter > 0) && (est_new <= est) )  { break; }
+    
+    est = est_new;
+    
+    for(uword i=0; i < n; ++i)
+      {
+      const T abs_x_i = std::abs(x[i]);
+      
+      x[i] = (abs_x_i > T(0)) ? eT(x[i] / abs_x_i) : eT(1);
+      }
+    
+    chol_solve(x.memptr(), work.memptr());
+    
+    uword j     = 0;
+    T     max_z = T(-1);
+    
+    for(uword i=0; i < n; ++i)
+      {
+      const T abs_x_i = std::abs(x[i]);
+      
+      if(abs_x_i > max_z)  { max_z = abs_x_i; j = i; }
+      }
+    
+    if(j == j_prev)  { break; }
+    
+    j_prev = j;
+    
+    x.zeros();
+    
+    x[j] = eT(1);
+    }
+  
+  for(uword i=0; i < n; ++i)
+    {
+    const T val = T(1) + T(i) / T( (std::max)(uword(1), n-1) );
+    
+    x[i] = eT( (i % 2) == 0 ? val : -val );
+    }
+  
+  chol_solve(x.memptr(), work.memptr());
+  
+  T alt = T(0);
+  
+  for(uword i=0; i < n; ++i)  { alt += std::abs(x[i]); }
+  
+  alt = T(2) * alt / T(3 * n);
+  
+  est = (std::max)(est, alt);
+  
+  return (est > T(0)) ? (T(1) / (norm_val * est)) : T(0);
+  }
+
+
+
+//! nonzero pattern of the strictly upper triangle of P*(A+A')*P', where pinv is the inverse of P;
+//! duplicate entries are allowed
+template<typename eT>
+inline
+void
+sp_chol_worker<eT>::upper_pattern(podarray<uword>& Cp, podarray<uword>& Ci, const SpMat<eT>& A, const uword* pinv)
+  {
+  arma_debug_sigprint();
+  
+  const uword N = A.n_cols;
+  
+  const uword* A_col_ptrs    = A.col_ptrs;
+  const uword* A_row_indices = A.row_indices;
+  
+  Cp.set_size(N+1);
+  Cp.zeros();
+  
+  for(uword j=0; j < N; ++j)
+  for(uword p = A_col_ptrs[j]; p < A_col_ptrs[j+1]; ++p)
+    {
+    const uword i = A_row_indices[p];
+    
+    if(i == j)  { continue; }
+    
+    ++Cp[ (std::max)(pinv[i], pinv[j]) + 1 ];
+    }
+  
+  for(uword j=0; j < N; ++j)  { Cp[j+1] += Cp[j]; }
+  
+  Ci.set_size(Cp[N]);
+  
+  podarray<uword> w(N);
+  
+  arrayops::copy(w.memptr(), Cp.memptr(), N);
+  
+  for(uword j=0; j < N; ++j)
+  for(uword p = A_col_ptrs[j]; p < A_col_ptrs[j+1]; ++p)
+    {
+    const uword i = A_row_indices[p];
+    
+    if(i == j)  { continue; }
+    
+    const uword ci = pinv[i];
+    const uword cj = pinv[j];
+    
+    Ci[ w[(std::max)(ci,cj)]++ ] = (std::min)(ci,cj);
+    }
+  }
+
+
+
+//! elimination tree of a symmetric matrix, given the pattern of its strictly upper triangle;
+//! roots have parent N
+template<typename eT>
+inline
+void
+sp_chol_worker<eT>::etree(podarray<uword>& parent, const podarray<uword>& Cp, const podarray<uword>& Ci, const uword N)
+  {
+  arma_debug_sigprint();
+  
+  parent.set_size(N);
+  
+  podarray<uword> ancestor(N);
+  
+  for(uword k=0; k < N; ++k)
+    {
+    parent[k]   = N;
+    ancestor[k] = N;
+    
+    for(uword p = Cp[k]; p < Cp[k+1]; ++p)
+      {
+      uword i = Ci[p];
+      
+      // traverse from i to the root, with path compression via ancestor
+      
+      while( (i != N) && (i < k) )
+        {
+        const uword i_next = ancestor[i];
+        
+        ancestor[i] = k;
+        
+        if(i_next == N)  { parent[i] = k; }
+        
+        i = i_next;
+        }
+      }
+    }
+  }
+
+
+
+//! @}
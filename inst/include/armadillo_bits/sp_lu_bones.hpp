@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 The RcppArmadillo Authors
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup sp_lu
+//! @{
+
+
+//! built-in sparse LU factorisation (left-looking, with threshold partial pivoting),
+//! used by spsolve() and spsolve_factoriser when SuperLU is not enabled.
+//! The factorisation is P*R*A*C*Q = L*U, where R and C are optional diagonal equilibration matrices,
+//! Q is a fill-reducing column permutation and P is the row permutation chosen during pivoting.
+template<typename eT>
+struct sp_lu_worker
+  {
+  typedef typename get_pod_type<eT>::result T;
+  
+  bool  factorisation_valid = false;
+  uword n                   = 0;
+  
+  double time_symbolic = 0.0;   // seconds spent on the column ordering
+  double time_numeric  = 0.0;   // seconds spent on the numeric factorisation, including the rcond estimate
+  
+  podarray<uword> q;      // column permutation: column k of L*U is column q[k] of A
+  podarray<uword> pinv;   // row permutation: row i of A is row pinv[i] of L*U
+  
+  bool        equilibrated = false;
+  podarray<T> R;          // row scaling
+  podarray<T> C;          // column scaling
+  
+  podarray<uword>    Lp;  // L is unit lower triangular; only the entries below the diagonal are stored
+  std::vector<uword> Li;
+  std::vector<eT>    Lx;
+  
+  podarray<uword>    Up;  // U is upper triangular; the entries above the diagonal are stored here,
+  std::vector<uword> Ui;  // and the diagonal is stored in Ud
+  std::vector<eT>    Ux;
+  podarray<eT>       Ud;
+  
+  inline ~sp_lu_worker();
+  inline  sp_lu_worker();
+  
+  inline bool factorise(T& out_rcond, const SpMat<eT>& A, const superlu_opts& user_opts, const bool reuse_ordering = false);
+  
+  inline bool solve(Mat<eT>& X, const Mat<eT>& B) const;
+  
+  inline void solve_vec      (eT* x, eT* work) const;  // x = inv(A) * x
+  inline void solve_trans_vec(eT* x, eT* work) const;  // x = inv(A') * x, where A' is the conjugate transpose
+  
+  inline void lu_solve      (eT* x, eT* work) const;   // as solve_vec(), but for the equilibrated matrix
+  inline void lu_solve_trans(eT* x, eT* work) const;   // as solve_trans_vec(), but for the equilibrated matrix
+  
+  inline bool log_det(eT& out_val, T& out_sign) const;
+  
+  inline T rcond_est(const T norm_val) const;
+  
+  inline static void equilibrate(podarray<T>& R, podarray<T>& C, const SpMat<eT>& A);
+  
+  inline static bool is_odd_perm(const podarray<uword>& p);
+  
+  inline      sp_lu_worker(const sp_lu_worker&) = delete;
+  inline void operator=   (const sp_lu_worker&) = delete;
+  };
+
+
+
+//! @}
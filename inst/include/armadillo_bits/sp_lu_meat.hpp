@@ -0,0 +1,669 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 The RcppArmadillo Authors
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup sp_lu
+//! @{
+
+
+
+template<typename eT>
+inline
+sp_lu_worker<eT>::~sp_lu_worker()
+  {
+  arma_debug_sigprint();
+  }
+
+
+
+template<typename eT>
+inline
+sp_lu_worker<eT>::sp_lu_worker()
+  {
+  arma_debug_sigprint();
+  }
+
+
+
+//! left-looking LU factorisation with threshold partial pivoting.
+//! Column k of L and U is obtained by applying the already computed columns of L to A(:,q[k]).
+//! The columns of L that need to be applied are found while the column is being updated:
+//! pivotal rows are placed in a min-heap keyed by their pivot step, so that the updates are applied
+//! in increasing step order, and new pivotal rows filled in by an update are added to the heap.
+//! As L(:,J) only has entries in rows pivoted after step J, each update only adds steps larger than the current one.
+template<typename eT>
+inline
+bool
+sp_lu_worker<eT>::factorise(T& out_rcond, const SpMat<eT>& A, const superlu_opts& user_opts, const bool reuse_ordering)
+  {
+  arma_debug_sigprint();
+  
+  factorisation_valid = false;
+  
+  out_rcond = T(0);
+  
+  time_symbolic = 0.0;
+  time_numeric  = 0.0;
+  
+  if(A.n_rows != A.n_cols)  { return false; }
+  
+  wall_clock timer;
+  
+  timer.tic();
+  
+  const bool have_ordering = (reuse_ordering) && (A.n_rows == n) && (q.n_elem == n);
+  
+  n = A.n_rows;
+  
+  // fill-reducing column ordering;
+  // matrices with a symmetric nonzero pattern are ordered via A+A', which generally gives less fill than A'*A
+  
+  if(have_ordering)
+    {
+    arma_debug_print("sp_lu_worker::factorise(): reusing column ordering");
+    }
+  else
+  if(user_opts.permutation == superlu_opts::NATURAL)
+    {
+    q.set_size(n);
+    
+    for(uword i=0; i < n; ++i)  { q[i] = i; }
+    }
+  else
+  if( (user_opts.symmetric) || (user_opts.permutation == superlu_opts::MMD_AT_PLUS_A) || sp_ordering::is_symmetric_pattern(A) )
+    {
+    arma_debug_print("sp_lu_worker::factorise(): ordering via A+A'");
+    
+    sp_ordering::amd(q, A);
+    }
+  else
+    {
+    arma_debug_print("sp_lu_worker::factorise(): ordering via A'*A");
+    
+    sp_ordering::colamd(q, A);
+    }
+  
+  time_symbolic = timer.toc();
+  
+  timer.tic();
+  
+  equilibrated = user_opts.equilibrate;
+  
+  if(equilibrated)  { sp_lu_worker<eT>::equilibrate(R, C, A); }
+  
+  const T tol = T(user_opts.pivot_thresh);
+  
+  //
+  
+  const uword* A_col_ptrs    = A.col_ptrs;
+  const uword* A_row_indices = A.row_indices;
+  const eT*    A_values      = A.values;
+  
+  const uword nnz_est = 2*A.n_nonzero + n;
+  
+  Lp.set_size(n+1);
+  Up.set_size(n+1);
+  Ud.set_size(n);
+  
+  Li.clear();  Li.reserve(nnz_est);
+  Lx.clear();  Lx.reserve(nnz_est);
+  Ui.clear();  Ui.reserve(nnz_est);
+  Ux.clear();  Ux.reserve(nnz_est);
+  
+  pinv.set_size(n);
+  pinv.fill(n);   // no rows pivotal yet
+  
+  podarray<uword> prow(n);   // row pivoted at each step
+  
+  podarray<eT> x(n);  x.zeros();
+  
+  podarray<uword> pattern(n);          // rows of the current column that may be nonzero
+  podarray<uword> mark(n);  mark.zeros();
+  
+  std::vector<uword> heap;
+  
+  heap.reserve(n);
+  
+  const std::greater<uword> heap_cmp;   // smallest step at the front
+  
+  for(uword k=0; k < n; ++k)
+    {
+    Lp[k] = uword(Li.size());
+    Up[k] = uword(Ui.size());
+    
+    const uword col   = q[k];
+    const uword stamp = k+1;
+    
+    uword n_pattern = 0;
+    
+    const T col_scale = (equilibrated) ? C[col] : T(1);
+    
+    for(uword p = A_col_ptrs[col]; p < A_col_ptrs[col+1]; ++p)
+      {
+      const uword row = A_row_indices[p];
+      
+      x[row]    = (equilibrated) ? A_values[p] * (R[row] * col_scale) : A_values[p];
+      mark[row] = stamp;
+      
+      pattern[n_pattern++] = row;
+      
+      if(pinv[row] != n)  { heap.push_back(pinv[row]);  std::push_heap(heap.begin(), heap.end(), heap_cmp); }
+      }
+    
+    // apply L(:,J) in increasing order of J; the entries of x in pivotal rows form the column of U
+    
+    while(heap.empty() == false)
+      {
+      std::pop_heap(heap.begin(), heap.end(), heap_cmp);
+      
+      const uword J = heap.back();
+      
+      heap.pop_back();
+      
+      const eT x_j = x[ prow[J] ];
+      
+      if(x_j == eT(0))  { continue; }
+      
+      Ui.push_back(J);
+      Ux.push_back(x_j);
+      
+      const uword p_end = Lp[J+1];
+      
+      for(uword p = Lp[J]; p < p_end; ++p)
+        {
+        const uword row = Li[p];
+        
+        if(mark[row] != stamp)
+          {
+          mark[row] = stamp;
+          x[row]    = eT(0);
+          
+          pattern[n_pattern++] = row;
+          
+          if(pinv[row] != n)  { heap.push_back(pinv[row]);  std::push_heap(heap.begin(), heap.end(), heap_cmp); }
+          }
+        
+        x[row] -= Lx[p] * x_j;
+        }
+      }
+    
+    // find pivot
+    
+    uword ipiv = n;
+    T     a    = T(-1);
+    
+    for(uword p=0; p < n_pattern; ++p)
+      {
+      const uword i = pattern[p];
+      
+      if(pinv[i] != n)  { continue; }
+      
+      const T t = std::abs(x[i]);
+      
+      if(t > a)  { a = t; ipiv = i; }
+      }
+    
+    if( (ipiv == n) || (a <= T(0)) )
+      {
+      arma_debug_print("sp_lu_worker::factorise(): matrix is singular");
+      return false;
+      }
+    
+    // tol = 1 gives partial pivoting; tol < 1 gives preference to the diagonal;
+    // x[col] is zero when col is not in the pattern
+    
+    if(pinv[col] == n)
+      {
+      const T x_col_abs = std::abs(x[col]);
+      
+      if( (x_col_abs > T(0)) && (x_col_abs >= a*tol) )  { ipiv = col; }
+      }
+    
+    const eT pivot = x[ipiv];
+    
+    Ud[k] = pivot;
+    
+    pinv[ipiv] = k;
+    prow[k]    = ipiv;
+    
+    for(uword p=0; p < n_pattern; ++p)
+      {
+      const uword i = pattern[p];
+      
+      if(pinv[i] == n)
+        {
+        Li.push_back(i);   // unpermuted row index; fixed after the factorisation
+        Lx.push_back(x[i] / pivot);
+        }
+      
+      x[i] = eT(0);
+      }
+    }
+  
+  Lp[n] = uword(Li.size());
+  Up[n] = uword(Ui.size());
+  
+  for(uword& i : Li)  { i = pinv[i]; }
+  
+  Li.shrink_to_fit();
+  Lx.shrink_to_fit();
+  Ui.shrink_to_fit();
+  Ux.shrink_to_fit();
+  
+  arma_debug_print("sp_lu_worker::factorise(): nnz(L) + nnz(U) = ", (Li.size() + Ui.size() + 2*n));
+  
+  factorisation_valid = true;
+  
+  // 1-norm of the factorised (equilibrated) matrix, for the rcond estimate
+  
+  T norm_val = T(0);
+  
+  for(uword col=0; col < n; ++col)
+    {
+    T acc = T(0);
+    
+    const T col_scale = (equilibrated) ? C[col] : T(1);
+    
+    for(uword p = A_col_ptrs[col]; p < A_col_ptrs[col+1]; ++p)
+      {
+      acc += (equilibrated) ? std::abs(A_values[p]) * (R[ A_row_indices[p] ] * col_scale) : std::abs(A_values[p]);
+      }
+    
+    norm_val = (std::max)(norm_val, acc);
+    }
+  
+  out_rcond = rcond_est(norm_val);
+  
+  time_numeric = timer.toc();
+  
+  if(arma_isnan(out_rcond))  { factorisation_valid = false; return false; }
+  
+  return true;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+sp_lu_worker<eT>::solve(Mat<eT>& X, const Mat<eT>& B) const
+  {
+  arma_debug_sigprint();
+  
+  if(factorisation_valid == false)  { return false; }
+  
+  if(B.n_rows != n)  { return false; }
+  
+  X = B;
+  
+  const uword X_n_cols = X.n_cols;
+  
+  if( (arma_config::openmp) && (mp_thread_limit::in_parallel() == false) && (X_n_cols >= 2) && mp_gate<eT>::eval(X.n_elem) )
+    {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      arma_debug_print("sp_lu_worker::solve(): openmp implementation");
+      
+      // the columns of X are split into contiguous blocks, each solved with its own workspace
+      
+      const int   n_threads = (std::min)(mp_thread_limit::get(), int(X_n_cols));
+      const uword n_parts   = uword(n_threads);
+      
+      Mat<eT> work(n, n_parts, arma_nozeros_indicator());
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword part=0; part < n_parts; ++part)
+        {
+        const uword col_start = (X_n_cols * (part    )) / n_parts;
+        const uword col_end   = (X_n_cols * (part + 1)) / n_parts;
+        
+        for(uword col=col_start; col < col_end; ++col)  { solve_vec(X.colptr(col), work.colptr(part)); }
+        }
+      
+      return true;
+      }
+    #endif
+    }
+  
+  podarray<eT> work(n);
+  
+  for(uword col=0; col < X_n_cols; ++col)
+    {
+    solve_vec(X.colptr(col), work.memptr());
+    }
+  
+  return true;
+  }
+
+
+
+template<typename eT>
+inline
+void
+sp_lu_worker<eT>::solve_vec(eT* x, eT* work) const
+  {
+  if(equilibrated)  { for(uword i=0; i < n; ++i)  { x[i] *= R[i]; } }
+  
+  lu_solve(x, work);
+  
+  if(equilibrated)  { for(uword i=0; i < n; ++i)  { x[i] *= C[i]; } }
+  }
+
+
+
+template<typename eT>
+inline
+void
+sp_lu_worker<eT>::solve_trans_vec(eT* x, eT* work) const
+  {
+  if(equilibrated)  { for(uword i=0; i < n; ++i)  { x[i] *= C[i]; } }
+  
+  lu_solve_trans(x, work);
+  
+  if(equilibrated)  { for(uword i=0; i < n; ++i)  { x[i] *= R[i]; } }
+  }
+
+
+
+template<typename eT>
+inline
+void
+sp_lu_worker<eT>::lu_solve(eT* x, eT* work) const
+  {
+  const uword* Lp_mem = Lp.memptr();
+  const uword* Up_mem = Up.memptr();
+  
+  const uword* Li_mem = Li.data();
+  const eT*    Lx_mem = Lx.data();
+  const uword* Ui_mem = Ui.data();
+  const eT*    Ux_mem = Ux.data();
+  const eT*    Ud_mem = Ud.memptr();
+  
+  for(uword i=0; i < n; ++i)  { work[ pinv[i] ] = x[i]; }
+  
+  // L is unit lower triangular
+  
+  for(uword j=0; j < n; ++j)
+    {
+    const eT x_j = work[j];
+    
+    if(x_j == eT(0))  { continue; }
+    
+    const uword p_end = Lp_mem[j+1];
+    
+    for(uword p = Lp_mem[j]; p < p_end; ++p)  { work[ Li_mem[p] ] -= Lx_mem[p] * x_j; }
+    }
+  
+  // U is upper triangular
+  
+  for(uword jj=n; jj > 0; --jj)
+    {
+    const uword j = jj-1;
+    
+    work[j] /= Ud_mem[j];
+    
+    const eT x_j = work[j];
+    
+    if(x_j == eT(0))  { continue; }
+    
+    const uword p_end = Up_mem[j+1];
+    
+    for(uword p = Up_mem[j]; p < p_end; ++p)  { work[ Ui_mem[p] ] -= Ux_mem[p] * x_j; }
+    }
+  
+  for(uword k=0; k < n; ++k)  { x[ q[k] ] = work[k]; }
+  }
+
+
+
+template<typename eT>
+inline
+void
+sp_lu_worker<eT>::lu_solve_trans(eT* x, eT* work) const
+  {
+  const uword* Lp_mem = Lp.memptr();
+  const uword* Up_mem = Up.memptr();
+  
+  const uword* Li_mem = Li.data();
+  const eT*    Lx_mem = Lx.data();
+  const uword* Ui_mem = Ui.data();
+  const eT*    Ux_mem = Ux.data();
+  const eT*    Ud_mem = Ud.memptr();
+  
+  for(uword k=0; k < n; ++k)  { work[k] = x[ q[k] ]; }
+  
+  // U' is lower triangular
+  
+  for(uword j=0; j < n; ++j)
+    {
+    const uword p_end = Up_mem[j+1];
+    
+    eT acc = work[j];
+    
+    for(uword p = Up_mem[j]; p < p_end; ++p)  { acc -= eop_aux::conj(Ux_mem[p]) * work[ Ui_mem[p] ]; }
+    
+    work[j] = acc / eop_aux::conj(Ud_mem[j]);
+    }
+  
+  // L' is unit upper triangular
+  
+  for(uword jj=n; jj > 0; --jj)
+    {
+    const uword j     = jj-1;
+    const uword p_end = Lp_mem[j+1];
+    
+    eT acc = work[j];
+    
+    for(uword p = Lp_mem[j]; p < p_end; ++p)  { acc -= eop_aux::conj(Lx_mem[p]) * work[ Li_mem[p] ]; }
+    
+    work[j] = acc;
+    }
+  
+  for(uword i=0; i < n; ++i)  { x[i] = work[ pinv[i] ]; }
+  }
+
+
+
+//! log determinant of A, obtained from the diagonal of U, the permutations and the equilibration scalings
+template<typename eT>
+inline
+bool
+sp_lu_worker<eT>::log_det(eT& out_val, T& out_sign) const
+  {
+  arma_debug_sigprint();
+  
+  if(factorisation_valid == false)  { return false; }
+  
+  eT val  = eT(0);
+  T  sign = T(1);
+  
+  for(uword j=0; j < n; ++j)
+    {
+    const eT x = Ud[j];
+    
+    sign *= (is_cx<eT>::no) ?         ( (access::tmp_real(x) < T(0)) ?   T(-1) : T(1) ) : T(1);
+    val  += (is_cx<eT>::no) ? std::log( (access::tmp_real(x) < T(0)) ? x*T(-1) : x    ) : std::log(x);
+    }
+  
+  if(equilibrated)
+    {
+    for(uword i=0; i < n; ++i)  { val -= eT( std::log(R[i]) + std::log(C[i]) ); }
+    }
+  
+  if(sp_lu_worker<eT>::is_odd_perm(pinv))  { sign *= T(-1); }
+  if(sp_lu_worker<eT>::is_odd_perm(q   ))  { sign *= T(-1); }
+  
+  out_val  = val;
+  out_sign = sign;
+  
+  return true;
+  }
+
+
+
+//! parity of a permutation, via the number of cycles
+template<typename eT>
+inline
+bool
+sp_lu_worker<eT>::is_odd_perm(const podarray<uword>& p)
+  {
+  const uword N = p.n_elem;
+  
+  podarray<uword> visited(N);
+  
+  visited.zeros();
+  
+  uword n_cycles = 0;
+  
+  for(uword i=0; i < N; ++i)
+    {
+    if(visited[i] != 0)  { continue; }
+    
+    ++n_cycles;
+    
+    for(uword j=i; visited[j] == 0; j = p[j])  { visited[j] = 1; }
+    }
+  
+  return (((N - n_cycles) % 2) == 1);
+  }
+
+
+
+//! estimate the reciprocal condition number in the 1-norm, without forming inv(A).
+//! Based on:
+//! N.J. Higham. FORTRAN codes for estimating the one-norm of a real or complex matrix,
+//! with applications to condition estimation. ACM Transactions on Mathematical Software, Vol. 14, No. 4, 1988.
+template<typename eT>
+inline
+typename sp_lu_worker<eT>::T
+sp_lu_worker<eT>::rcond_est(const T norm_val) const
+  {
+  arma_debug_sigprint();
+  
+  if( (n == 0) || (norm_val <= T(0)) )  { return T(0); }
+  
+  podarray<eT> x(n);
+  podarray<eT> work(n);
+  
+  x.fill( eT(T(1) / T(n)) );
+  
+  T     est    = T(0);
+  uword j_prev = n;
+  
+  for(uword iter=0; iter < 5; ++iter)
+    {
+    lu_solve(x.memptr(), work.memptr());
+    
+    T est_new = T(0);
+    
+    for(uword i=0; i < n; ++i)  { est_new += std::abs(x[i]); }
+    
+    if( (iter > 0) && (est_new <= est) )  { break; }
+    
+    est = est_new;
+    
+    for(uword i=0; i < n; ++i)
+      {
+      const T abs_x_i = std::abs(x[i]);
+      
+      x[i] = (abs_x_i > T(0)) ? eT(x[i] / abs_x_i) : eT(1);
+      }
+    
+    lu_solve_trans(x.memptr(), work.memptr());
+    
+    uword j     = 0;
+    T     max_z = T(-1);
+    
+    for(uword i=0; i < n; ++i)
+      {
+      const T abs_x_i = std::abs(x[i]);
+      
+      if(abs_x_i > max_z)  { max_z = abs_x_i; j = i; }
+      }
+    
+    if(j == j_prev)  { break; }
+    
+    j_prev = j;
+    
+    x.zeros();
+    
+    x[j] = eT(1);
+    }
+  
+  // alternative estimate, which guards against unlucky starting vectors
+  
+  for(uword i=0; i < n; ++i)
+    {
+    const T val = T(1) + T(i) / T( (std::max)(uword(1), n-1) );
+    
+    x[i] = eT( (i % 2) == 0 ? val : -val );
+    }
+  
+  lu_solve(x.memptr(), work.memptr());
+  
+  T alt = T(0);
+  
+  for(uword i=0; i < n; ++i)  { alt += std::abs(x[i]); }
+  
+  alt = T(2) * alt / T(3 * n);
+  
+  est = (std::max)(est, alt);
+  
+  return (est > T(0)) ? (T(1) / (norm_val * est)) : T(0);
+  }
+
+
+
+//! row and column scaling so that the largest absolute value in each row and column is 1
+template<typename eT>
+inline
+void
+sp_lu_worker<eT>::equilibrate(podarray<T>& R_out, podarray<T>& C_out, const SpMat<eT>& A)
+  {
+  arma_debug_sigprint();
+  
+  const uword N = A.n_rows;
+  
+  R_out.set_size(N);  R_out.zeros();
+  C_out.set_size(N);  C_out.zeros();
+  
+  for(uword col=0; col < N; ++col)
+  for(uword p = A.col_ptrs[col]; p < A.col_ptrs[col+1]; ++p)
+    {
+    T& R_i = R_out[ A.row_indices[p] ];
+    
+    R_i = (std::max)(R_i, T(std::abs(A.values[p])));
+    }
+  
+  for(uword i=0; i < N; ++i)  { R_out[i] = (R_out[i] > T(0)) ? (T(1) / R_out[i]) : T(1); }
+  
+  for(uword col=0; col < N; ++col)
+    {
+    T C_j = T(0);
+    
+    for(uword p = A.col_ptrs[col]; p < A.col_ptrs[col+1]; ++p)
+      {
+      C_j = (std::max)(C_j, T(std::abs(A.values[p]) * R_out[ A.row_indices[p] ]));
+      }
+    
+    C_out[col] = (C_j > T(0)) ? (T(1) / C_j) : T(1);
+    }
+  }
+
+
+
+//! @}
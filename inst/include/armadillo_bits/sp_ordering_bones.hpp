@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 The RcppArmadillo Authors
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup sp_ordering
+//! @{
+
+
+//! fill-reducing orderings for sparse matrices, used by the built-in sparse solvers
+struct sp_ordering
+  {
+  //! symmetric ordering of A+A' via approximate minimum degree
+  template<typename eT>
+  inline static void amd(podarray<uword>& out, const SpMat<eT>& A);
+  
+  //! column ordering of A via approximate minimum degree on the pattern of A'*A, with dense rows ignored
+  template<typename eT>
+  inline static void colamd(podarray<uword>& out, const SpMat<eT>& A);
+  
+  //! bandwidth-reducing ordering of A+A' via reverse Cuthill-McKee
+  template<typename eT>
+  inline static void rcm(podarray<uword>& out, const SpMat<eT>& A);
+  
+  //! B = A(p,p)
+  template<typename eT>
+  inline static void permute_sym(SpMat<eT>& B, const SpMat<eT>& A, const uword* p);
+  
+  
+  //! check whether the nonzero pattern of A is symmetric
+  template<typename eT>
+  inline static bool is_symmetric_pattern(const SpMat<eT>& A);
+  
+  
+  //
+  // internal functions
+  
+  template<typename eT>
+  inline static void pattern_sym(podarray<uword>& Cp, podarray<uword>& Ci, const SpMat<eT>& A);
+  
+  template<typename eT>
+  inline static void pattern_ata(podarray<uword>& Cp, podarray<uword>& Ci, const SpMat<eT>& A);
+  
+  inline static uword dense_threshold(const uword n);
+  
+  inline static void min_degree(podarray<uword>& out, const podarray<uword>& Cp, const podarray<uword>& Ci, const uword n);
+  
+  //! postordering of a forest, given the parent of each node (roots have parent n)
+  inline static void postorder(podarray<uword>& post, const podarray<uword>& parent, const uword n);
+  
+  inline static uword level_structure(const uword root, const uword* Cp, const uword* Ci, uword* queue, uword* mark, const uword stamp, uword& out_last_level, uword& out_n_nodes);
+  };
+
+
+
+//! @}
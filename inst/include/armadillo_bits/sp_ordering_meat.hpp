@@ -0,0 +1,868 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 The RcppArmadillo Authors
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup sp_ordering
+//! @{
+
+
+
+template<typename eT>
+inline
+void
+sp_ordering::amd(podarray<uword>& out, const SpMat<eT>& A)
+  {
+  arma_debug_sigprint();
+  
+  arma_conform_check( (A.n_rows != A.n_cols), "sp_ordering::amd(): given matrix must be square sized" );
+  
+  const uword n = A.n_cols;
+  
+  out.set_size(n);
+  
+  if(n <= 2)  { for(uword i=0; i < n; ++i)  { out[i] = i; }  return; }
+  
+  podarray<uword> Cp;
+  podarray<uword> Ci;
+  
+  sp_ordering::pattern_sym(Cp, Ci, A);
+  
+  sp_ordering::min_degree(out, Cp, Ci, n);
+  }
+
+
+
+template<typename eT>
+inline
+void
+sp_ordering::colamd(podarray<uword>& out, const SpMat<eT>& A)
+  {
+  arma_debug_sigprint();
+  
+  const uword n = A.n_cols;
+  
+  out.set_size(n);
+  
+  if(n <= 2)  { for(uword i=0; i < n; ++i)  { out[i] = i; }  return; }
+  
+  podarray<uword> Cp;
+  podarray<uword> Ci;
+  
+  sp_ordering::pattern_ata(Cp, Ci, A);
+  
+  sp_ordering::min_degree(out, Cp, Ci, n);
+  }
+
+
+
+template<typename eT>
+inline
+bool
+sp_ordering::is_symmetric_pattern(const SpMat<eT>& A)
+  {
+  arma_debug_sigprint();
+  
+  if(A.n_rows != A.n_cols)  { return false; }
+  
+  const uword n = A.n_cols;
+  
+  const uword* A_col_ptrs    = A.col_ptrs;
+  const uword* A_row_indices = A.row_indices;
+  
+  // the pattern is symmetric if each column of A' has the same row indices as the corresponding column of A;
+  // as the row indices within each column of A are sorted, the counting sort below also produces sorted columns of A'
+  
+  podarray<uword> Tp(n+1);  Tp.zeros();
+  
+  for(uword p=0; p < A.n_nonzero; ++p)  { Tp[ A_row_indices[p] + 1 ]++; }
+  
+  for(uword i=0; i < n; ++i)
+    {
+    Tp[i+1] += Tp[i];
+    
+    if(Tp[i+1] != A_col_ptrs[i+1])  { return false; }
+    }
+  
+  podarray<uword> Ti(A.n_nonzero);
+  podarray<uword> pos(n);
+  
+  arrayops::copy(pos.memptr(), Tp.memptr(), n);
+  
+  for(uword col=0; col < n; ++col)
+  for(uword p=A_col_ptrs[col]; p < A_col_ptrs[col+1]; ++p)
+    {
+    Ti[ pos[ A_row_indices[p] ]++ ] = col;
+    }
+  
+  for(uword p=0; p < A.n_nonzero; ++p)  { if(Ti[p] != A_row_indices[p])  { return false; } }
+  
+  return true;
+  }
+
+
+
+//! reverse Cuthill-McKee ordering of the pattern of A+A', which reduces the bandwidth;
+//! each connected component is started from a pseudo-peripheral node found as per
+//! N.E. Gibbs, W.G. Poole, P.K. Stockmeyer.
+//! An algorithm for reducing the bandwidth and profile of a sparse matrix.
+//! SIAM Journal on Numerical Analysis, Vol. 13, No. 2, 1976.
+template<typename eT>
+inline
+void
+sp_ordering::rcm(podarray<uword>& out, const SpMat<eT>& A)
+  {
+  arma_debug_sigprint();
+  
+  arma_conform_check( (A.n_rows != A.n_cols), "sp_ordering::rcm(): given matrix must be square sized" );
+  
+  const uword n = A.n_cols;
+  
+  out.set_size(n);
+  
+  if(n <= 2)  { for(uword i=0; i < n; ++i)  { out[i] = i; }  return; }
+  
+  podarray<uword> Cp;
+  podarray<uword> Ci;
+  
+  sp_ordering::pattern_sym(Cp, Ci, A);
+  
+  const uword* Cp_mem = Cp.memptr();
+  const uword* Ci_mem = Ci.memptr();
+  
+  podarray<uword> degree(n);
+  
+  for(uword i=0; i < n; ++i)  { degree[i] = uword(Cp_mem[i+1] - Cp_mem[i]); }
+  
+  podarray<uword> visited(n);  visited.zeros();
+  podarray<uword> level_mark(n);  level_mark.zeros();
+  podarray<uword> queue(n);
+  
+  uword stamp  = 0;
+  uword n_done = 0;
+  
+  for(uword start=0; start < n; ++start)
+    {
+    if(visited[start] != 0)  { continue; }
+    
+    // find a pseudo-peripheral node: repeatedly move to a node of minimum degree in the last level
+    // of the level structure, for as long as the number of levels increases
+    
+    uword root       = start;
+    uword last_level = 0;
+    uword n_comp     = 0;
+    uword n_levels   = sp_ordering::level_structure(root, Cp_mem, Ci_mem, queue.memptr(), level_mark.memptr(), ++stamp, last_level, n_comp);
+    
+    while(n_levels > 1)
+      {
+      uword candidate = queue[last_level];
+      
+      for(uword k=last_level+1; k < n_comp; ++k)
+        {
+        const uword node = queue[k];
+        
+        if(degree[node] < degree[candidate])  { candidate = node; }
+        }
+      
+      uword candidate_last_level = 0;
+      
+      const uword candidate_n_levels = sp_ordering::level_structure(candidate, Cp_mem, Ci_mem, queue.memptr(), level_mark.memptr(), ++stamp, candidate_last_level, n_comp);
+      
+      if(candidate_n_levels <= n_levels)  { break; }
+      
+      root       = candidate;
+      n_levels   = candidate_n_levels;
+      last_level = candidate_last_level;
+      }
+    
+    // Cuthill-McKee: breadth-first search from root, visiting the neighbours of each node in order of increasing degree
+    
+    uword* order = out.memptr();
+    
+    uword head = n_done;
+    
+    order[n_done++] = root;
+    visited[root]   = 1;
+    
+    while(head < n_done)
+      {
+      const uword node = order[head++];
+      
+      const uword first = n_done;
+      
+      for(uword p = Cp_mem[node]; p < Cp_mem[node+1]; ++p)
+        {
+        const uword nb = Ci_mem[p];
+        
+        if(visited[nb] == 0)  { visited[nb] = 1; order[n_done++] = nb; }
+        }
+      
+      // insertion sort by degree; the number of neighbours is typically small
+      
+      for(uword k=first+1; k < n_done; ++k)
+        {
+        const uword node_k   = order[k];
+        const uword degree_k = degree[node_k];
+        
+        uword l = k;
+        
+        while( (l > first) && (degree[ order[l-1] ] > degree_k) )  { order[l] = order[l-1]; --l; }
+        
+        order[l] = node_k;
+        }
+      }
+    }
+  
+  // reverse
+  
+  for(uword i=0; i < n/2; ++i)  { std::swap(out[i], out[n-1-i]); }
+  }
+
+
+
+//! B = A(p,p), ie. B = P*A*P' where P is the permutation matrix with P(i,p[i]) = 1;
+//! the rows of A are traversed in the order given by p, so that the row indices within each column of B are produced in sorted order
+template<typename eT>
+inline
+void
+sp_ordering::permute_sym(SpMat<eT>& B, const SpMat<eT>& A, const uword* p)
+  {
+  arma_debug_sigprint();
+  
+  const uword n = A.n_cols;
+  
+  const SpMat<eT> At(A.st());  // rows of A
+  
+  podarray<uword> pinv(n);
+  
+  for(uword k=0; k < n; ++k)  { pinv[ p[k] ] = k; }
+  
+  B.reserve(n, n, A.n_nonzero);
+  
+  if(A.n_nonzero == 0)  { return; }
+  
+  uword* B_col_ptrs    = access::rwp(B.col_ptrs);
+  uword* B_row_indices = access::rwp(B.row_indices);
+  eT*    B_values      = access::rwp(B.values);
+  
+  // column j of B has the same number of elements as column p[j] of A
+  
+  B_col_ptrs[0] = 0;
+  
+  for(uword j=0; j < n; ++j)  { B_col_ptrs[j+1] = B_col_ptrs[j] + (A.col_ptrs[ p[j] + 1 ] - A.col_ptrs[ p[j] ]); }
+  
+  podarray<uword> pos(n);
+  
+  arrayops::copy(pos.memptr(), B_col_ptrs, n);
+  
+  for(uword i=0; i < n; ++i)
+    {
+    const uword row = p[i];
+    
+    for(uword k = At.col_ptrs[row]; k < At.col_ptrs[row+1]; ++k)
+      {
+      const uword j = pinv[ At.row_indices[k] ];
+      
+      const uword pos_j = pos[j]++;
+      
+      B_row_indices[pos_j] = i;
+      B_values     [pos_j] = At.values[k];
+      }
+    }
+  }
+
+
+
+//! pattern of A+A' without the diagonal
+template<typename eT>
+inline
+void
+sp_ordering::pattern_sym(podarray<uword>& Cp, podarray<uword>& Ci, const SpMat<eT>& A)
+  {
+  arma_debug_sigprint();
+  
+  const uword n = A.n_cols;
+  
+  const uword* A_col_ptrs    = A.col_ptrs;
+  const uword* A_row_indices = A.row_indices;
+  
+  // pattern of A' via counting sort
+  
+  podarray<uword> Tp(n+1);  Tp.zeros();
+  podarray<uword> Ti(A.n_nonzero);
+  
+  for(uword p=0; p < A.n_nonzero; ++p)  { Tp[ A_row_indices[p] + 1 ]++; }
+  
+  for(uword i=0; i < n; ++i)  { Tp[i+1] += Tp[i]; }
+  
+  podarray<uword> pos(n);
+  
+  arrayops::copy(pos.memptr(), Tp.memptr(), n);
+  
+  for(uword col=0; col < n; ++col)
+  for(uword p=A_col_ptrs[col]; p < A_col_ptrs[col+1]; ++p)
+    {
+    Ti[ pos[ A_row_indices[p] ]++ ] = col;
+    }
+  
+  // merge columns of A and A', skipping duplicates and the diagonal;
+  // the first pass counts, the second pass fills
+  
+  podarray<uword> mark(n);  mark.fill(n);
+  
+  Cp.set_size(n+1);
+  
+  Cp[0] = 0;
+  
+  for(uword pass=0; pass < 2; ++pass)
+    {
+    if(pass == 1)
+      {
+      Ci.set_size(Cp[n]);
+      
+      mark.fill(n);
+      }
+    
+    for(uword col=0; col < n; ++col)
+      {
+      uword count = 0;
+      
+      uword* Ci_col = (pass == 1) ? (Ci.memptr() + Cp[col]) : nullptr;
+      
+      for(uword k=0; k < 2; ++k)
+        {
+        const uword* ptrs    = (k == 0) ? A_col_ptrs    : Tp.memptr();
+        const uword* indices = (k == 0) ? A_row_indices : Ti.memptr();
+        
+        for(uword p=ptrs[col]; p < ptrs[col+1]; ++p)
+          {
+          const uword row = indices[p];
+          
+          if( (row == col) || (mark[row] == col) )  { continue; }
+          
+          mark[row] = col;
+          
+          if(pass == 1)  { Ci_col[count] = row; }
+          
+          ++count;
+          }
+        }
+      
+      if(pass == 0)  { Cp[col+1] = Cp[col] + count; }
+      }
+    }
+  }
+
+
+
+//! pattern of A'*A without the diagonal, ignoring dense rows of A
+template<typename eT>
+inline
+void
+sp_ordering::pattern_ata(podarray<uword>& Cp, podarray<uword>& Ci, const SpMat<eT>& A)
+  {
+  arma_debug_sigprint();
+  
+  const uword m = A.n_rows;
+  const uword n = A.n_cols;
+  
+  const uword* A_col_ptrs    = A.col_ptrs;
+  const uword* A_row_indices = A.row_indices;
+  
+  const uword dense = sp_ordering::dense_threshold(n);
+  
+  // pattern of A' (ie. rows of A), with dense rows of A left empty
+  
+  podarray<uword> Tp(m+1);  Tp.zeros();
+  
+  for(uword p=0; p < A.n_nonzero; ++p)  { Tp[ A_row_indices[p] + 1 ]++; }
+  
+  for(uword row=0; row < m; ++row)  { if(Tp[row+1] > dense)  { Tp[row+1] = 0; } }
+  
+  for(uword row=0; row < m; ++row)  { Tp[row+1] += Tp[row]; }
+  
+  podarray<uword> Ti(Tp[m]);
+  podarray<uword> pos(m);
+  
+  arrayops::copy(pos.memptr(), Tp.memptr(), m);
+  
+  for(uword col=0; col < n; ++col)
+  for(uword p=A_col_ptrs[col]; p < A_col_ptrs[col+1]; ++p)
+    {
+    const uword row = A_row_indices[p];
+    
+    if(pos[row] < Tp[row+1])  { Ti[ pos[row]++ ] = col; }
+    }
+  
+  // column j of A'*A is the union of the rows of A that have an entry in column j
+  
+  podarray<uword> mark(n);
+  
+  Cp.set_size(n+1);
+  
+  Cp[0] = 0;
+  
+  for(uword pass=0; pass < 2; ++pass)
+    {
+    if(pass == 1)
+      {
+      Ci.set_size(Cp[n]);
+      }
+    
+    mark.fill(n);
+    
+    for(uword col=0; col < n; ++col)
+      {
+      uword count = 0;
+      
+      uword* Ci_col = (pass == 1) ? (Ci.memptr() + Cp[col]) : nullptr;
+      
+      for(uword p=A_col_ptrs[col]; p < A_col_ptrs[col+1]; ++p)
+        {
+        const uword row = A_row_indices[p];
+        
+        for(uword q=Tp[row]; q < Tp[row+1]; ++q)
+          {
+          const uword other = Ti[q];
+          
+          if( (other == col) || (mark[other] == col) )  { continue; }
+          
+          mark[other] = col;
+          
+          if(pass == 1)  { Ci_col[count] = other; }
+          
+          ++count;
+          }
+        }
+      
+      if(pass == 0)  { Cp[col+1] = Cp[col] + count; }
+      }
+    }
+  }
+
+
+
+inline
+uword
+sp_ordering::dense_threshold(const uword n)
+  {
+  const uword dense = (std::max)( uword(16), uword(10 * std::sqrt(double(n))) );
+  
+  return (n > 2) ? (std::min)( (n - 2), dense ) : n;
+  }
+
+
+
+//! minimum degree ordering of the symmetric pattern given by Cp and Ci, which must not contain diagonal entries.
+//! The elimination is simulated on a quotient graph: each eliminated node becomes an element,
+//! holding the list of its uneliminated neighbours in place of the clique that explicit elimination would create.
+//! Nodes with identical adjacency are merged into supervariables,
+//! and node degrees are replaced by the approximate external degrees described in:
+//! P.R. Amestoy, T.A. Davis, I.S. Duff.
+//! An approximate minimum degree ordering algorithm.
+//! SIAM Journal on Matrix Analysis and Applications, Vol. 17, No. 4, 1996.
+//! Nodes with more than dense_threshold() neighbours are ordered last.
+inline
+void
+sp_ordering::min_degree(podarray<uword>& out, const podarray<uword>& Cp, const podarray<uword>& Ci, const uword n)
+  {
+  arma_debug_sigprint();
+  
+  out.set_size(n);
+  
+  if(n == 0)  { return; }
+  
+  const uword none = n;
+  
+  const uword state_var      = 0;   // uneliminated node, possibly representing a supervariable
+  const uword state_elem     = 1;   // eliminated node, acting as an element
+  const uword state_absorbed = 2;   // element whose variables are contained in another element
+  const uword state_merged   = 3;   // node merged into a supervariable
+  const uword state_dense    = 4;   // dense node, excluded from the graph and ordered last
+  
+  // for a variable, vars holds the adjacent variables not covered by any element, and elems holds the adjacent elements;
+  // for an element, vars holds its variables.
+  // entries referring to merged nodes or absorbed elements are removed lazily
+  
+  std::vector< std::vector<uword> > vars(n);
+  std::vector< std::vector<uword> > elems(n);
+  
+  podarray<uword> state(n);
+  podarray<uword> weight(n);        // number of nodes represented by a supervariable
+  podarray<uword> elem_weight(n);   // total weight of the variables of an element
+  podarray<uword> degree(n);        // approximate external degree of a variable
+  
+  podarray<uword> chain_next(n);    // nodes merged into a supervariable, as a singly linked list
+  podarray<uword> chain_tail(n);
+  
+  podarray<uword> mark(n);          // set membership, via a new stamp value for each set
+  podarray<uword> ext(n);           // |Le \ Lp| for element e, valid when ext_mark[e] equals the current stamp
+  podarray<uword> ext_mark(n);
+  
+  podarray<uword> deg_head(n+1);    // variables of each degree, as doubly linked lists
+  podarray<uword> deg_next(n);
+  podarray<uword> deg_prev(n);
+  
+  podarray<uword> hash_head(n);     // candidates for merging, bucketed by a hash of their adjacency
+  podarray<uword> hash_next(n);
+  podarray<uword> hash_of(n);
+  
+  mark.zeros();
+  ext_mark.zeros();
+  deg_head.fill(none);
+  hash_head.fill(none);
+  
+  uword current = 0;
+  
+  const uword dense = sp_ordering::dense_threshold(n);
+  
+  for(uword i=0; i < n; ++i)
+    {
+    state[i]      = ( (Cp[i+1] - Cp[i]) > dense ) ? state_dense : state_var;
+    weight[i]     = 1;
+    chain_next[i] = none;
+    chain_tail[i] = i;
+    }
+  
+  auto deg_insert = [&](const uword i)
+    {
+    const uword d = degree[i];
+    
+    deg_prev[i] = none;
+    deg_next[i] = deg_head[d];
+    
+    if(deg_head[d] != none)  { deg_prev[ deg_head[d] ] = i; }
+    
+    deg_head[d] = i;
+    };
+  
+  auto deg_remove = [&](const uword i)
+    {
+    if(deg_prev[i] != none)  { deg_next[ deg_prev[i] ] = deg_next[i]; }  else  { deg_head[ degree[i] ] = deg_next[i]; }
+    if(deg_next[i] != none)  { deg_prev[ deg_next[i] ] = deg_prev[i]; }
+    };
+  
+  uword n_left = 0;   // total weight of the uneliminated variables
+  
+  for(uword i=0; i < n; ++i)
+    {
+    if(state[i] != state_var)  { continue; }
+    
+    std::vector<uword>& vars_i = vars[i];
+    
+    vars_i.reserve(Cp[i+1] - Cp[i]);
+    
+    for(uword p = Cp[i]; p < Cp[i+1]; ++p)  { if(state[ Ci[p] ] == state_var)  { vars_i.push_back(Ci[p]); } }
+    
+    degree[i] = uword(vars_i.size());
+    
+    deg_insert(i);
+    
+    ++n_left;
+    }
+  
+  std::vector<uword> Lp;
+  
+  uword n_ordered = 0;
+  uword min_deg   = 0;
+  
+  while(n_left > 0)
+    {
+    // the pivot is a variable of minimum approximate degree
+    
+    while(deg_head[min_deg] == none)  { ++min_deg; }
+    
+    const uword piv = deg_head[min_deg];
+    
+    deg_remove(piv);
+    
+    for(uword i=piv; i != none; i = chain_next[i])  { out[n_ordered++] = i; }
+    
+    n_left -= weight[piv];
+    
+    // the new element consists of the variables adjacent to the pivot, either directly or via its elements;
+    // the elements of the pivot are absorbed into the new element
+    
+    ++current;
+    
+    mark[piv] = current;
+    
+    Lp.clear();
+    
+    uword Lp_weight = 0;
+    
+    for(const uword j : vars[piv])
+      {
+      if( (state[j] == state_var) && (mark[j] != current) )  { mark[j] = current;  Lp.push_back(j);  Lp_weight += weight[j]; }
+      }
+    
+    for(const uword e : elems[piv])
+      {
+      if(state[e] != state_elem)  { continue; }
+      
+      for(const uword j : vars[e])
+        {
+        if( (state[j] == state_var) && (mark[j] != current) )  { mark[j] = current;  Lp.push_back(j);  Lp_weight += weight[j]; }
+        }
+      
+      state[e] = state_absorbed;
+      
+      std::vector<uword>().swap(vars[e]);
+      }
+    
+    std::vector<uword>().swap(elems[piv]);
+    
+    vars[piv] = Lp;
+    
+    state[piv]       = state_elem;
+    elem_weight[piv] = Lp_weight;
+    
+    // in the adjacency of each variable of the new element, replace the absorbed elements with the new element,
+    // and drop the variables now reachable via the new element
+    
+    for(const uword i : Lp)
+      {
+      deg_remove(i);
+      
+      std::vector<uword>& elems_i = elems[i];
+      std::vector<uword>&  vars_i =  vars[i];
+      
+      uword count = 0;
+      
+      for(const uword e : elems_i)  { if( (state[e] == state_elem) && (e != piv) )  { elems_i[count++] = e; } }
+      
+      elems_i.resize(count);
+      elems_i.push_back(piv);
+      
+      count = 0;
+      
+      for(const uword j : vars_i)  { if( (state[j] == state_var) && (mark[j] != current) )  { vars_i[count++] = j; } }
+      
+      vars_i.resize(count);
+      
+      uword h = 0;
+      
+      for(const uword e : elems_i)  { h += e; }
+      for(const uword j :  vars_i)  { h += j; }
+      
+      h %= n;
+      
+      hash_of[i]   = h;
+      hash_next[i] = hash_head[h];
+      hash_head[h] = i;
+      }
+    
+    // variables with the same adjacent elements and variables are indistinguishable, and are merged into one supervariable
+    
+    for(const uword i : Lp)
+      {
+      const uword h = hash_of[i];
+      
+      if( (state[i] != state_var) || (hash_head[h] == none) )  { continue; }
+      
+      for(uword a = hash_head[h]; a != none; a = hash_next[a])
+        {
+        if(state[a] != state_var)  { continue; }
+        
+        ++current;
+        
+        for(const uword e : elems[a])  { mark[e] = current; }
+        for(const uword j :  vars[a])  { mark[j] = current; }
+        
+        for(uword b = hash_next[a]; b != none; b = hash_next[b])
+          {
+          if( (state[b] != state_var) || (elems[b].size() != elems[a].size()) || (vars[b].size() != vars[a].size()) )  { continue; }
+          
+          bool same = true;
+          
+          for(const uword e : elems[b])  { if(mark[e] != current)  { same = false; break; } }
+          
+          if(same)  { for(const uword j : vars[b])  { if(mark[j] != current)  { same = false; break; } } }
+          
+          if(same == false)  { continue; }
+          
+          weight[a] += weight[b];
+          
+          state[b] = state_merged;
+          
+          chain_next[ chain_tail[a] ] = b;
+          chain_tail[a]               = chain_tail[b];
+          
+          std::vector<uword>().swap(elems[b]);
+          std::vector<uword>().swap( vars[b]);
+          }
+        }
+      
+      hash_head[h] = none;
+      }
+    
+    // |Le \ Lp| for each element e adjacent to the new element
+    
+    ++current;
+    
+    for(const uword i : Lp)
+      {
+      if(state[i] != state_var)  { continue; }
+      
+      for(const uword e : elems[i])
+        {
+        if( (e == piv) || (state[e] != state_elem) )  { continue; }
+        
+        if(ext_mark[e] != current)  { ext_mark[e] = current;  ext[e] = elem_weight[e]; }
+        
+        ext[e] -= weight[i];
+        }
+      }
+    
+    // approximate external degrees;
+    // elements entirely contained in the new element are absorbed into it
+    
+    for(const uword i : Lp)
+      {
+      if(state[i] != state_var)  { continue; }
+      
+      std::vector<uword>& elems_i = elems[i];
+      
+      uword d     = Lp_weight - weight[i];
+      uword count = 0;
+      
+      for(const uword e : elems_i)
+        {
+        if(e == piv)  { elems_i[count++] = e;  continue; }
+        
+        if(state[e] != state_elem)  { continue; }
+        
+        if(ext[e] == 0)
+          {
+          state[e] = state_absorbed;
+          
+          std::vector<uword>().swap(vars[e]);
+          
+          continue;
+          }
+        
+        d += ext[e];
+        
+        elems_i[count++] = e;
+        }
+      
+      elems_i.resize(count);
+      
+      for(const uword j : vars[i])  { if(state[j] == state_var)  { d += weight[j]; } }
+      
+      degree[i] = (std::min)(d, n_left - weight[i]);
+      
+      deg_insert(i);
+      
+      min_deg = (std::min)(min_deg, degree[i]);
+      }
+    }
+  
+  for(uword i=0; i < n; ++i)  { if(state[i] == state_dense)  { out[n_ordered++] = i; } }
+  }
+
+
+
+//! the postordering is obtained without a depth-first search, by using parent[j] > j (as holds for elimination trees):
+//! the size of each subtree is accumulated from the leaves upwards, after which each subtree is assigned
+//! a contiguous range of positions, with the root of the subtree placed last in its range
+inline
+void
+sp_ordering::postorder(podarray<uword>& post, const podarray<uword>& parent, const uword n)
+  {
+  arma_debug_sigprint();
+  
+  post.set_size(n);
+  
+  podarray<uword> subtree_size(n);
+  podarray<uword> start(n);
+  podarray<uword> used(n+1);   // positions used so far by the children of each node; index n is for the roots
+  
+  subtree_size.fill(1);
+  used.zeros();
+  
+  for(uword j=0; j < n; ++j)  { if(parent[j] < n)  { subtree_size[ parent[j] ] += subtree_size[j]; } }
+  
+  // offsets relative to the start of the parent's range, with siblings in ascending order
+  
+  for(uword j=0; j < n; ++j)
+    {
+    const uword pj = (parent[j] < n) ? parent[j] : n;
+    
+    start[j] = used[pj];
+    
+    used[pj] += subtree_size[j];
+    }
+  
+  // absolute offsets; parents are processed before their children
+  
+  for(uword jj=n; jj > 0; --jj)
+    {
+    const uword j = jj-1;
+    
+    if(parent[j] < n)  { start[j] += start[ parent[j] ]; }
+    
+    post[ start[j] + subtree_size[j] - 1 ] = j;
+    }
+  }
+
+
+
+//! level structure rooted at 'root', via breadth-first search over the nodes not yet marked with 'stamp';
+//! queue receives the nodes of the connected component in level order;
+//! returns the number of levels, with the last level starting at queue[out_last_level]
+inline
+uword
+sp_ordering::level_structure(const uword root, const uword* Cp, const uword* Ci, uword* queue, uword* mark, const uword stamp, uword& out_last_level, uword& out_n_nodes)
+  {
+  uword n_levels    = 0;
+  uword level_start = 0;
+  uword tail        = 0;
+  
+  queue[tail++] = root;
+  mark[root]    = stamp;
+  
+  while(level_start < tail)
+    {
+    const uword level_end = tail;
+    
+    out_last_level = level_start;
+    
+    ++n_levels;
+    
+    for(uword k=level_start; k < level_end; ++k)
+      {
+      const uword node = queue[k];
+      
+      for(uword p = Cp[node]; p < Cp[node+1]; ++p)
+        {
+        const uword nb = Ci[p];
+        
+        if(mark[nb] != stamp)  { mark[nb] = stamp; queue[tail++] = nb; }
+        }
+      }
+    
+    level_start = level_end;
+    }
+  
+  out_n_nodes = tail;
+  
+  return n_levels;
+  }
+
+
+
+//! @}
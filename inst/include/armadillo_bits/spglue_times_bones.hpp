@@ -43,8 +43,17 @@ struct spglue_times
   template<typename T1, typename T2>
   inline static void apply(SpMat_noalias<typename T1::elem_type>& out, const SpGlue<SpOp<T1,spop_scalar_times>,T2,spglue_times>& X);
   
+  template<typename T1, typename T2>
+  inline static void apply(SpMat<typename T1::elem_type>& out, const SpGlue<SpOp<T1,spop_htrans>,SpOp<T2,spop_htrans>,spglue_times>& X);
+  
+  template<typename eT>
+  inline static void apply_noalias(SpMat<eT>& c, const SpMat<eT>& x, const SpMat<eT>& y, const bool sort_rows = true);
+  
+  template<typename eT>
+  inline static uword count_col(const SpMat<eT>& x, const SpMat<eT>& y, const uword col, uword* mark);
+  
   template<typename eT>
-  inline static void apply_noalias(SpMat<eT>& c, const SpMat<eT>& x, const SpMat<eT>& y);
+  inline static void fill_col(SpMat<eT>& c, const SpMat<eT>& x, const SpMat<eT>& y, const uword col, eT* sums, uword* mark, const bool sort_rows);
   };
 
 
@@ -115,10 +115,61 @@ spglue_times::apply(SpMat_noalias<typename T1::elem_type>& out, const SpGlue<SpO
 
 
 
+template<typename T1, typename T2>
+inline
+void
+spglue_times::apply(SpMat<typename T1::elem_type>& out, const SpGlue<SpOp<T1,spop_htrans>,SpOp<T2,spop_htrans>,spglue_times>& X)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  // using trans(A)*trans(B) = trans(B*A);
+  // the row indices of B*A don't need to be sorted, as the transpose produces sorted row indices
+  
+  const unwrap_spmat<T1> UA(X.A.m);
+  const unwrap_spmat<T2> UB(X.B.m);
+  
+  SpMat<eT> tmp;
+  
+  spglue_times::apply_noalias(tmp, UB.M, UA.M, false);
+  
+  if(UA.is_alias(out) || UB.is_alias(out))
+    {
+    SpMat<eT> tmp2;
+    
+    spop_strans::apply_noalias(tmp2, tmp);
+    
+    out.steal_mem(tmp2);
+    }
+  else
+    {
+    spop_strans::apply_noalias(out, tmp);
+    }
+  
+  if(is_cx<eT>::yes)
+    {
+    const uword out_n_nonzero = out.n_nonzero;
+    
+    eT* out_values = access::rwp(out.values);
+    
+    for(uword i=0; i < out_n_nonzero; ++i)  { out_values[i] = eop_aux::conj(out_values[i]); }
+    }
+  }
+
+
+
+//! Gustavson's algorithm, using a dense accumulator and a dense marker array.
+//! The number of elements in each column is determined first, so that the
+//! results can be written directly into the CSC arrays; columns are processed
+//! in parallel if OpenMP is enabled.
+//! If sort_rows is false, the row indices within each column are left unsorted;
+//! this is only permissible if the result is used internally by an operation
+//! which does not depend on the ordering (such as a transpose).
 template<typename eT>
 inline
 void
-spglue_times::apply_noalias(SpMat<eT>& c, const SpMat<eT>& x, const SpMat<eT>& y)
+spglue_times::apply_noalias(SpMat<eT>& c, const SpMat<eT>& x, const SpMat<eT>& y, const bool sort_rows)
   {
   arma_debug_sigprint();
   
@@ -129,194 +180,215 @@ spglue_times::apply_noalias(SpMat<eT>& c, const SpMat<eT>& x, const SpMat<eT>& y
   
   arma_conform_assert_mul_size(x_n_rows, x_n_cols, y_n_rows, y_n_cols, "matrix multiplication");
   
-  // First we must determine the structure of the new matrix (column pointers).
-  // This follows the algorithm described in 'Sparse Matrix Multiplication
-  // Package (SMMP)' (R.E. Bank and C.C. Douglas, 2001).  Their description of
-  // "SYMBMM" does not include anything about memory allocation.  In addition it
-  // does not consider that there may be elements which space may be allocated
-  // for but which evaluate to zero anyway.  So we have to modify the algorithm
-  // to work that way.  For the "SYMBMM" implementation we will not determine
-  // the row indices but instead just the column pointers.
-  
-  //SpMat<typename T1::elem_type> c(x_n_rows, y_n_cols); // Initializes col_ptrs to 0.
   c.zeros(x_n_rows, y_n_cols);
   
-  //if( (x.n_elem == 0) || (y.n_elem == 0) )  { return; }
   if( (x.n_nonzero == 0) || (y.n_nonzero == 0) )  { return; }
   
-  // Auxiliary storage which denotes when items have been found.
-  podarray<uword> index(x_n_rows);
-  index.fill(x_n_rows); // Fill with invalid links.
+  uword* c_col_ptrs = access::rwp(c.col_ptrs);
   
-  typename SpMat<eT>::const_iterator y_it  = y.begin();
-  typename SpMat<eT>::const_iterator y_end = y.end();
+  const bool use_mp = (arma_config::openmp) && (y_n_cols >= 2) && (mp_thread_limit::in_parallel() == false) && mp_gate<eT>::eval(x.n_nonzero + y.n_nonzero);
   
-  // SYMBMM: calculate column pointers for resultant matrix to obtain a good
-  // upper bound on the number of nonzero elements.
-  uword cur_col_length = 0;
-  uword last_ind = x_n_rows + 1;
-  do
+  if(use_mp)
     {
-    const uword y_it_row = y_it.row();
-    
-    // Look through the column that this point (*y_it) could affect.
-    typename SpMat<eT>::const_iterator x_it = x.begin_col_no_sync(y_it_row);
-    
-    while(x_it.col() == y_it_row)
+    #if defined(ARMA_USE_OPENMP)
       {
-      const uword x_it_row = x_it.row();
+      arma_debug_print("spglue_times::apply_noalias(): parallelised implementation");
       
-      // A point at x(i, j) and y(j, k) implies a point at c(i, k).
-      if(index[x_it_row] == x_n_rows)
+      const uword n_threads = uword( (std::min)( mp_thread_limit::get(), int((std::min)(y_n_cols, uword(INT_MAX))) ) );
+      
+      podarray<uword> mark(x_n_rows * n_threads, arma_zeros_indicator());
+      
+      uword* mark_mem = mark.memptr();
+      
+      // dynamic scheduling, as the amount of work per column can be highly skewed
+      
+      #pragma omp parallel for schedule(dynamic, 16) num_threads(int(n_threads))
+      for(uword col=0; col < y_n_cols; ++col)
         {
-        index[x_it_row] = last_ind;
-        last_ind = x_it_row;
-        ++cur_col_length;
+        const uword thread_id = uword(omp_get_thread_num());
+        
+        c_col_ptrs[col+1] = spglue_times::count_col(x, y, col, (mark_mem + (x_n_rows * thread_id)));
         }
       
-      ++x_it;
-      }
-    
-    const uword old_col = y_it.col();
-    ++y_it;
-    
-    // See if column incremented.
-    if(old_col != y_it.col())
-      {
-      // Set column pointer (this is not a cumulative count; that is done later).
-      access::rw(c.col_ptrs[old_col + 1]) = cur_col_length;
-      cur_col_length = 0;
+      for(uword col=0; col < y_n_cols; ++col)  { c_col_ptrs[col+1] += c_col_ptrs[col]; }
+      
+      c.mem_resize(c_col_ptrs[y_n_cols]);
+      
+      mark.zeros();
+      
+      podarray<eT> sums(x_n_rows * n_threads, arma_zeros_indicator());
       
-      // Return index markers to zero.  Use last_ind for traversal.
-      while(last_ind != x_n_rows + 1)
+      eT* sums_mem = sums.memptr();
+      
+      #pragma omp parallel for schedule(dynamic, 16) num_threads(int(n_threads))
+      for(uword col=0; col < y_n_cols; ++col)
         {
-        const uword tmp = index[last_ind];
-        index[last_ind] = x_n_rows;
-        last_ind = tmp;
+        const uword thread_id = uword(omp_get_thread_num());
+        
+        spglue_times::fill_col(c, x, y, col, (sums_mem + (x_n_rows * thread_id)), (mark_mem + (x_n_rows * thread_id)), sort_rows);
         }
       }
+    #endif
     }
-  while(y_it != y_end);
-  
-  // Accumulate column pointers.
-  for(uword i = 0; i < c.n_cols; ++i)
+  else
     {
-    access::rw(c.col_ptrs[i + 1]) += c.col_ptrs[i];
+    arma_debug_print("spglue_times::apply_noalias(): serial implementation");
+    
+    podarray<uword> mark(x_n_rows, arma_zeros_indicator());
+    
+    uword* mark_mem = mark.memptr();
+    
+    for(uword col=0; col < y_n_cols; ++col)
+      {
+      c_col_ptrs[col+1] = spglue_times::count_col(x, y, col, mark_mem);
+      }
+    
+    for(uword col=0; col < y_n_cols; ++col)  { c_col_ptrs[col+1] += c_col_ptrs[col]; }
+    
+    c.mem_resize(c_col_ptrs[y_n_cols]);
+    
+    mark.zeros();
+    
+    podarray<eT> sums(x_n_rows, arma_zeros_indicator());
+    
+    eT* sums_mem = sums.memptr();
+    
+    for(uword col=0; col < y_n_cols; ++col)
+      {
+      spglue_times::fill_col(c, x, y, col, sums_mem, mark_mem, sort_rows);
+      }
     }
   
-  // Now that we know a decent bound on the number of nonzero elements,
-  // allocate the memory and fill it.
-  
-  const uword max_n_nonzero = c.col_ptrs[c.n_cols];
+  // remove elements which evaluated to zero through cancellation
   
-  c.mem_resize(max_n_nonzero);
+  const uword max_n_nonzero = c.n_nonzero;
   
-  // Now the implementation of the NUMBMM algorithm.
-  uword cur_pos = 0; // Current position in c matrix.
-  podarray<eT> sums(x_n_rows); // Partial sums.
-  sums.zeros();
+  uword* c_row_indices = access::rwp(c.row_indices);
+  eT*    c_values      = access::rwp(c.values);
   
-  podarray<uword> sorted_indices(x_n_rows);  // upper bound
+  uword cur_pos = 0;
+  uword start   = 0;
   
-  // last_ind is already set to x_n_rows, and cur_col_length is already set to 0.
-  // We will loop through all columns as necessary.
-  uword cur_col = 0;
-  while(cur_col < c.n_cols)
+  for(uword col=0; col < y_n_cols; ++col)
     {
-    // Skip to next column with elements in it.
-    while((cur_col < c.n_cols) && (c.col_ptrs[cur_col] == c.col_ptrs[cur_col + 1]))
-      {
-      // Update current column pointer to actual number of nonzero elements up
-      // to this point.
-      access::rw(c.col_ptrs[cur_col]) = cur_pos;
-      ++cur_col;
-      }
+    const uword end = c_col_ptrs[col+1];
     
-    if(cur_col == c.n_cols)  { break; }
-    
-    // Update current column pointer.
-    access::rw(c.col_ptrs[cur_col]) = cur_pos;
-    
-    // Check all elements in this column.
-    typename SpMat<eT>::const_iterator y_col_it = y.begin_col_no_sync(cur_col);
-    
-    while(y_col_it.col() == cur_col)
+    for(uword i=start; i < end; ++i)
       {
-      const uword y_col_it_row = y_col_it.row();
-      
-      // Check all elements in the column of the other matrix corresponding to
-      // the row of this column.
-      typename SpMat<eT>::const_iterator x_col_it = x.begin_col_no_sync(y_col_it_row);
+      const eT val = c_values[i];
       
-      const eT y_value = (*y_col_it);
-      
-      while(x_col_it.col() == y_col_it_row)
+      if(val != eT(0))
         {
-        const uword x_col_it_row = x_col_it.row();
-        
-        // A point at x(i, j) and y(j, k) implies a point at c(i, k).
-        // Add to partial sum.
-        const eT x_value = (*x_col_it);
-        sums[x_col_it_row] += (x_value * y_value);
-        
-        // Add point if it hasn't already been marked.
-        if(index[x_col_it_row] == x_n_rows)
-          {
-          index[x_col_it_row] = last_ind;
-          last_ind = x_col_it_row;
-          }
-        
-        ++x_col_it;
+        c_row_indices[cur_pos] = c_row_indices[i];
+        c_values     [cur_pos] = val;
+        ++cur_pos;
         }
-      
-      ++y_col_it;
       }
     
-    // Now sort the indices that were used in this column.
-    uword cur_index = 0;
-    while(last_ind != x_n_rows + 1)
-      {
-      const uword tmp = last_ind;
-      
-      // Check that it wasn't a "fake" nonzero element.
-      if(sums[tmp] != eT(0))
-        {
-        // Assign to next open position.
-        sorted_indices[cur_index] = tmp;
-        ++cur_index;
-        }
+    start = end;
+    
+    c_col_ptrs[col+1] = cur_pos;
+    }
+  
+  if(cur_pos < max_n_nonzero)  { c.mem_resize(cur_pos); }
+  }
 
-      last_ind = index[tmp];
-      index[tmp] = x_n_rows;
-      }
+
+
+//! number of distinct rows in column 'col' of x*y;
+//! mark[row] is set to col+1 for each row present
+template<typename eT>
+inline
+uword
+spglue_times::count_col(const SpMat<eT>& x, const SpMat<eT>& y, const uword col, uword* mark)
+  {
+  const uword* x_col_ptrs    = x.col_ptrs;
+  const uword* x_row_indices = x.row_indices;
+  
+  const uword* y_col_ptrs    = y.col_ptrs;
+  const uword* y_row_indices = y.row_indices;
+  
+  const uword stamp = col + 1;
+  
+  uword count = 0;
+  
+  const uword y_start = y_col_ptrs[col  ];
+  const uword y_end   = y_col_ptrs[col+1];
+  
+  for(uword j=y_start; j < y_end; ++j)
+    {
+    const uword k = y_row_indices[j];
+    
+    const uword x_start = x_col_ptrs[k  ];
+    const uword x_end   = x_col_ptrs[k+1];
     
-    // Now sort the indices.
-    if(cur_index != 0)
+    for(uword i=x_start; i < x_end; ++i)
       {
-      op_sort::direct_sort_ascending(sorted_indices.memptr(), cur_index);
-
-      for(uword k = 0; k < cur_index; ++k)
-        {
-        const uword row = sorted_indices[k];
-        access::rw(c.row_indices[cur_pos]) = row;
-        access::rw(c.values[cur_pos]) = sums[row];
-        sums[row] = eT(0);
-        ++cur_pos;
-        }
+      const uword row = x_row_indices[i];
+      
+      if(mark[row] != stamp)  { mark[row] = stamp; ++count; }
       }
-
-    // Move to next column.
-    ++cur_col;
     }
   
-  // Update last column pointer and resize to actual memory size.
+  return count;
+  }
+
+
+
+//! computes column 'col' of x*y and stores it at the position given by c.col_ptrs[col];
+//! the used elements of sums are reset to zero
+template<typename eT>
+inline
+void
+spglue_times::fill_col(SpMat<eT>& c, const SpMat<eT>& x, const SpMat<eT>& y, const uword col, eT* sums, uword* mark, const bool sort_rows)
+  {
+  const uword* x_col_ptrs    = x.col_ptrs;
+  const uword* x_row_indices = x.row_indices;
+  const eT*    x_values      = x.values;
+  
+  const uword* y_col_ptrs    = y.col_ptrs;
+  const uword* y_row_indices = y.row_indices;
+  const eT*    y_values      = y.values;
   
-  // access::rw(c.col_ptrs[c.n_cols]) = cur_pos;
-  // c.mem_resize(cur_pos);
+  const uword c_start = c.col_ptrs[col];
   
-  access::rw(c.col_ptrs[c.n_cols]) = cur_pos;
+  uword* c_row_indices = access::rwp(c.row_indices) + c_start;
+  eT*    c_values      = access::rwp(c.values)      + c_start;
   
-  if(cur_pos < max_n_nonzero)  { c.mem_resize(cur_pos); }
+  const uword stamp = col + 1;
+  
+  uword count = 0;
+  
+  const uword y_start = y_col_ptrs[col  ];
+  const uword y_end   = y_col_ptrs[col+1];
+  
+  for(uword j=y_start; j < y_end; ++j)
+    {
+    const uword k       = y_row_indices[j];
+    const eT    y_value = y_values[j];
+    
+    const uword x_start = x_col_ptrs[k  ];
+    const uword x_end   = x_col_ptrs[k+1];
+    
+    for(uword i=x_start; i < x_end; ++i)
+      {
+      const uword row = x_row_indices[i];
+      
+      sums[row] += x_values[i] * y_value;
+      
+      if(mark[row] != stamp)  { mark[row] = stamp; c_row_indices[count] = row; ++count; }
+      }
+    }
+  
+  if(sort_rows && (count > 1))  { op_sort::direct_sort_ascending(c_row_indices, count); }
+  
+  for(uword i=0; i < count; ++i)
+    {
+    const uword row = c_row_indices[i];
+    
+    c_values[i] = sums[row];
+    sums[row]   = eT(0);
+    }
   }
 
 
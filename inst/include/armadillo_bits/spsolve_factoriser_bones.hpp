@@ -21,6 +21,34 @@
 
 
 
+//! holds either a sparse Cholesky factorisation (for symmetric/hermitian positive definite matrices) or a sparse LU factorisation
+template<typename eT>
+struct spsolve_factoriser_worker
+  {
+  typedef typename get_pod_type<eT>::result T;
+  
+  #if defined(ARMA_USE_SUPERLU)
+    typedef superlu_worker<eT> lu_worker_type;
+  #else
+    typedef   sp_lu_worker<eT> lu_worker_type;
+  #endif
+  
+  bool               use_chol = false;
+  sp_chol_worker<eT> chol;
+  lu_worker_type     lu;
+  
+  double time_symbolic = 0.0;
+  double time_numeric  = 0.0;
+  
+  inline bool factorise(T& out_rcond, const SpMat<eT>& A, const superlu_opts& user_opts, const bool reuse_ordering);
+  
+  inline bool solve(Mat<eT>& X, const Mat<eT>& B);
+  
+  inline bool log_det(eT& out_val, T& out_sign) const;
+  };
+
+
+
 class spsolve_factoriser
   {
   private:
@@ -29,11 +57,15 @@ class spsolve_factoriser
   uword    elem_type_indicator = 0;
   uword    n_rows              = 0;
   double   rcond_value         = double(0);
+  double   time_symbolic_value = double(0);
+  double   time_numeric_value  = double(0);
   
   template<typename worker_type> inline void delete_worker();
   
   inline void cleanup();
   
+  template<typename T1> inline bool factorise_helper(const SpBase<typename T1::elem_type,T1>& A_expr, const spsolve_opts_base& settings, const bool reuse_ordering);
+  
   
   public:
   
@@ -44,10 +76,17 @@ class spsolve_factoriser
   
   inline double rcond() const;
   
+  inline double symbolic_time() const;
+  inline double  numeric_time() const;
+  
   template<typename T1> inline bool factorise(const SpBase<typename T1::elem_type,T1>& A_expr, const spsolve_opts_base& settings = spsolve_opts_none(), const typename arma_blas_real_or_cx_only<typename T1::elem_type>::result* junk = nullptr);
   
+  template<typename T1> inline bool refactorise(const SpBase<typename T1::elem_type,T1>& A_expr, const spsolve_opts_base& settings = spsolve_opts_none(), const typename arma_blas_real_or_cx_only<typename T1::elem_type>::result* junk = nullptr);
+  
   template<typename T1> inline bool solve(Mat<typename T1::elem_type>& X, const Base<typename T1::elem_type,T1>& B_expr, const typename arma_blas_real_or_cx_only<typename T1::elem_type>::result* junk = nullptr);
   
+  template<typename eT> inline bool log_det(eT& out_val, typename get_pod_type<eT>::result& out_sign, const typename arma_blas_real_or_cx_only<eT>::result* junk = nullptr) const;
+  
   inline      spsolve_factoriser(const spsolve_factoriser&) = delete;
   inline void operator=         (const spsolve_factoriser&) = delete;
   };
@@ -21,6 +21,93 @@
 
 
 
+template<typename eT>
+inline
+bool
+spsolve_factoriser_worker<eT>::factorise(T& out_rcond, const SpMat<eT>& A, const superlu_opts& user_opts, const bool reuse_ordering)
+  {
+  arma_debug_sigprint();
+  
+  time_symbolic = 0.0;
+  time_numeric  = 0.0;
+  
+  // when refactorising, the type of the previous factorisation is kept, unless the sparse Cholesky factorisation fails
+  
+  const bool try_chol = (reuse_ordering) ? use_chol : ( (user_opts.try_chol) && ((user_opts.likely_sympd) || sym_helper::guess_sympd(A)) );
+  
+  use_chol = false;
+  
+  if(try_chol)
+    {
+    arma_debug_print("spsolve_factoriser: attempting sparse Cholesky factorisation");
+    
+    use_chol = chol.factorise(out_rcond, A, user_opts);
+    
+    time_symbolic += chol.time_symbolic;
+    time_numeric  += chol.time_numeric;
+    
+    if(use_chol)  { return true; }
+    
+    arma_debug_print("spsolve_factoriser: sparse Cholesky factorisation failed; falling back to LU");
+    }
+  
+  const bool status = lu.factorise(out_rcond, A, user_opts, reuse_ordering);
+  
+  time_symbolic += lu.time_symbolic;
+  time_numeric  += lu.time_numeric;
+  
+  return status;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+spsolve_factoriser_worker<eT>::solve(Mat<eT>& X, const Mat<eT>& B)
+  {
+  arma_debug_sigprint();
+  
+  return (use_chol) ? chol.solve(X,B) : lu.solve(X,B);
+  }
+
+
+
+template<typename eT>
+inline
+bool
+spsolve_factoriser_worker<eT>::log_det(eT& out_val, T& out_sign) const
+  {
+  arma_debug_sigprint();
+  
+  if(use_chol)
+    {
+    if(chol.factorisation_valid == false)  { return false; }
+    
+    out_val  = eT(chol.log_det());
+    out_sign = T(1);
+    
+    return true;
+    }
+  
+  #if defined(ARMA_USE_SUPERLU)
+    {
+    arma_ignore(out_val);
+    arma_ignore(out_sign);
+    
+    arma_debug_print("spsolve_factoriser::log_det(): not available for SuperLU based factorisation");
+    
+    return false;
+    }
+  #else
+    {
+    return lu.log_det(out_val, out_sign);
+    }
+  #endif
+  }
+
+
+
 template<typename worker_type>
 inline
 void
@@ -46,19 +133,17 @@ spsolve_factoriser::cleanup()
   {
   arma_debug_sigprint();
   
-  #if defined(ARMA_USE_SUPERLU)
-    {
-         if(elem_type_indicator == 1)  { delete_worker< superlu_worker<    float> >(); }
-    else if(elem_type_indicator == 2)  { delete_worker< superlu_worker<   double> >(); }
-    else if(elem_type_indicator == 3)  { delete_worker< superlu_worker< cx_float> >(); }
-    else if(elem_type_indicator == 4)  { delete_worker< superlu_worker<cx_double> >(); }
-    }
-  #endif
+       if(elem_type_indicator == 1)  { delete_worker< spsolve_factoriser_worker<    float> >(); }
+  else if(elem_type_indicator == 2)  { delete_worker< spsolve_factoriser_worker<   double> >(); }
+  else if(elem_type_indicator == 3)  { delete_worker< spsolve_factoriser_worker< cx_float> >(); }
+  else if(elem_type_indicator == 4)  { delete_worker< spsolve_factoriser_worker<cx_double> >(); }
   
   worker_ptr          = nullptr;
   elem_type_indicator = 0;
   n_rows              = 0;
   rcond_value         = double(0);
+  time_symbolic_value = double(0);
+  time_numeric_value  = double(0);
   }
 
 
@@ -103,6 +188,30 @@ spsolve_factoriser::rcond() const
 
 
 
+//! seconds spent on the symbolic phase (ordering and symbolic analysis) of the last factorisation
+inline
+double
+spsolve_factoriser::symbolic_time() const
+  {
+  arma_debug_sigprint();
+  
+  return time_symbolic_value;
+  }
+
+
+
+//! seconds spent on the numeric phase of the last factorisation
+inline
+double
+spsolve_factoriser::numeric_time() const
+  {
+  arma_debug_sigprint();
+  
+  return time_numeric_value;
+  }
+
+
+
 template<typename T1>
 inline
 bool
@@ -116,89 +225,133 @@ spsolve_factoriser::factorise
   arma_debug_sigprint();
   arma_ignore(junk);
   
-  #if defined(ARMA_USE_SUPERLU)
+  return (*this).factorise_helper(A_expr, settings, false);
+  }
+
+
+
+//! factorise a matrix with the same sparsity pattern as the previously factorised matrix,
+//! reusing the fill-reducing ordering and (for sparse Cholesky) the symbolic analysis;
+//! if there is no previous factorisation, this is equivalent to factorise()
+template<typename T1>
+inline
+bool
+spsolve_factoriser::refactorise
+  (
+  const SpBase<typename T1::elem_type,T1>& A_expr,
+  const spsolve_opts_base&                 settings,
+  const typename arma_blas_real_or_cx_only<typename T1::elem_type>::result* junk
+  )
+  {
+  arma_debug_sigprint();
+  arma_ignore(junk);
+  
+  return (*this).factorise_helper(A_expr, settings, true);
+  }
+
+
+
+template<typename T1>
+inline
+bool
+spsolve_factoriser::factorise_helper
+  (
+  const SpBase<typename T1::elem_type,T1>& A_expr,
+  const spsolve_opts_base&                 settings,
+  const bool                               reuse_ordering
+  )
+  {
+  arma_debug_sigprint();
+  
+  typedef typename T1::elem_type            eT;
+  typedef typename get_pod_type<eT>::result  T;
+  
+  typedef spsolve_factoriser_worker<eT> worker_type;
+  
+  //
+  
+  uword local_elem_type_indicator = 0;
+  
+       if(    is_float<eT>::value)  { local_elem_type_indicator = 1; }
+  else if(   is_double<eT>::value)  { local_elem_type_indicator = 2; }
+  else if( is_cx_float<eT>::value)  { local_elem_type_indicator = 3; }
+  else if(is_cx_double<eT>::value)  { local_elem_type_indicator = 4; }
+  
+  // an existing worker for the same element type is retained,
+  // so that the symbolic analysis of a sparse Cholesky factorisation can be reused if the sparsity pattern is unchanged
+  
+  if( (worker_ptr != nullptr) && (elem_type_indicator != local_elem_type_indicator) )  { cleanup(); }
+  
+  n_rows              = 0;
+  rcond_value         = double(0);
+  time_symbolic_value = double(0);
+  time_numeric_value  = double(0);
+  
+  //
+  
+  const unwrap_spmat<T1> U(A_expr.get_ref());
+  const SpMat<eT>& A =   U.M;
+  
+  if(A.is_square() == false)
     {
-    typedef typename T1::elem_type            eT;
-    typedef typename get_pod_type<eT>::result  T;
-    
-    typedef superlu_worker<eT> worker_type;
-    
-    //
-    
+    arma_warn(1, "spsolve_factoriser::factorise(): solving under-determined / over-determined systems is currently not supported");
     cleanup();
-    
-    //
-    
-    const unwrap_spmat<T1> U(A_expr.get_ref());
-    const SpMat<eT>& A =   U.M;
-    
-    if(A.is_square() == false)
-      {
-      arma_warn(1, "spsolve_factoriser::factorise(): solving under-determined / over-determined systems is currently not supported");
-      return false;
-      }
-    
-    n_rows = A.n_rows;
-    
-    //
-    
-    superlu_opts superlu_opts_default;
-    
-    const superlu_opts& opts = (settings.id == 1) ? static_cast<const superlu_opts&>(settings) : superlu_opts_default;
-    
-    if( (opts.pivot_thresh < double(0)) || (opts.pivot_thresh > double(1)) )
-      {
-      arma_warn(1, "spsolve_factoriser::factorise(): pivot_thresh must be in the [0,1] interval" );
-      return false;
-      }
-    
-    //
-    
+    return false;
+    }
+  
+  n_rows = A.n_rows;
+  
+  //
+  
+  superlu_opts superlu_opts_default;
+  
+  const superlu_opts& opts = (settings.id == 1) ? static_cast<const superlu_opts&>(settings) : superlu_opts_default;
+  
+  if( (opts.pivot_thresh < double(0)) || (opts.pivot_thresh > double(1)) )
+    {
+    arma_warn(1, "spsolve_factoriser::factorise(): pivot_thresh must be in the [0,1] interval" );
+    cleanup();
+    return false;
+    }
+  
+  //
+  
+  if(worker_ptr == nullptr)
+    {
     worker_ptr = new(std::nothrow) worker_type;
-    
+  
     if(worker_ptr == nullptr)
       {
       arma_warn(3, "spsolve_factoriser::factorise(): could not construct worker object");
       return false;
       }
-    
-    //
-    
-         if(    is_float<eT>::value)  { elem_type_indicator = 1; }
-    else if(   is_double<eT>::value)  { elem_type_indicator = 2; }
-    else if( is_cx_float<eT>::value)  { elem_type_indicator = 3; }
-    else if(is_cx_double<eT>::value)  { elem_type_indicator = 4; }
-    
-    //
-    
-    worker_type* local_worker_ptr = reinterpret_cast<worker_type*>(worker_ptr);
-    worker_type& local_worker_ref = (*local_worker_ptr);
-    
-    //
-    
-    T local_rcond_value = T(0);
-    
-    const bool status = local_worker_ref.factorise(local_rcond_value, A, opts);
-    
-    rcond_value = double(local_rcond_value);
-    
-    if( (status == false) || arma_isnan(local_rcond_value) || ((opts.allow_ugly == false) && (local_rcond_value < std::numeric_limits<T>::epsilon())) )
-      {
-      arma_warn(3, "spsolve_factoriser::factorise(): factorisation failed; rcond: ", local_rcond_value);
-      delete_worker<worker_type>();
-      return false;
-      }
-    
-    return true;
     }
-  #else
+  
+  elem_type_indicator = local_elem_type_indicator;
+  
+  //
+  
+  worker_type* local_worker_ptr = reinterpret_cast<worker_type*>(worker_ptr);
+  worker_type& local_worker_ref = (*local_worker_ptr);
+  
+  //
+  
+  T local_rcond_value = T(0);
+  
+  const bool status = local_worker_ref.factorise(local_rcond_value, A, opts, reuse_ordering);
+  
+  rcond_value         = double(local_rcond_value);
+  time_symbolic_value = local_worker_ref.time_symbolic;
+  time_numeric_value  = local_worker_ref.time_numeric;
+  
+  if( (status == false) || arma_isnan(local_rcond_value) || ((opts.allow_ugly == false) && (local_rcond_value < std::numeric_limits<T>::epsilon())) )
     {
-    arma_ignore(A_expr);
-    arma_ignore(settings);
-    arma_stop_logic_error("spsolve_factoriser::factorise(): use of SuperLU must be enabled");
+    arma_warn(3, "spsolve_factoriser::factorise(): factorisation failed; rcond: ", local_rcond_value);
+    delete_worker<worker_type>();
     return false;
     }
-  #endif
+  
+  return true;
   }
 
 
@@ -216,72 +369,112 @@ spsolve_factoriser::solve
   arma_debug_sigprint();
   arma_ignore(junk);
   
-  #if defined(ARMA_USE_SUPERLU)
+  typedef typename T1::elem_type eT;
+  
+  typedef spsolve_factoriser_worker<eT> worker_type;
+  
+  if(worker_ptr == nullptr)
     {
-    typedef typename T1::elem_type eT;
-    
-    typedef superlu_worker<eT> worker_type;
-    
-    if(worker_ptr == nullptr)
-      {
-      arma_warn(2, "spsolve_factoriser::solve(): no factorisation available");
-      X.soft_reset();
-      return false;
-      }
-    
-    bool type_mismatch = false;
-    
-         if(    (is_float<eT>::value) && (elem_type_indicator != 1) )  { type_mismatch = true; }
-    else if(   (is_double<eT>::value) && (elem_type_indicator != 2) )  { type_mismatch = true; }
-    else if( (is_cx_float<eT>::value) && (elem_type_indicator != 3) )  { type_mismatch = true; }
-    else if((is_cx_double<eT>::value) && (elem_type_indicator != 4) )  { type_mismatch = true; }
-    
-    if(type_mismatch)
-      {
-      arma_warn(1, "spsolve_factoriser::solve(): matrix type mismatch");
-      X.soft_reset();
-      return false;
-      }
-    
-    const quasi_unwrap<T1> U(B_expr.get_ref());
-    const Mat<eT>& B     = U.M;
-    
-    if(n_rows != B.n_rows)
-      {
-      arma_warn(1, "spsolve_factoriser::solve(): matrix size mismatch");
-      X.soft_reset();
-      return false;
-      }
+    arma_warn(2, "spsolve_factoriser::solve(): no factorisation available");
+    X.soft_reset();
+    return false;
+    }
+  
+  bool type_mismatch = false;
+  
+       if(    (is_float<eT>::value) && (elem_type_indicator != 1) )  { type_mismatch = true; }
+  else if(   (is_double<eT>::value) && (elem_type_indicator != 2) )  { type_mismatch = true; }
+  else if( (is_cx_float<eT>::value) && (elem_type_indicator != 3) )  { type_mismatch = true; }
+  else if((is_cx_double<eT>::value) && (elem_type_indicator != 4) )  { type_mismatch = true; }
+  
+  if(type_mismatch)
+    {
+    arma_warn(1, "spsolve_factoriser::solve(): matrix type mismatch");
+    X.soft_reset();
+    return false;
+    }
+  
+  const quasi_unwrap<T1> U(B_expr.get_ref());
+  const Mat<eT>& B     = U.M;
+  
+  if(n_rows != B.n_rows)
+    {
+    arma_warn(1, "spsolve_factoriser::solve(): matrix size mismatch");
+    X.soft_reset();
+    return false;
+    }
 
-    const bool is_alias = U.is_alias(X);
-    
-    Mat<eT>  tmp;
-    Mat<eT>& out = is_alias ? tmp : X;
-    
-    worker_type* local_worker_ptr = reinterpret_cast<worker_type*>(worker_ptr);
-    worker_type& local_worker_ref = (*local_worker_ptr);
-    
-    const bool status = local_worker_ref.solve(out,B);
-    
-    if(is_alias)  { X.steal_mem(tmp); }
-    
-    if(status == false)
-      {
-      arma_warn(3, "spsolve_factoriser::solve(): solution not found");
-      X.soft_reset();
-      return false;
-      }
-    
-    return true;
+  const bool is_alias = U.is_alias(X);
+  
+  Mat<eT>  tmp;
+  Mat<eT>& out = is_alias ? tmp : X;
+  
+  worker_type* local_worker_ptr = reinterpret_cast<worker_type*>(worker_ptr);
+  worker_type& local_worker_ref = (*local_worker_ptr);
+  
+  const bool status = local_worker_ref.solve(out,B);
+  
+  if(is_alias)  { X.steal_mem(tmp); }
+  
+  if(status == false)
+    {
+    arma_warn(3, "spsolve_factoriser::solve(): solution not found");
+    X.soft_reset();
+    return false;
     }
-  #else
+  
+  return true;
+  }
+
+
+
+//! log determinant of the factorised matrix;
+//! for symmetric/hermitian positive definite matrices this is obtained directly from the diagonal of the Cholesky factor
+template<typename eT>
+inline
+bool
+spsolve_factoriser::log_det
+  (
+  eT&                                  out_val,
+  typename get_pod_type<eT>::result&   out_sign,
+  const typename arma_blas_real_or_cx_only<eT>::result* junk
+  ) const
+  {
+  arma_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef spsolve_factoriser_worker<eT> worker_type;
+  
+  if(worker_ptr == nullptr)
     {
-    arma_ignore(X);
-    arma_ignore(B_expr);
-    arma_stop_logic_error("spsolve_factoriser::solve(): use of SuperLU must be enabled");
+    arma_warn(2, "spsolve_factoriser::log_det(): no factorisation available");
     return false;
     }
-  #endif
+  
+  bool type_mismatch = false;
+  
+       if(    (is_float<eT>::value) && (elem_type_indicator != 1) )  { type_mismatch = true; }
+  else if(   (is_double<eT>::value) && (elem_type_indicator != 2) )  { type_mismatch = true; }
+  else if( (is_cx_float<eT>::value) && (elem_type_indicator != 3) )  { type_mismatch = true; }
+  else if((is_cx_double<eT>::value) && (elem_type_indicator != 4) )  { type_mismatch = true; }
+  
+  if(type_mismatch)
+    {
+    arma_warn(1, "spsolve_factoriser::log_det(): matrix type mismatch");
+    return false;
+    }
+  
+  const worker_type* local_worker_ptr = reinterpret_cast<const worker_type*>(worker_ptr);
+  
+  const bool status = local_worker_ptr->log_det(out_val, out_sign);
+  
+  if(status == false)
+    {
+    arma_warn(3, "spsolve_factoriser::log_det(): determinant not available");
+    return false;
+    }
+  
+  return true;
   }
 
 
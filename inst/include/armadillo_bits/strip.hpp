@@ -164,6 +164,120 @@ struct strip_trimat< Op<T1, op_trimat> >
 
 
 
+template<typename T1>
+struct strip_symmat
+  {
+  typedef T1 stored_type;
+  
+  const T1& M;
+  
+  static constexpr bool do_symmat  = false;
+  static constexpr bool do_symmatu = false;
+  static constexpr bool do_symmatl = false;
+  static constexpr bool do_conj    = false;
+  
+  inline
+  strip_symmat(const T1& X)
+    : M(X)
+    {
+    arma_debug_sigprint();
+    }
+  };
+
+
+
+template<typename T1>
+struct strip_symmat< Op<T1, op_symmatu> >
+  {
+  typedef T1 stored_type;
+  
+  const T1& M;
+  
+  static constexpr bool do_symmat  = true;
+  static constexpr bool do_symmatu = true;
+  static constexpr bool do_symmatl = false;
+  static constexpr bool do_conj    = false;
+  
+  inline
+  strip_symmat(const Op<T1, op_symmatu>& X)
+    : M(X.m)
+    {
+    arma_debug_sigprint();
+    }
+  };
+
+
+
+template<typename T1>
+struct strip_symmat< Op<T1, op_symmatl> >
+  {
+  typedef T1 stored_type;
+  
+  const T1& M;
+  
+  static constexpr bool do_symmat  = true;
+  static constexpr bool do_symmatu = false;
+  static constexpr bool do_symmatl = true;
+  static constexpr bool do_conj    = false;
+  
+  inline
+  strip_symmat(const Op<T1, op_symmatl>& X)
+    : M(X.m)
+    {
+    arma_debug_sigprint();
+    }
+  };
+
+
+
+template<typename T1>
+struct strip_symmat< Op<T1, op_symmatu_cx> >
+  {
+  typedef T1 stored_type;
+  
+  const T1& M;
+  
+  static constexpr bool do_symmat  = true;
+  static constexpr bool do_symmatu = true;
+  static constexpr bool do_symmatl = false;
+  
+  const bool do_conj;
+  
+  inline
+  strip_symmat(const Op<T1, op_symmatu_cx>& X)
+    : M(X.m)
+    , do_conj(X.aux_uword_b == 1)
+    {
+    arma_debug_sigprint();
+    }
+  };
+
+
+
+template<typename T1>
+struct strip_symmat< Op<T1, op_symmatl_cx> >
+  {
+  typedef T1 stored_type;
+  
+  const T1& M;
+  
+  static constexpr bool do_symmat  = true;
+  static constexpr bool do_symmatu = false;
+  static constexpr bool do_symmatl = true;
+  
+  const bool do_conj;
+  
+  inline
+  strip_symmat(const Op<T1, op_symmatl_cx>& X)
+    : M(X.m)
+    , do_conj(X.aux_uword_b == 1)
+    {
+    arma_debug_sigprint();
+    }
+  };
+
+
+
 //
 
 
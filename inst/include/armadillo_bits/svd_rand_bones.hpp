@@ -0,0 +1,80 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 The RcppArmadillo Authors
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup svd_rand
+//! @{
+
+
+//! out = A*X and out = A'*X for dense A; both products are done by BLAS without forming A'
+template<typename eT>
+struct svd_rand_op_mat
+  {
+  const uword n_rows;
+  const uword n_cols;
+  
+  const Mat<eT>& A;
+  
+  inline svd_rand_op_mat(const Mat<eT>& in_A);
+  
+  inline void apply      (Mat<eT>& out, const Mat<eT>& X) const;
+  inline void apply_trans(Mat<eT>& out, const Mat<eT>& X) const;
+  };
+
+
+
+//! out = A*X and out = A'*X for sparse A;
+//! A' is formed once, so that both products use the parallel sparse-dense multiplication
+template<typename eT>
+struct svd_rand_op_spmat
+  {
+  const uword n_rows;
+  const uword n_cols;
+  
+  const SpMat<eT>& A;
+  
+  SpMat<eT> At;
+  
+  inline svd_rand_op_spmat(const SpMat<eT>& in_A);
+  
+  inline void apply      (Mat<eT>& out, const Mat<eT>& X) const;
+  inline void apply_trans(Mat<eT>& out, const Mat<eT>& X) const;
+  };
+
+
+
+//! randomised truncated SVD via range finding (Halko, Martinsson, Tropp, 2011);
+//! the matrix is only accessed through products with blocks of vectors
+struct svd_rand_worker
+  {
+  //! U*diagmat(S)*V' approximates the k largest singular triplets of A - ones*mu;
+  //! mu is a row vector of column means to be subtracted implicitly, or empty for no centering
+  template<typename eT, typename op_type>
+  inline static bool apply(Mat<eT>& U, Col<typename get_pod_type<eT>::result>& S, Mat<eT>& V, const op_type& op, const Row<eT>& mu, const uword k, const svd_rand_opts& opts, const bool calc_UV);
+  
+  //! out = (A - ones*mu)*X or out = (A - ones*mu)'*X
+  template<typename eT, typename op_type>
+  inline static void times(Mat<eT>& out, const op_type& op, const Row<eT>& mu, const Mat<eT>& X, const bool trans);
+  
+  //! orthonormal basis for the range of Y
+  template<typename eT>
+  inline static bool orth(Mat<eT>& Q, const Mat<eT>& Y);
+  };
+
+
+
+//! @}
@@ -0,0 +1,240 @@
+// SPDX-License-Identifier: Apache-2.0
+// 
+// Copyright 2026 The RcppArmadillo Authors
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// https://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+//! \addtogroup svd_rand
+//! @{
+
+
+
+template<typename eT>
+inline
+svd_rand_op_mat<eT>::svd_rand_op_mat(const Mat<eT>& in_A)
+  : n_rows(in_A.n_rows)
+  , n_cols(in_A.n_cols)
+  , A     (in_A)
+  {
+  arma_debug_sigprint();
+  }
+
+
+
+template<typename eT>
+inline
+void
+svd_rand_op_mat<eT>::apply(Mat<eT>& out, const Mat<eT>& X) const
+  {
+  arma_debug_sigprint();
+  
+  out = A * X;
+  }
+
+
+
+template<typename eT>
+inline
+void
+svd_rand_op_mat<eT>::apply_trans(Mat<eT>& out, const Mat<eT>& X) const
+  {
+  arma_debug_sigprint();
+  
+  out = A.t() * X;
+  }
+
+
+
+template<typename eT>
+inline
+svd_rand_op_spmat<eT>::svd_rand_op_spmat(const SpMat<eT>& in_A)
+  : n_rows(in_A.n_rows)
+  , n_cols(in_A.n_cols)
+  , A     (in_A)
+  , At    (in_A.t())
+  {
+  arma_debug_sigprint();
+  }
+
+
+
+template<typename eT>
+inline
+void
+svd_rand_op_spmat<eT>::apply(Mat<eT>& out, const Mat<eT>& X) const
+  {
+  arma_debug_sigprint();
+  
+  out = A * X;
+  }
+
+
+
+template<typename eT>
+inline
+void
+svd_rand_op_spmat<eT>::apply_trans(Mat<eT>& out, const Mat<eT>& X) const
+  {
+  arma_debug_sigprint();
+  
+  out = At * X;
+  }
+
+
+
+template<typename eT, typename op_type>
+inline
+void
+svd_rand_worker::times(Mat<eT>& out, const op_type& op, const Row<eT>& mu, const Mat<eT>& X, const bool trans)
+  {
+  arma_debug_sigprint();
+  
+  if(trans == false)
+    {
+    op.apply(out, X);
+    
+    // (A - ones*mu)*X = A*X - ones*(mu*X)
+    
+    if(mu.n_elem > 0)  { out.each_row() -= (mu * X); }
+    }
+  else
+    {
+    op.apply_trans(out, X);
+    
+    // (A - ones*mu)'*X = A'*X - mu'*(ones'*X)
+    
+    if(mu.n_elem > 0)  { out -= mu.t() * sum(X, 0); }
+    }
+  }
+
+
+
+template<typename eT>
+inline
+bool
+svd_rand_worker::orth(Mat<eT>& Q, const Mat<eT>& Y)
+  {
+  arma_debug_sigprint();
+  
+  Mat<eT> R;
+  
+  return qr_econ(Q, R, Y);
+  }
+
+
+
+template<typename eT, typename op_type>
+inline
+bool
+svd_rand_worker::apply(Mat<eT>& U, Col<typename get_pod_type<eT>::result>& S, Mat<eT>& V, const op_type& op, const Row<eT>& mu, const uword k, const svd_rand_opts& opts, const bool calc_UV)
+  {
+  arma_debug_sigprint();
+  
+  const uword m = op.n_rows;
+  const uword n = op.n_cols;
+  
+  const uword min_mn = (std::min)(m, n);
+  
+  const uword kk = (std::min)(k, min_mn);
+  
+  if(kk == 0)
+    {
+    S.reset();
+    
+    if(calc_UV)  { U.set_size(m, 0); V.set_size(n, 0); }
+    
+    return true;
+    }
+  
+  const uword l = (std::min)(kk + uword(opts.oversample), min_mn);
+  
+  // for wide matrices the range of A' is sampled instead of the range of A,
+  // so that the basis Q is always in the larger dimension and the small matrix Z has l columns
+  
+  const bool wide = (m < n);
+  
+  Mat<eT> Omega;
+  
+  Omega.randn( (wide ? m : n), l );
+  
+  Mat<eT> Y;
+  Mat<eT> Q;
+  Mat<eT> Z;
+  
+  svd_rand_worker::times(Y, op, mu, Omega, wide);
+  
+  Omega.reset();
+  
+  if(svd_rand_worker::orth(Q, Y) == false)  { return false; }
+  
+  // power iterations sharpen the decay of the singular values;
+  // re-orthonormalising after each product avoids loss of the smaller singular directions to round-off
+  
+  for(uword iter=0; iter < uword(opts.n_iter); ++iter)
+    {
+    svd_rand_worker::times(Z, op, mu, Q, !wide);
+    
+    if(svd_rand_worker::orth(Q, Z) == false)  { return false; }
+    
+    svd_rand_worker::times(Y, op, mu, Q, wide);
+    
+    if(svd_rand_worker::orth(Q, Y) == false)  { return false; }
+    }
+  
+  Y.reset();
+  
+  // tall: A ~= Q*Z' with Z = A'*Q;  wide: A ~= Z*Q' with Z = A*Q
+  
+  svd_rand_worker::times(Z, op, mu, Q, !wide);
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  Col<T> s;
+  
+  if(calc_UV == false)
+    {
+    if(svd(s, Z) == false)  { return false; }
+    
+    S = s.head(kk);
+    
+    return true;
+    }
+  
+  Mat<eT> W;
+  Mat<eT> X;
+  
+  // Z = W*diagmat(s)*X'
+  
+  if(svd_econ(W, s, X, Z) == false)  { return false; }
+  
+  S = s.head(kk);
+  
+  if(wide == false)
+    {
+    U = Q * X.head_cols(kk);
+    V = W.head_cols(kk);
+    }
+  else
+    {
+    U = W.head_cols(kk);
+    V = Q * X.head_cols(kk);
+    }
+  
+  return true;
+  }
+
+
+
+//! @}
@@ -261,6 +261,130 @@ guess_sympd(const Mat<eT>& A, const uword min_n_rows)
 
 
 
+//! sparse variant of guess_sympd(): same conditions, but the partner of each element below the diagonal is found via binary search;
+//! all diagonal elements must be stored
+template<typename eT>
+inline
+bool
+guess_sympd(const SpMat<eT>& A)
+  {
+  arma_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  if((A.n_rows != A.n_cols) || (A.n_rows == uword(0)))  { return false; }
+  
+  const T tol = T(100) * std::numeric_limits<T>::epsilon();  // allow some leeway
+  
+  const uword N = A.n_rows;
+  
+  const uword* col_ptrs    = A.col_ptrs;
+  const uword* row_indices = A.row_indices;
+  const eT*    values      = A.values;
+  
+  podarray<T> diag(N);
+  
+  diag.zeros();
+  
+  for(uword j=0; j < N; ++j)
+    {
+    for(uword p = col_ptrs[j]; p < col_ptrs[j+1]; ++p)
+      {
+      if(row_indices[p] != j)  { continue; }
+      
+      const T A_jj_r = access::tmp_real(values[p]);
+      const T A_jj_i = access::tmp_imag(values[p]);
+      
+      if(arma_isnonfinite(A_jj_r))  { return false; }
+      
+      if( (std::abs)(A_jj_i) > tol                  )  { return false; }  // imag should be approx zero
+      if( (std::abs)(A_jj_i) > (std::abs)(A_jj_r)   )  { return false; }
+      
+      diag[j] = A_jj_r;
+      }
+    }
+  
+  bool diag_below_tol = true;
+  
+  T max_diag = T(0);
+  
+  for(uword j=0; j < N; ++j)
+    {
+    const T A_jj_r = diag[j];
+    
+    if(A_jj_r <= T(0))  { return false; }  // real should be positive; also rejects missing diagonal elements
+    
+    if(A_jj_r >= tol)  { diag_below_tol = false; }
+    
+    max_diag = (A_jj_r > max_diag) ? A_jj_r : max_diag;
+    }
+  
+  if(diag_below_tol)  { return false; }
+  
+  const T square_max_diag = max_diag * max_diag;
+  
+  if(arma_isnonfinite(square_max_diag))  { return false; }
+  
+  uword count_lower = 0;
+  uword count_upper = 0;
+  
+  for(uword j=0; j < N; ++j)
+    {
+    for(uword p = col_ptrs[j]; p < col_ptrs[j+1]; ++p)
+      {
+      const uword i = row_indices[p];
+      
+      if(i <  j)  { ++count_upper; continue; }
+      if(i == j)  { continue; }
+      
+      ++count_lower;
+      
+      const T A_ij_real = access::tmp_real(values[p]);
+      const T A_ij_imag = access::tmp_imag(values[p]);
+      
+      const T square_A_ij_abs = (A_ij_real * A_ij_real) + (A_ij_imag * A_ij_imag);
+      
+      if(arma_isnonfinite(square_A_ij_abs))  { return false; }
+      
+      if(square_A_ij_abs >= square_max_diag)  { return false; }
+      
+      // find A(j,i) in column i
+      
+      const uword* i_start = &(row_indices[ col_ptrs[i  ] ]);
+      const uword* i_end   = &(row_indices[ col_ptrs[i+1] ]);
+      
+      const uword* loc = std::lower_bound(i_start, i_end, j);
+      
+      if( (loc == i_end) || ((*loc) != j) )  { return false; }
+      
+      const eT& A_ji = values[ col_ptrs[i] + uword(loc - i_start) ];
+      
+      const T A_ji_real = access::tmp_real(A_ji);
+      const T A_ji_imag = access::tmp_imag(A_ji);
+      
+      const T A_real_delta   = (std::abs)(A_ij_real - A_ji_real);
+      const T A_real_abs_max = (std::max)((std::abs)(A_ij_real), (std::abs)(A_ji_real));
+      
+      if( (A_real_delta > tol) && (A_real_delta > (A_real_abs_max*tol)) )  { return false; }
+      
+      const T A_imag_delta   = (std::abs)(A_ij_imag + A_ji_imag);  // take into account complex conjugate
+      const T A_imag_abs_max = (std::max)((std::abs)(A_ij_imag), (std::abs)(A_ji_imag));
+      
+      if( (A_imag_delta > tol) && (A_imag_delta > (A_imag_abs_max*tol)) )  { return false; }
+      
+      const T A_ij_real_abs = (std::abs)(A_ij_real);
+      
+      if( (A_ij_real_abs + A_ij_real_abs) >= (diag[i] + diag[j]) )  { return false; }
+      }
+    }
+  
+  // each element below the diagonal has a partner above the diagonal, so equal counts imply a symmetric pattern
+  
+  return (count_lower == count_upper);
+  }
+
+
+
 //
 
 
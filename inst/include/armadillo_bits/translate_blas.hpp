@@ -77,6 +77,106 @@ namespace blas
   
   
   
+  template<typename eT>
+  inline
+  void
+  trsm(const char* side, const char* uplo, const char* transA, const char* diag, const blas_int* m, const blas_int* n, const eT* alpha, const eT* A, const blas_int* ldA, eT* B, const blas_int* ldB)
+    {
+    arma_type_check((is_blas_type<eT>::value == false));
+    
+    #if defined(ARMA_USE_FORTRAN_HIDDEN_ARGS)
+      {
+           if(    is_float<eT>::value)  { typedef    float T; arma_fortran(arma_strsm)(side, uplo, transA, diag, m, n, (const T*)alpha, (const T*)A, ldA, (T*)B, ldB, 1, 1, 1, 1); }
+      else if(   is_double<eT>::value)  { typedef   double T; arma_fortran(arma_dtrsm)(side, uplo, transA, diag, m, n, (const T*)alpha, (const T*)A, ldA, (T*)B, ldB, 1, 1, 1, 1); }
+      else if( is_cx_float<eT>::value)  { typedef blas_cxf T; arma_fortran(arma_ctrsm)(side, uplo, transA, diag, m, n, (const T*)alpha, (const T*)A, ldA, (T*)B, ldB, 1, 1, 1, 1); }
+      else if(is_cx_double<eT>::value)  { typedef blas_cxd T; arma_fortran(arma_ztrsm)(side, uplo, transA, diag, m, n, (const T*)alpha, (const T*)A, ldA, (T*)B, ldB, 1, 1, 1, 1); }
+      }
+    #else
+      {
+           if(    is_float<eT>::value)  { typedef    float T; arma_fortran(arma_strsm)(side, uplo, transA, diag, m, n, (const T*)alpha, (const T*)A, ldA, (T*)B, ldB); }
+      else if(   is_double<eT>::value)  { typedef   double T; arma_fortran(arma_dtrsm)(side, uplo, transA, diag, m, n, (const T*)alpha, (const T*)A, ldA, (T*)B, ldB); }
+      else if( is_cx_float<eT>::value)  { typedef blas_cxf T; arma_fortran(arma_ctrsm)(side, uplo, transA, diag, m, n, (const T*)alpha, (const T*)A, ldA, (T*)B, ldB); }
+      else if(is_cx_double<eT>::value)  { typedef blas_cxd T; arma_fortran(arma_ztrsm)(side, uplo, transA, diag, m, n, (const T*)alpha, (const T*)A, ldA, (T*)B, ldB); }
+      }
+    #endif
+    }
+  
+  
+  
+  template<typename eT>
+  inline
+  void
+  trmm(const char* side, const char* uplo, const char* transA, const char* diag, const blas_int* m, const blas_int* n, const eT* alpha, const eT* A, const blas_int* ldA, eT* B, const blas_int* ldB)
+    {
+    arma_type_check((is_blas_type<eT>::value == false));
+    
+    #if defined(ARMA_USE_FORTRAN_HIDDEN_ARGS)
+      {
+           if(    is_float<eT>::value)  { typedef    float T; arma_fortran(arma_strmm)(side, uplo, transA, diag, m, n, (const T*)alpha, (const T*)A, ldA, (T*)B, ldB, 1, 1, 1, 1); }
+      else if(   is_double<eT>::value)  { typedef   double T; arma_fortran(arma_dtrmm)(side, uplo, transA, diag, m, n, (const T*)alpha, (const T*)A, ldA, (T*)B, ldB, 1, 1, 1, 1); }
+      else if( is_cx_float<eT>::value)  { typedef blas_cxf T; arma_fortran(arma_ctrmm)(side, uplo, transA, diag, m, n, (const T*)alpha, (const T*)A, ldA, (T*)B, ldB, 1, 1, 1, 1); }
+      else if(is_cx_double<eT>::value)  { typedef blas_cxd T; arma_fortran(arma_ztrmm)(side, uplo, transA, diag, m, n, (const T*)alpha, (const T*)A, ldA, (T*)B, ldB, 1, 1, 1, 1); }
+      }
+    #else
+      {
+           if(    is_float<eT>::value)  { typedef    float T; arma_fortran(arma_strmm)(side, uplo, transA, diag, m, n, (const T*)alpha, (const T*)A, ldA, (T*)B, ldB); }
+      else if(   is_double<eT>::value)  { typedef   double T; arma_fortran(arma_dtrmm)(side, uplo, transA, diag, m, n, (const T*)alpha, (const T*)A, ldA, (T*)B, ldB); }
+      else if( is_cx_float<eT>::value)  { typedef blas_cxf T; arma_fortran(arma_ctrmm)(side, uplo, transA, diag, m, n, (const T*)alpha, (const T*)A, ldA, (T*)B, ldB); }
+      else if(is_cx_double<eT>::value)  { typedef blas_cxd T; arma_fortran(arma_ztrmm)(side, uplo, transA, diag, m, n, (const T*)alpha, (const T*)A, ldA, (T*)B, ldB); }
+      }
+    #endif
+    }
+  
+  
+  
+  template<typename eT>
+  inline
+  void
+  symm(const char* side, const char* uplo, const blas_int* m, const blas_int* n, const eT* alpha, const eT* A, const blas_int* ldA, const eT* B, const blas_int* ldB, const eT* beta, eT* C, const blas_int* ldC)
+    {
+    arma_type_check((is_blas_type<eT>::value == false));
+    
+    #if defined(ARMA_USE_FORTRAN_HIDDEN_ARGS)
+      {
+           if(    is_float<eT>::value)  { typedef    float T; arma_fortran(arma_ssymm)(side, uplo, m, n, (const T*)alpha, (const T*)A, ldA, (const T*)B, ldB, (const T*)beta, (T*)C, ldC, 1, 1); }
+      else if(   is_double<eT>::value)  { typedef   double T; arma_fortran(arma_dsymm)(side, uplo, m, n, (const T*)alpha, (const T*)A, ldA, (const T*)B, ldB, (const T*)beta, (T*)C, ldC, 1, 1); }
+      else if( is_cx_float<eT>::value)  { typedef blas_cxf T; arma_fortran(arma_csymm)(side, uplo, m, n, (const T*)alpha, (const T*)A, ldA, (const T*)B, ldB, (const T*)beta, (T*)C, ldC, 1, 1); }
+      else if(is_cx_double<eT>::value)  { typedef blas_cxd T; arma_fortran(arma_zsymm)(side, uplo, m, n, (const T*)alpha, (const T*)A, ldA, (const T*)B, ldB, (const T*)beta, (T*)C, ldC, 1, 1); }
+      }
+    #else
+      {
+           if(    is_float<eT>::value)  { typedef    float T; arma_fortran(arma_ssymm)(side, uplo, m, n, (const T*)alpha, (const T*)A, ldA, (const T*)B, ldB, (const T*)beta, (T*)C, ldC); }
+      else if(   is_double<eT>::value)  { typedef   double T; arma_fortran(arma_dsymm)(side, uplo, m, n, (const T*)alpha, (const T*)A, ldA, (const T*)B, ldB, (const T*)beta, (T*)C, ldC); }
+      else if( is_cx_float<eT>::value)  { typedef blas_cxf T; arma_fortran(arma_csymm)(side, uplo, m, n, (const T*)alpha, (const T*)A, ldA, (const T*)B, ldB, (const T*)beta, (T*)C, ldC); }
+      else if(is_cx_double<eT>::value)  { typedef blas_cxd T; arma_fortran(arma_zsymm)(side, uplo, m, n, (const T*)alpha, (const T*)A, ldA, (const T*)B, ldB, (const T*)beta, (T*)C, ldC); }
+      }
+    #endif
+    }
+  
+  
+  
+  template<typename eT>
+  inline
+  void
+  hemm(const char* side, const char* uplo, const blas_int* m, const blas_int* n, const eT* alpha, const eT* A, const blas_int* ldA, const eT* B, const blas_int* ldB, const eT* beta, eT* C, const blas_int* ldC)
+    {
+    arma_type_check((is_blas_type<eT>::value == false));
+    
+    #if defined(ARMA_USE_FORTRAN_HIDDEN_ARGS)
+      {
+           if( is_cx_float<eT>::value)  { typedef blas_cxf T; arma_fortran(arma_chemm)(side, uplo, m, n, (const T*)alpha, (const T*)A, ldA, (const T*)B, ldB, (const T*)beta, (T*)C, ldC, 1, 1); }
+      else if(is_cx_double<eT>::value)  { typedef blas_cxd T; arma_fortran(arma_zhemm)(side, uplo, m, n, (const T*)alpha, (const T*)A, ldA, (const T*)B, ldB, (const T*)beta, (T*)C, ldC, 1, 1); }
+      }
+    #else
+      {
+           if( is_cx_float<eT>::value)  { typedef blas_cxf T; arma_fortran(arma_chemm)(side, uplo, m, n, (const T*)alpha, (const T*)A, ldA, (const T*)B, ldB, (const T*)beta, (T*)C, ldC); }
+      else if(is_cx_double<eT>::value)  { typedef blas_cxd T; arma_fortran(arma_zhemm)(side, uplo, m, n, (const T*)alpha, (const T*)A, ldA, (const T*)B, ldB, (const T*)beta, (T*)C, ldC); }
+      }
+    #endif
+    }
+  
+  
+  
   template<typename eT>
   inline
   void
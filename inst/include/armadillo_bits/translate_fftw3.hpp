@@ -63,6 +63,26 @@ namespace fftw3
   
   
   
+  template<typename eT>
+  arma_inline
+  void
+  execute_dft(void_ptr plan, eT* input, eT* output)
+    {
+    arma_type_check((is_cx<eT>::value == false));
+    
+    if(is_cx_float<eT>::value)
+      {
+      fftwf_execute_dft(fftwf_plan(plan), (fftwf_complex*)(input), (fftwf_complex*)(output));
+      }
+    else
+    if(is_cx_double<eT>::value)
+      {
+      fftw_execute_dft(fftw_plan(plan), (fftw_complex*)(input), (fftw_complex*)(output));
+      }
+    }
+  
+  
+  
   template<typename eT>
   arma_inline
   void
@@ -253,6 +253,106 @@ namespace lapack
     #endif
     }
   
+  
+  
+  template<typename eT>
+  inline
+  void
+  syevr
+    (
+    char* jobz, char* range, char* uplo, blas_int* n,
+    eT* a, blas_int* lda, eT* vl, eT* vu, blas_int* il, blas_int* iu, eT* abstol,
+    blas_int* m, eT* w, eT* z, blas_int* ldz, blas_int* isuppz,
+    eT* work, blas_int* lwork, blas_int* iwork, blas_int* liwork,
+    blas_int* info
+    )
+    {
+    arma_type_check(( is_blas_type<eT>::value == false ));
+    
+    #if defined(ARMA_USE_FORTRAN_HIDDEN_ARGS)
+           if( is_float<eT>::value)  { typedef float  T; arma_fortran(arma_ssyevr)(jobz, range, uplo, n, (T*)a, lda, (T*)vl, (T*)vu, il, iu, (T*)abstol, m, (T*)w, (T*)z, ldz, isuppz, (T*)work, lwork, iwork, liwork, info, 1, 1, 1); }
+      else if(is_double<eT>::value)  { typedef double T; arma_fortran(arma_dsyevr)(jobz, range, uplo, n, (T*)a, lda, (T*)vl, (T*)vu, il, iu, (T*)abstol, m, (T*)w, (T*)z, ldz, isuppz, (T*)work, lwork, iwork, liwork, info, 1, 1, 1); }
+    #else
+           if( is_float<eT>::value)  { typedef float  T; arma_fortran(arma_ssyevr)(jobz, range, uplo, n, (T*)a, lda, (T*)vl, (T*)vu, il, iu, (T*)abstol, m, (T*)w, (T*)z, ldz, isuppz, (T*)work, lwork, iwork, liwork, info); }
+      else if(is_double<eT>::value)  { typedef double T; arma_fortran(arma_dsyevr)(jobz, range, uplo, n, (T*)a, lda, (T*)vl, (T*)vu, il, iu, (T*)abstol, m, (T*)w, (T*)z, ldz, isuppz, (T*)work, lwork, iwork, liwork, info); }
+    #endif
+    }
+  
+  
+  
+  template<typename eT>
+  inline
+  void
+  heevr
+    (
+    char* jobz, char* range, char* uplo, blas_int* n,
+    eT* a, blas_int* lda, typename eT::value_type* vl, typename eT::value_type* vu, blas_int* il, blas_int* iu, typename eT::value_type* abstol,
+    blas_int* m, typename eT::value_type* w, eT* z, blas_int* ldz, blas_int* isuppz,
+    eT* work, blas_int* lwork, typename eT::value_type* rwork, blas_int* lrwork, blas_int* iwork, blas_int* liwork,
+    blas_int* info
+    )
+    {
+    arma_type_check(( is_blas_type<eT>::value == false ));
+    
+    #if defined(ARMA_USE_FORTRAN_HIDDEN_ARGS)
+           if( is_cx_float<eT>::value)  { typedef float  T; typedef blas_cxf cx_T; arma_fortran(arma_cheevr)(jobz, range, uplo, n, (cx_T*)a, lda, (T*)vl, (T*)vu, il, iu, (T*)abstol, m, (T*)w, (cx_T*)z, ldz, isuppz, (cx_T*)work, lwork, (T*)rwork, lrwork, iwork, liwork, info, 1, 1, 1); }
+      else if(is_cx_double<eT>::value)  { typedef double T; typedef blas_cxd cx_T; arma_fortran(arma_zheevr)(jobz, range, uplo, n, (cx_T*)a, lda, (T*)vl, (T*)vu, il, iu, (T*)abstol, m, (T*)w, (cx_T*)z, ldz, isuppz, (cx_T*)work, lwork, (T*)rwork, lrwork, iwork, liwork, info, 1, 1, 1); }
+    #else
+           if( is_cx_float<eT>::value)  { typedef float  T; typedef blas_cxf cx_T; arma_fortran(arma_cheevr)(jobz, range, uplo, n, (cx_T*)a, lda, (T*)vl, (T*)vu, il, iu, (T*)abstol, m, (T*)w, (cx_T*)z, ldz, isuppz, (cx_T*)work, lwork, (T*)rwork, lrwork, iwork, liwork, info); }
+      else if(is_cx_double<eT>::value)  { typedef double T; typedef blas_cxd cx_T; arma_fortran(arma_zheevr)(jobz, range, uplo, n, (cx_T*)a, lda, (T*)vl, (T*)vu, il, iu, (T*)abstol, m, (T*)w, (cx_T*)z, ldz, isuppz, (cx_T*)work, lwork, (T*)rwork, lrwork, iwork, liwork, info); }
+    #endif
+    }
+  
+  
+  
+  template<typename eT>
+  inline
+  void
+  syevx
+    (
+    char* jobz, char* range, char* uplo, blas_int* n,
+    eT* a, blas_int* lda, eT* vl, eT* vu, blas_int* il, blas_int* iu, eT* abstol,
+    blas_int* m, eT* w, eT* z, blas_int* ldz,
+    eT* work, blas_int* lwork, blas_int* iwork, blas_int* ifail,
+    blas_int* info
+    )
+    {
+    arma_type_check(( is_blas_type<eT>::value == false ));
+    
+    #if defined(ARMA_USE_FORTRAN_HIDDEN_ARGS)
+           if( is_float<eT>::value)  { typedef float  T; arma_fortran(arma_ssyevx)(jobz, range, uplo, n, (T*)a, lda, (T*)vl, (T*)vu, il, iu, (T*)abstol, m, (T*)w, (T*)z, ldz, (T*)work, lwork, iwork, ifail, info, 1, 1, 1); }
+      else if(is_double<eT>::value)  { typedef double T; arma_fortran(arma_dsyevx)(jobz, range, uplo, n, (T*)a, lda, (T*)vl, (T*)vu, il, iu, (T*)abstol, m, (T*)w, (T*)z, ldz, (T*)work, lwork, iwork, ifail, info, 1, 1, 1); }
+    #else
+           if( is_float<eT>::value)  { typedef float  T; arma_fortran(arma_ssyevx)(jobz, range, uplo, n, (T*)a, lda, (T*)vl, (T*)vu, il, iu, (T*)abstol, m, (T*)w, (T*)z, ldz, (T*)work, lwork, iwork, ifail, info); }
+      else if(is_double<eT>::value)  { typedef double T; arma_fortran(arma_dsyevx)(jobz, range, uplo, n, (T*)a, lda, (T*)vl, (T*)vu, il, iu, (T*)abstol, m, (T*)w, (T*)z, ldz, (T*)work, lwork, iwork, ifail, info); }
+    #endif
+    }
+  
+  
+  
+  template<typename eT>
+  inline
+  void
+  heevx
+    (
+    char* jobz, char* range, char* uplo, blas_int* n,
+    eT* a, blas_int* lda, typename eT::value_type* vl, typename eT::value_type* vu, blas_int* il, blas_int* iu, typename eT::value_type* abstol,
+    blas_int* m, typename eT::value_type* w, eT* z, blas_int* ldz,
+    eT* work, blas_int* lwork, typename eT::value_type* rwork, blas_int* iwork, blas_int* ifail,
+    blas_int* info
+    )
+    {
+    arma_type_check(( is_blas_type<eT>::value == false ));
+    
+    #if defined(ARMA_USE_FORTRAN_HIDDEN_ARGS)
+           if( is_cx_float<eT>::value)  { typedef float  T; typedef blas_cxf cx_T; arma_fortran(arma_cheevx)(jobz, range, uplo, n, (cx_T*)a, lda, (T*)vl, (T*)vu, il, iu, (T*)abstol, m, (T*)w, (cx_T*)z, ldz, (cx_T*)work, lwork, (T*)rwork, iwork, ifail, info, 1, 1, 1); }
+      else if(is_cx_double<eT>::value)  { typedef double T; typedef blas_cxd cx_T; arma_fortran(arma_zheevx)(jobz, range, uplo, n, (cx_T*)a, lda, (T*)vl, (T*)vu, il, iu, (T*)abstol, m, (T*)w, (cx_T*)z, ldz, (cx_T*)work, lwork, (T*)rwork, iwork, ifail, info, 1, 1, 1); }
+    #else
+           if( is_cx_float<eT>::value)  { typedef float  T; typedef blas_cxf cx_T; arma_fortran(arma_cheevx)(jobz, range, uplo, n, (cx_T*)a, lda, (T*)vl, (T*)vu, il, iu, (T*)abstol, m, (T*)w, (cx_T*)z, ldz, (cx_T*)work, lwork, (T*)rwork, iwork, ifail, info); }
+      else if(is_cx_double<eT>::value)  { typedef double T; typedef blas_cxd cx_T; arma_fortran(arma_zheevx)(jobz, range, uplo, n, (cx_T*)a, lda, (T*)vl, (T*)vu, il, iu, (T*)abstol, m, (T*)w, (cx_T*)z, ldz, (cx_T*)work, lwork, (T*)rwork, iwork, ifail, info); }
+    #endif
+    }
+  
 	
 	
   template<typename eT>
@@ -556,6 +656,55 @@ namespace lapack
   
   
   
+  template<typename eT>
+  inline
+  void
+  gesvdx
+    (
+    char* jobu, char* jobvt, char* range, blas_int* m, blas_int* n,
+    eT* a, blas_int* lda, eT* vl, eT* vu, blas_int* il, blas_int* iu, blas_int* ns,
+    eT* s, eT* u, blas_int* ldu, eT* vt, blas_int* ldvt,
+    eT* work, blas_int* lwork, blas_int* iwork, blas_int* info
+    )
+    {
+    arma_type_check(( is_blas_type<eT>::value == false ));
+    
+    #if defined(ARMA_USE_FORTRAN_HIDDEN_ARGS)
+           if( is_float<eT>::value)  { typedef float  T; arma_fortran(arma_sgesvdx)(jobu, jobvt, range, m, n, (T*)a, lda, (T*)vl, (T*)vu, il, iu, ns, (T*)s, (T*)u, ldu, (T*)vt, ldvt, (T*)work, lwork, iwork, info, 1, 1, 1); }
+      else if(is_double<eT>::value)  { typedef double T; arma_fortran(arma_dgesvdx)(jobu, jobvt, range, m, n, (T*)a, lda, (T*)vl, (T*)vu, il, iu, ns, (T*)s, (T*)u, ldu, (T*)vt, ldvt, (T*)work, lwork, iwork, info, 1, 1, 1); }
+    #else
+           if( is_float<eT>::value)  { typedef float  T; arma_fortran(arma_sgesvdx)(jobu, jobvt, range, m, n, (T*)a, lda, (T*)vl, (T*)vu, il, iu, ns, (T*)s, (T*)u, ldu, (T*)vt, ldvt, (T*)work, lwork, iwork, info); }
+      else if(is_double<eT>::value)  { typedef double T; arma_fortran(arma_dgesvdx)(jobu, jobvt, range, m, n, (T*)a, lda, (T*)vl, (T*)vu, il, iu, ns, (T*)s, (T*)u, ldu, (T*)vt, ldvt, (T*)work, lwork, iwork, info); }
+    #endif
+    }
+  
+  
+  
+  template<typename T>
+  inline
+  void
+  cx_gesvdx
+    (
+    char* jobu, char* jobvt, char* range, blas_int* m, blas_int* n,
+    std::complex<T>* a, blas_int* lda, T* vl, T* vu, blas_int* il, blas_int* iu, blas_int* ns,
+    T* s, std::complex<T>* u, blas_int* ldu, std::complex<T>* vt, blas_int* ldvt,
+    std::complex<T>* work, blas_int* lwork, T* rwork, blas_int* iwork, blas_int* info
+    )
+    {
+    arma_type_check(( is_blas_type<T>::value == false ));
+    arma_type_check(( is_blas_type< std::complex<T> >::value == false ));
+    
+    #if defined(ARMA_USE_FORTRAN_HIDDEN_ARGS)
+           if( is_float<T>::value)  { typedef float  bT; typedef blas_cxf cx_bT; arma_fortran(arma_cgesvdx)(jobu, jobvt, range, m, n, (cx_bT*)a, lda, (bT*)vl, (bT*)vu, il, iu, ns, (bT*)s, (cx_bT*)u, ldu, (cx_bT*)vt, ldvt, (cx_bT*)work, lwork, (bT*)rwork, iwork, info, 1, 1, 1); }
+      else if(is_double<T>::value)  { typedef double bT; typedef blas_cxd cx_bT; arma_fortran(arma_zgesvdx)(jobu, jobvt, range, m, n, (cx_bT*)a, lda, (bT*)vl, (bT*)vu, il, iu, ns, (bT*)s, (cx_bT*)u, ldu, (cx_bT*)vt, ldvt, (cx_bT*)work, lwork, (bT*)rwork, iwork, info, 1, 1, 1); }
+    #else
+           if( is_float<T>::value)  { typedef float  bT; typedef blas_cxf cx_bT; arma_fortran(arma_cgesvdx)(jobu, jobvt, range, m, n, (cx_bT*)a, lda, (bT*)vl, (bT*)vu, il, iu, ns, (bT*)s, (cx_bT*)u, ldu, (cx_bT*)vt, ldvt, (cx_bT*)work, lwork, (bT*)rwork, iwork, info); }
+      else if(is_double<T>::value)  { typedef double bT; typedef blas_cxd cx_bT; arma_fortran(arma_zgesvdx)(jobu, jobvt, range, m, n, (cx_bT*)a, lda, (bT*)vl, (bT*)vu, il, iu, ns, (bT*)s, (cx_bT*)u, ldu, (cx_bT*)vt, ldvt, (cx_bT*)work, lwork, (bT*)rwork, iwork, info); }
+    #endif
+    }
+  
+  
+  
   template<typename eT>
   inline
   void
@@ -0,0 +1,118 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// batch.cpp: RcppArmadillo unit test code for batched linear algebra
+//
+// Copyright (C) 2026  The RcppArmadillo Authors
+//
+// This file is part of RcppArmadillo.
+//
+// RcppArmadillo is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// RcppArmadillo is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with RcppArmadillo.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <RcppArmadillo.h>
+
+// [[Rcpp::depends(RcppArmadillo)]]
+
+// [[Rcpp::export]]
+Rcpp::List cholBatch(const arma::cube& X, std::string layout) {
+    arma::cube R;
+    bool status = arma::chol_batch(R, X, layout.c_str());
+    return Rcpp::List::create(Rcpp::Named("status") = status,
+                              Rcpp::Named("R")      = R);
+}
+
+// [[Rcpp::export]]
+arma::cube invSympdBatch(const arma::cube& X) {
+    arma::cube Y;
+    arma::inv_sympd_batch(Y, X);
+    return Y;
+}
+
+// [[Rcpp::export]]
+arma::cube solveBatch(const arma::cube& A, const arma::cube& B) {
+    arma::cube X;
+    arma::solve_batch(X, A, B);
+    return X;
+}
+
+// [[Rcpp::export]]
+arma::cube solveBatchAlias(arma::cube A, const arma::cube& B) {
+    // the output overwrites A
+    arma::solve_batch(A, A, B);
+    return A;
+}
+
+// [[Rcpp::export]]
+Rcpp::List solveBatchStatus(const arma::cube& A, const arma::cube& B) {
+    arma::cube X;
+    bool status = arma::solve_batch(X, A, B);
+    return Rcpp::List::create(Rcpp::Named("status") = status,
+                              Rcpp::Named("X")      = X);
+}
+
+// [[Rcpp::export]]
+arma::cube solveEach(const arma::cube& A, const arma::cube& B) {
+    // reference: solve() applied to each slice
+    arma::cube X(A.n_rows, B.n_cols, A.n_slices);
+    for (arma::uword s = 0; s < A.n_slices; ++s) {
+        X.slice(s) = arma::solve(A.slice(s), B.slice(s));
+    }
+    return X;
+}
+
+// [[Rcpp::export]]
+arma::cx_cube solveBatchComplex(const arma::cube& Are, const arma::cube& Aim,
+                                const arma::cube& Bre, const arma::cube& Bim) {
+    arma::cx_cube X;
+    arma::solve_batch(X, arma::cx_cube(Are, Aim), arma::cx_cube(Bre, Bim));
+    return X;
+}
+
+// [[Rcpp::export]]
+arma::vec detBatch(const arma::cube& X) {
+    arma::vec d;
+    arma::det_batch(d, X);
+    return d;
+}
+
+// [[Rcpp::export]]
+Rcpp::List logDetBatch(const arma::cube& X) {
+    arma::vec val, sign;
+    arma::log_det_batch(val, sign, X);
+    return Rcpp::List::create(Rcpp::Named("val")  = val,
+                              Rcpp::Named("sign") = sign);
+}
+
+// [[Rcpp::export]]
+arma::vec logDetSympdBatch(const arma::cube& X) {
+    arma::vec d;
+    arma::log_det_sympd_batch(d, X);
+    return d;
+}
+
+// [[Rcpp::export]]
+arma::cube timesBatch(const arma::cube& A, const arma::cube& B) {
+    arma::cube C;
+    arma::times_batch(C, A, B);
+    return C;
+}
+
+// [[Rcpp::export]]
+Rcpp::IntegerVector batchEmpty(int n) {
+    // no slices
+    arma::cube A(n, n, 0), B(n, 2, 0), X;
+    arma::solve_batch(X, A, B);
+    arma::vec d;
+    arma::det_batch(d, A);
+    return Rcpp::IntegerVector::create(X.n_rows, X.n_cols, X.n_slices, d.n_elem);
+}
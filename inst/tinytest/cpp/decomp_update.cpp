@@ -0,0 +1,73 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// decomp_update.cpp: RcppArmadillo unit test code for updates of Cholesky and QR decompositions
+//
+// Copyright (C) 2026  The RcppArmadillo Authors
+//
+// This file is part of RcppArmadillo.
+//
+// RcppArmadillo is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// RcppArmadillo is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with RcppArmadillo.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <RcppArmadillo.h>
+
+// [[Rcpp::depends(RcppArmadillo)]]
+
+// [[Rcpp::export]]
+Rcpp::List cholUpdate(const arma::mat& X, const arma::mat& V, std::string method, std::string layout) {
+    arma::mat R = arma::chol(X, layout.c_str());
+    const bool status = arma::chol_update(R, V, method.c_str(), layout.c_str());
+    return Rcpp::List::create(Rcpp::Named("status") = status,
+                              Rcpp::Named("R")      = R);
+}
+
+// [[Rcpp::export]]
+arma::mat cholFresh(const arma::mat& X, std::string layout) {
+    return arma::chol(X, layout.c_str());
+}
+
+// op: 1 = insert column, 2 = delete column, 3 = insert row
+// [[Rcpp::export]]
+Rcpp::List qrUpdate(const arma::mat& X, int op, int index, const arma::vec& x, bool econ) {
+    arma::mat Q, R;
+    if (econ) arma::qr_econ(Q, R, X); else arma::qr(Q, R, X);
+    bool status = false;
+    if (op == 1) status = arma::qr_insert_col(Q, R, index, x);
+    if (op == 2) status = arma::qr_delete_col(Q, R, index);
+    if (op == 3) status = arma::qr_insert_row(Q, R, index, x);
+    return Rcpp::List::create(Rcpp::Named("status") = status,
+                              Rcpp::Named("Q")      = Q,
+                              Rcpp::Named("R")      = R);
+}
+
+// [[Rcpp::export]]
+Rcpp::List qrFresh(const arma::mat& X, bool econ) {
+    arma::mat Q, R;
+    if (econ) arma::qr_econ(Q, R, X); else arma::qr(Q, R, X);
+    return Rcpp::List::create(Rcpp::Named("Q") = Q,
+                              Rcpp::Named("R") = R);
+}
+
+// [[Rcpp::export]]
+Rcpp::List qrFactoriserUpdate(const arma::mat& X, int op, int index, const arma::vec& x, const arma::mat& B) {
+    arma::qr_factoriser F;
+    F.factorise(X);
+    bool status = false;
+    if (op == 1) status = F.insert_col(index, x);
+    if (op == 2) status = F.delete_col(index);
+    if (op == 3) status = F.insert_row(index, x);
+    arma::mat Y;
+    status = status && F.solve(Y, B);
+    return Rcpp::List::create(Rcpp::Named("status") = status,
+                              Rcpp::Named("X")      = Y);
+}
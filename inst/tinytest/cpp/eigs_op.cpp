@@ -0,0 +1,126 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// eigs_op.cpp: RcppArmadillo unit test code for matrix-free eigs_sym(), eigs_gen() and svds()
+//
+// Copyright (C) 2026  The RcppArmadillo Authors
+//
+// This file is part of RcppArmadillo.
+//
+// RcppArmadillo is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// RcppArmadillo is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with RcppArmadillo.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <RcppArmadillo.h>
+
+// [[Rcpp::depends(RcppArmadillo)]]
+
+// operator providing only the vector form
+struct VecOp {
+    const arma::sp_mat& A;
+    const arma::uword n_rows;
+    const arma::uword n_cols;
+
+    VecOp(const arma::sp_mat& in_A) : A(in_A), n_rows(in_A.n_rows), n_cols(in_A.n_cols) {}
+
+    void perform_op(double* x_in, double* y_out) const {
+        const arma::vec x(x_in, n_cols, false, true);
+        arma::vec y(y_out, n_rows, false, true);
+        y = A * x;
+    }
+
+    void perform_op_trans(double* x_in, double* y_out) const {
+        const arma::vec x(x_in, n_rows, false, true);
+        arma::vec y(y_out, n_cols, false, true);
+        y = A.t() * x;
+    }
+};
+
+// operator providing only the block form
+struct BlockOp {
+    const arma::sp_mat& A;
+    const arma::uword n_rows;
+
+    BlockOp(const arma::sp_mat& in_A) : A(in_A), n_rows(in_A.n_rows) {}
+
+    void perform_op_block(const arma::mat& X_in, arma::mat& Y_out) const {
+        Y_out = A * X_in;
+    }
+};
+
+// [[Rcpp::export]]
+Rcpp::List eigsSymOp(const arma::sp_mat& A, int k, std::string form, int mode) {
+    arma::vec eigval;
+    arma::mat eigvec;
+    bool status;
+    if (mode == 1) {
+        status = arma::eigs_sym(eigval, eigvec, VecOp(A), k, form.c_str());
+    } else if (mode == 2) {
+        status = arma::eigs_sym(eigval, eigvec, BlockOp(A), k, form.c_str());
+    } else {
+        status = arma::eigs_sym(eigval, eigvec, A, k, form.c_str());
+    }
+    return Rcpp::List::create(Rcpp::Named("status")  = status,
+                              Rcpp::Named("values")  = eigval,
+                              Rcpp::Named("vectors") = eigvec);
+}
+
+// [[Rcpp::export]]
+Rcpp::List eigsGenOp(const arma::sp_mat& A, int k, int mode) {
+    arma::cx_vec eigval;
+    arma::cx_mat eigvec;
+    bool status;
+    if (mode == 1) {
+        status = arma::eigs_gen(eigval, eigvec, VecOp(A), k);
+    } else if (mode == 2) {
+        status = arma::eigs_gen(eigval, eigvec, BlockOp(A), k);
+    } else {
+        status = arma::eigs_gen(eigval, eigvec, A, k);
+    }
+    return Rcpp::List::create(Rcpp::Named("status")  = status,
+                              Rcpp::Named("values")  = eigval,
+                              Rcpp::Named("vectors") = eigvec);
+}
+
+// [[Rcpp::export]]
+Rcpp::List svdsOp(const arma::sp_mat& A, int k, bool matrix_free) {
+    arma::mat U, V;
+    arma::vec s;
+    bool status;
+    if (matrix_free) {
+        status = arma::svds(U, s, V, VecOp(A), k);
+    } else {
+        status = arma::svds(U, s, V, A, k);
+    }
+    return Rcpp::List::create(Rcpp::Named("status") = status,
+                              Rcpp::Named("U")      = U,
+                              Rcpp::Named("s")      = s,
+                              Rcpp::Named("V")      = V);
+}
+
+// [[Rcpp::export]]
+Rcpp::List eigsSymLobpcg(const arma::sp_mat& A, int k, std::string form, int precond, bool matrix_free) {
+    arma::eigs_opts opts;
+    opts.method = arma::eigs_opts::METHOD_LOBPCG;
+    if (precond == 1) opts.precond = arma::eigs_opts::PREC_JACOBI;
+    if (precond == 2) opts.precond = arma::eigs_opts::PREC_IC0;
+    arma::vec eigval;
+    arma::mat eigvec;
+    bool status;
+    if (matrix_free) {
+        status = arma::eigs_sym(eigval, eigvec, BlockOp(A), k, form.c_str(), opts);
+    } else {
+        status = arma::eigs_sym(eigval, eigvec, A, k, form.c_str(), opts);
+    }
+    return Rcpp::List::create(Rcpp::Named("status")  = status,
+                              Rcpp::Named("values")  = eigval,
+                              Rcpp::Named("vectors") = eigvec);
+}
@@ -0,0 +1,76 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// factoriser.cpp: RcppArmadillo unit test code for chol_factoriser, lu_factoriser and qr_factoriser
+//
+// Copyright (C) 2026  The RcppArmadillo Authors
+//
+// This file is part of RcppArmadillo.
+//
+// RcppArmadillo is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// RcppArmadillo is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with RcppArmadillo.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <RcppArmadillo.h>
+
+// [[Rcpp::depends(RcppArmadillo)]]
+
+template<typename factoriser_type>
+Rcpp::List factoriserResults(factoriser_type& F, const arma::mat& B, const arma::mat& C) {
+    arma::mat X, Y, Ainv;
+    double val, sign;
+    bool status = F.solve(X, B);
+    status = status && F.solve_trans(Y, C);
+    status = status && F.inv(Ainv);
+    const bool det_status = F.log_det(val, sign);
+    return Rcpp::List::create(Rcpp::Named("status")     = status,
+                              Rcpp::Named("X")          = X,
+                              Rcpp::Named("Y")          = Y,
+                              Rcpp::Named("inv")        = Ainv,
+                              Rcpp::Named("det_status") = det_status,
+                              Rcpp::Named("log_det")    = val,
+                              Rcpp::Named("sign")       = sign,
+                              Rcpp::Named("rcond")      = F.rcond());
+}
+
+// [[Rcpp::export]]
+Rcpp::List cholFactoriser(const arma::mat& A, const arma::mat& B) {
+    arma::chol_factoriser F;
+    if (!F.factorise(A)) return Rcpp::List::create(Rcpp::Named("status") = false);
+    return factoriserResults(F, B, B);
+}
+
+// [[Rcpp::export]]
+Rcpp::List luFactoriser(const arma::mat& A, const arma::mat& B, const arma::mat& C, bool no_sympd) {
+    arma::lu_factoriser F;
+    const bool status = no_sympd ? F.factorise(A, arma::solve_opts::no_sympd) : F.factorise(A);
+    if (!status) return Rcpp::List::create(Rcpp::Named("status") = false);
+    return factoriserResults(F, B, C);
+}
+
+// [[Rcpp::export]]
+Rcpp::List qrFactoriser(const arma::mat& A, const arma::mat& B, const arma::mat& C) {
+    arma::qr_factoriser F;
+    if (!F.factorise(A)) return Rcpp::List::create(Rcpp::Named("status") = false);
+    return factoriserResults(F, B, C);
+}
+
+// [[Rcpp::export]]
+Rcpp::List cholFactoriserUpdate(const arma::mat& A, const arma::mat& V, std::string method, const arma::mat& B) {
+    arma::chol_factoriser F;
+    F.factorise(A);
+    if (!F.update(V, method.c_str())) return Rcpp::List::create(Rcpp::Named("status") = false);
+    arma::mat X;
+    const bool status = F.solve(X, B);
+    return Rcpp::List::create(Rcpp::Named("status") = status,
+                              Rcpp::Named("X")      = X,
+                              Rcpp::Named("rcond")  = F.rcond());
+}
@@ -0,0 +1,85 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// fft.cpp: RcppArmadillo unit test code for fast Fourier transforms
+//
+// Copyright (C) 2026  The RcppArmadillo Authors
+//
+// This file is part of RcppArmadillo.
+//
+// RcppArmadillo is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// RcppArmadillo is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with RcppArmadillo.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <RcppArmadillo.h>
+
+// [[Rcpp::depends(RcppArmadillo)]]
+
+// [[Rcpp::export]]
+arma::cx_mat fftCols(const arma::mat& X) {
+    return arma::fft(X);
+}
+
+// [[Rcpp::export]]
+arma::mat ifftRoundTrip(const arma::mat& X) {
+    return arma::real(arma::ifft(arma::fft(X)));
+}
+
+// [[Rcpp::export]]
+Rcpp::List fftManyLengths(int max_len) {
+    // more distinct lengths than the plan cache holds, with one length reused throughout
+    Rcpp::List out(max_len);
+    arma::vec y = arma::linspace(0.0, 1.0, 64);
+    arma::cx_vec Y_first = arma::fft(y);
+    for (int n = 1; n <= max_len; n++) {
+        arma::vec x = arma::linspace(-1.0, 1.0, n);
+        out[n - 1] = arma::fft(x);
+        arma::cx_vec Y = arma::fft(y);
+        if (arma::any(Y != Y_first)) Rcpp::stop("results changed across plan cache evictions");
+    }
+    return out;
+}
+
+// [[Rcpp::export]]
+arma::cx_cube fft3Real(const arma::cube& X) {
+    return arma::fft3(X);
+}
+
+// [[Rcpp::export]]
+arma::cx_cube fft3Padded(const arma::cube& X, int n_rows, int n_cols, int n_slices) {
+    return arma::fft3(X, n_rows, n_cols, n_slices);
+}
+
+// [[Rcpp::export]]
+arma::cx_cube ifft3Complex(arma::cx_cube X) {
+    X = arma::ifft3(X);                      // output aliases the input
+    return X;
+}
+
+// [[Rcpp::export]]
+arma::cx_cube fftCubeDim(const arma::cube& X, int dim) {
+    return arma::fft(X, X.n_rows, dim);
+}
+
+// [[Rcpp::export]]
+arma::cx_vec fftReal(const arma::vec& x) {
+    return arma::fft(x);
+}
+
+// [[Rcpp::export]]
+arma::cx_vec fftRealPadded(const arma::vec& x, int n) {
+    return arma::fft(x, n);
+}
+
+// [[Rcpp::export]]
+arma::cx_vec ifftComplex(const arma::cx_vec& X) {
+    return arma::ifft(X);
+}
@@ -0,0 +1,102 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// fixed.cpp: RcppArmadillo unit test code for multiplication, inverse and solve of fixed size matrices
+//
+// Copyright (C) 2026  The RcppArmadillo Authors
+//
+// This file is part of RcppArmadillo.
+//
+// RcppArmadillo is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// RcppArmadillo is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with RcppArmadillo.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <RcppArmadillo.h>
+
+// [[Rcpp::depends(RcppArmadillo)]]
+
+// products handled by the fixed size kernels: matrix-vector products always,
+// matrix-matrix products when compiled with AVX support
+
+// [[Rcpp::export]]
+Rcpp::List fixedTimes(const arma::mat& A, const arma::mat& B, const arma::vec& x, double a, const arma::mat& S) {
+    arma::mat::fixed<6,7> FA(A);
+    arma::mat::fixed<7,5> FB(B);
+    arma::vec::fixed<7>   Fx(x);
+    arma::mat::fixed<12,12> FS(S);
+    arma::mat::fixed<6,5> C  = FA * FB;
+    arma::mat::fixed<6,5> Ca = a * FA * FB;
+    arma::mat::fixed<5,6> Ct = FB.t() * FA.t();
+    arma::vec::fixed<6>   y  = FA * Fx;
+    arma::rowvec::fixed<7> z = Fx.t() * FB * FB.t();
+    arma::mat::fixed<12,12> SS = FS * FS.t();
+    return Rcpp::List::create(Rcpp::Named("C")  = arma::mat(C),
+                              Rcpp::Named("Ca") = arma::mat(Ca),
+                              Rcpp::Named("Ct") = arma::mat(Ct),
+                              Rcpp::Named("y")  = arma::vec(y),
+                              Rcpp::Named("z")  = arma::rowvec(z),
+                              Rcpp::Named("S")  = arma::mat(SS));
+}
+
+// [[Rcpp::export]]
+Rcpp::List fixedInv(const arma::mat& A5, const arma::mat& A16) {
+    arma::mat::fixed<5,5>   F5(A5);
+    arma::mat::fixed<16,16> F16(A16);
+    arma::mat::fixed<5,5>   I5;
+    arma::mat::fixed<16,16> I16;
+    bool status5  = arma::inv(I5,  F5);
+    bool status16 = arma::inv(I16, F16);
+    // aliasing: the inverse overwrites the input
+    F5 = arma::inv(F5);
+    return Rcpp::List::create(Rcpp::Named("status") = status5 && status16,
+                              Rcpp::Named("I5")     = arma::mat(I5),
+                              Rcpp::Named("I16")    = arma::mat(I16),
+                              Rcpp::Named("alias")  = arma::mat(F5));
+}
+
+// [[Rcpp::export]]
+Rcpp::List fixedInvSingular(const arma::mat& A) {
+    arma::mat::fixed<6,6> F(A);
+    arma::mat::fixed<6,6> I;
+    bool status = arma::inv(I, F);
+    return Rcpp::List::create(Rcpp::Named("status") = status,
+                              Rcpp::Named("n_elem") = I.n_elem);
+}
+
+// [[Rcpp::export]]
+Rcpp::List fixedSolve(const arma::mat& A, const arma::mat& B) {
+    arma::mat::fixed<9,9> F(A);
+    arma::mat::fixed<9,3> FB(B);
+    arma::mat::fixed<9,3> X;
+    bool status = arma::solve(X, F, FB);
+    arma::mat::fixed<9,3> Xf = arma::solve(F, FB, arma::solve_opts::fast);
+    // aliasing: the solution overwrites the right hand side
+    FB = arma::solve(F, FB);
+    return Rcpp::List::create(Rcpp::Named("status") = status,
+                              Rcpp::Named("X")      = arma::mat(X),
+                              Rcpp::Named("fast")   = arma::mat(Xf),
+                              Rcpp::Named("alias")  = arma::mat(FB));
+}
+
+// [[Rcpp::export]]
+Rcpp::List fixedSolveSingular(const arma::mat& A, const arma::mat& B) {
+    // exactly singular or badly conditioned systems are solved approximately, as for other matrices
+    arma::mat::fixed<9,9> F(A);
+    arma::mat::fixed<9,3> FB(B);
+    arma::mat::fixed<9,3> X;
+    bool status = arma::solve(X, F, FB);
+    arma::mat::fixed<9,3> Y;
+    bool status_no_approx = arma::solve(Y, F, FB, arma::solve_opts::no_approx);
+    return Rcpp::List::create(Rcpp::Named("status")           = status,
+                              Rcpp::Named("X")                = arma::mat(X),
+                              Rcpp::Named("dense")            = arma::mat(arma::solve(arma::mat(A), B)),
+                              Rcpp::Named("status_no_approx") = status_no_approx);
+}
@@ -0,0 +1,103 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// inplace.cpp: RcppArmadillo unit test code for in-place decompositions and solve_opts::destroy_A
+//
+// Copyright (C) 2026  The RcppArmadillo Authors
+//
+// This file is part of RcppArmadillo.
+//
+// RcppArmadillo is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// RcppArmadillo is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with RcppArmadillo.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <RcppArmadillo.h>
+
+// [[Rcpp::depends(RcppArmadillo)]]
+
+// [[Rcpp::export]]
+Rcpp::List cholInplace(arma::mat X, std::string layout) {
+    const bool status = arma::chol_inplace(X, layout.c_str());
+    return Rcpp::List::create(Rcpp::Named("status") = status,
+                              Rcpp::Named("X")      = X);
+}
+
+// [[Rcpp::export]]
+Rcpp::List invInplace(arma::mat X) {
+    const bool status = arma::inv_inplace(X);
+    return Rcpp::List::create(Rcpp::Named("status") = status,
+                              Rcpp::Named("X")      = X);
+}
+
+// [[Rcpp::export]]
+Rcpp::List eigSymInplace(arma::mat X) {
+    arma::vec eigval;
+    const bool status = arma::eig_sym_inplace(eigval, X);
+    return Rcpp::List::create(Rcpp::Named("status") = status,
+                              Rcpp::Named("values") = eigval,
+                              Rcpp::Named("n_elem") = X.n_elem);
+}
+
+// [[Rcpp::export]]
+Rcpp::List eigSymInplaceVec(arma::mat X, std::string method) {
+    arma::vec eigval;
+    const bool status = arma::eig_sym_inplace(eigval, X, method.c_str());
+    return Rcpp::List::create(Rcpp::Named("status")  = status,
+                              Rcpp::Named("values")  = eigval,
+                              Rcpp::Named("vectors") = X);
+}
+
+// [[Rcpp::export]]
+Rcpp::List solveDestroyA(arma::mat A, const arma::mat& B) {
+    arma::mat X;
+    const bool status = arma::solve(X, A, B, arma::solve_opts::destroy_A);
+    return Rcpp::List::create(Rcpp::Named("status") = status,
+                              Rcpp::Named("X")      = X,
+                              Rcpp::Named("n_elem") = A.n_elem);
+}
+
+// fixed-size matrices cannot give up or change their memory, so the in-place functions
+// must leave them with their size intact
+
+// [[Rcpp::export]]
+Rcpp::List inplaceFixed(const arma::mat& S, const arma::mat& G, const arma::mat& B) {
+    arma::mat::fixed<4,4> C(S);
+    arma::mat::fixed<4,4> I(G);
+    arma::mat::fixed<4,4> E(S);
+    arma::mat::fixed<4,4> V(S);
+    arma::mat::fixed<4,4> A(G);
+    arma::vec eigval_E, eigval_V;
+    arma::mat X;
+    const bool status = arma::chol_inplace(C) && arma::inv_inplace(I) &&
+        arma::eig_sym_inplace(eigval_E, E) && arma::eig_sym_inplace(eigval_V, V, "dc") &&
+        arma::solve(X, A, B, arma::solve_opts::destroy_A);
+    return Rcpp::List::create(Rcpp::Named("status")   = status,
+                              Rcpp::Named("chol")     = arma::mat(C),
+                              Rcpp::Named("inv")      = arma::mat(I),
+                              Rcpp::Named("values")   = eigval_E,
+                              Rcpp::Named("E_n_elem") = E.n_elem,
+                              Rcpp::Named("values_V") = eigval_V,
+                              Rcpp::Named("vectors")  = arma::mat(V),
+                              Rcpp::Named("X")        = X,
+                              Rcpp::Named("A_n_elem") = A.n_elem);
+}
+
+// [[Rcpp::export]]
+Rcpp::List failFixed(const arma::mat& N) {
+    arma::mat::fixed<4,4> C(N);
+    arma::mat::fixed<4,4> I(arma::fill::ones);
+    const bool status_C = arma::chol_inplace(C);
+    const bool status_I = arma::inv_inplace(I);
+    return Rcpp::List::create(Rcpp::Named("status_chol") = status_C,
+                              Rcpp::Named("status_inv")  = status_I,
+                              Rcpp::Named("chol")        = arma::mat(C),
+                              Rcpp::Named("inv")         = arma::mat(I));
+}
@@ -0,0 +1,81 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// itsolve.cpp: RcppArmadillo unit test code for iterative solvers
+//
+// Copyright (C) 2026  The RcppArmadillo Authors
+//
+// This file is part of RcppArmadillo.
+//
+// RcppArmadillo is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// RcppArmadillo is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with RcppArmadillo.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <RcppArmadillo.h>
+
+// [[Rcpp::depends(RcppArmadillo)]]
+
+// [[Rcpp::export]]
+Rcpp::List itsolveSparse(const arma::sp_mat& A, const arma::mat& B,
+                         std::string method, int precond, int maxiter) {
+    arma::itsolve_opts opts;
+    opts.tol     = 1e-10;
+    opts.maxiter = maxiter;
+    opts.precond = arma::itsolve_opts::precond_type(precond);
+    arma::itsolve_info info;
+    arma::mat X;
+    bool status = arma::itsolve(X, info, A, B, method.c_str(), opts);
+    return Rcpp::List::create(Rcpp::Named("status")    = status,
+                              Rcpp::Named("X")         = X,
+                              Rcpp::Named("n_iter")    = info.n_iter,
+                              Rcpp::Named("rel_resid") = info.rel_resid);
+}
+
+// [[Rcpp::export]]
+arma::mat itsolveDense(const arma::mat& A, const arma::mat& B, std::string method) {
+    arma::itsolve_opts opts;
+    opts.tol = 1e-10;
+    return arma::itsolve(A, B, method.c_str(), opts);
+}
+
+// [[Rcpp::export]]
+arma::mat itsolveOperator(const arma::sp_mat& A, const arma::mat& B) {
+    // matrix-free operator: y = A*x
+    auto op = [&A](arma::vec& y, const arma::vec& x) { y = A * x; };
+    arma::itsolve_opts opts;
+    opts.tol = 1e-10;
+    return arma::itsolve(op, B, "cg", opts);
+}
+
+// [[Rcpp::export]]
+arma::cx_mat itsolveComplex(const arma::sp_mat& Are, const arma::sp_mat& Aim,
+                            const arma::cx_mat& B) {
+    arma::sp_cx_mat A(Are, Aim);
+    arma::itsolve_opts opts;
+    opts.tol = 1e-10;
+    return arma::itsolve(A, B, "bicgstab", opts);
+}
+
+// [[Rcpp::export]]
+arma::mat itsolveAlias(const arma::sp_mat& A, arma::mat B) {
+    arma::itsolve_opts opts;
+    opts.tol = 1e-10;
+    arma::itsolve(B, A, B, "gmres", opts);   // output aliases the right hand side
+    return B;
+}
+
+// [[Rcpp::export]]
+Rcpp::IntegerVector itsolveEmpty(int k) {
+    arma::sp_mat A;
+    arma::mat B(0, k);
+    arma::mat X = arma::itsolve(A, B, "cg");
+    return Rcpp::IntegerVector::create(X.n_rows, X.n_cols);
+}
@@ -0,0 +1,54 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// mixed_precision.cpp: RcppArmadillo unit test code for solve() with mixed precision
+//
+// Copyright (C) 2026  The RcppArmadillo Authors
+//
+// This file is part of RcppArmadillo.
+//
+// RcppArmadillo is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// RcppArmadillo is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with RcppArmadillo.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <RcppArmadillo.h>
+
+// [[Rcpp::depends(RcppArmadillo)]]
+
+// [[Rcpp::export]]
+Rcpp::List solveMixed(const arma::mat& A, const arma::mat& B, bool likely_sympd) {
+    arma::mat X;
+    arma::solve_info info;
+    const bool status = likely_sympd
+        ? arma::solve(X, A, B, arma::solve_opts::mixed_precision + arma::solve_opts::likely_sympd, info)
+        : arma::solve(X, A, B, arma::solve_opts::mixed_precision, info);
+    return Rcpp::List::create(Rcpp::Named("status")          = status,
+                              Rcpp::Named("x")               = X,
+                              Rcpp::Named("mixed_precision") = info.mixed_precision,
+                              Rcpp::Named("n_iter")          = info.n_iter);
+}
+
+// [[Rcpp::export]]
+Rcpp::List solveMixedComplex(const arma::cx_mat& A, const arma::cx_mat& B) {
+    arma::cx_mat X;
+    arma::solve_info info;
+    const bool status = arma::solve(X, A, B, arma::solve_opts::mixed_precision, info);
+    return Rcpp::List::create(Rcpp::Named("status")          = status,
+                              Rcpp::Named("x")               = X,
+                              Rcpp::Named("mixed_precision") = info.mixed_precision);
+}
+
+// [[Rcpp::export]]
+arma::mat solveMixedAlias(const arma::mat& A, arma::mat B) {
+    // the output is also the right hand side
+    arma::solve(B, A, B, arma::solve_opts::mixed_precision);
+    return B;
+}
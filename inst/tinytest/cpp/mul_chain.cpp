@@ -0,0 +1,58 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// mul_chain.cpp: RcppArmadillo unit test code for the ordering of multiplication chains
+//
+// Copyright (C) 2026  The RcppArmadillo Authors
+//
+// This file is part of RcppArmadillo.
+//
+// RcppArmadillo is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// RcppArmadillo is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with RcppArmadillo.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <RcppArmadillo.h>
+
+// [[Rcpp::depends(RcppArmadillo)]]
+
+// [[Rcpp::export]]
+Rcpp::List mulChain(const arma::mat& A, const arma::mat& B, const arma::mat& C, const arma::mat& D,
+                    const arma::vec& v, const arma::rowvec& r) {
+    return Rcpp::List::create(Rcpp::Named("four")   = arma::mat(A * B * C * D),
+                              Rcpp::Named("five")   = arma::mat(A * B * C * D * v),
+                              Rcpp::Named("row")    = arma::mat(r * A * B * C * D),
+                              Rcpp::Named("scalar") = arma::mat(2.0 * A * B * C * D * 3.0),
+                              Rcpp::Named("trans")  = arma::mat(D.t() * C.t() * B.t() * A.t()),
+                              Rcpp::Named("seven")  = arma::mat(A * B * C * D * D.t() * C.t() * B.t()));
+}
+
+// [[Rcpp::export]]
+Rcpp::List mulChainSpecial(const arma::mat& A, const arma::mat& B, const arma::mat& C, const arma::mat& D,
+                           const arma::vec& d, const arma::mat& S, const arma::mat& G) {
+    // d is the diagonal for the operand after A; S is symmetric positive definite, G is a general matrix
+    return Rcpp::List::create(Rcpp::Named("diag")      = arma::mat(A * arma::diagmat(d) * B * C * D),
+                              Rcpp::Named("diagfirst") = arma::mat(arma::diagmat(d) * B * C * D),
+                              Rcpp::Named("inv_sympd") = arma::mat(A * arma::inv_sympd(S) * B * C * D),
+                              Rcpp::Named("inv")       = arma::mat(A * arma::inv(G) * B * C * D),
+                              Rcpp::Named("mixed")     = arma::mat(A * arma::diagmat(d) * arma::inv(G) * B * C));
+}
+
+// [[Rcpp::export]]
+arma::mat mulChainAlias(arma::mat A, const arma::mat& B, const arma::mat& C, const arma::mat& D) {
+    // the output is also the first operand
+    A = A * B * C * D;
+    return A;
+}
+
+// [[Rcpp::export]]
+arma::cx_mat mulChainComplex(const arma::cx_mat& A, const arma::cx_mat& B, const arma::cx_mat& C, const arma::cx_mat& D) {
+    return A * B.t() * C * D;
+}
@@ -0,0 +1,36 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// ordering.cpp: RcppArmadillo unit test code for sparse matrix orderings
+//
+// Copyright (C) 2026  The RcppArmadillo Authors
+//
+// This file is part of RcppArmadillo.
+//
+// RcppArmadillo is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// RcppArmadillo is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with RcppArmadillo.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <RcppArmadillo.h>
+
+// [[Rcpp::depends(RcppArmadillo)]]
+
+// [[Rcpp::export]]
+arma::uvec spOrder(const arma::sp_mat& A, std::string method) {
+    if (method == "colamd") return arma::colamd(A);
+    if (method == "symrcm") return arma::symrcm(A);
+    return arma::amd(A);
+}
+
+// [[Rcpp::export]]
+arma::sp_mat spSymperm(const arma::sp_mat& A, const arma::uvec& p) {
+    return arma::symperm(A, p);
+}
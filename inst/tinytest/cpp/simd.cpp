@@ -0,0 +1,80 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// simd.cpp: RcppArmadillo unit test code for SIMD kernels of element-wise operations
+//
+// Copyright (C) 2026  The RcppArmadillo Authors
+//
+// This file is part of RcppArmadillo.
+//
+// RcppArmadillo is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// RcppArmadillo is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with RcppArmadillo.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <RcppArmadillo.h>
+
+// [[Rcpp::depends(RcppArmadillo)]]
+
+// [[Rcpp::export]]
+Rcpp::List simdExpr(const arma::vec& x, const arma::vec& y, double a) {
+    return Rcpp::List::create(Rcpp::Named("plus")   = arma::vec(x + y),
+                              Rcpp::Named("minus")  = arma::vec(x - y),
+                              Rcpp::Named("schur")  = arma::vec(x % y),
+                              Rcpp::Named("div")    = arma::vec(x / y),
+                              Rcpp::Named("scalar") = arma::vec(a * x + y / a - (a - x) + (a / y)),
+                              Rcpp::Named("neg")    = arma::vec(-x),
+                              Rcpp::Named("square") = arma::vec(arma::square(x)),
+                              Rcpp::Named("sqrt")   = arma::vec(arma::sqrt(arma::abs(x))),
+                              Rcpp::Named("abs")    = arma::vec(arma::abs(x - y)));
+}
+
+// [[Rcpp::export]]
+arma::vec simdCompound(const arma::vec& x, const arma::vec& y) {
+    arma::vec out = x;
+    out += 2 * y;
+    out -= y;
+    out %= x;
+    out /= (y + 3);
+    return out;
+}
+
+// [[Rcpp::export]]
+arma::vec simdFloat(const arma::vec& x, const arma::vec& y) {
+    arma::fvec xf = arma::conv_to<arma::fvec>::from(x);
+    arma::fvec yf = arma::conv_to<arma::fvec>::from(y);
+    arma::fvec out = 2 * xf % yf - xf / (yf + 3) + arma::square(xf);
+    return arma::conv_to<arma::vec>::from(out);
+}
+
+// [[Rcpp::export]]
+arma::vec simdAlias(arma::vec x) {
+    // the output is also a leaf of the expression
+    x = 2 * x + x % x;
+    return x;
+}
+
+// [[Rcpp::export]]
+arma::mat simdSubview(const arma::mat& X) {
+    // non-contiguous leaves are handled by the generic loops
+    return X.rows(1, X.n_rows - 1) % X.rows(0, X.n_rows - 2) + 1;
+}
+
+// [[Rcpp::export]]
+arma::cube simdCube(const arma::cube& A, const arma::cube& B) {
+    arma::cube C = A % B - 2 * A;
+    C += B;
+    return C;
+}
+
+// [[Rcpp::export]]
+arma::vec simdClamp(const arma::vec& x, double lo, double hi) {
+    return arma::clamp(x, lo, hi);
+}
@@ -0,0 +1,70 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// simd_math.cpp: RcppArmadillo unit test code for SIMD kernels of elementary functions
+//
+// Copyright (C) 2026  The RcppArmadillo Authors
+//
+// This file is part of RcppArmadillo.
+//
+// RcppArmadillo is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// RcppArmadillo is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with RcppArmadillo.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <RcppArmadillo.h>
+
+// [[Rcpp::depends(RcppArmadillo)]]
+
+// [[Rcpp::export]]
+Rcpp::List simdMath(const arma::vec& x, const arma::vec& y) {
+    return Rcpp::List::create(Rcpp::Named("exp")   = arma::vec(arma::exp(x)),
+                              Rcpp::Named("log")   = arma::vec(arma::log(y)),
+                              Rcpp::Named("log1p") = arma::vec(arma::log1p(y)),
+                              Rcpp::Named("pow")   = arma::vec(arma::pow(y, 1.7)),
+                              Rcpp::Named("sin")   = arma::vec(arma::sin(x)),
+                              Rcpp::Named("cos")   = arma::vec(arma::cos(x)),
+                              Rcpp::Named("tanh")  = arma::vec(arma::tanh(x)),
+                              Rcpp::Named("erf")   = arma::vec(arma::erf(x)),
+                              Rcpp::Named("erfc")  = arma::vec(arma::erfc(x)),
+                              Rcpp::Named("expr")  = arma::vec(arma::exp(x) % y + arma::log(y)));
+}
+
+// [[Rcpp::export]]
+Rcpp::List simdNorm(const arma::vec& x, const arma::vec& m, const arma::vec& s) {
+    return Rcpp::List::create(Rcpp::Named("normpdf")     = arma::vec(arma::normpdf(x, m, s)),
+                              Rcpp::Named("normcdf")     = arma::vec(arma::normcdf(x, m, s)),
+                              Rcpp::Named("log_normpdf") = arma::vec(arma::log_normpdf(x, m, s)));
+}
+
+// [[Rcpp::export]]
+Rcpp::List simdChunks(const arma::vec& x, const arma::vec& y, arma::uword len) {
+    // long vectors can be split into chunks processed by OpenMP threads;
+    // the results must not depend on the chunk boundaries, so they are compared
+    // with the results for short pieces, which are processed by a single thread
+    const arma::uword n = x.n_elem;
+    arma::vec full  = arma::exp(x) % y + arma::erfc(x);
+    arma::vec fpdf  = arma::normpdf(x, y, y + 1);
+    arma::vec fcdf  = arma::normcdf(x, y, y + 1);
+    arma::vec piece(n), ppdf(n), pcdf(n);
+    for (arma::uword i = 0; i < n; i += len) {
+        const arma::uword j = std::min(i + len, n) - 1;
+        const arma::vec xi = x.subvec(i, j), yi = y.subvec(i, j);
+        piece.subvec(i, j) = arma::vec(arma::exp(xi) % yi + arma::erfc(xi));
+        ppdf.subvec(i, j)  = arma::normpdf(xi, yi, yi + 1);
+        pcdf.subvec(i, j)  = arma::normcdf(xi, yi, yi + 1);
+    }
+    return Rcpp::List::create(Rcpp::Named("full")  = full,
+                              Rcpp::Named("piece") = piece,
+                              Rcpp::Named("fpdf")  = fpdf,
+                              Rcpp::Named("ppdf")  = ppdf,
+                              Rcpp::Named("fcdf")  = fcdf,
+                              Rcpp::Named("pcdf")  = pcdf);
+}
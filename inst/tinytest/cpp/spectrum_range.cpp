@@ -0,0 +1,86 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// spectrum_range.cpp: RcppArmadillo unit test code for subsets of eigenvalues and singular values
+//
+// Copyright (C) 2026  The RcppArmadillo Authors
+//
+// This file is part of RcppArmadillo.
+//
+// RcppArmadillo is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// RcppArmadillo is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with RcppArmadillo.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <RcppArmadillo.h>
+
+// [[Rcpp::depends(RcppArmadillo)]]
+
+// [[Rcpp::export]]
+Rcpp::List eigSymIndex(const arma::mat& X, int first, int last) {
+    arma::vec eigval;
+    arma::mat eigvec;
+    arma::eig_sym(eigval, eigvec, X, arma::eig_range::by_index(first, last));
+    return Rcpp::List::create(Rcpp::Named("values")  = eigval,
+                              Rcpp::Named("vectors") = eigvec);
+}
+
+// [[Rcpp::export]]
+Rcpp::List eigSymValue(const arma::mat& X, double lo, double hi) {
+    arma::vec eigval;
+    arma::mat eigvec;
+    arma::eig_sym(eigval, eigvec, X, arma::eig_range::by_value(lo, hi));
+    return Rcpp::List::create(Rcpp::Named("values")  = eigval,
+                              Rcpp::Named("vectors") = eigvec);
+}
+
+// [[Rcpp::export]]
+arma::vec eigSymValuesOnly(const arma::mat& X, int first, int last) {
+    return arma::eig_sym(X, arma::eig_range::by_index(first, last));
+}
+
+// [[Rcpp::export]]
+Rcpp::List eigSymIndexComplex(const arma::cx_mat& X, int first, int last) {
+    arma::vec eigval;
+    arma::cx_mat eigvec;
+    arma::eig_sym(eigval, eigvec, X, arma::eig_range::by_index(first, last));
+    return Rcpp::List::create(Rcpp::Named("values")  = eigval,
+                              Rcpp::Named("vectors") = eigvec);
+}
+
+// [[Rcpp::export]]
+Rcpp::List svdIndex(const arma::mat& X, int first, int last, std::string method) {
+    arma::mat U, V;
+    arma::vec s;
+    arma::svd_econ(U, s, V, X, arma::svd_range::by_index(first, last), method.c_str());
+    arma::vec s_only;
+    arma::svd(s_only, X, arma::svd_range::by_index(first, last), method.c_str());
+    return Rcpp::List::create(Rcpp::Named("U")      = U,
+                              Rcpp::Named("s")      = s,
+                              Rcpp::Named("V")      = V,
+                              Rcpp::Named("s_only") = s_only);
+}
+
+// [[Rcpp::export]]
+Rcpp::List svdValue(const arma::mat& X, double lo, double hi, std::string method) {
+    arma::mat U, V;
+    arma::vec s;
+    arma::svd_econ(U, s, V, X, arma::svd_range::by_value(lo, hi), method.c_str());
+    return Rcpp::List::create(Rcpp::Named("U") = U,
+                              Rcpp::Named("s") = s,
+                              Rcpp::Named("V") = V);
+}
+
+// [[Rcpp::export]]
+arma::vec svdIndexComplex(const arma::cx_mat& X, int first, int last) {
+    arma::vec s;
+    arma::svd(s, X, arma::svd_range::by_index(first, last));
+    return s;
+}
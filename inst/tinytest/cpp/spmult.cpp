@@ -0,0 +1,82 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// spmult.cpp: RcppArmadillo unit test code for sparse matrix multiplication
+//
+// Copyright (C) 2026  The RcppArmadillo Authors
+//
+// This file is part of RcppArmadillo.
+//
+// RcppArmadillo is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// RcppArmadillo is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with RcppArmadillo.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <RcppArmadillo.h>
+
+// [[Rcpp::depends(RcppArmadillo)]]
+
+// [[Rcpp::export]]
+arma::sp_mat spTimesSp(const arma::sp_mat& A, const arma::sp_mat& B, int mode) {
+    switch (mode) {
+    case 1:  return A.t() * B;
+    case 2:  return A * B.t();
+    case 3:  return A.t() * B.t();
+    default: return A * B;
+    }
+}
+
+// [[Rcpp::export]]
+Rcpp::List spTimesSpNnz(const arma::sp_mat& A, const arma::sp_mat& B) {
+    // elements which cancel to zero must not be stored
+    arma::sp_mat C = A * B;
+    return Rcpp::List::create(Rcpp::Named("C")   = C,
+                              Rcpp::Named("nnz") = C.n_nonzero);
+}
+
+// [[Rcpp::export]]
+arma::cx_mat spTimesSpComplex(const arma::sp_mat& Re, const arma::sp_mat& Im) {
+    arma::sp_cx_mat A(Re, Im);
+    return arma::cx_mat(A * A);
+}
+
+// [[Rcpp::export]]
+arma::sp_mat spTimesSpAlias(arma::sp_mat A) {
+    // the output is also an operand
+    A = A * A;
+    return A;
+}
+
+// [[Rcpp::export]]
+arma::mat spTimesDense(const arma::sp_mat& A, const arma::mat& B, int mode) {
+    if (mode == 1) return A.t() * B;
+    return A * B;
+}
+
+// [[Rcpp::export]]
+arma::mat denseTimesSp(const arma::mat& B, const arma::sp_mat& A) {
+    return B * A;
+}
+
+// [[Rcpp::export]]
+arma::vec spTimesVec(const arma::sp_mat& A, const arma::vec& x) {
+    return A * x;
+}
+
+// [[Rcpp::export]]
+arma::rowvec rowvecTimesSp(const arma::rowvec& x, const arma::sp_mat& A) {
+    return x * A;
+}
+
+// [[Rcpp::export]]
+arma::cx_mat denseTimesSpComplex(const arma::cx_mat& B, const arma::sp_mat& Re, const arma::sp_mat& Im) {
+    arma::sp_cx_mat A(Re, Im);
+    return B * A;
+}
@@ -0,0 +1,130 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// spsolve.cpp: RcppArmadillo unit test code for the built-in sparse solvers
+//
+// Copyright (C) 2026  The RcppArmadillo Authors
+//
+// This file is part of RcppArmadillo.
+//
+// RcppArmadillo is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// RcppArmadillo is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with RcppArmadillo.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <RcppArmadillo.h>
+
+// [[Rcpp::depends(RcppArmadillo)]]
+
+// [[Rcpp::export]]
+arma::mat spsolveLU(const arma::sp_mat& A, const arma::mat& B) {
+    return arma::spsolve(A, B);
+}
+
+// [[Rcpp::export]]
+arma::mat spsolveLUOpts(const arma::sp_mat& A, const arma::mat& B,
+                        bool equilibrate, bool natural, double pivot_thresh) {
+    arma::superlu_opts opts;
+    opts.equilibrate  = equilibrate;
+    opts.pivot_thresh = pivot_thresh;
+    opts.refine       = arma::superlu_opts::REF_DOUBLE;
+    if (natural) opts.permutation = arma::superlu_opts::NATURAL;
+    return arma::spsolve(A, B, "superlu", opts);
+}
+
+// [[Rcpp::export]]
+arma::cx_mat spsolveLUComplex(const arma::sp_mat& Are, const arma::sp_mat& Aim,
+                              const arma::cx_mat& B) {
+    arma::sp_cx_mat A(Are, Aim);
+    return arma::spsolve(A, B);
+}
+
+// [[Rcpp::export]]
+arma::mat spsolveLUAlias(const arma::sp_mat& A, arma::mat B) {
+    B = arma::spsolve(A, B);                 // output aliases the right hand side
+    return B;
+}
+
+// [[Rcpp::export]]
+Rcpp::List spsolveLUStatus(const arma::sp_mat& A, const arma::mat& B) {
+    arma::mat X(1, 1, arma::fill::ones);
+    bool status = arma::spsolve(X, A, B);
+    return Rcpp::List::create(Rcpp::Named("status") = status,
+                              Rcpp::Named("n_rows") = X.n_rows,
+                              Rcpp::Named("n_cols") = X.n_cols);
+}
+
+// [[Rcpp::export]]
+Rcpp::List spsolveFactoriserLU(const arma::sp_mat& A, const arma::mat& B) {
+    arma::spsolve_factoriser F;
+    bool status = F.factorise(A);
+    arma::mat X;
+    F.solve(X, B);
+    double val = 0.0, sign = 0.0;
+    F.log_det(val, sign);
+    return Rcpp::List::create(Rcpp::Named("status") = status,
+                              Rcpp::Named("X")      = X,
+                              Rcpp::Named("rcond")  = F.rcond(),
+                              Rcpp::Named("logdet") = val,
+                              Rcpp::Named("sign")   = sign);
+}
+
+// [[Rcpp::export]]
+Rcpp::IntegerVector spsolveLUEmpty(int k) {
+    arma::sp_mat A;
+    arma::mat B(0, k);
+    arma::mat X = arma::spsolve(A, B);
+    return Rcpp::IntegerVector::create(X.n_rows, X.n_cols);
+}
+
+// [[Rcpp::export]]
+arma::mat spsolveChol(const arma::sp_mat& A, const arma::mat& B, bool likely_sympd) {
+    arma::superlu_opts opts;
+    opts.try_chol     = true;
+    opts.likely_sympd = likely_sympd;
+    return arma::spsolve(A, B, "superlu", opts);
+}
+
+// [[Rcpp::export]]
+arma::cx_mat spsolveCholComplex(const arma::sp_mat& Are, const arma::sp_mat& Aim,
+                                const arma::cx_mat& B) {
+    arma::sp_cx_mat A(Are, Aim);
+    arma::superlu_opts opts;
+    opts.try_chol = true;
+    return arma::spsolve(A, B, "superlu", opts);
+}
+
+// [[Rcpp::export]]
+arma::mat spsolveCholAlias(const arma::sp_mat& A, arma::mat B) {
+    arma::superlu_opts opts;
+    opts.try_chol = true;
+    B = arma::spsolve(A, B, "superlu", opts);  // output aliases the right hand side
+    return B;
+}
+
+// [[Rcpp::export]]
+Rcpp::List spsolveFactoriserChol(const arma::sp_mat& A, const arma::sp_mat& A2,
+                                 const arma::mat& B) {
+    arma::superlu_opts opts;
+    opts.try_chol = true;
+    arma::spsolve_factoriser F;
+    bool status = F.factorise(A, opts);
+    double val = 0.0, sign = 0.0;
+    F.log_det(val, sign);
+    // same pattern, new values: the symbolic analysis is reused
+    bool status2 = F.refactorise(A2, opts);
+    arma::mat X2;
+    F.solve(X2, B);
+    return Rcpp::List::create(Rcpp::Named("status")  = status,
+                              Rcpp::Named("logdet")  = val,
+                              Rcpp::Named("sign")    = sign,
+                              Rcpp::Named("status2") = status2,
+                              Rcpp::Named("X2")      = X2);
+}
@@ -0,0 +1,96 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// svd_rand.cpp: RcppArmadillo unit test code for randomised SVD
+//
+// Copyright (C) 2026  The RcppArmadillo Authors
+//
+// This file is part of RcppArmadillo.
+//
+// RcppArmadillo is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// RcppArmadillo is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with RcppArmadillo.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <RcppArmadillo.h>
+
+// [[Rcpp::depends(RcppArmadillo)]]
+
+// [[Rcpp::export]]
+Rcpp::List svdRand(const arma::mat& X, int k) {
+    arma::mat U, V;
+    arma::vec S;
+    bool status = arma::svd_rand(U, S, V, X, k);
+    return Rcpp::List::create(Rcpp::Named("status") = status,
+                              Rcpp::Named("U")      = U,
+                              Rcpp::Named("S")      = S,
+                              Rcpp::Named("V")      = V);
+}
+
+// [[Rcpp::export]]
+arma::vec svdRandValues(const arma::mat& X, int k) {
+    arma::vec S;
+    arma::svd_rand(S, X, k);
+    return S;
+}
+
+// [[Rcpp::export]]
+Rcpp::List svdRandSparse(const arma::sp_mat& X, int k) {
+    arma::mat U, V;
+    arma::vec S;
+    bool status = arma::svd_rand(U, S, V, X, k);
+    return Rcpp::List::create(Rcpp::Named("status") = status,
+                              Rcpp::Named("U")      = U,
+                              Rcpp::Named("S")      = S,
+                              Rcpp::Named("V")      = V);
+}
+
+// [[Rcpp::export]]
+arma::vec svdRandSparseValues(const arma::sp_mat& X, int k) {
+    arma::vec S;
+    arma::svd_rand(S, X, k);
+    return S;
+}
+
+// [[Rcpp::export]]
+arma::cx_mat svdRandComplex(const arma::cx_mat& X, int k) {
+    // rank-k reconstruction
+    arma::cx_mat U, V;
+    arma::vec S;
+    arma::svd_rand(U, S, V, X, k);
+    return U * arma::diagmat(arma::conv_to<arma::cx_vec>::from(S)) * V.t();
+}
+
+// [[Rcpp::export]]
+arma::vec svdRandAlias(const arma::mat& X, int k) {
+    // the input matrix is overwritten by U
+    arma::mat U = X;
+    arma::mat V;
+    arma::vec S;
+    arma::svd_rand(U, S, V, U, k);
+    return S;
+}
+
+// [[Rcpp::export]]
+Rcpp::IntegerVector svdRandEmpty(int n) {
+    arma::mat X(n, 0);
+    arma::mat U, V;
+    arma::vec S;
+    arma::svd_rand(U, S, V, X, 3);
+    return Rcpp::IntegerVector::create(S.n_elem, U.n_rows, U.n_cols, V.n_rows, V.n_cols);
+}
+
+// [[Rcpp::export]]
+bool svdRandNonfinite(arma::mat X) {
+    X(0, 0) = arma::datum::nan;
+    arma::mat U, V;
+    arma::vec S;
+    return arma::svd_rand(U, S, V, X, 2);
+}
@@ -0,0 +1,80 @@
+// -*- mode: C++; c-indent-level: 4; c-basic-offset: 4; indent-tabs-mode: nil; -*-
+//
+// trimat_mult.cpp: RcppArmadillo unit test code for products with trimatu(), trimatl(), symmatu() and symmatl() operands
+//
+// Copyright (C) 2026  The RcppArmadillo Authors
+//
+// This file is part of RcppArmadillo.
+//
+// RcppArmadillo is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 2 of the License, or
+// (at your option) any later version.
+//
+// RcppArmadillo is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with RcppArmadillo.  If not, see <http://www.gnu.org/licenses/>.
+
+#include <RcppArmadillo.h>
+
+// [[Rcpp::depends(RcppArmadillo)]]
+
+// A is square, B has as many rows as A, and C has as many columns as A
+
+// [[Rcpp::export]]
+Rcpp::List trimatTimes(const arma::mat& A, const arma::mat& B, const arma::mat& C) {
+    return Rcpp::List::create(Rcpp::Named("upper")        = arma::mat(arma::trimatu(A) * B),
+                              Rcpp::Named("lower")        = arma::mat(arma::trimatl(A) * B),
+                              Rcpp::Named("upper_right")  = arma::mat(C * arma::trimatu(A)),
+                              Rcpp::Named("lower_right")  = arma::mat(C * arma::trimatl(A)),
+                              Rcpp::Named("upper_transA") = arma::mat(arma::trimatu(A.t()) * B),
+                              Rcpp::Named("lower_transA") = arma::mat(C * arma::trimatl(A.t())),
+                              Rcpp::Named("transB")       = arma::mat(arma::trimatu(A) * C.t()),
+                              Rcpp::Named("transB_right") = arma::mat(B.t() * arma::trimatl(A)),
+                              Rcpp::Named("scaled")       = arma::mat(arma::trimatu(2.5 * A) * (B * 0.5)),
+                              Rcpp::Named("vec")          = arma::vec(arma::trimatl(A) * B.col(0)));
+}
+
+// [[Rcpp::export]]
+Rcpp::List symmatTimes(const arma::mat& A, const arma::mat& B, const arma::mat& C) {
+    return Rcpp::List::create(Rcpp::Named("upper")        = arma::mat(arma::symmatu(A) * B),
+                              Rcpp::Named("lower")        = arma::mat(arma::symmatl(A) * B),
+                              Rcpp::Named("upper_right")  = arma::mat(C * arma::symmatu(A)),
+                              Rcpp::Named("lower_right")  = arma::mat(C * arma::symmatl(A)),
+                              Rcpp::Named("upper_transA") = arma::mat(arma::symmatu(A.t()) * B),
+                              Rcpp::Named("lower_transA") = arma::mat(C * arma::symmatl(A.t())),
+                              Rcpp::Named("transB")       = arma::mat(arma::symmatu(A) * C.t()),
+                              Rcpp::Named("transB_right") = arma::mat(B.t() * arma::symmatl(A)),
+                              Rcpp::Named("scaled")       = arma::mat(arma::symmatu(2.5 * A) * (B * 0.5)),
+                              Rcpp::Named("vec")          = arma::vec(arma::symmatl(A) * B.col(0)));
+}
+
+// [[Rcpp::export]]
+Rcpp::List trimatTimesAlias(const arma::mat& A, const arma::mat& B) {
+    // the output is also one of the operands
+    arma::mat X = A, Y = A, Z = B, S = A, T = B;
+    X = arma::trimatu(X) * X;
+    Y = Y * arma::trimatl(Y);
+    Z = arma::trimatu(A) * Z;
+    S = arma::symmatl(S) * S;
+    T = arma::symmatu(A) * T;
+    return Rcpp::List::create(Rcpp::Named("tri_both")  = X,
+                              Rcpp::Named("tri_right") = Y,
+                              Rcpp::Named("tri_other") = Z,
+                              Rcpp::Named("sym_both")  = S,
+                              Rcpp::Named("sym_other") = T);
+}
+
+// [[Rcpp::export]]
+Rcpp::List cxTrimatTimes(const arma::cx_mat& A, const arma::cx_mat& B) {
+    return Rcpp::List::create(Rcpp::Named("triu")        = arma::cx_mat(arma::trimatu(A) * B),
+                              Rcpp::Named("tril_htrans") = arma::cx_mat(arma::trimatl(A.t()) * B),
+                              Rcpp::Named("herm_upper")  = arma::cx_mat(arma::symmatu(A) * B),
+                              Rcpp::Named("herm_lower")  = arma::cx_mat(B.t() * arma::symmatl(A)),
+                              Rcpp::Named("sym_upper")   = arma::cx_mat(arma::symmatu(A, false) * B),
+                              Rcpp::Named("sym_transA")  = arma::cx_mat(arma::symmatu(A.t(), false) * B));
+}